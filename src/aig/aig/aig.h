@@ -145,6 +145,8 @@ struct Aig_Man_t_
     void (*pImpFunc) (void*, void*); // implication checking precedure
     void *           pImpData;       // implication checking data
     void *           pManTime;       // the timing manager
+    void *           pCnfCache;      // the cache of CNF clauses (see cnfCache.c)
+    void (*pCnfCacheFree) (void*);   // the procedure to free the CNF cache
     void *           pManCuts;
     int *            pFastSim; 
     unsigned *       pTerSimData;    // ternary simulation data
@@ -194,6 +194,8 @@ void Aig_ManStop( Aig_Man_t * p )
     Aig_ManForEachObj( p, pObj, i )
         assert( !pObj->fMarkA && !pObj->fMarkB );
     Tim_ManStopP( (Tim_Man_t **)&p->pManTime );
+    if ( p->pCnfCacheFree )
+        p->pCnfCacheFree( p->pCnfCache );
     if ( p->pFanData ) 
         Aig_ManFanoutStop( p );
     if ( p->pManExdc )  
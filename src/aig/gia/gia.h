@@ -53,6 +53,7 @@ typedef struct Gia_MmFixed_t_        Gia_MmFixed_t;
 typedef struct Gia_MmFlex_t_         Gia_MmFlex_t;     
 typedef struct Gia_MmStep_t_         Gia_MmStep_t;     
 typedef struct Gia_Dat_t_            Gia_Dat_t;
+typedef struct Gia_Zip_t_            Gia_Zip_t;
 
 typedef struct Gia_Rpr_t_ Gia_Rpr_t;
 struct Gia_Rpr_t_
@@ -111,6 +112,7 @@ struct Gia_Man_t_
     Vec_Int_t *    vCos;          // the vector of COs (POs + LIs)
     Vec_Int_t      vHash;         // hash links
     Vec_Int_t      vHTable;       // hash table
+    Vec_Wrd_t *    vHashConc;     // concurrent hash table (key and object ID in each slot)
     int            fAddStrash;    // performs additional structural hashing
     int            fSweeper;      // sweeper is running
     int            fGiaSimple;    // simple mode (no const-propagation and strashing)
@@ -1268,6 +1270,7 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
 extern int                 Gia_FileSize( char * pFileName );
 extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadExt( char * pFileName, int fGiaSimple, int fSkipStrash, int fSkipNames, int fCheck );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine );
 extern void                Gia_AigerWriteS( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
@@ -1493,6 +1496,10 @@ extern int                 Gia_ManHashXor( Gia_Man_t * p, int iLit0, int iLit1 )
 extern int                 Gia_ManHashMux( Gia_Man_t * p, int iCtrl, int iData1, int iData0 );
 extern int                 Gia_ManHashMaj( Gia_Man_t * p, int iData0, int iData1, int iData2 );
 extern int                 Gia_ManHashAndTry( Gia_Man_t * p, int iLit0, int iLit1 );
+extern int                 Gia_ManHashConcStart( Gia_Man_t * p, int nObjsMax );
+extern void                Gia_ManHashConcStop( Gia_Man_t * p );
+extern int                 Gia_ManHashConcAnd( Gia_Man_t * p, int iLit0, int iLit1 );
+extern int                 Gia_ManHashConcLookup( Gia_Man_t * p, int iLit0, int iLit1 );
 extern Gia_Man_t *         Gia_ManRehash( Gia_Man_t * p, int fAddStrash );
 extern void                Gia_ManHashProfile( Gia_Man_t * p );
 extern int                 Gia_ManHashLookupInt( Gia_Man_t * p, int iLit0, int iLit1 );
@@ -1584,6 +1591,8 @@ extern void                Gia_ManCountMuxXor( Gia_Man_t * p, int * pnMuxes, int
 extern void                Gia_ManPrintMuxStats( Gia_Man_t * p );
 extern Gia_Man_t *         Gia_ManDupMuxes( Gia_Man_t * p, int Limit );
 extern Gia_Man_t *         Gia_ManDupNoMuxes( Gia_Man_t * p, int fSkipBufs );
+/*=== giaOrch.c ===========================================================*/
+extern Gia_Man_t *         Gia_ManOrchestrate( Gia_Man_t * p, int nIters, int nCutRef, int nCutRes, int nDivsMax, int fKeepLevel, int fUseZeros, int fVerbose );
 /*=== giaPat.c ===========================================================*/
 extern void                Gia_SatVerifyPattern( Gia_Man_t * p, Gia_Obj_t * pRoot, Vec_Int_t * vCex, Vec_Int_t * vVisit );
 /*=== giaRetime.c ===========================================================*/
@@ -1631,6 +1640,7 @@ extern int                 Gia_ManIncrSimCheckEqual( Gia_Man_t * p, int iLit0, i
 /*=== giaSimBase.c ============================================================*/
 extern Vec_Wrd_t *         Gia_ManSimPatSim( Gia_Man_t * p );
 extern Vec_Wrd_t *         Gia_ManSimPatSimOut( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOuts );
+extern void                Gia_ManSimPatSimObjs( Gia_Man_t * pGia, int * pObjs, int nObjs, int nWords, Vec_Wrd_t * vSims );
 extern void                Gia_ManSim2ArrayOne( Vec_Wrd_t * vSimsPi, Vec_Int_t * vRes );
 extern Vec_Wec_t *         Gia_ManSim2Array( Vec_Ptr_t * vSims );
 extern Vec_Wrd_t *         Gia_ManArray2SimOne( Vec_Int_t * vRes );
@@ -1638,6 +1648,17 @@ extern Vec_Ptr_t *         Gia_ManArray2Sim( Vec_Wec_t * vRes );
 extern void                Gia_ManPtrWrdDumpBin( char * pFileName, Vec_Ptr_t * p, int fVerbose );
 extern Vec_Ptr_t *         Gia_ManPtrWrdReadBin( char * pFileName, int fVerbose );
 extern Vec_Str_t *         Gia_ManComputeRange( Gia_Man_t * p );
+extern int                 Gia_ManSimPatSetIsa( int Isa );
+extern int                 Gia_ManSimPatGetIsa();
+extern char *              Gia_ManSimPatIsaName( int Isa );
+extern int                 Gia_ManSimPatBench( Gia_Man_t * p, int nWords, int nRounds, int fVerbose );
+/*=== giaSimPar.c ============================================================*/
+extern Vec_Wrd_t *         Gia_ManSimPatSimPar( Gia_Man_t * p, Vec_Wrd_t * vSimsPi, int nThreads, int fLevels, int fVerbose );
+extern int                 Gia_ManSimulateWordsInitPar( Gia_Man_t * p, Vec_Wrd_t * vSimsIn, int nThreads );
+extern int                 Gia_ManSimPatBenchPar( Gia_Man_t * p, int nWords, int nRounds, int nThreads, int fLevels, int fVerbose );
+/*=== giaSnap.c ============================================================*/
+extern int                 Gia_ManSnapWrite( Gia_Man_t * p, char * pFileName );
+extern Gia_Man_t *         Gia_ManSnapRead( char * pFileName );
 /*=== giaSpeedup.c ============================================================*/
 extern float               Gia_ManDelayTraceLut( Gia_Man_t * p );
 extern float               Gia_ManDelayTraceLutPrint( Gia_Man_t * p, int fVerbose );
@@ -1793,6 +1814,12 @@ extern int                 Gia_ManCountPosWithNonZeroDrivers( Gia_Man_t * p );
 extern void                Gia_ManUpdateCopy( Vec_Int_t * vCopy, Gia_Man_t * p );
 extern Vec_Int_t *         Gia_ManComputeDistance( Gia_Man_t * p, int iObj, Vec_Int_t * vObjs, int fVerbose );
 
+/*=== giaZip.c ===========================================================*/
+extern Gia_Zip_t *         Gia_ManZip( Gia_Man_t * p );
+extern Gia_Man_t *         Gia_ManUnzip( Gia_Zip_t * pZip );
+extern void                Gia_ZipFree( Gia_Zip_t * pZip );
+extern int                 Gia_ZipSize( Gia_Zip_t * pZip, int * pnSizeOrig );
+
 /*=== giaTtopt.cpp ===========================================================*/
 extern Gia_Man_t *         Gia_ManTtopt( Gia_Man_t * p, int nIns, int nOuts, int nRounds );
 extern Gia_Man_t *         Gia_ManTtoptCare( Gia_Man_t * p, int nIns, int nOuts, int nRounds, char * pFileName, int nRarity );
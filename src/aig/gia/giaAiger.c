@@ -22,6 +22,15 @@
 #include "gia.h"
 #include "misc/tim/tim.h"
 #include "base/main/main.h"
+#include "misc/zlib/zlib.h"
+#include "misc/bzlib/bzlib.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -31,6 +40,24 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// decodes an AND-gate delta; most deltas fit into one or two bytes
+static inline unsigned Gia_AigerReadUnsignedFast( unsigned char ** ppPos )
+{
+    unsigned char * pPos = *ppPos;
+    unsigned x = pPos[0];
+    if ( !(x & 0x80) )
+    {
+        *ppPos = pPos + 1;
+        return x;
+    }
+    if ( !(pPos[1] & 0x80) )
+    {
+        *ppPos = pPos + 2;
+        return (x & 0x7f) | ((unsigned)pPos[1] << 7);
+    }
+    return Gia_AigerReadUnsigned( ppPos );
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -166,19 +193,21 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
 
-  Description []
+  Description [If fSkipNames is set, the symbol table is stepped over
+  without being parsed. The buffer is modified while reading names.]
   
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+static Gia_Man_t * Gia_AigerReadFromMemoryInt( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fSkipNames, int fCheck )
 {
     Gia_Man_t * pNew, * pTemp;
     Vec_Ptr_t * vNamesIn = NULL, * vNamesOut = NULL, * vNamesRegIn = NULL, * vNamesRegOut = NULL, * vNamesNode = NULL;
     Vec_Int_t * vLits = NULL, * vPoTypes = NULL;
     Vec_Int_t * vNodes, * vDrivers, * vInits = NULL;
+    int * pNodes;
     int iObj, iNode0, iNode1, fHieOnly = 0;
     int nTotal, nInputs, nOutputs, nLatches, nAnds, i;
     int nBad = 0, nConstr = 0, nJust = 0, nFair = 0;
@@ -283,17 +312,26 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
         vLits = Gia_AigerReadLiterals( &pCur, nLatches + nOutputs );
     }
 
-    // create the AND gates
+    // create the AND gates (vNodes is presized, so its array does not move)
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashAlloc( pNew );
+    pNodes = Vec_IntArray( vNodes );
     for ( i = 0; i < nAnds; i++ )
     {
         uLit = ((i + 1 + nInputs + nLatches) << 1);
-        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
-        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        uLit1 = uLit  - Gia_AigerReadUnsignedFast( &pCur );
+        uLit0 = uLit1 - Gia_AigerReadUnsignedFast( &pCur );
 //        assert( uLit1 > uLit0 );
-        iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
-        iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
+        if ( uLit1 >= uLit || uLit0 > uLit1 )
+        {
+            fprintf( stdout, "The AND gate %d has an invalid fanin delta.\n", i );
+            Vec_IntFree( vNodes );
+            if ( vLits ) Vec_IntFree( vLits );
+            Gia_ManStop( pNew );
+            return NULL;
+        }
+        iNode0 = Abc_LitNotCond( pNodes[uLit0 >> 1], uLit0 & 1 );
+        iNode1 = Abc_LitNotCond( pNodes[uLit1 >> 1], uLit1 & 1 );
         assert( Vec_IntSize(vNodes) == i + 1 + nInputs + nLatches );
         if ( !fGiaSimple && fSkipStrash )
         {
@@ -376,7 +414,21 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
 
     // read signal names if they are of the special type
     pCur = pSymbols;
-    if ( pCur < (unsigned char *)pContents + nFileSize && *pCur != 'c' )
+    if ( fSkipNames )
+    {
+        // jump from line to line until the comment section
+        while ( pCur < (unsigned char *)pContents + nFileSize && *pCur != 'c' )
+        {
+            pCur = (unsigned char *)memchr( pCur, '\n', (unsigned char *)pContents + nFileSize - pCur );
+            if ( pCur == NULL )
+            {
+                pCur = (unsigned char *)pContents + nFileSize;
+                break;
+            }
+            pCur++;
+        }
+    }
+    else if ( pCur < (unsigned char *)pContents + nFileSize && *pCur != 'c' )
     {
         int fReadNames = 1;
         if ( fReadNames )
@@ -1002,35 +1054,167 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     if ( vNamesRegOut ) Vec_PtrFreeFree( vNamesRegOut );
     return pNew;
 }
+Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadFromMemoryInt( pContents, nFileSize, fGiaSimple, fSkipStrash, 0, fCheck );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the file into memory.]
+
+  Description [The mapping is private and writable because reading the
+  symbol table terminates names in place. Returns NULL if the file cannot
+  be mapped; the caller then falls back to reading it. Files whose size is
+  a multiple of the page size are not mapped, so that the parser may look
+  one byte past the end without faulting.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Gia_AigerMapFile( char * pFileName, int * pnFileSize )
+{
+#ifndef _WIN32
+    struct stat Stat;
+    char * pContents;
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd < 0 )
+        return NULL;
+    if ( fstat( fd, &Stat ) != 0 || Stat.st_size == 0 || Stat.st_size >= 0x7FFFFFFF || Stat.st_size % sysconf(_SC_PAGESIZE) == 0 )
+    {
+        close( fd );
+        return NULL;
+    }
+    pContents = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if ( pContents == (char *)MAP_FAILED )
+        return NULL;
+#ifdef MADV_SEQUENTIAL
+    madvise( pContents, (size_t)Stat.st_size, MADV_SEQUENTIAL );
+#endif
+    *pnFileSize = (int)Stat.st_size;
+    return pContents;
+#else
+    return NULL;
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Decompresses a gzip or bzip2 file into memory.]
+
+  Description [Returns NULL if the file is not compressed.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Gia_AigerLoadCompressed( char * pFileName, int * pnFileSize )
+{
+    Vec_Str_t * vData;
+    char * pContents;
+    int nLength = strlen( pFileName ), nRead, bzError;
+    if ( nLength > 3 && !strcmp(pFileName + nLength - 3, ".gz") )
+    {
+        gzFile pGzip = gzopen( pFileName, "rb" );
+        if ( pGzip == NULL )
+            return NULL;
+        vData = Vec_StrAlloc( 1 << 20 );
+        while ( 1 )
+        {
+            Vec_StrGrow( vData, Vec_StrSize(vData) + (1 << 20) );
+            nRead = gzread( pGzip, Vec_StrArray(vData) + Vec_StrSize(vData), 1 << 20 );
+            if ( nRead <= 0 )
+                break;
+            vData->nSize += nRead;
+        }
+        gzclose( pGzip );
+    }
+    else if ( nLength > 4 && !strcmp(pFileName + nLength - 4, ".bz2") )
+    {
+        BZFILE * pBzip;
+        FILE * pFile = fopen( pFileName, "rb" );
+        if ( pFile == NULL )
+            return NULL;
+        pBzip = BZ2_bzReadOpen( &bzError, pFile, 0, 0, NULL, 0 );
+        if ( bzError != BZ_OK )
+        {
+            fclose( pFile );
+            return NULL;
+        }
+        vData = Vec_StrAlloc( 1 << 20 );
+        do {
+            Vec_StrGrow( vData, Vec_StrSize(vData) + (1 << 20) );
+            nRead = BZ2_bzRead( &bzError, pBzip, Vec_StrArray(vData) + Vec_StrSize(vData), 1 << 20 );
+            if ( nRead > 0 )
+                vData->nSize += nRead;
+        } while ( bzError == BZ_OK );
+        nRead = (bzError == BZ_STREAM_END);
+        BZ2_bzReadClose( &bzError, pBzip );
+        fclose( pFile );
+        if ( !nRead ) // not a bzip2 file; read it as is
+        {
+            Vec_StrFree( vData );
+            return NULL;
+        }
+    }
+    else
+        return NULL;
+    Vec_StrPush( vData, 0 );
+    *pnFileSize = Vec_StrSize(vData) - 1;
+    pContents = Vec_StrReleaseArray( vData );
+    Vec_StrFree( vData );
+    return pContents;
+}
 
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
 
-  Description []
+  Description [The file is memory-mapped when possible. Files ending in
+  ".gz" or ".bz2" are decompressed. If fSkipNames is set, the symbol table
+  is not parsed.]
   
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+Gia_Man_t * Gia_AigerReadExt( char * pFileName, int fGiaSimple, int fSkipStrash, int fSkipNames, int fCheck )
 {
     FILE * pFile;
     Gia_Man_t * pNew;
     char * pName, * pContents;
-    int nFileSize;
+    int nFileSize = 0, fMapped = 0;
     int RetValue;
 
-    // read the file into the buffer
+    // map the file or read it into the buffer
     Gia_FileFixName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    RetValue = fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
+    if ( (pContents = Gia_AigerLoadCompressed( pFileName, &nFileSize )) )
+        fMapped = 0;
+    else if ( (pContents = Gia_AigerMapFile( pFileName, &nFileSize )) )
+        fMapped = 1;
+    else
+    {
+        nFileSize = Gia_FileSize( pFileName );
+        pFile = fopen( pFileName, "rb" );
+        if ( pFile == NULL )
+            return NULL;
+        pContents = ABC_ALLOC( char, nFileSize + 1 );
+        RetValue = fread( pContents, nFileSize, 1, pFile );
+        pContents[nFileSize] = 0;
+        fclose( pFile );
+    }
 
-    pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
+    pNew = Gia_AigerReadFromMemoryInt( pContents, nFileSize, fGiaSimple, fSkipStrash, fSkipNames, fCheck );
+#ifndef _WIN32
+    if ( fMapped )
+        munmap( pContents, (size_t)nFileSize );
+    else
+#endif
     ABC_FREE( pContents );
     if ( pNew )
     {
@@ -1044,6 +1228,10 @@ Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, in
     }
     return pNew;
 }
+Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadExt( pFileName, fGiaSimple, fSkipStrash, 0, fCheck );
+}
 
 
 
@@ -1206,6 +1394,149 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
     return vBuffer;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Buffered output stream for writing AIGER files.]
+
+  Description [Data is staged in a fixed-size buffer and flushed to the
+  file, to a gzip stream (file name ends in ".gz"), or to a bzip2 stream 
+  (file name ends in ".bz2"), so that writing takes bounded memory.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define GIA_AIGER_OUT_SIZE (1 << 16)
+
+typedef struct Gia_AigerOut_t_ Gia_AigerOut_t;
+struct Gia_AigerOut_t_
+{
+    FILE *          pFile;      // output file
+    gzFile          pGzip;      // gzip stream or NULL
+    BZFILE *        pBzip;      // bzip2 stream or NULL
+    int             nBuffer;    // the number of staged bytes
+    int             fError;     // an I/O error has occurred
+    unsigned char   pBuffer[GIA_AIGER_OUT_SIZE];
+};
+
+static Gia_AigerOut_t * Gia_AigerOutStart( char * pFileName )
+{
+    Gia_AigerOut_t * p = ABC_CALLOC( Gia_AigerOut_t, 1 );
+    int nLength = strlen( pFileName ), bzError;
+    if ( nLength > 3 && !strcmp(pFileName + nLength - 3, ".gz") )
+    {
+        p->pGzip = gzopen( pFileName, "wb" );
+        if ( p->pGzip == NULL )
+        {
+            ABC_FREE( p );
+            return NULL;
+        }
+        return p;
+    }
+    p->pFile = fopen( pFileName, "wb" );
+    if ( p->pFile == NULL )
+    {
+        ABC_FREE( p );
+        return NULL;
+    }
+    if ( nLength > 4 && !strcmp(pFileName + nLength - 4, ".bz2") )
+    {
+        p->pBzip = BZ2_bzWriteOpen( &bzError, p->pFile, 9, 0, 0 );
+        if ( bzError != BZ_OK )
+        {
+            BZ2_bzWriteClose( &bzError, p->pBzip, 1, NULL, NULL );
+            fclose( p->pFile );
+            ABC_FREE( p );
+            return NULL;
+        }
+    }
+    return p;
+}
+static void Gia_AigerOutEmit( Gia_AigerOut_t * p, void * pData, int nBytes )
+{
+    int bzError;
+    if ( nBytes == 0 || p->fError )
+        return;
+    if ( p->pGzip )
+        p->fError = (gzwrite( p->pGzip, pData, (unsigned)nBytes ) != nBytes);
+    else if ( p->pBzip )
+    {
+        BZ2_bzWrite( &bzError, p->pBzip, pData, nBytes );
+        p->fError = (bzError != BZ_OK);
+    }
+    else
+        p->fError = (fwrite( pData, 1, (size_t)nBytes, p->pFile ) != (size_t)nBytes);
+}
+static inline void Gia_AigerOutFlush( Gia_AigerOut_t * p )
+{
+    Gia_AigerOutEmit( p, p->pBuffer, p->nBuffer );
+    p->nBuffer = 0;
+}
+static void Gia_AigerOutWrite( Gia_AigerOut_t * p, void * pData, int nBytes )
+{
+    if ( p->nBuffer + nBytes > GIA_AIGER_OUT_SIZE )
+        Gia_AigerOutFlush( p );
+    if ( nBytes > GIA_AIGER_OUT_SIZE )
+        Gia_AigerOutEmit( p, pData, nBytes );
+    else
+    {
+        memcpy( p->pBuffer + p->nBuffer, pData, (size_t)nBytes );
+        p->nBuffer += nBytes;
+    }
+}
+static void Gia_AigerOutPrintf( Gia_AigerOut_t * p, const char * pFormat, ... )
+{
+    char Buffer[1000], * pStr = Buffer;
+    int nBytes;
+    va_list args;
+    va_start( args, pFormat );
+    nBytes = vsnprintf( Buffer, sizeof(Buffer), pFormat, args );
+    va_end( args );
+    if ( nBytes >= (int)sizeof(Buffer) )
+    {
+        pStr = ABC_ALLOC( char, nBytes + 1 );
+        va_start( args, pFormat );
+        vsnprintf( pStr, nBytes + 1, pFormat, args );
+        va_end( args );
+    }
+    if ( nBytes > 0 )
+        Gia_AigerOutWrite( p, pStr, nBytes );
+    if ( pStr != Buffer )
+        ABC_FREE( pStr );
+}
+static inline void Gia_AigerOutUnsigned( Gia_AigerOut_t * p, unsigned x )
+{
+    if ( p->nBuffer + 5 > GIA_AIGER_OUT_SIZE )
+        Gia_AigerOutFlush( p );
+    p->nBuffer = Gia_AigerWriteUnsignedBuffer( p->pBuffer, p->nBuffer, x );
+}
+static inline void Gia_AigerOutInt( Gia_AigerOut_t * p, int Value )
+{
+    unsigned char Buffer[4];
+    Gia_AigerWriteInt( Buffer, Value );
+    Gia_AigerOutWrite( p, Buffer, 4 );
+}
+static int Gia_AigerOutStop( Gia_AigerOut_t * p )
+{
+    int RetValue, bzError;
+    Gia_AigerOutFlush( p );
+    if ( p->pGzip )
+        p->fError |= (gzclose( p->pGzip ) != Z_OK);
+    else
+    {
+        if ( p->pBzip )
+        {
+            BZ2_bzWriteClose( &bzError, p->pBzip, p->fError, NULL, NULL );
+            p->fError |= (bzError != BZ_OK);
+        }
+        p->fError |= (fclose( p->pFile ) != 0);
+    }
+    RetValue = !p->fError;
+    ABC_FREE( p );
+    return RetValue;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Writes the AIG in the binary AIGER format.]
@@ -1220,12 +1551,11 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
 void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int fWriteNewLine, int fSkipComment )
 {
     int fVerbose = XAIG_VERBOSE;
-    FILE * pFile;
+    Gia_AigerOut_t * pOut;
     Gia_Man_t * p;
     Gia_Obj_t * pObj;
     Vec_Str_t * vStrExt;
-    int i, nBufferSize, Pos;
-    unsigned char * pBuffer;
+    int i;
     unsigned uLit0, uLit1, uLit;
     assert( pInit->nXors == 0 && pInit->nMuxes == 0 );
 
@@ -1236,8 +1566,8 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     }
 
     // start the output stream
-    pFile = fopen( pFileName, "wb" );
-    if ( pFile == NULL )
+    pOut = Gia_AigerOutStart( pFileName );
+    if ( pOut == NULL )
     {
         fprintf( stdout, "Gia_AigerWrite(): Cannot open the output file \"%s\".\n", pFileName );
         return;
@@ -1257,7 +1587,7 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         p = pInit;
 
     // write the header "M I L O A" where M = I + L + A
-    fprintf( pFile, "aig%s %u %u %u %u %u", 
+    Gia_AigerOutPrintf( pOut, "aig%s %u %u %u %u %u", 
         fCompact? "2" : "",
         Gia_ManCiNum(p) + Gia_ManAndNum(p), 
         Gia_ManPiNum(p),
@@ -1266,55 +1596,39 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         Gia_ManAndNum(p) );
     // write the extended header "B C J F"
     if ( Gia_ManConstrNum(p) )
-        fprintf( pFile, " %u %u", Gia_ManPoNum(p) - Gia_ManConstrNum(p), Gia_ManConstrNum(p) );
-    fprintf( pFile, "\n" ); 
+        Gia_AigerOutPrintf( pOut, " %u %u", Gia_ManPoNum(p) - Gia_ManConstrNum(p), Gia_ManConstrNum(p) );
+    Gia_AigerOutPrintf( pOut, "\n" ); 
 
     Gia_ManInvertConstraints( p );
     if ( !fCompact ) 
     {
         // write latch drivers
         Gia_ManForEachRi( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            Gia_AigerOutPrintf( pOut, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
         // write PO drivers
         Gia_ManForEachPo( p, pObj, i )
-            fprintf( pFile, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
+            Gia_AigerOutPrintf( pOut, "%u\n", Gia_ObjFaninLit0p(p, pObj) );
     }
     else
     {
         Vec_Int_t * vLits = Gia_AigerCollectLiterals( p );
         Vec_Str_t * vBinary = Gia_AigerWriteLiterals( vLits );
-        fwrite( Vec_StrArray(vBinary), 1, Vec_StrSize(vBinary), pFile );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vBinary), Vec_StrSize(vBinary) );
         Vec_StrFree( vBinary );
         Vec_IntFree( vLits );
     }
     Gia_ManInvertConstraints( p );
 
-    // write the nodes into the buffer
-    Pos = 0;
-    nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
-    pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
+    // stream the nodes through the output buffer
     Gia_ManForEachAnd( p, pObj, i )
     {
         uLit  = Abc_Var2Lit( i, 0 );
         uLit0 = Gia_ObjFaninLit0( pObj, i );
         uLit1 = Gia_ObjFaninLit1( pObj, i );
         assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
-        if ( Pos > nBufferSize - 10 )
-        {
-            printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
-            fclose( pFile );
-            if ( p != pInit )
-                Gia_ManStop( p );
-            return;
-        }
+        Gia_AigerOutUnsigned( pOut, uLit  - uLit1 );
+        Gia_AigerOutUnsigned( pOut, uLit1 - uLit0 );
     }
-    assert( Pos < nBufferSize );
-
-    // write the buffer
-    fwrite( pBuffer, 1, Pos, pFile );
-    ABC_FREE( pBuffer );
 
     // write the symbol table
     if ( p->vNamesIn && p->vNamesOut )
@@ -1323,13 +1637,13 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         assert( Vec_PtrSize(p->vNamesOut) == Gia_ManCoNum(p) );
         // write PIs
         Gia_ManForEachPi( p, pObj, i )
-            fprintf( pFile, "i%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, i) );
+            Gia_AigerOutPrintf( pOut, "i%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, i) );
         // write latches
         Gia_ManForEachRo( p, pObj, i )
-            fprintf( pFile, "l%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, Gia_ManPiNum(p) + i) );
+            Gia_AigerOutPrintf( pOut, "l%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesIn, Gia_ManPiNum(p) + i) );
         // write POs
         Gia_ManForEachPo( p, pObj, i )
-            fprintf( pFile, "o%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesOut, i) );
+            Gia_AigerOutPrintf( pOut, "o%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesOut, i) );
     }
     if ( p->vNamesNode && Vec_PtrSize(p->vNamesNode) != Gia_ManObjNum(p) )
         Abc_Print( 0, "The size of the node name array does not match the number of objects. Names are not written.\n" );
@@ -1337,38 +1651,38 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     {
         Gia_ManForEachAnd( p, pObj, i )
             if ( Vec_PtrEntry(p->vNamesNode, i) )
-                fprintf( pFile, "n%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesNode, i) );
+                Gia_AigerOutPrintf( pOut, "n%d %s\n", i, (char *)Vec_PtrEntry(p->vNamesNode, i) );
     }
 
     // write the comment
     if ( fWriteNewLine ) 
-        fprintf( pFile, "c\n" );
+        Gia_AigerOutPrintf( pOut, "c\n" );
     else
-        fprintf( pFile, "c" );
+        Gia_AigerOutPrintf( pOut, "c" );
 
     // write additional AIG
     if ( p->pAigExtra )
     {
-        fprintf( pFile, "a" );
+        Gia_AigerOutPrintf( pOut, "a" );
         vStrExt = Gia_AigerWriteIntoMemoryStr( p->pAigExtra );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutInt( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"a\".\n" );
     }
     // write constraints
     if ( p->nConstrs )
     {
-        fprintf( pFile, "c" );
-        Gia_FileWriteBufferSize( pFile, 4 );
-        Gia_FileWriteBufferSize( pFile, p->nConstrs );
+        Gia_AigerOutPrintf( pOut, "c" );
+        Gia_AigerOutInt( pOut, 4 );
+        Gia_AigerOutInt( pOut, p->nConstrs );
     }
     // write timing information
     if ( p->nAnd2Delay )
     {
-        fprintf( pFile, "d" );
-        Gia_FileWriteBufferSize( pFile, 4 );
-        Gia_FileWriteBufferSize( pFile, p->nAnd2Delay );
+        Gia_AigerOutPrintf( pOut, "d" );
+        Gia_AigerOutInt( pOut, 4 );
+        Gia_AigerOutInt( pOut, p->nAnd2Delay );
     }
     if ( p->pManTime )
     {
@@ -1376,18 +1690,18 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         pTimes = Tim_ManGetArrTimes( (Tim_Man_t *)p->pManTime );
         if ( pTimes )
         {
-            fprintf( pFile, "i" );
-            Gia_FileWriteBufferSize( pFile, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
-            fwrite( pTimes, 1, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime), pFile );
+            Gia_AigerOutPrintf( pOut, "i" );
+            Gia_AigerOutInt( pOut, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
+            Gia_AigerOutWrite( pOut, pTimes, 4*Tim_ManPiNum((Tim_Man_t *)p->pManTime) );
             ABC_FREE( pTimes );
             if ( fVerbose ) printf( "Finished writing extension \"i\".\n" );
         }
         pTimes = Tim_ManGetReqTimes( (Tim_Man_t *)p->pManTime );
         if ( pTimes )
         {
-            fprintf( pFile, "o" );
-            Gia_FileWriteBufferSize( pFile, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
-            fwrite( pTimes, 1, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime), pFile );
+            Gia_AigerOutPrintf( pOut, "o" );
+            Gia_AigerOutInt( pOut, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
+            Gia_AigerOutWrite( pOut, pTimes, 4*Tim_ManPoNum((Tim_Man_t *)p->pManTime) );
             ABC_FREE( pTimes );
             if ( fVerbose ) printf( "Finished writing extension \"o\".\n" );
         }
@@ -1396,35 +1710,35 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     if ( p->pReprs && p->pNexts )
     {
         extern Vec_Str_t * Gia_WriteEquivClasses( Gia_Man_t * p );
-        fprintf( pFile, "e" );
+        Gia_AigerOutPrintf( pOut, "e" );
         vStrExt = Gia_WriteEquivClasses( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutInt( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
     }
     // write flop classes
     if ( p->vFlopClasses )
     {
-        fprintf( pFile, "f" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManRegNum(p) );
+        Gia_AigerOutPrintf( pOut, "f" );
+        Gia_AigerOutInt( pOut, 4*Gia_ManRegNum(p) );
         assert( Vec_IntSize(p->vFlopClasses) == Gia_ManRegNum(p) );
-        fwrite( Vec_IntArray(p->vFlopClasses), 1, 4*Gia_ManRegNum(p), pFile );
+        Gia_AigerOutWrite( pOut, Vec_IntArray(p->vFlopClasses), 4*Gia_ManRegNum(p) );
     }
     // write gate classes
     if ( p->vGateClasses )
     {
-        fprintf( pFile, "g" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutPrintf( pOut, "g" );
+        Gia_AigerOutInt( pOut, 4*Gia_ManObjNum(p) );
         assert( Vec_IntSize(p->vGateClasses) == Gia_ManObjNum(p) );
-        fwrite( Vec_IntArray(p->vGateClasses), 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutWrite( pOut, Vec_IntArray(p->vGateClasses), 4*Gia_ManObjNum(p) );
     }
     // write hierarchy info
     if ( p->pManTime )
     {
-        fprintf( pFile, "h" );
+        Gia_AigerOutPrintf( pOut, "h" );
         vStrExt = Tim_ManSave( (Tim_Man_t *)p->pManTime, 1 );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutInt( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"h\".\n" );
     }
@@ -1432,10 +1746,10 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     if ( p->vPacking )
     {
         extern Vec_Str_t * Gia_WritePacking( Vec_Int_t * vPacking );
-        fprintf( pFile, "k" );
+        Gia_AigerOutPrintf( pOut, "k" );
         vStrExt = Gia_WritePacking( p->vPacking );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutInt( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"k\".\n" );
     }
@@ -1444,11 +1758,11 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     {
         Vec_Int_t * vPairs = Gia_ManEdgeToArray( p );
         int i;
-        fprintf( pFile, "w" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(vPairs)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(vPairs)/2 );
+        Gia_AigerOutPrintf( pOut, "w" );
+        Gia_AigerOutInt( pOut, 4*(Vec_IntSize(vPairs)+1) );
+        Gia_AigerOutInt( pOut, Vec_IntSize(vPairs)/2 );
         for ( i = 0; i < Vec_IntSize(vPairs); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(vPairs, i) );
+            Gia_AigerOutInt( pOut, Vec_IntEntry(vPairs, i) );
         Vec_IntFree( vPairs );
     }
     // write mapping
@@ -1457,10 +1771,10 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
         extern Vec_Str_t * Gia_AigerWriteMapping( Gia_Man_t * p );
         extern Vec_Str_t * Gia_AigerWriteMappingSimple( Gia_Man_t * p );
         extern Vec_Str_t * Gia_AigerWriteMappingDoc( Gia_Man_t * p );
-        fprintf( pFile, "m" );
+        Gia_AigerOutPrintf( pOut, "m" );
         vStrExt = Gia_AigerWriteMappingDoc( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutInt( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"m\".\n" );
     }
@@ -1468,10 +1782,10 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     if ( Gia_ManHasCellMapping(p) )
     {
         extern Vec_Str_t * Gia_AigerWriteCellMappingDoc( Gia_Man_t * p );
-        fprintf( pFile, "M" );
+        Gia_AigerOutPrintf( pOut, "M" );
         vStrExt = Gia_AigerWriteCellMappingDoc( p );
-        Gia_FileWriteBufferSize( pFile, Vec_StrSize(vStrExt) );
-        fwrite( Vec_StrArray(vStrExt), 1, Vec_StrSize(vStrExt), pFile );
+        Gia_AigerOutInt( pOut, Vec_StrSize(vStrExt) );
+        Gia_AigerOutWrite( pOut, Vec_StrArray(vStrExt), Vec_StrSize(vStrExt) );
         Vec_StrFree( vStrExt );
         if ( fVerbose ) printf( "Finished writing extension \"M\".\n" );
 
@@ -1479,65 +1793,65 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     // write placement
     if ( p->pPlacement )
     {
-        fprintf( pFile, "p" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
-        fwrite( p->pPlacement, 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutPrintf( pOut, "p" );
+        Gia_AigerOutInt( pOut, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutWrite( pOut, p->pPlacement, 4*Gia_ManObjNum(p) );
     }
     // write register classes
     if ( p->vRegClasses )
     {
         int i;
-        fprintf( pFile, "r" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(p->vRegClasses)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(p->vRegClasses) );
+        Gia_AigerOutPrintf( pOut, "r" );
+        Gia_AigerOutInt( pOut, 4*(Vec_IntSize(p->vRegClasses)+1) );
+        Gia_AigerOutInt( pOut, Vec_IntSize(p->vRegClasses) );
         for ( i = 0; i < Vec_IntSize(p->vRegClasses); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vRegClasses, i) );
+            Gia_AigerOutInt( pOut, Vec_IntEntry(p->vRegClasses, i) );
     }
     // write register inits
     if ( p->vRegInits )
     {
         int i;
-        fprintf( pFile, "s" );
-        Gia_FileWriteBufferSize( pFile, 4*(Vec_IntSize(p->vRegInits)+1) );
-        Gia_FileWriteBufferSize( pFile, Vec_IntSize(p->vRegInits) );
+        Gia_AigerOutPrintf( pOut, "s" );
+        Gia_AigerOutInt( pOut, 4*(Vec_IntSize(p->vRegInits)+1) );
+        Gia_AigerOutInt( pOut, Vec_IntSize(p->vRegInits) );
         for ( i = 0; i < Vec_IntSize(p->vRegInits); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vRegInits, i) );
+            Gia_AigerOutInt( pOut, Vec_IntEntry(p->vRegInits, i) );
     }
     // write configuration data
     if ( p->vConfigs )
     {
-        fprintf( pFile, "b" );
+        Gia_AigerOutPrintf( pOut, "b" );
         assert( p->pCellStr != NULL );
-        Gia_FileWriteBufferSize( pFile, 4*Vec_IntSize(p->vConfigs) + strlen(p->pCellStr) + 1 );
-        fwrite( p->pCellStr, 1, strlen(p->pCellStr) + 1, pFile );
+        Gia_AigerOutInt( pOut, 4*Vec_IntSize(p->vConfigs) + strlen(p->pCellStr) + 1 );
+        Gia_AigerOutWrite( pOut, p->pCellStr, strlen(p->pCellStr) + 1 );
 //        fwrite( Vec_IntArray(p->vConfigs), 1, 4*Vec_IntSize(p->vConfigs), pFile );
         for ( i = 0; i < Vec_IntSize(p->vConfigs); i++ )
-            Gia_FileWriteBufferSize( pFile, Vec_IntEntry(p->vConfigs, i) );
+            Gia_AigerOutInt( pOut, Vec_IntEntry(p->vConfigs, i) );
     }
     // write choices
     if ( Gia_ManHasChoices(p) )
     {
         int i, nPairs = 0;
-        fprintf( pFile, "q" );
+        Gia_AigerOutPrintf( pOut, "q" );
         for ( i = 0; i < Gia_ManObjNum(p); i++ )
             nPairs += (Gia_ObjSibl(p, i) > 0);
-        Gia_FileWriteBufferSize( pFile, 4*(nPairs * 2 + 1) );
-        Gia_FileWriteBufferSize( pFile, nPairs );
+        Gia_AigerOutInt( pOut, 4*(nPairs * 2 + 1) );
+        Gia_AigerOutInt( pOut, nPairs );
         for ( i = 0; i < Gia_ManObjNum(p); i++ )
             if ( Gia_ObjSibl(p, i) )
             {
                 assert( i > Gia_ObjSibl(p, i) );
-                Gia_FileWriteBufferSize( pFile, i );
-                Gia_FileWriteBufferSize( pFile, Gia_ObjSibl(p, i) );
+                Gia_AigerOutInt( pOut, i );
+                Gia_AigerOutInt( pOut, Gia_ObjSibl(p, i) );
             }
         if ( fVerbose ) printf( "Finished writing extension \"q\".\n" );
     }
     // write switching activity
     if ( p->pSwitching )
     {
-        fprintf( pFile, "u" );
-        Gia_FileWriteBufferSize( pFile, Gia_ManObjNum(p) );
-        fwrite( p->pSwitching, 1, Gia_ManObjNum(p), pFile );
+        Gia_AigerOutPrintf( pOut, "u" );
+        Gia_AigerOutInt( pOut, Gia_ManObjNum(p) );
+        Gia_AigerOutWrite( pOut, p->pSwitching, Gia_ManObjNum(p) );
     }
 /*
     // write timing information
@@ -1553,27 +1867,28 @@ void Gia_AigerWriteS( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, in
     // write object classes
     if ( p->vObjClasses )
     {
-        fprintf( pFile, "v" );
-        Gia_FileWriteBufferSize( pFile, 4*Gia_ManObjNum(p) );
+        Gia_AigerOutPrintf( pOut, "v" );
+        Gia_AigerOutInt( pOut, 4*Gia_ManObjNum(p) );
         assert( Vec_IntSize(p->vObjClasses) == Gia_ManObjNum(p) );
-        fwrite( Vec_IntArray(p->vObjClasses), 1, 4*Gia_ManObjNum(p), pFile );
+        Gia_AigerOutWrite( pOut, Vec_IntArray(p->vObjClasses), 4*Gia_ManObjNum(p) );
     }
     // write name
     if ( p->pName )
     {
-        fprintf( pFile, "n" );
-        Gia_FileWriteBufferSize( pFile, strlen(p->pName)+1 );
-        fwrite( p->pName, 1, strlen(p->pName), pFile );
-        fprintf( pFile, "%c", '\0' );
+        Gia_AigerOutPrintf( pOut, "n" );
+        Gia_AigerOutInt( pOut, strlen(p->pName)+1 );
+        Gia_AigerOutWrite( pOut, p->pName, strlen(p->pName) );
+        Gia_AigerOutPrintf( pOut, "%c", '\0' );
     }
     // write comments
     if ( fWriteNewLine )
-        fprintf( pFile, "c\n" );
+        Gia_AigerOutPrintf( pOut, "c\n" );
     if ( !fSkipComment ) {
-        fprintf( pFile, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
-        fprintf( pFile, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
+        Gia_AigerOutPrintf( pOut, "\nThis file was produced by the GIA package in ABC on %s\n", Gia_TimeStamp() );
+        Gia_AigerOutPrintf( pOut, "For information about AIGER format, refer to %s\n", "http://fmv.jku.at/aiger" );
     }
-    fclose( pFile );
+    if ( !Gia_AigerOutStop( pOut ) )
+        fprintf( stdout, "Gia_AigerWrite(): I/O error when writing the output file \"%s\".\n", pFileName );
     if ( p != pInit )
     {
         Gia_ManTransferTiming( pInit, p );
@@ -654,6 +654,169 @@ int Gia_ManHashAndTry( Gia_Man_t * p, int iLit0, int iLit1 )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts the concurrent hash table.]
+
+  Description [The table uses open addressing with linear probing. Each
+  slot is two words: the key (two fanin literals) claimed by compare-and-swap,
+  and the object ID published after the object is written. The object array
+  is allocated for nObjsMax objects upfront, so that the threads can reserve
+  new objects by incrementing the object counter. The existing AND nodes are
+  added to the table. The number of objects is limited to 2^28, so that the
+  table size fits into an integer. Returns 0 if atomic operations are not 
+  available or the manager already has more objects than that.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word * Gia_ManHashConcSlot( Gia_Man_t * p, word Key )
+{
+    int Mask = Vec_WrdSize(p->vHashConc) / 2 - 1;
+    return Vec_WrdEntryP( p->vHashConc, 2 * ((int)((Key * ABC_CONST(0x9E3779B97F4A7C15)) >> 32) & Mask) );
+}
+static inline int Gia_ManHashConcObjLimit( Gia_Man_t * p )
+{
+    // the table is at most half full
+    return Abc_MinInt( p->nObjsAlloc, Vec_WrdSize(p->vHashConc) / 4 );
+}
+int Gia_ManHashConcStart( Gia_Man_t * p, int nObjsMax )
+{
+#if defined(__GNUC__)
+    Gia_Obj_t * pObj; 
+    word * pSlot, * pLimit;
+    int i;
+    assert( p->vHashConc == NULL );
+    assert( Vec_IntSize(&p->vHTable) == 0 );
+    assert( p->pMuxes == NULL && p->pFanData == NULL && !p->fSweeper && !p->fBuiltInSim && p->vSuppWords == NULL );
+    if ( p->nObjs > (1 << 28) )
+        return 0;
+    nObjsMax = Abc_MinInt( Abc_MaxInt(nObjsMax, p->nObjs), (1 << 28) );
+    if ( p->nObjsAlloc < nObjsMax )
+    {
+        p->pObjs = ABC_REALLOC( Gia_Obj_t, p->pObjs, nObjsMax );
+        memset( p->pObjs + p->nObjsAlloc, 0, sizeof(Gia_Obj_t) * (nObjsMax - p->nObjsAlloc) );
+        p->nObjsAlloc = nObjsMax;
+    }
+    // the table is at most half full: 2^29 slots of two words for 2^28 objects
+    p->vHashConc = Vec_WrdStart( 2 << Abc_Base2Log(2 * nObjsMax) );
+    pLimit = Vec_WrdLimit( p->vHashConc );
+    Gia_ManForEachAnd( p, pObj, i )
+    {
+        word Key = ((word)Gia_ObjFaninLit1(pObj, i) << 32) | (word)Gia_ObjFaninLit0(pObj, i);
+        for ( pSlot = Gia_ManHashConcSlot(p, Key); pSlot[0] && pSlot[0] != Key; )
+            if ( (pSlot += 2) == pLimit )
+                pSlot = Vec_WrdArray( p->vHashConc );
+        pSlot[0] = Key;
+        pSlot[1] = i;
+    }
+    return 1;
+#else
+    return 0;
+#endif
+}
+void Gia_ManHashConcStop( Gia_Man_t * p )
+{
+    Vec_WrdFreeP( &p->vHashConc );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Hashes AND gate using the concurrent hash table.]
+
+  Description [Can be called by several threads adding nodes to the same
+  manager. The thread that claims the slot for the new key reserves the
+  next object, writes its fanins, and publishes its ID. Other threads
+  looking up the same key wait until the ID is published. Since the fanins
+  are created before the node, the node order remains topological.
+  Returns -1 if the preallocated objects are exhausted. In this case, 
+  the caller should stop the concurrent table and continue with the 
+  regular one (Gia_ManHashStart and Gia_ManHashAnd).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManHashConcAnd( Gia_Man_t * p, int iLit0, int iLit1 )
+{
+#if defined(__GNUC__)
+    word Key, Old, Id, * pSlot, * pLimit = Vec_WrdLimit( p->vHashConc );
+    int nObjsLimit = Gia_ManHashConcObjLimit( p );
+    if ( iLit0 < 2 )
+        return iLit0 ? iLit1 : 0;
+    if ( iLit1 < 2 )
+        return iLit1 ? iLit0 : 0;
+    if ( iLit0 == iLit1 )
+        return iLit1;
+    if ( iLit0 == Abc_LitNot(iLit1) )
+        return 0;
+    if ( iLit0 > iLit1 )
+        iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
+    Key = ((word)iLit1 << 32) | (word)iLit0;
+    for ( pSlot = Gia_ManHashConcSlot(p, Key); ; )
+    {
+        Old = __atomic_load_n( pSlot, __ATOMIC_ACQUIRE );
+        // if another thread claims the slot first, Old is updated to its key
+        if ( Old == 0 && __atomic_compare_exchange_n( pSlot, &Old, Key, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE ) )
+        {
+            int iObj = __atomic_load_n( &p->nObjs, __ATOMIC_RELAXED );
+            Gia_Obj_t * pObj;
+            // reserve the next object without moving the counter past the limit
+            do {
+                if ( iObj >= nObjsLimit )
+                {
+                    // the key stays claimed; its lookups return -1
+                    __atomic_store_n( pSlot + 1, ~(word)0, __ATOMIC_RELEASE );
+                    return -1;
+                }
+            } while ( !__atomic_compare_exchange_n( &p->nObjs, &iObj, iObj + 1, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED ) );
+            pObj = Gia_ManObj( p, iObj );
+            pObj->iDiff0  = (unsigned)(iObj - Abc_Lit2Var(iLit0));
+            pObj->fCompl0 = (unsigned)(Abc_LitIsCompl(iLit0));
+            pObj->iDiff1  = (unsigned)(iObj - Abc_Lit2Var(iLit1));
+            pObj->fCompl1 = (unsigned)(Abc_LitIsCompl(iLit1));
+            __atomic_store_n( pSlot + 1, (word)iObj, __ATOMIC_RELEASE );
+            return Abc_Var2Lit( iObj, 0 );
+        }
+        if ( Old == Key )
+        {
+            while ( (Id = __atomic_load_n(pSlot + 1, __ATOMIC_ACQUIRE)) == 0 )
+                ;
+            return Id == ~(word)0 ? -1 : Abc_Var2Lit( (int)Id, 0 );
+        }
+        if ( (pSlot += 2) == pLimit )
+            pSlot = Vec_WrdArray( p->vHashConc );
+    }
+#else
+    assert( 0 );
+    return -1;
+#endif
+}
+int Gia_ManHashConcLookup( Gia_Man_t * p, int iLit0, int iLit1 )
+{
+#if defined(__GNUC__)
+    word Key, Old, Id, * pSlot, * pLimit = Vec_WrdLimit( p->vHashConc );
+    if ( iLit0 > iLit1 )
+        iLit0 ^= iLit1, iLit1 ^= iLit0, iLit0 ^= iLit1;
+    Key = ((word)iLit1 << 32) | (word)iLit0;
+    for ( pSlot = Gia_ManHashConcSlot(p, Key); (Old = __atomic_load_n(pSlot, __ATOMIC_ACQUIRE)); )
+    {
+        if ( Old == Key )
+        {
+            while ( (Id = __atomic_load_n(pSlot + 1, __ATOMIC_ACQUIRE)) == 0 )
+                ;
+            return Id == ~(word)0 ? -1 : Abc_Var2Lit( (int)Id, 0 );
+        }
+        if ( (pSlot += 2) == pLimit )
+            pSlot = Vec_WrdArray( p->vHashConc );
+    }
+#endif
+    return -1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
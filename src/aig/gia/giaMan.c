@@ -155,6 +155,7 @@ void Gia_ManStop( Gia_Man_t * p )
     Vec_IntFree( p->vCos );
     Vec_IntErase( &p->vHash );
     Vec_IntErase( &p->vHTable );
+    Vec_WrdFreeP( &p->vHashConc );
     Vec_IntErase( &p->vRefs );
     Vec_StrFreeP( &p->vStopsF );
     Vec_StrFreeP( &p->vStopsB );    
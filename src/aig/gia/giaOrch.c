@@ -0,0 +1,760 @@
+/**CFile****************************************************************
+
+  FileName    [giaOrch.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Orchestration of rewriting, resubstitution and refactoring.]
+
+  Author      [Berkeley Logic Synthesis and Verification Group]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "gia.h"
+#include "bool/kit/kit.h"
+#include "misc/util/utilTruth.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// For each AND node (in the topological order), the three operators are
+// applied to a window of the node in the original AIG, their results are
+// strashed into the new AIG, and the one with the largest gain is used as
+// the copy of the node. The gain of a result is the size of the MFFC of the
+// node minus the number of nodes in the new AIG it needs, where the nodes
+// created for other results and the nodes no longer used are not free.
+
+#define GIA_ORCH_RWR        0       // rewriting (4-input cuts, DAR library)
+#define GIA_ORCH_RES        1       // resubstitution (giaResub)
+#define GIA_ORCH_REF        2       // refactoring (ISOP + factoring)
+#define GIA_ORCH_NUM        3
+
+#define GIA_ORCH_FANOUT_MAX 100     // the largest fanout count of a divisor to look for side divisors
+
+typedef struct Gia_OrchMan_t_ Gia_OrchMan_t;
+struct Gia_OrchMan_t_
+{
+    Gia_Man_t *      p;             // the original AIG
+    Gia_Man_t *      pNew;          // the resulting AIG
+    // parameters
+    int              nCutRef;       // the cut size for refactoring
+    int              nCutRes;       // the cut size for resubstitution
+    int              nDivsMax;      // the largest number of divisors
+    int              fKeepLevel;    // do not increase the level of the nodes
+    int              fUseZeros;     // accept zero-cost replacements
+    // the window of the current node
+    Vec_Int_t *      vLeaves;       // the cut leaves
+    Vec_Int_t *      vCone;         // the nodes between the leaves and the root (topological order)
+    Vec_Int_t *      vMffc;         // the MFFC of the root bounded by the leaves
+    Vec_Int_t *      vDivs;         // the divisors (leaves, cone nodes not in the MFFC, side nodes)
+    Vec_Int_t *      vWin;          // the objects with truth tables
+    Vec_Int_t *      vSimMap;       // the truth table index of each object (-1 if none)
+    Vec_Wrd_t *      vSims;         // the truth tables
+    int              nWords;        // the number of words in a truth table
+    word *           pTemp;         // temporary truth table
+    // the new AIG
+    Vec_Str_t *      vDead;         // the nodes of the new AIG that are not used
+    Vec_Int_t *      vMffcLits;     // the nodes of the new AIG that implement the MFFC
+    Vec_Int_t *      vVisited;      // the nodes of the new AIG used by a result
+    Vec_Int_t *      vMarkMffc;     // the MFFC stamp of each object of the original AIG
+    Vec_Int_t *      vMarkLits;     // the MFFC stamp of each node of the new AIG
+    Vec_Int_t *      vMarkUsed;     // the visited stamp of each node of the new AIG
+    int              nStampMffc;    // the current MFFC stamp
+    int              nStampNew;     // the current stamp for the new AIG
+    // temporary storage
+    Vec_Ptr_t *      vDivTts;       // truth tables passed to resubstitution
+    Vec_Int_t *      vCover;        // the ISOP
+    Vec_Int_t *      vLits;         // the literals of the leaves in the new AIG
+    Vec_Int_t *      vLeavesBest;   // the leaves of the best rewriting structure
+    Vec_Int_t *      vGateLits;     // the literals of the resubstitution gates
+    // statistics
+    int              nNodesTried;
+    int              nChanges[GIA_ORCH_NUM];
+    int              nGains[GIA_ORCH_NUM];
+};
+
+extern int  Dar_LibEvalBuild( Gia_Man_t * p, Vec_Int_t * vCut, unsigned uTruth, int fKeepLevel, Vec_Int_t * vLeavesBest );
+extern void Dar_LibStart();
+extern void Dar_LibPrepare( int nSubgraphs );
+extern void Abc_ResubPrepareManager( int nWords );
+extern int  Abc_ResubComputeFunction( void ** ppDivs, int nDivs, int nWords, int nLimit, int nDivsMax, int iChoice, int fUseXor, int fDebug, int fVerbose, int ** ppArray );
+
+static inline word * Gia_OrchSim( Gia_OrchMan_t * p, int iObj )     { return Vec_WrdEntryP( p->vSims, p->nWords * Vec_IntEntry(p->vSimMap, iObj) ); }
+static inline int    Gia_OrchIsDead( Gia_OrchMan_t * p, int iNode )  { return Vec_StrGetEntry( p->vDead, iNode );                                    }
+static inline int    Gia_OrchIsMffc( Gia_OrchMan_t * p, int iObj )   { return Vec_IntEntry( p->vMarkMffc, iObj ) == p->nStampMffc;                    }
+static inline int    Gia_OrchIsLit( Gia_OrchMan_t * p, int iNode )   { return Vec_IntGetEntry( p->vMarkLits, iNode ) == p->nStampNew;                 }
+static inline int    Gia_OrchIsUsed( Gia_OrchMan_t * p, int iNode )  { return Vec_IntGetEntry( p->vMarkUsed, iNode ) == p->nStampNew;                 }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the manager.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_OrchMan_t * Gia_OrchManStart( Gia_Man_t * p, int nCutRef, int nCutRes, int nDivsMax, int fKeepLevel, int fUseZeros )
+{
+    Gia_OrchMan_t * pMan = ABC_CALLOC( Gia_OrchMan_t, 1 );
+    pMan->p           = p;
+    pMan->nCutRef     = nCutRef;
+    pMan->nCutRes     = nCutRes;
+    pMan->nDivsMax    = nDivsMax;
+    pMan->fKeepLevel  = fKeepLevel;
+    pMan->fUseZeros   = fUseZeros;
+    pMan->vLeaves     = Vec_IntAlloc( 16 );
+    pMan->vCone       = Vec_IntAlloc( 100 );
+    pMan->vMffc       = Vec_IntAlloc( 100 );
+    pMan->vDivs       = Vec_IntAlloc( 100 );
+    pMan->vWin        = Vec_IntAlloc( 100 );
+    pMan->vSimMap     = Vec_IntStartFull( Gia_ManObjNum(p) );
+    pMan->vSims       = Vec_WrdAlloc( 1000 );
+    pMan->pTemp       = ABC_CALLOC( word, Abc_Truth6WordNum(Abc_MaxInt(nCutRef, nCutRes)) );
+    pMan->vDead       = Vec_StrAlloc( Gia_ManObjNum(p) );
+    pMan->vMffcLits   = Vec_IntAlloc( 100 );
+    pMan->vVisited    = Vec_IntAlloc( 100 );
+    pMan->vMarkMffc   = Vec_IntStart( Gia_ManObjNum(p) );
+    pMan->vMarkLits   = Vec_IntStart( Gia_ManObjNum(p) );
+    pMan->vMarkUsed   = Vec_IntStart( Gia_ManObjNum(p) );
+    pMan->vDivTts     = Vec_PtrAlloc( 100 );
+    pMan->vCover      = Vec_IntAlloc( 1 << 16 );
+    pMan->vLits       = Vec_IntAlloc( 16 );
+    pMan->vLeavesBest = Vec_IntAlloc( 4 );
+    pMan->vGateLits   = Vec_IntAlloc( 100 );
+    return pMan;
+}
+static void Gia_OrchManStop( Gia_OrchMan_t * pMan )
+{
+    Vec_IntFree( pMan->vLeaves );
+    Vec_IntFree( pMan->vCone );
+    Vec_IntFree( pMan->vMffc );
+    Vec_IntFree( pMan->vDivs );
+    Vec_IntFree( pMan->vWin );
+    Vec_IntFree( pMan->vSimMap );
+    Vec_WrdFree( pMan->vSims );
+    Vec_StrFree( pMan->vDead );
+    Vec_IntFree( pMan->vMffcLits );
+    Vec_IntFree( pMan->vVisited );
+    Vec_IntFree( pMan->vMarkMffc );
+    Vec_IntFree( pMan->vMarkLits );
+    Vec_IntFree( pMan->vMarkUsed );
+    Vec_PtrFree( pMan->vDivTts );
+    Vec_IntFree( pMan->vCover );
+    Vec_IntFree( pMan->vLits );
+    Vec_IntFree( pMan->vLeavesBest );
+    Vec_IntFree( pMan->vGateLits );
+    ABC_FREE( pMan->pTemp );
+    ABC_FREE( pMan );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Strashes one AND gate in the new AIG.]
+
+  Description [Updates the level and the phase of the node.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Gia_OrchHashAnd( Gia_Man_t * pNew, int iLit0, int iLit1 )
+{
+    int iLit = Gia_ManHashAnd( pNew, iLit0, iLit1 );
+    Gia_Obj_t * pObj = Gia_ManObj( pNew, Abc_Lit2Var(iLit) );
+    if ( Gia_ObjIsAnd(pObj) )
+    {
+        Gia_ObjSetAndLevel( pNew, pObj );
+        Gia_ObjSetPhase( pNew, pObj );
+    }
+    return iLit;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes a reconvergence-driven cut of the node.]
+
+  Description [Expands the leaf that adds the fewest new leaves, preferring
+  the leaves with the largest level, while the cut fits into nLeafMax.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_OrchAddLeaf( Gia_OrchMan_t * p, int iObj )
+{
+    if ( Gia_ObjIsTravIdCurrentId(p->p, iObj) )
+        return;
+    Gia_ObjSetTravIdCurrentId( p->p, iObj );
+    Vec_IntPush( p->vLeaves, iObj );
+}
+static void Gia_OrchFindCut( Gia_OrchMan_t * p, int iObj, int nLeafMax )
+{
+    Gia_Man_t * pGia = p->p;
+    Gia_Obj_t * pObj = Gia_ManObj( pGia, iObj ), * pLeaf;
+    int i, iLeaf, iBest, Cost, CostBest;
+    Vec_IntClear( p->vLeaves );
+    Gia_ManIncrementTravId( pGia );
+    Gia_ObjSetTravIdCurrentId( pGia, iObj );
+    Gia_OrchAddLeaf( p, Gia_ObjFaninId0(pObj, iObj) );
+    Gia_OrchAddLeaf( p, Gia_ObjFaninId1(pObj, iObj) );
+    while ( 1 )
+    {
+        iBest = -1;
+        CostBest = ABC_INFINITY;
+        Vec_IntForEachEntry( p->vLeaves, iLeaf, i )
+        {
+            pLeaf = Gia_ManObj( pGia, iLeaf );
+            if ( !Gia_ObjIsAnd(pLeaf) )
+                continue;
+            Cost = !Gia_ObjIsTravIdCurrentId(pGia, Gia_ObjFaninId0(pLeaf, iLeaf)) + !Gia_ObjIsTravIdCurrentId(pGia, Gia_ObjFaninId1(pLeaf, iLeaf)) - 1;
+            if ( CostBest > Cost || (CostBest == Cost && Gia_ObjLevelId(pGia, iLeaf) > Gia_ObjLevelId(pGia, Vec_IntEntry(p->vLeaves, iBest))) )
+                CostBest = Cost, iBest = i;
+        }
+        if ( iBest == -1 || Vec_IntSize(p->vLeaves) + CostBest > nLeafMax )
+            break;
+        iLeaf = Vec_IntEntry( p->vLeaves, iBest );
+        Vec_IntDrop( p->vLeaves, iBest );
+        pLeaf = Gia_ManObj( pGia, iLeaf );
+        Gia_OrchAddLeaf( p, Gia_ObjFaninId0(pLeaf, iLeaf) );
+        Gia_OrchAddLeaf( p, Gia_ObjFaninId1(pLeaf, iLeaf) );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the MFFC of the node bounded by the leaves.]
+
+  Description [The leaves are marked with the current traversal ID.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_OrchDeref_rec( Gia_OrchMan_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->p, iObj );
+    int iFan0 = Gia_ObjFaninId0( pObj, iObj );
+    int iFan1 = Gia_ObjFaninId1( pObj, iObj );
+    Vec_IntPush( p->vMffc, iObj );
+    Vec_IntWriteEntry( p->vMarkMffc, iObj, p->nStampMffc );
+    if ( !Gia_ObjIsTravIdCurrentId(p->p, iFan0) && Gia_ObjRefDecId(p->p, iFan0) == 0 )
+        Gia_OrchDeref_rec( p, iFan0 );
+    if ( !Gia_ObjIsTravIdCurrentId(p->p, iFan1) && Gia_ObjRefDecId(p->p, iFan1) == 0 )
+        Gia_OrchDeref_rec( p, iFan1 );
+}
+static void Gia_OrchRef_rec( Gia_OrchMan_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->p, iObj );
+    int iFan0 = Gia_ObjFaninId0( pObj, iObj );
+    int iFan1 = Gia_ObjFaninId1( pObj, iObj );
+    if ( !Gia_ObjIsTravIdCurrentId(p->p, iFan0) && Gia_ObjRefIncId(p->p, iFan0) == 0 )
+        Gia_OrchRef_rec( p, iFan0 );
+    if ( !Gia_ObjIsTravIdCurrentId(p->p, iFan1) && Gia_ObjRefIncId(p->p, iFan1) == 0 )
+        Gia_OrchRef_rec( p, iFan1 );
+}
+static void Gia_OrchCollectCone_rec( Gia_OrchMan_t * p, int iObj )
+{
+    Gia_Obj_t * pObj;
+    if ( Gia_ObjIsTravIdCurrentId(p->p, iObj) )
+        return;
+    Gia_ObjSetTravIdCurrentId( p->p, iObj );
+    pObj = Gia_ManObj( p->p, iObj );
+    assert( Gia_ObjIsAnd(pObj) );
+    Gia_OrchCollectCone_rec( p, Gia_ObjFaninId0(pObj, iObj) );
+    Gia_OrchCollectCone_rec( p, Gia_ObjFaninId1(pObj, iObj) );
+    Vec_IntPush( p->vCone, iObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the truth tables of the window.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void Gia_OrchWinAdd( Gia_OrchMan_t * p, int iObj )
+{
+    Vec_IntWriteEntry( p->vSimMap, iObj, Vec_IntSize(p->vWin) );
+    Vec_IntPush( p->vWin, iObj );
+    Vec_WrdFillExtra( p->vSims, p->nWords * Vec_IntSize(p->vWin), 0 );
+}
+static inline void Gia_OrchSimulateNode( Gia_OrchMan_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->p, iObj );
+    Gia_OrchWinAdd( p, iObj );
+    Abc_TtAndCompl( Gia_OrchSim(p, iObj), Gia_OrchSim(p, Gia_ObjFaninId0(pObj, iObj)), Gia_ObjFaninC0(pObj),
+        Gia_OrchSim(p, Gia_ObjFaninId1(pObj, iObj)), Gia_ObjFaninC1(pObj), p->nWords );
+}
+static void Gia_OrchPrepare( Gia_OrchMan_t * p, int iObj, int nLeafMax )
+{
+    int i, iTemp;
+    // clean the previous window
+    Vec_IntForEachEntry( p->vWin, iTemp, i )
+        Vec_IntWriteEntry( p->vSimMap, iTemp, -1 );
+    Vec_IntClear( p->vWin );
+    // compute the cut and the MFFC
+    Gia_OrchFindCut( p, iObj, nLeafMax );
+    Gia_ManIncrementTravId( p->p );
+    Vec_IntForEachEntry( p->vLeaves, iTemp, i )
+        Gia_ObjSetTravIdCurrentId( p->p, iTemp );
+    Vec_IntClear( p->vMffc );
+    p->nStampMffc++;
+    Gia_OrchDeref_rec( p, iObj );
+    Gia_OrchRef_rec( p, iObj );
+    Vec_IntClear( p->vCone );
+    Gia_OrchCollectCone_rec( p, iObj );
+    // compute the truth tables
+    p->nWords = Abc_Truth6WordNum( nLeafMax );
+    Vec_IntForEachEntry( p->vLeaves, iTemp, i )
+    {
+        Gia_OrchWinAdd( p, iTemp );
+        Abc_TtIthVar( Gia_OrchSim(p, iTemp), i, nLeafMax );
+    }
+    Vec_IntForEachEntry( p->vCone, iTemp, i )
+        Gia_OrchSimulateNode( p, iTemp );
+    // collect the literals of the leaves
+    Vec_IntClear( p->vLits );
+    Vec_IntForEachEntry( p->vLeaves, iTemp, i )
+        Vec_IntPush( p->vLits, Gia_ManObj(p->p, iTemp)->Value );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the literal if the function is trivial.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_OrchTryTrivial( Gia_OrchMan_t * p, word * pTruth )
+{
+    int i, iLeaf;
+    if ( Abc_TtIsConst0(pTruth, p->nWords) )
+        return 0;
+    if ( Abc_TtIsConst1(pTruth, p->nWords) )
+        return 1;
+    Vec_IntForEachEntry( p->vLeaves, iLeaf, i )
+        if ( Abc_TtEqual(pTruth, Gia_OrchSim(p, iLeaf), p->nWords) )
+            return Vec_IntEntry( p->vLits, i );
+        else if ( Abc_TtOpposite(pTruth, Gia_OrchSim(p, iLeaf), p->nWords) )
+            return Abc_LitNot( Vec_IntEntry(p->vLits, i) );
+    return -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rewrites the node using the 4-input cut.]
+
+  Description [Returns the literal of the result in the new AIG or -1.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_OrchTryRwr( Gia_OrchMan_t * p, int iObj )
+{
+    word * pTruth;
+    int iLit;
+    Gia_OrchPrepare( p, iObj, 4 );
+    pTruth = Gia_OrchSim( p, iObj );
+    if ( (iLit = Gia_OrchTryTrivial(p, pTruth)) >= 0 )
+        return iLit;
+    while ( Vec_IntSize(p->vLits) < 4 )
+        Vec_IntPush( p->vLits, 0 );
+    iLit = Dar_LibEvalBuild( p->pNew, p->vLits, 0xFFFF & (unsigned)pTruth[0], p->fKeepLevel, p->vLeavesBest );
+    // the library structure implements the function up to complementation
+    return Abc_LitNotCond( iLit, Gia_ObjPhaseRealLit(p->pNew, iLit) ^ Gia_ManObj(p->p, iObj)->fPhase );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Refactors the node using the large cut.]
+
+  Description [Returns the literal of the result in the new AIG or -1.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_OrchBuildGraph( Gia_OrchMan_t * p, Kit_Graph_t * pGraph )
+{
+    Kit_Node_t * pNode = NULL;
+    int i, iLit0, iLit1;
+    if ( Kit_GraphIsConst(pGraph) )
+        return Abc_LitNotCond( 1, Kit_GraphIsComplement(pGraph) );
+    Kit_GraphForEachLeaf( pGraph, pNode, i )
+        pNode->iFunc = Vec_IntEntry( p->vLits, i );
+    if ( Kit_GraphIsVar(pGraph) )
+        return Abc_LitNotCond( Kit_GraphVar(pGraph)->iFunc, Kit_GraphIsComplement(pGraph) );
+    Kit_GraphForEachNode( pGraph, pNode, i )
+    {
+        iLit0 = Abc_LitNotCond( Kit_GraphNode(pGraph, pNode->eEdge0.Node)->iFunc, pNode->eEdge0.fCompl );
+        iLit1 = Abc_LitNotCond( Kit_GraphNode(pGraph, pNode->eEdge1.Node)->iFunc, pNode->eEdge1.fCompl );
+        pNode->iFunc = Gia_OrchHashAnd( p->pNew, iLit0, iLit1 );
+    }
+    return Abc_LitNotCond( pNode->iFunc, Kit_GraphIsComplement(pGraph) );
+}
+static int Gia_OrchTryRef( Gia_OrchMan_t * p, int iObj )
+{
+    Kit_Graph_t * pGraph = NULL, * pGraphTemp;
+    word * pTruth;
+    int fCompl, nVars, iLit;
+    Gia_OrchPrepare( p, iObj, p->nCutRef );
+    pTruth = Gia_OrchSim( p, iObj );
+    if ( (iLit = Gia_OrchTryTrivial(p, pTruth)) >= 0 )
+        return iLit;
+    // factor both phases and keep the smaller form
+    nVars = Vec_IntSize( p->vLeaves );
+    for ( fCompl = 0; fCompl < 2; fCompl++ )
+    {
+        Abc_TtCopy( p->pTemp, pTruth, p->nWords, fCompl );
+        if ( Kit_TruthIsop( (unsigned *)p->pTemp, nVars, p->vCover, 0 ) < 0 )
+            continue;
+        pGraphTemp = Kit_SopFactor( p->vCover, fCompl, nVars, p->vCover );
+        if ( pGraph == NULL || Kit_GraphNodeNum(pGraph) > Kit_GraphNodeNum(pGraphTemp) )
+            ABC_SWAP( Kit_Graph_t *, pGraph, pGraphTemp );
+        if ( pGraphTemp )
+            Kit_GraphFree( pGraphTemp );
+    }
+    if ( pGraph == NULL )
+        return -1;
+    iLit = Gia_OrchBuildGraph( p, pGraph );
+    Kit_GraphFree( pGraph );
+    return iLit;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Resubstitutes the node using the divisors of the window.]
+
+  Description [Returns the literal of the result in the new AIG or -1.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_OrchCollectDivs( Gia_OrchMan_t * p, int iObj )
+{
+    Gia_Obj_t * pFan;
+    int i, k, iDiv, iFan;
+    Vec_IntClear( p->vDivs );
+    Gia_ManIncrementTravId( p->p );
+    Vec_IntForEachEntry( p->vLeaves, iDiv, i )
+    {
+        Gia_ObjSetTravIdCurrentId( p->p, iDiv );
+        Vec_IntPush( p->vDivs, iDiv );
+    }
+    Vec_IntForEachEntry( p->vCone, iDiv, i )
+        if ( !Gia_OrchIsMffc(p, iDiv) )
+        {
+            Gia_ObjSetTravIdCurrentId( p->p, iDiv );
+            Vec_IntPush( p->vDivs, iDiv );
+        }
+    // add the nodes whose fanins are both divisors
+    Vec_IntForEachEntry( p->vDivs, iDiv, i )
+    {
+        if ( Vec_IntSize(p->vDivs) >= p->nDivsMax )
+            break;
+        if ( Gia_ObjFanoutNumId(p->p, iDiv) > GIA_ORCH_FANOUT_MAX )
+            continue;
+        Gia_ObjForEachFanoutStaticId( p->p, iDiv, iFan, k )
+        {
+            if ( iFan >= iObj || Gia_ObjIsTravIdCurrentId(p->p, iFan) )
+                continue;
+            pFan = Gia_ManObj( p->p, iFan );
+            if ( !Gia_ObjIsAnd(pFan) || Gia_OrchIsMffc(p, iFan) )
+                continue;
+            if ( !Gia_ObjIsTravIdCurrentId(p->p, Gia_ObjFaninId0(pFan, iFan)) || !Gia_ObjIsTravIdCurrentId(p->p, Gia_ObjFaninId1(pFan, iFan)) )
+                continue;
+            Gia_ObjSetTravIdCurrentId( p->p, iFan );
+            Vec_IntPush( p->vDivs, iFan );
+            Gia_OrchSimulateNode( p, iFan );
+            if ( Vec_IntSize(p->vDivs) >= p->nDivsMax )
+                break;
+        }
+    }
+}
+static inline int Gia_OrchResubLit( Gia_OrchMan_t * p, int iLit, int nDivs )
+{
+    int iVar = Abc_Lit2Var( iLit );
+    int iRes = iVar < nDivs ? Gia_ManObj(p->p, Vec_IntEntry(p->vDivs, iVar - 2))->Value : Vec_IntEntry(p->vGateLits, iVar - nDivs);
+    return Abc_LitNotCond( iRes, Abc_LitIsCompl(iLit) );
+}
+static int Gia_OrchTryRes( Gia_OrchMan_t * p, int iObj )
+{
+    word * pTruth;
+    int * pGates, nGates, i, iDiv, iLit, nLimit, nDivs;
+    Gia_OrchPrepare( p, iObj, p->nCutRes );
+    pTruth = Gia_OrchSim( p, iObj );
+    if ( (iLit = Gia_OrchTryTrivial(p, pTruth)) >= 0 )
+        return iLit;
+    // the result should have fewer gates than the MFFC
+    nLimit = Vec_IntSize(p->vMffc) - !p->fUseZeros;
+    if ( nLimit < 0 )
+        return -1;
+    Gia_OrchCollectDivs( p, iObj );
+    // the first two entries are the off-set and the on-set
+    pTruth = Gia_OrchSim( p, iObj );
+    Abc_TtCopy( p->pTemp, pTruth, p->nWords, 1 );
+    Vec_PtrClear( p->vDivTts );
+    Vec_PtrPush( p->vDivTts, p->pTemp );
+    Vec_PtrPush( p->vDivTts, pTruth );
+    Vec_IntForEachEntry( p->vDivs, iDiv, i )
+        Vec_PtrPush( p->vDivTts, Gia_OrchSim(p, iDiv) );
+    nDivs  = Vec_PtrSize( p->vDivTts );
+    nGates = Abc_ResubComputeFunction( Vec_PtrArray(p->vDivTts), nDivs, p->nWords, nLimit, p->nDivsMax, 0, 0, 0, 0, &pGates );
+    if ( nGates == 0 )
+        return -1;
+    iLit = pGates[nGates-1];
+    if ( iLit < 2 )
+        return iLit;
+    Vec_IntClear( p->vGateLits );
+    for ( i = 0; i + 1 < nGates; i += 2 )
+    {
+        assert( Abc_Lit2Var(pGates[i]) < Abc_Lit2Var(pGates[i+1]) );
+        Vec_IntPush( p->vGateLits, Gia_OrchHashAnd(p->pNew, Gia_OrchResubLit(p, pGates[i], nDivs), Gia_OrchResubLit(p, pGates[i+1], nDivs)) );
+    }
+    return Gia_OrchResubLit( p, iLit, nDivs );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the gain of using the literal as the copy of the node.]
+
+  Description [Collects the nodes of the new AIG needed by the literal.
+  Old nodes that are used are free (except the ones that implement the
+  MFFC, which are not saved), while new nodes (with IDs above nObjsStart)
+  and the nodes that are no longer used have to be paid for.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_OrchCollectUsed_rec( Gia_OrchMan_t * p, int iNode, int nObjsStart, int * pnReused, int * pnAdded )
+{
+    Gia_Obj_t * pNode = Gia_ManObj( p->pNew, iNode );
+    if ( !Gia_ObjIsAnd(pNode) || Gia_OrchIsUsed(p, iNode) )
+        return;
+    if ( Gia_OrchIsLit(p, iNode) )
+        (*pnReused)++;
+    else if ( iNode < nObjsStart && !Gia_OrchIsDead(p, iNode) )
+        return;
+    else
+        (*pnAdded)++;
+    Vec_IntPush( p->vVisited, iNode );
+    Vec_IntSetEntry( p->vMarkUsed, iNode, p->nStampNew );
+    Gia_OrchCollectUsed_rec( p, Gia_ObjFaninId0(pNode, iNode), nObjsStart, pnReused, pnAdded );
+    Gia_OrchCollectUsed_rec( p, Gia_ObjFaninId1(pNode, iNode), nObjsStart, pnReused, pnAdded );
+}
+static int Gia_OrchGain( Gia_OrchMan_t * p, int iLit, int nObjsStart )
+{
+    int i, iMffc, iNode, nReused = 0, nAdded = 0;
+    // the root (the first entry of the MFFC) does not have a copy yet;
+    // the copies of other MFFC nodes may be shared or already unused
+    Vec_IntClear( p->vMffcLits );
+    p->nStampNew++;
+    Vec_IntForEachEntryStart( p->vMffc, iMffc, i, 1 )
+    {
+        iNode = Abc_Lit2Var( Gia_ManObj(p->p, iMffc)->Value );
+        if ( Gia_ObjIsAnd(Gia_ManObj(p->pNew, iNode)) && !Gia_OrchIsDead(p, iNode) && !Gia_OrchIsLit(p, iNode) )
+        {
+            Vec_IntSetEntry( p->vMarkLits, iNode, p->nStampNew );
+            Vec_IntPush( p->vMffcLits, iNode );
+        }
+    }
+    Vec_IntClear( p->vVisited );
+    Gia_OrchCollectUsed_rec( p, Abc_Lit2Var(iLit), nObjsStart, &nReused, &nAdded );
+    return 1 + Vec_IntSize(p->vMffcLits) - nReused - nAdded;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one pass of orchestration.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_Man_t * Gia_ManOrchestrateOne( Gia_OrchMan_t * p )
+{
+    Gia_Man_t * pNew, * pTemp;
+    Gia_Obj_t * pObj;
+    int i, k, iMffc, iLit, iLitBest, Gain, GainBest, OpBest, Level, LevelBest, LevelMax, nObjsStart;
+    Gia_ManFillValue( p->p );
+    pNew = Gia_ManStart( Gia_ManObjNum(p->p) );
+    pNew->pName = Abc_UtilStrsav( p->p->pName );
+    pNew->pSpec = Abc_UtilStrsav( p->p->pSpec );
+    Gia_ManHashAlloc( pNew );
+    Gia_ManCleanLevels( pNew, Gia_ManObjNum(p->p) );
+    p->pNew = pNew;
+    Vec_StrClear( p->vDead );
+    Gia_ManConst0(p->p)->Value = 0;
+    Gia_ManForEachCi( p->p, pObj, i )
+        pObj->Value = Gia_ManAppendCi( pNew );
+    Gia_ManForEachAnd( p->p, pObj, i )
+    {
+        p->nNodesTried++;
+        nObjsStart = Gia_ManObjNum( pNew );
+        LevelMax = 1 + Abc_MaxInt( Gia_ObjLevelId(pNew, Abc_Lit2Var(Gia_ObjFanin0Copy(pObj))), Gia_ObjLevelId(pNew, Abc_Lit2Var(Gia_ObjFanin1Copy(pObj))) );
+        iLitBest = -1; GainBest = 0; OpBest = -1; LevelBest = 0;
+        for ( k = 0; k < GIA_ORCH_NUM; k++ )
+        {
+            if ( k == GIA_ORCH_RWR )
+                iLit = Gia_OrchTryRwr( p, i );
+            else if ( k == GIA_ORCH_RES )
+                iLit = Gia_OrchTryRes( p, i );
+            else
+                iLit = Gia_OrchTryRef( p, i );
+            if ( iLit < 0 )
+                continue;
+            Level = Gia_ObjLevelId( pNew, Abc_Lit2Var(iLit) );
+            if ( p->fKeepLevel && Level > LevelMax )
+                continue;
+            // the MFFC depends on the cut of the operator
+            Gain = Gia_OrchGain( p, iLit, nObjsStart );
+            if ( Gain < !p->fUseZeros )
+                continue;
+            if ( iLitBest == -1 || GainBest < Gain || (GainBest == Gain && LevelBest > Level) )
+                iLitBest = iLit, GainBest = Gain, OpBest = k, LevelBest = Level;
+        }
+        if ( iLitBest == -1 )
+        {
+            pObj->Value = Gia_OrchHashAnd( pNew, Gia_ObjFanin0Copy(pObj), Gia_ObjFanin1Copy(pObj) );
+            Vec_StrFillExtra( p->vDead, Gia_ManObjNum(pNew), 0 );
+            for ( k = nObjsStart; k < Gia_ManObjNum(pNew); k++ )
+                Vec_StrWriteEntry( p->vDead, k, (char)(k != Abc_Lit2Var(pObj->Value)) );
+            continue;
+        }
+        pObj->Value = iLitBest;
+        p->nChanges[OpBest]++;
+        p->nGains[OpBest] += GainBest;
+        // recompute the MFFC of the best operator and the nodes it uses
+        if ( OpBest == GIA_ORCH_RWR )
+            Gia_OrchPrepare( p, i, 4 );
+        else if ( OpBest == GIA_ORCH_RES )
+            Gia_OrchPrepare( p, i, p->nCutRes );
+        else
+            Gia_OrchPrepare( p, i, p->nCutRef );
+        Gia_OrchGain( p, iLitBest, nObjsStart );
+        // the new nodes and the MFFC nodes not used by the result are dead
+        Vec_StrFillExtra( p->vDead, Gia_ManObjNum(pNew), 0 );
+        for ( k = nObjsStart; k < Gia_ManObjNum(pNew); k++ )
+            Vec_StrWriteEntry( p->vDead, k, 1 );
+        Vec_IntForEachEntry( p->vMffcLits, iMffc, k )
+            Vec_StrWriteEntry( p->vDead, iMffc, 1 );
+        Vec_IntForEachEntry( p->vVisited, iMffc, k )
+            Vec_StrWriteEntry( p->vDead, iMffc, 0 );
+    }
+    Gia_ManForEachCo( p->p, pObj, i )
+        pObj->Value = Gia_ManAppendCo( pNew, Gia_ObjFanin0Copy(pObj) );
+    Gia_ManHashStop( pNew );
+    pNew = Gia_ManCleanup( pTemp = pNew );
+    Gia_ManStop( pTemp );
+    Gia_ManSetRegNum( pNew, Gia_ManRegNum(p->p) );
+    p->pNew = NULL;
+    return pNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs orchestration of rewriting, resubstitution and refactoring.]
+
+  Description [For each node, chooses the operator with the largest gain.
+  The cut size of rewriting is 4, the cut sizes of refactoring (nCutRef)
+  and resubstitution (nCutRes) are the parameters. If fKeepLevel is set,
+  the level of a node cannot increase. The passes are repeated while the
+  number of AND nodes decreases, up to nIters times.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManOrchestrate( Gia_Man_t * p, int nIters, int nCutRef, int nCutRes, int nDivsMax, int fKeepLevel, int fUseZeros, int fVerbose )
+{
+    Gia_OrchMan_t * pMan;
+    Gia_Man_t * pNew = Gia_ManDup( p ), * pTemp;
+    abctime clk = Abc_Clock();
+    int i, k, fImproved;
+    assert( nCutRef <= 16 && nCutRes <= 16 );
+    Dar_LibStart();
+    Dar_LibPrepare( 5 );
+    Abc_ResubPrepareManager( Abc_Truth6WordNum(nCutRes) );
+    for ( i = 0; i < nIters; i++ )
+    {
+        Gia_ManCreateRefs( pNew );
+        Gia_ManStaticFanoutStart( pNew );
+        Gia_ManLevelNum( pNew );
+        Gia_ManSetPhase( pNew );
+        pMan = Gia_OrchManStart( pNew, nCutRef, nCutRes, nDivsMax, fKeepLevel, fUseZeros );
+        pTemp = Gia_ManOrchestrateOne( pMan );
+        if ( fVerbose )
+        {
+            printf( "Pass %2d : AND = %8d -> %8d  Lev = %4d -> %4d   ", i+1,
+                Gia_ManAndNum(pNew), Gia_ManAndNum(pTemp), Gia_ManLevelNum(pNew), Gia_ManLevelNum(pTemp) );
+            for ( k = 0; k < GIA_ORCH_NUM; k++ )
+                printf( "%s = %6d (%6d)  ", k == GIA_ORCH_RWR ? "rw" : (k == GIA_ORCH_RES ? "rs" : "rf"), pMan->nChanges[k], pMan->nGains[k] );
+            printf( "\n" );
+        }
+        Gia_OrchManStop( pMan );
+        Gia_ManStaticFanoutStop( pNew );
+        ABC_FREE( pNew->pRefs );
+        if ( Gia_ManAndNum(pTemp) > Gia_ManAndNum(pNew) )
+        {
+            Gia_ManStop( pTemp );
+            break;
+        }
+        fImproved = Gia_ManAndNum(pTemp) < Gia_ManAndNum(pNew);
+        Gia_ManStop( pNew );
+        pNew = pTemp;
+        if ( !fImproved )
+            break;
+    }
+    Abc_ResubPrepareManager( 0 );
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    return pNew;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -21,7 +21,13 @@
 #include "gia.h"
 #include "misc/util/utilTruth.h"
 #include "misc/extra/extra.h"
-//#include <immintrin.h>
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(ABC_SIM_NO_SIMD)
+#define GIA_SIM_USE_SIMD
+#endif
+
+#ifdef GIA_SIM_USE_SIMD
+#include <immintrin.h>
+#endif
 #include "aig/miniaig/miniaig.h"
 
 ABC_NAMESPACE_IMPL_START
@@ -71,6 +77,219 @@ struct Gia_SimAbsMan_t_
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Word-parallel kernels of the pattern simulator.]
+
+  Description [The kernels below process 4 (AVX2) or 8 (AVX-512) words
+  per instruction. The instruction set is selected at runtime using CPUID,
+  so the binary does not require these extensions to be present. The scalar
+  code is used for short simulation vectors and on other platforms.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define GIA_SIM_ISA_SCALAR  1
+#define GIA_SIM_ISA_AVX2    2
+#define GIA_SIM_ISA_AVX512  3
+
+static int s_SimIsa = 0;  // the selected instruction set (0 = not detected yet)
+
+#ifdef GIA_SIM_USE_SIMD
+
+__attribute__((target("avx2"))) static void Gia_SimAndAvx2( word * pRes, word * p0, word * p1, word Diff0, word Diff1, int fXor, int nWords )
+{
+    __m256i m0 = _mm256_set1_epi64x( (long long)Diff0 );
+    __m256i m1 = _mm256_set1_epi64x( (long long)Diff1 );
+    int w, nVecs = nWords & ~3;
+    if ( fXor )
+        for ( w = 0; w < nVecs; w += 4 )
+            _mm256_storeu_si256( (__m256i *)(pRes + w), _mm256_xor_si256( 
+                _mm256_xor_si256(_mm256_loadu_si256((__m256i *)(p0 + w)), m0), 
+                _mm256_xor_si256(_mm256_loadu_si256((__m256i *)(p1 + w)), m1) ) );
+    else
+        for ( w = 0; w < nVecs; w += 4 )
+            _mm256_storeu_si256( (__m256i *)(pRes + w), _mm256_and_si256( 
+                _mm256_xor_si256(_mm256_loadu_si256((__m256i *)(p0 + w)), m0), 
+                _mm256_xor_si256(_mm256_loadu_si256((__m256i *)(p1 + w)), m1) ) );
+    for ( w = nVecs; w < nWords; w++ )
+        pRes[w] = fXor ? (p0[w] ^ Diff0) ^ (p1[w] ^ Diff1) : (p0[w] ^ Diff0) & (p1[w] ^ Diff1);
+}
+__attribute__((target("avx2"))) static void Gia_SimAndPairAvx2( word * pRes, word * pResN, word * p0, word * p1, int nWords )
+{
+    __m256i Ones = _mm256_set1_epi64x( -1 ), Res;
+    int w, nVecs = nWords & ~3;
+    for ( w = 0; w < nVecs; w += 4 )
+    {
+        Res = _mm256_and_si256( _mm256_loadu_si256((__m256i *)(p0 + w)), _mm256_loadu_si256((__m256i *)(p1 + w)) );
+        _mm256_storeu_si256( (__m256i *)(pRes  + w), Res );
+        _mm256_storeu_si256( (__m256i *)(pResN + w), _mm256_xor_si256(Res, Ones) );
+    }
+    for ( w = nVecs; w < nWords; w++ )
+        pResN[w] = ~(pRes[w] = p0[w] & p1[w]);
+}
+__attribute__((target("avx2"))) static void Gia_SimObsAvx2( word * pObs0, word * pObs1, word * pRes, word * p0, word * p1, word * pObs, word Diff0, word Diff1, int nWords )
+{
+    __m256i m0 = _mm256_set1_epi64x( (long long)Diff0 );
+    __m256i m1 = _mm256_set1_epi64x( (long long)Diff1 );
+    __m256i Res, Obs;
+    int w, nVecs = nWords & ~3;
+    for ( w = 0; w < nVecs; w += 4 )
+    {
+        Res = _mm256_loadu_si256( (__m256i *)(pRes + w) );
+        Obs = _mm256_loadu_si256( (__m256i *)(pObs + w) );
+        _mm256_storeu_si256( (__m256i *)(pObs0 + w), _mm256_or_si256( _mm256_loadu_si256((__m256i *)(pObs0 + w)), 
+            _mm256_and_si256( _mm256_or_si256(Res, _mm256_xor_si256(_mm256_loadu_si256((__m256i *)(p0 + w)), m0)), Obs ) ) );
+        _mm256_storeu_si256( (__m256i *)(pObs1 + w), _mm256_or_si256( _mm256_loadu_si256((__m256i *)(pObs1 + w)), 
+            _mm256_and_si256( _mm256_or_si256(Res, _mm256_xor_si256(_mm256_loadu_si256((__m256i *)(p1 + w)), m1)), Obs ) ) );
+    }
+    for ( w = nVecs; w < nWords; w++ )
+    {
+        pObs0[w] |= (pRes[w] | (p0[w] ^ Diff0)) & pObs[w];
+        pObs1[w] |= (pRes[w] | (p1[w] ^ Diff1)) & pObs[w];
+    }
+}
+
+__attribute__((target("avx512f"))) static void Gia_SimAndAvx512( word * pRes, word * p0, word * p1, word Diff0, word Diff1, int fXor, int nWords )
+{
+    __m512i m0 = _mm512_set1_epi64( (long long)Diff0 );
+    __m512i m1 = _mm512_set1_epi64( (long long)Diff1 );
+    int w, nVecs = nWords & ~7;
+    if ( fXor )
+        for ( w = 0; w < nVecs; w += 8 )
+            _mm512_storeu_si512( pRes + w, _mm512_xor_si512( 
+                _mm512_xor_si512(_mm512_loadu_si512(p0 + w), m0), 
+                _mm512_xor_si512(_mm512_loadu_si512(p1 + w), m1) ) );
+    else
+        for ( w = 0; w < nVecs; w += 8 )
+            _mm512_storeu_si512( pRes + w, _mm512_and_si512( 
+                _mm512_xor_si512(_mm512_loadu_si512(p0 + w), m0), 
+                _mm512_xor_si512(_mm512_loadu_si512(p1 + w), m1) ) );
+    for ( w = nVecs; w < nWords; w++ )
+        pRes[w] = fXor ? (p0[w] ^ Diff0) ^ (p1[w] ^ Diff1) : (p0[w] ^ Diff0) & (p1[w] ^ Diff1);
+}
+__attribute__((target("avx512f"))) static void Gia_SimAndPairAvx512( word * pRes, word * pResN, word * p0, word * p1, int nWords )
+{
+    __m512i Ones = _mm512_set1_epi64( -1 ), Res;
+    int w, nVecs = nWords & ~7;
+    for ( w = 0; w < nVecs; w += 8 )
+    {
+        Res = _mm512_and_si512( _mm512_loadu_si512(p0 + w), _mm512_loadu_si512(p1 + w) );
+        _mm512_storeu_si512( pRes  + w, Res );
+        _mm512_storeu_si512( pResN + w, _mm512_xor_si512(Res, Ones) );
+    }
+    for ( w = nVecs; w < nWords; w++ )
+        pResN[w] = ~(pRes[w] = p0[w] & p1[w]);
+}
+__attribute__((target("avx512f"))) static void Gia_SimObsAvx512( word * pObs0, word * pObs1, word * pRes, word * p0, word * p1, word * pObs, word Diff0, word Diff1, int nWords )
+{
+    __m512i m0 = _mm512_set1_epi64( (long long)Diff0 );
+    __m512i m1 = _mm512_set1_epi64( (long long)Diff1 );
+    __m512i Res, Obs;
+    int w, nVecs = nWords & ~7;
+    for ( w = 0; w < nVecs; w += 8 )
+    {
+        Res = _mm512_loadu_si512( pRes + w );
+        Obs = _mm512_loadu_si512( pObs + w );
+        _mm512_storeu_si512( pObs0 + w, _mm512_or_si512( _mm512_loadu_si512(pObs0 + w), 
+            _mm512_and_si512( _mm512_or_si512(Res, _mm512_xor_si512(_mm512_loadu_si512(p0 + w), m0)), Obs ) ) );
+        _mm512_storeu_si512( pObs1 + w, _mm512_or_si512( _mm512_loadu_si512(pObs1 + w), 
+            _mm512_and_si512( _mm512_or_si512(Res, _mm512_xor_si512(_mm512_loadu_si512(p1 + w), m1)), Obs ) ) );
+    }
+    for ( w = nVecs; w < nWords; w++ )
+    {
+        pObs0[w] |= (pRes[w] | (p0[w] ^ Diff0)) & pObs[w];
+        pObs1[w] |= (pRes[w] | (p1[w] ^ Diff1)) & pObs[w];
+    }
+}
+
+#endif
+
+static int Gia_ManSimPatDetectIsa()
+{
+#ifdef GIA_SIM_USE_SIMD
+    __builtin_cpu_init();
+    if ( __builtin_cpu_supports("avx512f") )
+        return GIA_SIM_ISA_AVX512;
+    if ( __builtin_cpu_supports("avx2") )
+        return GIA_SIM_ISA_AVX2;
+#endif
+    return GIA_SIM_ISA_SCALAR;
+}
+static inline int Gia_ManSimPatIsa()
+{
+    if ( s_SimIsa == 0 )
+        s_SimIsa = Gia_ManSimPatDetectIsa();
+    return s_SimIsa;
+}
+// returns 1 if the vector of the given length is processed by a SIMD kernel
+static inline int Gia_ManSimPatUseSimd( int nWords )
+{
+    return nWords >= 4 && Gia_ManSimPatIsa() != GIA_SIM_ISA_SCALAR;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the instruction set used by the simulator.]
+
+  Description [Isa is one of the following: 0 (the best available), 1 (scalar),
+  2 (AVX2), 3 (AVX-512). Returns the instruction set actually selected, which
+  may be lower than requested if the processor does not support it.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSimPatSetIsa( int Isa )
+{
+    int IsaBest = Gia_ManSimPatDetectIsa();
+    s_SimIsa = (Isa == 0 || Isa > IsaBest) ? IsaBest : Isa;
+    return s_SimIsa;
+}
+int Gia_ManSimPatGetIsa()
+{
+    return Gia_ManSimPatIsa();
+}
+char * Gia_ManSimPatIsaName( int Isa )
+{
+    if ( Isa == GIA_SIM_ISA_AVX512 )
+        return "AVX-512";
+    if ( Isa == GIA_SIM_ISA_AVX2 )
+        return "AVX2";
+    return "scalar";
+}
+
+static inline void Gia_ManSimPatAndWords( word * pRes, word * p0, word * p1, word Diff0, word Diff1, int fXor, int nWords )
+{
+#ifdef GIA_SIM_USE_SIMD
+    if ( s_SimIsa == GIA_SIM_ISA_AVX512 )
+        Gia_SimAndAvx512( pRes, p0, p1, Diff0, Diff1, fXor, nWords );
+    else
+        Gia_SimAndAvx2( pRes, p0, p1, Diff0, Diff1, fXor, nWords );
+#endif
+}
+static inline void Gia_ManSimPatAndPairWords( word * pRes, word * pResN, word * p0, word * p1, int nWords )
+{
+#ifdef GIA_SIM_USE_SIMD
+    if ( s_SimIsa == GIA_SIM_ISA_AVX512 )
+        Gia_SimAndPairAvx512( pRes, pResN, p0, p1, nWords );
+    else
+        Gia_SimAndPairAvx2( pRes, pResN, p0, p1, nWords );
+#endif
+}
+static inline void Gia_ManSimPatObsWords( word * pObs0, word * pObs1, word * pRes, word * p0, word * p1, word * pObs, word Diff0, word Diff1, int nWords )
+{
+#ifdef GIA_SIM_USE_SIMD
+    if ( s_SimIsa == GIA_SIM_ISA_AVX512 )
+        Gia_SimObsAvx512( pObs0, pObs1, pRes, p0, p1, pObs, Diff0, Diff1, nWords );
+    else
+        Gia_SimObsAvx2( pObs0, pObs1, pRes, p0, p1, pObs, Diff0, Diff1, nWords );
+#endif
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -99,7 +318,9 @@ static inline void Gia_ManSimPatSimAnd( Gia_Man_t * p, int i, Gia_Obj_t * pObj,
     word * pSims0 = pSims + nWords*Gia_ObjFaninId0(pObj, i);
     word * pSims1 = pSims + nWords*Gia_ObjFaninId1(pObj, i);
     word * pSims2 = pSims + nWords*i; int w;
-    if ( Gia_ObjIsXor(pObj) )
+    if ( Gia_ManSimPatUseSimd(nWords) )
+        Gia_ManSimPatAndWords( pSims2, pSims0, pSims1, Diff0, Diff1, Gia_ObjIsXor(pObj), nWords );
+    else if ( Gia_ObjIsXor(pObj) )
         for ( w = 0; w < nWords; w++ )
             pSims2[w] = (pSims0[w] ^ Diff0) ^ (pSims1[w] ^ Diff1);
     else
@@ -113,8 +334,11 @@ static inline void Gia_ManSimPatSimPo( Gia_Man_t * p, int i, Gia_Obj_t * pObj, i
     word * pSims   = Vec_WrdArray(vSims);
     word * pSims0  = pSims + nWords*Gia_ObjFaninId0(pObj, i);
     word * pSims2  = pSims + nWords*i; int w;
-    for ( w = 0; w < nWords; w++ )
-        pSims2[w]  = (pSims0[w] ^ Diff0);
+    if ( Gia_ManSimPatUseSimd(nWords) ) // AND of the fanin with itself
+        Gia_ManSimPatAndWords( pSims2, pSims0, pSims0, Diff0, Diff0, 0, nWords );
+    else
+        for ( w = 0; w < nWords; w++ )
+            pSims2[w]  = (pSims0[w] ^ Diff0);
 }
 static inline void Gia_ManSimPatSimNot( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
 {
@@ -135,6 +359,20 @@ Vec_Wrd_t * Gia_ManSimPatSim( Gia_Man_t * pGia )
         Gia_ManSimPatSimPo( pGia, Gia_ObjId(pGia, pObj), pObj, nWords, vSims );
     return vSims;
 }
+void Gia_ManSimPatSimObjs( Gia_Man_t * pGia, int * pObjs, int nObjs, int nWords, Vec_Wrd_t * vSims )
+{
+    Gia_Obj_t * pObj; int i;
+    assert( Vec_WrdSize(vSims) == nWords * Gia_ManObjNum(pGia) );
+    for ( i = 0; i < nObjs; i++ )
+    {
+        pObj = Gia_ManObj( pGia, pObjs[i] );
+        if ( Gia_ObjIsAnd(pObj) )
+            Gia_ManSimPatSimAnd( pGia, pObjs[i], pObj, nWords, vSims );
+        else if ( Gia_ObjIsCo(pObj) )
+            Gia_ManSimPatSimPo( pGia, pObjs[i], pObj, nWords, vSims );
+        else assert( 0 );
+    }
+}
 Vec_Wrd_t * Gia_ManSimPatSimOut( Gia_Man_t * pGia, Vec_Wrd_t * vSimsPi, int fOuts )
 {
     Gia_Obj_t * pObj;
@@ -171,6 +409,8 @@ static inline void Gia_ManSimPatSimAnd3( Gia_Man_t * p, int i, Gia_Obj_t * pObj,
             pSimsC0[w] |= pSimsC2[w];
             pSimsC1[w] |= pSimsC2[w];
         }
+    else if ( Gia_ManSimPatUseSimd(nWords) )
+        Gia_ManSimPatObsWords( pSimsC0, pSimsC1, pSims2, pSims0, pSims1, pSimsC2, Diff0, Diff1, nWords );
     else
         for ( w = 0; w < nWords; w++ )
         {
@@ -528,12 +768,16 @@ static inline void Gia_ManSimPatSimAnd2( Gia_Man_t * p, int i, Gia_Obj_t * pObj,
 //        for ( w = 0; w < nWords; w++ )
 //            pSims2[w] = pSims0[w] ^ pSims1[w];
 //    else
+    if ( Gia_ManSimPatUseSimd(nWords) )
+    {
+        Gia_ManSimPatAndPairWords( pSims2, pSims3, pSims0, pSims1, nWords );
+        return;
+    }
     for ( w = 0; w < nWords; w++ )
     {
         pSims2[w] = pSims0[w] & pSims1[w];
         pSims3[w] = ~pSims2[w];
     }
-    //_mm256_storeu_ps( (float *)pSims2, _mm256_and_ps(_mm256_loadu_ps((float *)pSims0), _mm256_loadu_ps((float *)pSims1)) );
 }
 static inline void Gia_ManSimPatSimPo2( Gia_Man_t * p, int i, Gia_Obj_t * pObj, int nWords, Vec_Wrd_t * vSims )
 {
@@ -3740,6 +3984,67 @@ void Gia_ManComparePrint( Gia_Man_t * p, Gia_Man_t * q )
     Vec_WrdFree( vSimsPi );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Measures the throughput of the pattern simulator.]
+
+  Description [Simulates nWords words of random patterns nRounds times
+  using each instruction set supported by the processor and prints the
+  number of pattern-node evaluations per second. Returns 1 if all kernels
+  produced the same simulation info.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSimPatBench( Gia_Man_t * p, int nWords, int nRounds, int fVerbose )
+{
+    Gia_Obj_t * pObj;
+    Vec_Wrd_t * vSimsPi = Vec_WrdStartRandom( Gia_ManCiNum(p) * nWords );
+    Vec_Wrd_t * vSims   = Vec_WrdStart( Gia_ManObjNum(p) * nWords );
+    Vec_Wrd_t * vGold   = NULL;
+    int IsaOld = Gia_ManSimPatGetIsa();
+    int IsaBest = Gia_ManSimPatSetIsa( 0 );
+    int Isa, i, r, fSame = 1;
+    double Work = 64.0 * nWords * nRounds * (Gia_ManAndNum(p) + Gia_ManCoNum(p));
+    double RateScalar = 0;
+    for ( Isa = GIA_SIM_ISA_SCALAR; Isa <= IsaBest; Isa++ )
+    {
+        abctime clk = Abc_Clock();
+        double Time, Rate;
+        Gia_ManSimPatSetIsa( Isa );
+        for ( r = 0; r < nRounds; r++ )
+        {
+            Gia_ManSimPatAssignInputs( p, nWords, vSims, vSimsPi );
+            Gia_ManForEachAnd( p, pObj, i ) 
+                Gia_ManSimPatSimAnd( p, i, pObj, nWords, vSims );
+            Gia_ManForEachCo( p, pObj, i )
+                Gia_ManSimPatSimPo( p, Gia_ObjId(p, pObj), pObj, nWords, vSims );
+        }
+        clk  = Abc_Clock() - clk;
+        Time = 1.0*clk/CLOCKS_PER_SEC;
+        Rate = Work / Abc_MaxDouble(Time, 1e-6);
+        if ( Isa == GIA_SIM_ISA_SCALAR )
+            RateScalar = Rate;
+        if ( vGold == NULL )
+            vGold = Vec_WrdDup( vSims );
+        else if ( !Vec_WrdEqual( vGold, vSims ) )
+            fSame = 0;
+        printf( "%-8s : %10.2f M pattern*node/sec  (speedup %5.2f)  ", Gia_ManSimPatIsaName(Isa), Rate / 1e6, Rate / RateScalar );
+        Abc_PrintTime( 1, "Time", clk );
+    }
+    if ( fVerbose )
+        printf( "Simulated %d patterns on %d nodes %d times.\n", 64*nWords, Gia_ManAndNum(p) + Gia_ManCoNum(p), nRounds );
+    if ( !fSame )
+        printf( "The results of the accelerated kernels differ from those of the scalar kernels.\n" );
+    Gia_ManSimPatSetIsa( IsaOld );
+    Vec_WrdFree( vSimsPi );
+    Vec_WrdFree( vSims );
+    Vec_WrdFree( vGold );
+    return fSame;
+}
+
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
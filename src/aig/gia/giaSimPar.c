@@ -0,0 +1,424 @@
+/**CFile****************************************************************
+
+  FileName    [giaSimPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Multi-threaded bit-parallel simulation.]
+
+  Author      [Berkeley Logic Synthesis and Verification Group]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "gia.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// Two ways of splitting the work are supported. By default, the range of
+// simulation words is split into slices and each thread simulates the whole
+// AIG for its slice in a private buffer, which it allocates and initializes
+// itself, so that the memory is local to the thread. When there are few
+// words and many nodes, the nodes of each level are split among the threads,
+// which wait for each other before proceeding to the next level. In both
+// cases, every word is computed by the same kernel as in the serial code,
+// so the results are identical to those of Gia_ManSimPatSimOut().
+
+#define GIA_SIM_THR_MAX  100
+#define GIA_SIM_ALIGN      8   // slice boundaries are multiples of this (words)
+
+typedef struct Gia_SimParBar_t_ Gia_SimParBar_t;
+typedef struct Gia_SimParThData_t_ Gia_SimParThData_t;
+
+#ifdef ABC_USE_PTHREADS
+struct Gia_SimParBar_t_
+{
+    pthread_mutex_t  Mutex;
+    pthread_cond_t   Cond;
+    int              nThreads;   // the number of threads waiting at the barrier
+    int              nWaiting;   // the number of threads currently waiting
+    int              iPhase;     // the number of times the barrier was passed
+};
+#endif
+
+struct Gia_SimParThData_t_
+{
+    Gia_Man_t *      p;          // the AIG
+    Vec_Int_t *      vObjs;      // the ANDs and COs in the order of simulation
+    Vec_Wrd_t *      vSimsPi;    // the input patterns
+    Vec_Wrd_t *      vSims;      // the resulting simulation info
+    int              nWords;     // the number of words in the resulting info
+    // splitting by words
+    int              iStart;     // the first word of the slice
+    int              nSlice;     // the number of words in the slice
+    // splitting by levels
+    Vec_Int_t *      vStarts;    // the beginning of each level in vObjs
+    Gia_SimParBar_t *pBar;       // the barrier
+    int              iThread;    // the thread number
+    int              nThreads;   // the number of threads
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the objects to be simulated.]
+
+  Description [If vStarts is given, the ANDs are ordered by level, followed
+  by the COs, and vStarts gets the first position of each group in vObjs,
+  followed by the total number of objects.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Int_t * Gia_SimParCollectObjs( Gia_Man_t * p, Vec_Int_t * vStarts )
+{
+    Vec_Int_t * vObjs = Vec_IntAlloc( Gia_ManAndNum(p) + Gia_ManCoNum(p) );
+    Vec_Int_t * vPlaces;
+    Gia_Obj_t * pObj; int i, Level, nLevels;
+    if ( vStarts == NULL )
+    {
+        Gia_ManForEachAnd( p, pObj, i )
+            Vec_IntPush( vObjs, i );
+        Gia_ManForEachCo( p, pObj, i )
+            Vec_IntPush( vObjs, Gia_ObjId(p, pObj) );
+        return vObjs;
+    }
+    // count the nodes on each level; the COs make up the last group
+    nLevels = Gia_ManLevelNum( p );
+    vPlaces = Vec_IntStart( nLevels + 2 );
+    Gia_ManForEachAnd( p, pObj, i )
+        Vec_IntAddToEntry( vPlaces, Gia_ObjLevelId(p, i), 1 );
+    Vec_IntAddToEntry( vPlaces, nLevels + 1, Gia_ManCoNum(p) );
+    // convert the counts into the starting positions
+    Vec_IntClear( vStarts );
+    Vec_IntPush( vStarts, 0 );
+    Vec_IntForEachEntry( vPlaces, Level, i )
+        Vec_IntPush( vStarts, Vec_IntEntryLast(vStarts) + Level );
+    Vec_IntForEachEntry( vStarts, Level, i )
+        if ( i < Vec_IntSize(vPlaces) )
+            Vec_IntWriteEntry( vPlaces, i, Level );
+    // place the objects
+    Vec_IntFill( vObjs, Vec_IntEntryLast(vStarts), -1 );
+    Gia_ManForEachAnd( p, pObj, i )
+        Vec_IntWriteEntry( vObjs, Vec_IntAddToEntry(vPlaces, Gia_ObjLevelId(p, i), 1) - 1, i );
+    Gia_ManForEachCo( p, pObj, i )
+        Vec_IntWriteEntry( vObjs, Vec_IntAddToEntry(vPlaces, nLevels + 1, 1) - 1, Gia_ObjId(p, pObj) );
+    Vec_IntFree( vPlaces );
+    return vObjs;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates one slice of words in a private buffer.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_SimParSimulateSlice( Gia_SimParThData_t * pThData )
+{
+    Gia_Man_t * p = pThData->p;
+    int i, Id, nWords = pThData->nWords, nSlice = pThData->nSlice, iStart = pThData->iStart;
+    // the buffer is allocated and zeroed by this thread
+    Vec_Wrd_t * vLocal = Vec_WrdStart( Gia_ManObjNum(p) * nSlice );
+    Gia_ManForEachCiId( p, Id, i )
+        memcpy( Vec_WrdEntryP(vLocal, Id*nSlice), Vec_WrdEntryP(pThData->vSimsPi, i*nWords + iStart), sizeof(word)*nSlice );
+    Gia_ManSimPatSimObjs( p, Vec_IntArray(pThData->vObjs), Vec_IntSize(pThData->vObjs), nSlice, vLocal );
+    for ( i = 1; i < Gia_ManObjNum(p); i++ )
+        memcpy( Vec_WrdEntryP(pThData->vSims, i*nWords + iStart), Vec_WrdEntryP(vLocal, i*nSlice), sizeof(word)*nSlice );
+    Vec_WrdFree( vLocal );
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Barrier used to separate the levels.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_SimParBarStart( Gia_SimParBar_t * p, int nThreads )
+{
+    pthread_mutex_init( &p->Mutex, NULL );
+    pthread_cond_init( &p->Cond, NULL );
+    p->nThreads = nThreads;
+    p->nWaiting = 0;
+    p->iPhase   = 0;
+}
+static void Gia_SimParBarStop( Gia_SimParBar_t * p )
+{
+    pthread_mutex_destroy( &p->Mutex );
+    pthread_cond_destroy( &p->Cond );
+}
+static void Gia_SimParBarWait( Gia_SimParBar_t * p )
+{
+    int iPhase;
+    pthread_mutex_lock( &p->Mutex );
+    iPhase = p->iPhase;
+    if ( ++p->nWaiting == p->nThreads )
+    {
+        p->nWaiting = 0;
+        p->iPhase++;
+        pthread_cond_broadcast( &p->Cond );
+    }
+    else
+    {
+        while ( iPhase == p->iPhase )
+            pthread_cond_wait( &p->Cond, &p->Mutex );
+    }
+    pthread_mutex_unlock( &p->Mutex );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates a part of each level.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_SimParSimulateLevels( Gia_SimParThData_t * pThData )
+{
+    int * pObjs = Vec_IntArray( pThData->vObjs );
+    int i, nThreads = pThData->nThreads, iThread = pThData->iThread;
+    for ( i = 0; i + 1 < Vec_IntSize(pThData->vStarts); i++ )
+    {
+        int iBeg = Vec_IntEntry( pThData->vStarts, i );
+        int nObjs = Vec_IntEntry( pThData->vStarts, i+1 ) - iBeg;
+        int iFirst = iBeg + (int)((long)nObjs * iThread / nThreads);
+        int iLast  = iBeg + (int)((long)nObjs * (iThread+1) / nThreads);
+        if ( nObjs == 0 )
+            continue;
+        Gia_ManSimPatSimObjs( pThData->p, pObjs + iFirst, iLast - iFirst, pThData->nWords, pThData->vSims );
+        Gia_SimParBarWait( pThData->pBar );
+    }
+}
+static void * Gia_SimParWorkerThread( void * pArg )
+{
+    Gia_SimParThData_t * pThData = (Gia_SimParThData_t *)pArg;
+    if ( pThData->pBar )
+        Gia_SimParSimulateLevels( pThData );
+    else
+        Gia_SimParSimulateSlice( pThData );
+    return NULL;
+}
+static void Gia_SimParRun( Gia_SimParThData_t * pData, int nThreads, int fLevels )
+{
+    pthread_t WorkerThread[GIA_SIM_THR_MAX];
+    Gia_SimParBar_t Bar;
+    int i, status;
+    if ( fLevels )
+        Gia_SimParBarStart( &Bar, nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pData[i].pBar = fLevels ? &Bar : NULL;
+        status = pthread_create( WorkerThread + i, NULL, Gia_SimParWorkerThread, (void *)(pData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nThreads; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    if ( fLevels )
+        Gia_SimParBarStop( &Bar );
+}
+
+#endif // pthreads are used
+
+/**Function*************************************************************
+
+  Synopsis    [Performs multi-threaded simulation.]
+
+  Description [Returns the simulation info of all objects in the same
+  format as Gia_ManSimPatSimOut( p, vSimsPi, 0 ). If fLevels is 1, the
+  nodes of each level are split among the threads; otherwise, the words
+  are split. Without pthreads, the simulation is serial.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wrd_t * Gia_ManSimPatSimPar( Gia_Man_t * p, Vec_Wrd_t * vSimsPi, int nThreads, int fLevels, int fVerbose )
+{
+    Gia_SimParThData_t ThData[GIA_SIM_THR_MAX];
+    Vec_Int_t * vStarts = fLevels ? Vec_IntAlloc( 100 ) : NULL;
+    Vec_Int_t * vObjs;
+    Vec_Wrd_t * vSims;
+    int i, Id, nWords = Vec_WrdSize(vSimsPi) / Gia_ManCiNum(p);
+    abctime clk = Abc_Clock();
+    assert( Vec_WrdSize(vSimsPi) == nWords * Gia_ManCiNum(p) );
+    nThreads = Abc_MinInt( Abc_MaxInt(nThreads, 1), GIA_SIM_THR_MAX );
+#ifndef ABC_USE_PTHREADS
+    fLevels = 0;
+#endif
+    if ( !fLevels ) // each thread gets at least GIA_SIM_ALIGN words
+        nThreads = Abc_MinInt( nThreads, Abc_MaxInt(1, nWords / GIA_SIM_ALIGN) );
+    if ( nThreads == 1 )
+    {
+        Vec_IntFreeP( &vStarts );
+        return Gia_ManSimPatSimOut( p, vSimsPi, 0 );
+    }
+    Gia_ManSimPatGetIsa(); // detect the instruction set before starting the threads
+    vObjs = Gia_SimParCollectObjs( p, vStarts );
+    vSims = Vec_WrdStart( Gia_ManObjNum(p) * nWords );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        memset( ThData + i, 0, sizeof(Gia_SimParThData_t) );
+        ThData[i].p        = p;
+        ThData[i].vObjs    = vObjs;
+        ThData[i].vSimsPi  = vSimsPi;
+        ThData[i].vSims    = vSims;
+        ThData[i].nWords   = nWords;
+        ThData[i].vStarts  = vStarts;
+        ThData[i].iThread  = i;
+        ThData[i].nThreads = nThreads;
+    }
+    if ( fLevels )
+        Gia_ManForEachCiId( p, Id, i )
+            memcpy( Vec_WrdEntryP(vSims, Id*nWords), Vec_WrdEntryP(vSimsPi, i*nWords), sizeof(word)*nWords );
+    else
+    {
+        // split the words into slices whose boundaries are aligned
+        int nChunks = nWords / GIA_SIM_ALIGN;
+        for ( i = 0; i < nThreads; i++ )
+        {
+            int iStart = GIA_SIM_ALIGN * (int)((long)nChunks * i / nThreads);
+            int iStop  = i == nThreads-1 ? nWords : GIA_SIM_ALIGN * (int)((long)nChunks * (i+1) / nThreads);
+            ThData[i].iStart = iStart;
+            ThData[i].nSlice = iStop - iStart;
+        }
+    }
+#ifdef ABC_USE_PTHREADS
+    Gia_SimParRun( ThData, nThreads, fLevels );
+#else
+    for ( i = 0; i < nThreads; i++ )
+        Gia_SimParSimulateSlice( ThData + i );
+#endif
+    if ( fVerbose )
+    {
+        printf( "Simulated %d patterns on %d nodes using %d threads split by %s",
+            64*nWords, Vec_IntSize(vObjs), nThreads, fLevels ? "levels" : "words" );
+        if ( fLevels )
+            printf( " (%d levels)", Vec_IntSize(vStarts) - 1 );
+        printf( ".  " );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Vec_IntFree( vObjs );
+    Vec_IntFreeP( &vStarts );
+    return vSims;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Multi-threaded version of Gia_ManSimulateWordsInit().]
+
+  Description [Fills in the built-in simulation info (vSims, nSimWords).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSimulateWordsInitPar( Gia_Man_t * p, Vec_Wrd_t * vSimsIn, int nThreads )
+{
+    int nWords = Vec_WrdSize(vSimsIn) / Gia_ManCiNum(p);
+    assert( Vec_WrdSize(vSimsIn) == nWords * Gia_ManCiNum(p) );
+    Vec_WrdFreeP( &p->vSims );
+    p->vSims = Gia_ManSimPatSimPar( p, vSimsIn, nThreads, 0, 0 );
+    p->nSimWords = nWords;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Measures the throughput of the multi-threaded simulator.]
+
+  Description [Returns 1 if the results are identical to serial simulation.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSimPatBenchPar( Gia_Man_t * p, int nWords, int nRounds, int nThreads, int fLevels, int fVerbose )
+{
+    Vec_Wrd_t * vSimsPi = Vec_WrdStartRandom( Gia_ManCiNum(p) * nWords );
+    Vec_Wrd_t * vGold, * vSims = NULL;
+    double Work = 64.0 * nWords * nRounds * (Gia_ManAndNum(p) + Gia_ManCoNum(p));
+    double RateSerial, Rate;
+    abctime clk;
+    int r, fSame;
+    clk = Abc_Clock();
+    for ( r = 0; r < nRounds; r++ )
+    {
+        Vec_WrdFreeP( &vSims );
+        vSims = Gia_ManSimPatSimOut( p, vSimsPi, 0 );
+    }
+    clk = Abc_Clock() - clk;
+    RateSerial = Work / Abc_MaxDouble(1.0*clk/CLOCKS_PER_SEC, 1e-6);
+    printf( "Serial   : %10.2f M pattern*node/sec                 ", RateSerial / 1e6 );
+    Abc_PrintTime( 1, "Time", clk );
+    vGold = vSims; vSims = NULL;
+    clk = Abc_Clock();
+    for ( r = 0; r < nRounds; r++ )
+    {
+        Vec_WrdFreeP( &vSims );
+        vSims = Gia_ManSimPatSimPar( p, vSimsPi, nThreads, fLevels, fVerbose && r == 0 );
+    }
+    clk = Abc_Clock() - clk;
+    Rate = Work / Abc_MaxDouble(1.0*clk/CLOCKS_PER_SEC, 1e-6);
+    printf( "Threads %-2d: %8.2f M pattern*node/sec  (speedup %5.2f)  ", nThreads, Rate / 1e6, Rate / RateSerial );
+    Abc_PrintTime( 1, "Time", clk );
+    fSame = Vec_WrdEqual( vGold, vSims );
+    if ( !fSame )
+        printf( "The results of multi-threaded simulation differ from those of serial simulation.\n" );
+    Vec_WrdFree( vSimsPi );
+    Vec_WrdFree( vSims );
+    Vec_WrdFree( vGold );
+    return fSame;
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
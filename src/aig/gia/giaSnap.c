@@ -0,0 +1,643 @@
+/**CFile****************************************************************
+
+  FileName    [giaSnap.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Binary snapshots of the AIG with its attributes.]
+
+  Author      [Berkeley Logic Synthesis and Verification Group]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "gia.h"
+#include "misc/tim/tim.h"
+
+#include <stddef.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The snapshot is the memory image of the manager arrays, stored in the
+// native byte order. The file starts with a header and a table of sections,
+// each given by its tag, offset, and size. The section payloads are aligned
+// to 8 bytes, so that they can be copied directly from the mapped file.
+// Readers skip the sections they do not know; the scalar section may grow
+// at the end. The version changes only when the layout of an existing
+// section changes.
+
+#define GIA_SNAP_VERSION    1
+#define GIA_SNAP_ORDER      0x01020304
+#define GIA_SNAP_TAG(a,b,c,d) ((unsigned)(a) | ((unsigned)(b) << 8) | ((unsigned)(c) << 16) | ((unsigned)(d) << 24))
+
+typedef struct Gia_SnapHead_t_ Gia_SnapHead_t;
+struct Gia_SnapHead_t_
+{
+    char           Magic[8];      // "GIASNAP"
+    unsigned       Version;       // format version
+    unsigned       Order;         // byte order mark
+    unsigned       ObjSize;       // the size of Gia_Obj_t
+    unsigned       nSections;     // the number of sections
+};
+
+typedef struct Gia_SnapSec_t_ Gia_SnapSec_t;
+struct Gia_SnapSec_t_
+{
+    unsigned       Tag;           // section tag
+    unsigned       Reserved;      // unused
+    word           Offset;        // offset from the beginning of the file
+    word           Size;          // size in bytes
+};
+
+// integer arrays stored as they are
+typedef struct Gia_SnapVec_t_ Gia_SnapVec_t;
+struct Gia_SnapVec_t_
+{
+    unsigned       Tag;           // section tag
+    int            Offset;        // offset of the vector pointer in Gia_Man_t
+    int            fFloat;        // the vector is Vec_Flt_t
+};
+
+#define GIA_SNAP_VEC(a,b,c,d,Field,fFloat) { GIA_SNAP_TAG(a,b,c,d), (int)offsetof(Gia_Man_t, Field), fFloat }
+
+static Gia_SnapVec_t s_SnapVecs[] = {
+    GIA_SNAP_VEC( 'C','I','S',' ', vCis,         0 ),
+    GIA_SNAP_VEC( 'C','O','S',' ', vCos,         0 ),
+    GIA_SNAP_VEC( 'M','A','P','P', vMapping,     0 ),
+    GIA_SNAP_VEC( 'C','M','A','P', vCellMapping, 0 ),
+    GIA_SNAP_VEC( 'P','A','C','K', vPacking,     0 ),
+    GIA_SNAP_VEC( 'C','O','N','F', vConfigs,     0 ),
+    GIA_SNAP_VEC( 'L','U','T','C', vLutConfigs,  0 ),
+    GIA_SNAP_VEC( 'E','D','L','Y', vEdgeDelay,   0 ),
+    GIA_SNAP_VEC( 'E','D','L','R', vEdgeDelayR,  0 ),
+    GIA_SNAP_VEC( 'E','D','G','1', vEdge1,       0 ),
+    GIA_SNAP_VEC( 'E','D','G','2', vEdge2,       0 ),
+    GIA_SNAP_VEC( 'F','C','L','S', vFlopClasses, 0 ),
+    GIA_SNAP_VEC( 'G','C','L','S', vGateClasses, 0 ),
+    GIA_SNAP_VEC( 'O','C','L','S', vObjClasses,  0 ),
+    GIA_SNAP_VEC( 'I','C','L','S', vInitClasses, 0 ),
+    GIA_SNAP_VEC( 'R','C','L','S', vRegClasses,  0 ),
+    GIA_SNAP_VEC( 'R','I','N','I', vRegInits,    0 ),
+    GIA_SNAP_VEC( 'D','O','M','S', vDoms,        0 ),
+    GIA_SNAP_VEC( 'B','A','R','B', vBarBufs,     0 ),
+    GIA_SNAP_VEC( 'U','P','I','D', vUserPiIds,   0 ),
+    GIA_SNAP_VEC( 'U','P','O','D', vUserPoIds,   0 ),
+    GIA_SNAP_VEC( 'U','F','F','D', vUserFfIds,   0 ),
+    GIA_SNAP_VEC( 'I','D','O','R', vIdsOrig,     0 ),
+    GIA_SNAP_VEC( 'I','D','E','Q', vIdsEquiv,    0 ),
+    GIA_SNAP_VEC( 'C','O','F','V', vCofVars,     0 ),
+    GIA_SNAP_VEC( 'C','I','A','R', vCiArrs,      0 ),
+    GIA_SNAP_VEC( 'C','O','R','Q', vCoReqs,      0 ),
+    GIA_SNAP_VEC( 'C','O','A','R', vCoArrs,      0 ),
+    GIA_SNAP_VEC( 'C','O','A','T', vCoAttrs,     0 ),
+    GIA_SNAP_VEC( 'W','G','H','T', vWeights,     0 ),
+    GIA_SNAP_VEC( 'S','W','V','C', vSwitching,   0 ),
+    GIA_SNAP_VEC( 'I','N','A','R', vInArrs,      1 ),
+    GIA_SNAP_VEC( 'O','U','R','Q', vOutReqs,     1 ),
+    GIA_SNAP_VEC( 'T','I','M','G', vTiming,      1 ),
+};
+
+// arrays with one entry per object
+#define GIA_SNAP_OBJS  GIA_SNAP_TAG('O','B','J','S')
+#define GIA_SNAP_MUXS  GIA_SNAP_TAG('M','U','X','S')
+#define GIA_SNAP_REPR  GIA_SNAP_TAG('R','E','P','R')
+#define GIA_SNAP_NEXT  GIA_SNAP_TAG('N','E','X','T')
+#define GIA_SNAP_SIBL  GIA_SNAP_TAG('S','I','B','L')
+#define GIA_SNAP_SWIT  GIA_SNAP_TAG('S','W','I','T')
+#define GIA_SNAP_PLAC  GIA_SNAP_TAG('P','L','A','C')
+// other sections
+#define GIA_SNAP_SCAL  GIA_SNAP_TAG('S','C','A','L')
+#define GIA_SNAP_NAME  GIA_SNAP_TAG('N','A','M','E')
+#define GIA_SNAP_SPEC  GIA_SNAP_TAG('S','P','E','C')
+#define GIA_SNAP_CSTR  GIA_SNAP_TAG('C','S','T','R')
+#define GIA_SNAP_NMIN  GIA_SNAP_TAG('N','M','I','N')
+#define GIA_SNAP_NMOU  GIA_SNAP_TAG('N','M','O','U')
+#define GIA_SNAP_NMND  GIA_SNAP_TAG('N','M','N','D')
+#define GIA_SNAP_TMAN  GIA_SNAP_TAG('T','M','A','N')
+#define GIA_SNAP_AIGX  GIA_SNAP_TAG('A','I','G','X')
+#define GIA_SNAP_CEXS  GIA_SNAP_TAG('C','E','X','S')
+#define GIA_SNAP_CEXC  GIA_SNAP_TAG('C','E','X','C')
+
+// the section list collected before writing
+typedef struct Gia_SnapOut_t_ Gia_SnapOut_t;
+struct Gia_SnapOut_t_
+{
+    Vec_Int_t *    vTags;         // section tags
+    Vec_Ptr_t *    vData;         // section data
+    Vec_Wrd_t *    vSizes;        // section sizes
+    Vec_Ptr_t *    vTemp;         // temporary buffers (Vec_Str_t)
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Collecting sections for writing.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_SnapAdd( Gia_SnapOut_t * p, unsigned Tag, void * pData, word Size )
+{
+    if ( pData == NULL )
+        return;
+    Vec_IntPush( p->vTags, (int)Tag );
+    Vec_PtrPush( p->vData, pData );
+    Vec_WrdPush( p->vSizes, Size );
+}
+static void Gia_SnapAddStr( Gia_SnapOut_t * p, unsigned Tag, Vec_Str_t * vStr )
+{
+    if ( vStr == NULL )
+        return;
+    Vec_PtrPush( p->vTemp, vStr );
+    Gia_SnapAdd( p, Tag, Vec_StrArray(vStr), (word)Vec_StrSize(vStr) );
+}
+static void Gia_SnapAddString( Gia_SnapOut_t * p, unsigned Tag, char * pStr )
+{
+    if ( pStr )
+        Gia_SnapAdd( p, Tag, pStr, (word)strlen(pStr) + 1 );
+}
+// each name is preceded by a byte telling whether it is present
+static Vec_Str_t * Gia_SnapNames( Vec_Ptr_t * vNames )
+{
+    Vec_Str_t * vStr;
+    char * pName; int i;
+    if ( vNames == NULL )
+        return NULL;
+    vStr = Vec_StrAlloc( 16 * Vec_PtrSize(vNames) + 16 );
+    Vec_PtrForEachEntry( char *, vNames, pName, i )
+    {
+        Vec_StrPush( vStr, (char)(pName != NULL) );
+        if ( pName )
+            Vec_StrPrintStr( vStr, pName );
+        Vec_StrPush( vStr, '\0' );
+    }
+    return vStr;
+}
+static Vec_Str_t * Gia_SnapCex( Abc_Cex_t * pCex )
+{
+    Vec_Str_t * vStr;
+    int nBytes;
+    if ( pCex == NULL )
+        return NULL;
+    nBytes = sizeof(Abc_Cex_t) + sizeof(unsigned) * Abc_BitWordNum(pCex->nBits);
+    vStr = Vec_StrStart( nBytes );
+    memcpy( Vec_StrArray(vStr), pCex, (size_t)nBytes );
+    return vStr;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the snapshot of the AIG into a file.]
+
+  Description [Returns 1 on success.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSnapWrite( Gia_Man_t * p, char * pFileName )
+{
+    Gia_SnapOut_t Out, * pOut = &Out;
+    Gia_SnapHead_t Head;
+    Gia_SnapSec_t * pSecs;
+    Vec_Str_t * vStr;
+    FILE * pFile;
+    char Zeros[8] = {0};
+    int Scalars[12], i, nObjs = Gia_ManObjNum(p), fError = 0;
+    word Offset;
+
+    pFile = fopen( pFileName, "wb" );
+    if ( pFile == NULL )
+    {
+        printf( "Gia_ManSnapWrite(): Cannot open the output file \"%s\".\n", pFileName );
+        return 0;
+    }
+    pOut->vTags  = Vec_IntAlloc( 64 );
+    pOut->vData  = Vec_PtrAlloc( 64 );
+    pOut->vSizes = Vec_WrdAlloc( 64 );
+    pOut->vTemp  = Vec_PtrAlloc( 16 );
+
+    // scalars
+    Scalars[0]  = p->nRegs;
+    Scalars[1]  = p->nConstrs;
+    Scalars[2]  = p->nXors;
+    Scalars[3]  = p->nMuxes;
+    Scalars[4]  = p->nBufs;
+    Scalars[5]  = p->fGiaSimple;
+    Scalars[6]  = p->And2Delay;
+    Scalars[7]  = p->nAnd2Delay;
+    Scalars[8]  = p->MappedArea;
+    Scalars[9]  = p->MappedDelay;
+    memcpy( Scalars + 10, &p->DefInArrs,  sizeof(float) );
+    memcpy( Scalars + 11, &p->DefOutReqs, sizeof(float) );
+    Gia_SnapAdd( pOut, GIA_SNAP_SCAL, Scalars, sizeof(Scalars) );
+
+    // per-object arrays
+    Gia_SnapAdd( pOut, GIA_SNAP_OBJS, p->pObjs,      (word)sizeof(Gia_Obj_t) * nObjs );
+    Gia_SnapAdd( pOut, GIA_SNAP_MUXS, p->pMuxes,     (word)sizeof(unsigned)  * nObjs );
+    Gia_SnapAdd( pOut, GIA_SNAP_REPR, p->pReprs,     (word)sizeof(Gia_Rpr_t) * nObjs );
+    Gia_SnapAdd( pOut, GIA_SNAP_NEXT, p->pNexts,     (word)sizeof(int)       * nObjs );
+    Gia_SnapAdd( pOut, GIA_SNAP_SIBL, p->pSibls,     (word)sizeof(int)       * nObjs );
+    Gia_SnapAdd( pOut, GIA_SNAP_SWIT, p->pSwitching, (word)sizeof(char)      * nObjs );
+    Gia_SnapAdd( pOut, GIA_SNAP_PLAC, p->pPlacement, (word)sizeof(Gia_Plc_t) * nObjs );
+
+    // vectors
+    for ( i = 0; i < (int)(sizeof(s_SnapVecs) / sizeof(s_SnapVecs[0])); i++ )
+    {
+        void * pVec = *(void **)((char *)p + s_SnapVecs[i].Offset);
+        if ( pVec == NULL )
+            continue;
+        if ( s_SnapVecs[i].fFloat )
+            Gia_SnapAdd( pOut, s_SnapVecs[i].Tag, Vec_FltArray((Vec_Flt_t *)pVec), (word)sizeof(float) * Vec_FltSize((Vec_Flt_t *)pVec) );
+        else
+            Gia_SnapAdd( pOut, s_SnapVecs[i].Tag, Vec_IntArray((Vec_Int_t *)pVec), (word)sizeof(int) * Vec_IntSize((Vec_Int_t *)pVec) );
+    }
+
+    // strings and names
+    Gia_SnapAddString( pOut, GIA_SNAP_NAME, p->pName );
+    Gia_SnapAddString( pOut, GIA_SNAP_SPEC, p->pSpec );
+    Gia_SnapAddString( pOut, GIA_SNAP_CSTR, p->pCellStr );
+    Gia_SnapAddStr( pOut, GIA_SNAP_NMIN, Gia_SnapNames(p->vNamesIn) );
+    Gia_SnapAddStr( pOut, GIA_SNAP_NMOU, Gia_SnapNames(p->vNamesOut) );
+    Gia_SnapAddStr( pOut, GIA_SNAP_NMND, Gia_SnapNames(p->vNamesNode) );
+
+    // other attributes
+    if ( p->pManTime )
+        Gia_SnapAddStr( pOut, GIA_SNAP_TMAN, Tim_ManSave( (Tim_Man_t *)p->pManTime, 1 ) );
+    if ( p->pAigExtra )
+        Gia_SnapAddStr( pOut, GIA_SNAP_AIGX, Gia_AigerWriteIntoMemoryStr( p->pAigExtra ) );
+    Gia_SnapAddStr( pOut, GIA_SNAP_CEXS, Gia_SnapCex(p->pCexSeq) );
+    Gia_SnapAddStr( pOut, GIA_SNAP_CEXC, Gia_SnapCex(p->pCexComb) );
+
+    // create the header and the section table
+    memset( &Head, 0, sizeof(Gia_SnapHead_t) );
+    strcpy( Head.Magic, "GIASNAP" );
+    Head.Version   = GIA_SNAP_VERSION;
+    Head.Order     = GIA_SNAP_ORDER;
+    Head.ObjSize   = sizeof(Gia_Obj_t);
+    Head.nSections = Vec_IntSize(pOut->vTags);
+    pSecs  = ABC_CALLOC( Gia_SnapSec_t, Head.nSections );
+    Offset = sizeof(Gia_SnapHead_t) + sizeof(Gia_SnapSec_t) * Head.nSections;
+    for ( i = 0; i < (int)Head.nSections; i++ )
+    {
+        Offset = (Offset + 7) & ~(word)7;
+        pSecs[i].Tag    = (unsigned)Vec_IntEntry( pOut->vTags, i );
+        pSecs[i].Offset = Offset;
+        pSecs[i].Size   = Vec_WrdEntry( pOut->vSizes, i );
+        Offset += pSecs[i].Size;
+    }
+
+    // write the file
+    fError |= (fwrite( &Head, sizeof(Gia_SnapHead_t), 1, pFile ) != 1);
+    fError |= (fwrite( pSecs, sizeof(Gia_SnapSec_t), Head.nSections, pFile ) != Head.nSections);
+    Offset = sizeof(Gia_SnapHead_t) + sizeof(Gia_SnapSec_t) * Head.nSections;
+    for ( i = 0; i < (int)Head.nSections && !fError; i++ )
+    {
+        if ( Offset < pSecs[i].Offset )
+            fError |= (fwrite( Zeros, 1, (size_t)(pSecs[i].Offset - Offset), pFile ) != (size_t)(pSecs[i].Offset - Offset));
+        fError |= (fwrite( Vec_PtrEntry(pOut->vData, i), 1, (size_t)pSecs[i].Size, pFile ) != (size_t)pSecs[i].Size);
+        Offset = pSecs[i].Offset + pSecs[i].Size;
+    }
+    fError |= (fclose( pFile ) != 0);
+    if ( fError )
+        printf( "Gia_ManSnapWrite(): I/O error when writing the output file \"%s\".\n", pFileName );
+
+    ABC_FREE( pSecs );
+    Vec_PtrForEachEntry( Vec_Str_t *, pOut->vTemp, vStr, i )
+        Vec_StrFree( vStr );
+    Vec_PtrFree( pOut->vTemp );
+    Vec_IntFree( pOut->vTags );
+    Vec_PtrFree( pOut->vData );
+    Vec_WrdFree( pOut->vSizes );
+    return !fError;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loading the file.]
+
+  Description [Maps the file into memory or reads it into a buffer.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Gia_SnapLoad( char * pFileName, word * pnSize, int * pfMapped )
+{
+    char * pContents;
+    FILE * pFile;
+    long nSize;
+#ifndef _WIN32
+    struct stat Stat;
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd >= 0 )
+    {
+        if ( fstat( fd, &Stat ) == 0 && Stat.st_size > 0 )
+        {
+            pContents = (char *)mmap( NULL, (size_t)Stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+            if ( pContents != (char *)MAP_FAILED )
+            {
+                close( fd );
+                *pnSize = (word)Stat.st_size;
+                *pfMapped = 1;
+                return pContents;
+            }
+        }
+        close( fd );
+    }
+#endif
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    fseek( pFile, 0, SEEK_END );
+    nSize = ftell( pFile );
+    rewind( pFile );
+    if ( nSize <= 0 )
+    {
+        fclose( pFile );
+        return NULL;
+    }
+    pContents = ABC_ALLOC( char, nSize );
+    if ( fread( pContents, 1, (size_t)nSize, pFile ) != (size_t)nSize )
+        ABC_FREE( pContents );
+    fclose( pFile );
+    *pnSize = (word)nSize;
+    *pfMapped = 0;
+    return pContents;
+}
+static void Gia_SnapUnload( char * pContents, word nSize, int fMapped )
+{
+#ifndef _WIN32
+    if ( fMapped )
+    {
+        munmap( pContents, (size_t)nSize );
+        return;
+    }
+#endif
+    ABC_FREE( pContents );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restoring sections.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Gia_SnapCopy( char * pData, word Size, word SizeExp )
+{
+    void * pRes;
+    if ( Size != SizeExp )
+        return NULL;
+    pRes = ABC_ALLOC( char, Size ? Size : 1 );
+    memcpy( pRes, pData, (size_t)Size );
+    return pRes;
+}
+static Vec_Ptr_t * Gia_SnapReadNames( char * pData, word Size )
+{
+    Vec_Ptr_t * vNames = Vec_PtrAlloc( 100 );
+    char * pCur = pData, * pStop = pData + Size;
+    while ( pCur < pStop )
+    {
+        int fPresent = *pCur++;
+        char * pEnd = (char *)memchr( pCur, 0, (size_t)(pStop - pCur) );
+        if ( pEnd == NULL )
+            break;
+        Vec_PtrPush( vNames, fPresent ? Abc_UtilStrsav(pCur) : NULL );
+        pCur = pEnd + 1;
+    }
+    return vNames;
+}
+static Abc_Cex_t * Gia_SnapReadCex( char * pData, word Size )
+{
+    Abc_Cex_t * pCex;
+    if ( Size < sizeof(Abc_Cex_t) )
+        return NULL;
+    pCex = (Abc_Cex_t *)ABC_ALLOC( char, Size );
+    memcpy( pCex, pData, (size_t)Size );
+    if ( Size != sizeof(Abc_Cex_t) + sizeof(unsigned) * Abc_BitWordNum(pCex->nBits) )
+        ABC_FREE( pCex );
+    return pCex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the snapshot of the AIG from a file.]
+
+  Description [Returns NULL if the file is not a snapshot or if it was
+  written on a machine with a different byte order or object layout.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManSnapRead( char * pFileName )
+{
+    Gia_Man_t * p = NULL;
+    Gia_SnapHead_t * pHead;
+    Gia_SnapSec_t * pSecs;
+    char * pContents, * pData;
+    word nFileSize, Size;
+    int i, k, nObjs = 0, fMapped = 0, fError = 0;
+
+    pContents = Gia_SnapLoad( pFileName, &nFileSize, &fMapped );
+    if ( pContents == NULL )
+    {
+        printf( "Gia_ManSnapRead(): Cannot read the input file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    // check the header
+    pHead = (Gia_SnapHead_t *)pContents;
+    if ( nFileSize < sizeof(Gia_SnapHead_t) || strncmp(pHead->Magic, "GIASNAP", 8) )
+    {
+        printf( "Gia_ManSnapRead(): The file \"%s\" is not a GIA snapshot.\n", pFileName );
+        Gia_SnapUnload( pContents, nFileSize, fMapped );
+        return NULL;
+    }
+    if ( pHead->Order != GIA_SNAP_ORDER || pHead->ObjSize != sizeof(Gia_Obj_t) )
+    {
+        printf( "Gia_ManSnapRead(): The snapshot was written on an incompatible platform.\n" );
+        Gia_SnapUnload( pContents, nFileSize, fMapped );
+        return NULL;
+    }
+    if ( pHead->Version > GIA_SNAP_VERSION )
+    {
+        printf( "Gia_ManSnapRead(): The snapshot version (%d) is not supported.\n", pHead->Version );
+        Gia_SnapUnload( pContents, nFileSize, fMapped );
+        return NULL;
+    }
+    pSecs = (Gia_SnapSec_t *)(pContents + sizeof(Gia_SnapHead_t));
+    if ( nFileSize < sizeof(Gia_SnapHead_t) + (word)sizeof(Gia_SnapSec_t) * pHead->nSections )
+        fError = 1;
+    for ( i = 0; !fError && i < (int)pHead->nSections; i++ )
+        if ( pSecs[i].Offset > nFileSize || pSecs[i].Size > nFileSize - pSecs[i].Offset )
+            fError = 1;
+    // the objects come first
+    for ( i = 0; !fError && i < (int)pHead->nSections; i++ )
+        if ( pSecs[i].Tag == GIA_SNAP_OBJS )
+        {
+            nObjs = (int)(pSecs[i].Size / sizeof(Gia_Obj_t));
+            if ( nObjs == 0 || pSecs[i].Size % sizeof(Gia_Obj_t) )
+                break;
+            p = ABC_CALLOC( Gia_Man_t, 1 );
+            p->nObjs = p->nObjsAlloc = nObjs;
+            p->pObjs = (Gia_Obj_t *)Gia_SnapCopy( pContents + pSecs[i].Offset, pSecs[i].Size, pSecs[i].Size );
+            break;
+        }
+    if ( p == NULL )
+    {
+        printf( "Gia_ManSnapRead(): The snapshot \"%s\" is corrupted.\n", pFileName );
+        Gia_SnapUnload( pContents, nFileSize, fMapped );
+        return NULL;
+    }
+    // restore the remaining sections
+    for ( i = 0; !fError && i < (int)pHead->nSections; i++ )
+    {
+        unsigned Tag = pSecs[i].Tag;
+        pData = pContents + pSecs[i].Offset;
+        Size  = pSecs[i].Size;
+        for ( k = 0; k < (int)(sizeof(s_SnapVecs) / sizeof(s_SnapVecs[0])); k++ )
+            if ( s_SnapVecs[k].Tag == Tag )
+                break;
+        if ( k < (int)(sizeof(s_SnapVecs) / sizeof(s_SnapVecs[0])) )
+        {
+            void ** ppVec = (void **)((char *)p + s_SnapVecs[k].Offset);
+            int nEntries = (int)(Size / 4);
+            if ( Size % 4 || *ppVec )
+                fError = 1;
+            else if ( s_SnapVecs[k].fFloat )
+            {
+                Vec_Flt_t * vVec = Vec_FltStart( nEntries );
+                memcpy( Vec_FltArray(vVec), pData, (size_t)Size );
+                *ppVec = vVec;
+            }
+            else
+            {
+                Vec_Int_t * vVec = Vec_IntStart( nEntries );
+                memcpy( Vec_IntArray(vVec), pData, (size_t)Size );
+                *ppVec = vVec;
+            }
+        }
+        else if ( Tag == GIA_SNAP_SCAL )
+        {
+            int Scalars[12] = {0};
+            memcpy( Scalars, pData, (size_t)Abc_MinInt((int)Size, (int)sizeof(Scalars)) );
+            p->nRegs       = Scalars[0];
+            p->nConstrs    = Scalars[1];
+            p->nXors       = Scalars[2];
+            p->nMuxes      = Scalars[3];
+            p->nBufs       = Scalars[4];
+            p->fGiaSimple  = Scalars[5];
+            p->And2Delay   = Scalars[6];
+            p->nAnd2Delay  = Scalars[7];
+            p->MappedArea  = Scalars[8];
+            p->MappedDelay = Scalars[9];
+            memcpy( &p->DefInArrs,  Scalars + 10, sizeof(float) );
+            memcpy( &p->DefOutReqs, Scalars + 11, sizeof(float) );
+        }
+        else if ( Tag == GIA_SNAP_MUXS )
+            fError = !(p->pMuxes = (unsigned *)Gia_SnapCopy( pData, Size, (word)sizeof(unsigned) * nObjs ));
+        else if ( Tag == GIA_SNAP_REPR )
+            fError = !(p->pReprs = (Gia_Rpr_t *)Gia_SnapCopy( pData, Size, (word)sizeof(Gia_Rpr_t) * nObjs ));
+        else if ( Tag == GIA_SNAP_NEXT )
+            fError = !(p->pNexts = (int *)Gia_SnapCopy( pData, Size, (word)sizeof(int) * nObjs ));
+        else if ( Tag == GIA_SNAP_SIBL )
+            fError = !(p->pSibls = (int *)Gia_SnapCopy( pData, Size, (word)sizeof(int) * nObjs ));
+        else if ( Tag == GIA_SNAP_SWIT )
+            fError = !(p->pSwitching = (unsigned char *)Gia_SnapCopy( pData, Size, (word)sizeof(char) * nObjs ));
+        else if ( Tag == GIA_SNAP_PLAC )
+            fError = !(p->pPlacement = (Gia_Plc_t *)Gia_SnapCopy( pData, Size, (word)sizeof(Gia_Plc_t) * nObjs ));
+        else if ( Tag == GIA_SNAP_NAME || Tag == GIA_SNAP_SPEC || Tag == GIA_SNAP_CSTR )
+        {
+            char ** ppStr = Tag == GIA_SNAP_NAME ? &p->pName : Tag == GIA_SNAP_SPEC ? &p->pSpec : &p->pCellStr;
+            if ( Size == 0 || pData[Size-1] != '\0' )
+                fError = 1;
+            else
+                *ppStr = Abc_UtilStrsav( pData );
+        }
+        else if ( Tag == GIA_SNAP_NMIN )
+            p->vNamesIn = Gia_SnapReadNames( pData, Size );
+        else if ( Tag == GIA_SNAP_NMOU )
+            p->vNamesOut = Gia_SnapReadNames( pData, Size );
+        else if ( Tag == GIA_SNAP_NMND )
+            p->vNamesNode = Gia_SnapReadNames( pData, Size );
+        else if ( Tag == GIA_SNAP_TMAN )
+        {
+            Vec_Str_t * vStr = Vec_StrStart( (int)Size );
+            memcpy( Vec_StrArray(vStr), pData, (size_t)Size );
+            p->pManTime = Tim_ManLoad( vStr, 1 );
+            Vec_StrFree( vStr );
+        }
+        else if ( Tag == GIA_SNAP_AIGX )
+        {
+            // the AIGER reader may modify its buffer, while the mapping is read-only
+            Vec_Str_t * vStr = Vec_StrStart( (int)Size + 1 );
+            memcpy( Vec_StrArray(vStr), pData, (size_t)Size );
+            p->pAigExtra = Gia_AigerReadFromMemory( Vec_StrArray(vStr), (int)Size, 0, 0, 0 );
+            Vec_StrFree( vStr );
+        }
+        else if ( Tag == GIA_SNAP_CEXS )
+            p->pCexSeq = Gia_SnapReadCex( pData, Size );
+        else if ( Tag == GIA_SNAP_CEXC )
+            p->pCexComb = Gia_SnapReadCex( pData, Size );
+    }
+    Gia_SnapUnload( pContents, nFileSize, fMapped );
+    if ( p->vCis == NULL )
+        p->vCis = Vec_IntAlloc( 0 );
+    if ( p->vCos == NULL )
+        p->vCos = Vec_IntAlloc( 0 );
+    // check that terminals are consistent with the object array
+    for ( i = 0; !fError && i < Vec_IntSize(p->vCis); i++ )
+        fError = Vec_IntEntry(p->vCis, i) <= 0 || Vec_IntEntry(p->vCis, i) >= nObjs || !Gia_ObjIsCi(Gia_ManObj(p, Vec_IntEntry(p->vCis, i)));
+    for ( i = 0; !fError && i < Vec_IntSize(p->vCos); i++ )
+        fError = Vec_IntEntry(p->vCos, i) <= 0 || Vec_IntEntry(p->vCos, i) >= nObjs || !Gia_ObjIsCo(Gia_ManObj(p, Vec_IntEntry(p->vCos, i)));
+    if ( !fError && (p->nRegs < 0 || p->nRegs > Vec_IntSize(p->vCis) || p->nRegs > Vec_IntSize(p->vCos)) )
+        fError = 1;
+    if ( fError )
+    {
+        printf( "Gia_ManSnapRead(): The snapshot \"%s\" is corrupted.\n", pFileName );
+        Gia_ManStop( p );
+        return NULL;
+    }
+    return p;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,432 @@
+/**CFile****************************************************************
+
+  FileName    [giaZip.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Scalable AIG package.]
+
+  Synopsis    [Compressed in-memory representation of the AIG.]
+
+  Author      [Berkeley Logic Synthesis and Verification Group]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "gia.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The object array is stored as a sequence of variable-length unsigned
+// numbers, as in the binary AIGER format. Each object is represented by
+// the difference between its ID and the IDs of its fanins, which keeps
+// the numbers small. Unlike AIGER, the object order is preserved, so that
+// the other attributes of the manager, which are indexed by object IDs
+// (names, mapping, equivalences, etc), remain valid without changes.
+// These attributes stay in the manager, which is kept without objects.
+// The data that the procedures derive from the objects and recompute
+// when needed (reference counters, levels, fanouts, traversal IDs, copies,
+// truth tables, etc) is deleted, so that the manager does not keep arrays
+// proportional to the number of objects that are not compressed.
+//
+// The first number of each record gives the object type:
+//   0             : combinational input
+//   1             : combinational output, followed by (2 * iDiff0 + fCompl0)
+//   2             : object without fanins, followed by iDiff1 and the complement bits
+//   3 + 2 * iDiff0 + fCompl0 : internal node, followed by (2 * Zig(iDiff0 - iDiff1) + fCompl1)
+// If the manager has MUXes, the record of an internal node ends with the
+// control literal (0 if the node is not a MUX, or 1 + the literal difference).
+// The phase bits of all objects are stored after the objects. They are
+// followed by the LUT mapping, if present: for each object, 0 if it is
+// not a LUT root, or 1 + the number of fanins followed by Zig(iObj - iFanin)
+// for each fanin. The choice nodes, if present, come last: for each
+// object, 0 if it has no sibling, or 1 + Zig(iObj - iSibl).
+
+struct Gia_Zip_t_
+{
+    Gia_Man_t *      pShell;      // the manager without the object array
+    unsigned char *  pData;       // the compressed object array
+    int              nData;       // the size of the compressed data
+    int              nObjs;       // the number of objects
+    int              fMuxes;      // the manager has MUXes
+    int              fMapping;    // the LUT mapping is compressed
+    int              fSibls;      // the choice nodes are compressed
+    int              nShell;      // the memory used by the attributes kept in the manager
+    int              nShellOrig;  // the memory used by all attributes before compression
+};
+
+static inline unsigned Gia_ZipZig( int Diff )     { return Diff >= 0 ? (unsigned)Diff << 1 : ((unsigned)(-Diff) << 1) - 1; }
+static inline int      Gia_ZipUnzig( unsigned z ) { return (z & 1) ? -(int)((z + 1) >> 1) : (int)(z >> 1);                 }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the memory used by the attributes of the manager.]
+
+  Description [Counts the arrays proportional to the number of objects,
+  except the object array itself.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static double Gia_ZipShellMemory( Gia_Man_t * p )
+{
+    double Memory = sizeof(Gia_Man_t);
+    Memory += Vec_IntMemory( p->vCis ) + Vec_IntMemory( p->vCos );
+    Memory += sizeof(int) * (Vec_IntCap(&p->vHash) + Vec_IntCap(&p->vHTable) + Vec_IntCap(&p->vRefs));
+    Memory += sizeof(int) * p->nObjs * ((p->pRefs != NULL) + (p->pLutRefs != NULL) + (p->pNexts != NULL) + (p->pSibls != NULL) + (p->pReprsOld != NULL));
+    Memory += sizeof(Gia_Rpr_t) * p->nObjs * (p->pReprs != NULL);
+    Memory += sizeof(int) * (p->nFansAlloc + p->nTravIdsAlloc);
+    Memory += Vec_IntMemory( p->vLevels ) + Vec_IntMemory( p->vFanoutNums ) + Vec_IntMemory( p->vFanout );
+    Memory += Vec_IntMemory( p->vMapping ) + Vec_IntMemory( p->vCellMapping ) + Vec_IntMemory( p->vPacking );
+    Memory += Vec_WecMemory( p->vMapping2 ) + Vec_WecMemory( p->vFanouts2 );
+    Memory += sizeof(int) * (Vec_IntCap(&p->vCopies) + Vec_IntCap(&p->vCopies2) + Vec_IntCap(&p->vCopiesTwo) + Vec_IntCap(&p->vSuppVars) + Vec_IntCap(&p->vVarMap));
+    Memory += Vec_IntMemory( p->vTruths ) + Vec_IntMemory( p->vTtNums ) + Vec_IntMemory( p->vTtNodes ) + Vec_WrdMemory( p->vTtMemory );
+    Memory += Vec_IntMemory( p->vSuper ) + Vec_IntMemory( p->vStore ) + Vec_IntMemory( p->vXors ) + Vec_IntMemory( p->vVar2Obj );
+    Memory += Vec_WrdMemory( p->vSuppWords ) + Vec_WrdMemory( p->vHashConc ) + Vec_IntMemory( p->vTimeStamps );
+    Memory += Vec_WrdMemory( p->vSims ) + Vec_WrdMemory( p->vSimsT ) + Vec_WrdMemory( p->vSimsPi ) + Vec_WrdMemory( p->vSimsPo );
+    Memory += Vec_PtrMemory( p->vNamesIn ) + Vec_PtrMemory( p->vNamesOut ) + Vec_PtrMemory( p->vNamesNode );
+    Memory += Vec_IntMemory( p->vFlopClasses ) + Vec_IntMemory( p->vObjClasses ) + Vec_IntMemory( p->vSwitching );
+    return Memory;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Deletes the data that can be recomputed from the objects.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ZipDropDerived( Gia_Man_t * p )
+{
+    Gia_ManHashStop( p );
+    Vec_WrdFreeP( &p->vHashConc );
+    Vec_IntErase( &p->vRefs );
+    ABC_FREE( p->pRefs );
+    ABC_FREE( p->pLutRefs );
+    Vec_IntFreeP( &p->vLevels );
+    ABC_FREE( p->pFanData );
+    p->nFansAlloc = 0;
+    Vec_IntFreeP( &p->vFanoutNums );
+    Vec_IntFreeP( &p->vFanout );
+    ABC_FREE( p->pTravIds );
+    p->nTravIdsAlloc = 0;
+    Vec_IntErase( &p->vCopies );
+    Vec_IntErase( &p->vCopies2 );
+    Vec_IntErase( &p->vCopiesTwo );
+    Vec_IntErase( &p->vSuppVars );
+    Vec_IntErase( &p->vVarMap );
+    Vec_WrdFreeP( &p->vSuppWords );
+    Vec_IntFreeP( &p->vTruths );
+    Gia_ObjComputeTruthTableStop( p );
+    Vec_IntFreeP( &p->vSuper );
+    Vec_IntFreeP( &p->vStore );
+    Vec_IntFreeP( &p->vXors );
+    Vec_IntFreeP( &p->vVar2Obj );
+    Vec_IntFreeP( &p->vTimeStamps );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compresses and restores the LUT mapping and the choices.]
+
+  Description [The mapping is compressed if each LUT record ends with
+  the root, as created by the mappers. The records are restored in the
+  order of their roots.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Gia_ZipCanWriteMapping( Gia_Man_t * p )
+{
+    int i, iOffset;
+    if ( p->vMapping == NULL || Vec_IntSize(p->vMapping) < Gia_ManObjNum(p) )
+        return 0;
+    for ( i = 0; i < Gia_ManObjNum(p); i++ )
+    {
+        if ( (iOffset = Vec_IntEntry(p->vMapping, i)) == 0 )
+            continue;
+        if ( iOffset < Gia_ManObjNum(p) || iOffset + Vec_IntEntry(p->vMapping, iOffset) + 1 >= Vec_IntSize(p->vMapping) )
+            return 0;
+        if ( Vec_IntEntry(p->vMapping, iOffset + Vec_IntEntry(p->vMapping, iOffset) + 1) != i )
+            return 0;
+    }
+    return 1;
+}
+static void Gia_ZipWriteMapping( Gia_Man_t * p, Vec_Str_t * vData )
+{
+    int i, k, iFan;
+    for ( i = 0; i < Gia_ManObjNum(p); i++ )
+    {
+        if ( !Gia_ObjIsLut(p, i) )
+        {
+            Gia_AigerWriteUnsigned( vData, 0 );
+            continue;
+        }
+        Gia_AigerWriteUnsigned( vData, 1 + Gia_ObjLutSize(p, i) );
+        Gia_LutForEachFanin( p, i, iFan, k )
+            Gia_AigerWriteUnsigned( vData, Gia_ZipZig(i - iFan) );
+    }
+}
+static unsigned char * Gia_ZipReadMapping( Gia_Man_t * p, unsigned char * pPos )
+{
+    int i, k, nFans, nObjs = Gia_ManObjNum(p);
+    assert( p->vMapping == NULL );
+    p->vMapping = Vec_IntStart( 2 * nObjs );
+    Vec_IntShrink( p->vMapping, nObjs );
+    for ( i = 0; i < nObjs; i++ )
+    {
+        if ( (nFans = (int)Gia_AigerReadUnsigned( &pPos )) == 0 )
+            continue;
+        nFans--;
+        Vec_IntWriteEntry( p->vMapping, i, Vec_IntSize(p->vMapping) );
+        Vec_IntPush( p->vMapping, nFans );
+        for ( k = 0; k < nFans; k++ )
+            Vec_IntPush( p->vMapping, i - Gia_ZipUnzig(Gia_AigerReadUnsigned(&pPos)) );
+        Vec_IntPush( p->vMapping, i );
+    }
+    return pPos;
+}
+static void Gia_ZipWriteSibls( Gia_Man_t * p, Vec_Str_t * vData )
+{
+    int i;
+    for ( i = 0; i < Gia_ManObjNum(p); i++ )
+        Gia_AigerWriteUnsigned( vData, p->pSibls[i] ? 1 + Gia_ZipZig(i - p->pSibls[i]) : 0 );
+}
+static unsigned char * Gia_ZipReadSibls( Gia_Man_t * p, unsigned char * pPos )
+{
+    unsigned Code; int i;
+    assert( p->pSibls == NULL );
+    p->pSibls = ABC_CALLOC( int, Gia_ManObjNum(p) );
+    for ( i = 0; i < Gia_ManObjNum(p); i++ )
+        if ( (Code = Gia_AigerReadUnsigned( &pPos )) )
+            p->pSibls[i] = i - Gia_ZipUnzig( Code - 1 );
+    return pPos;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compresses the manager.]
+
+  Description [Takes the ownership of the manager. The object array
+  is replaced by the compressed data. The other attributes remain in the
+  manager, except the data derived from the objects, which is deleted
+  and is not restored (including the structural hashing table). The
+  values and marks of the objects are not saved.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Zip_t * Gia_ManZip( Gia_Man_t * p )
+{
+    Gia_Zip_t * pZip;
+    Vec_Str_t * vData;
+    Gia_Obj_t * pObj;
+    int i, Lit, nBytes;
+    vData = Vec_StrAlloc( 3 * Gia_ManObjNum(p) + 16 );
+    Gia_ManForEachObj( p, pObj, i )
+    {
+        if ( pObj->fTerm && pObj->iDiff0 == GIA_NONE )
+            Gia_AigerWriteUnsigned( vData, 0 );
+        else if ( pObj->fTerm )
+        {
+            Gia_AigerWriteUnsigned( vData, 1 );
+            Gia_AigerWriteUnsigned( vData, 2 * pObj->iDiff0 + pObj->fCompl0 );
+        }
+        else if ( pObj->iDiff0 == GIA_NONE )
+        {
+            Gia_AigerWriteUnsigned( vData, 2 );
+            Gia_AigerWriteUnsigned( vData, pObj->iDiff1 );
+            Gia_AigerWriteUnsigned( vData, pObj->fCompl0 | (pObj->fCompl1 << 1) );
+        }
+        else
+        {
+            Gia_AigerWriteUnsigned( vData, 3 + 2 * pObj->iDiff0 + pObj->fCompl0 );
+            Gia_AigerWriteUnsigned( vData, 2 * Gia_ZipZig((int)pObj->iDiff0 - (int)pObj->iDiff1) + pObj->fCompl1 );
+            if ( p->pMuxes )
+            {
+                Lit = p->pMuxes[i];
+                Gia_AigerWriteUnsigned( vData, Lit ? 1 + 2 * (i - Abc_Lit2Var(Lit)) + Abc_LitIsCompl(Lit) : 0 );
+            }
+        }
+    }
+    // write the phases
+    nBytes = Vec_StrSize( vData );
+    Vec_StrFillExtra( vData, nBytes + (Gia_ManObjNum(p) + 7) / 8, 0 );
+    Gia_ManForEachObj( p, pObj, i )
+        if ( pObj->fPhase )
+            vData->pArray[nBytes + i / 8] |= (char)(1 << (i % 8));
+    // create the container
+    pZip = ABC_CALLOC( Gia_Zip_t, 1 );
+    pZip->nObjs   = Gia_ManObjNum(p);
+    pZip->fMuxes  = (p->pMuxes != NULL);
+    pZip->fMapping = Gia_ZipCanWriteMapping( p );
+    pZip->fSibls  = (p->pSibls != NULL);
+    if ( pZip->fMapping )
+        Gia_ZipWriteMapping( p, vData );
+    if ( pZip->fSibls )
+        Gia_ZipWriteSibls( p, vData );
+    pZip->nData   = Vec_StrSize( vData );
+    pZip->pData   = (unsigned char *)Vec_StrReleaseArray( vData );
+    pZip->pData   = ABC_REALLOC( unsigned char, pZip->pData, pZip->nData );
+    Vec_StrFree( vData );
+    // remove the objects and the derived data from the manager
+    pZip->nShellOrig = (int)Gia_ZipShellMemory( p );
+    Gia_ZipDropDerived( p );
+    if ( pZip->fMapping )
+        Vec_IntFreeP( &p->vMapping );
+    if ( pZip->fSibls )
+        ABC_FREE( p->pSibls );
+    pZip->nShell  = (int)Gia_ZipShellMemory( p );
+    ABC_FREE( p->pObjs );
+    ABC_FREE( p->pMuxes );
+    p->nObjsAlloc = 0;
+    pZip->pShell  = p;
+    return pZip;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores the manager and deletes the container.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_ManUnzip( Gia_Zip_t * pZip )
+{
+    Gia_Man_t * p = pZip->pShell;
+    unsigned char * pPos = pZip->pData;
+    Gia_Obj_t * pObj;
+    unsigned Type, Code;
+    int i, iObj, nObjs = pZip->nObjs;
+    assert( p->pObjs == NULL );
+    p->pObjs      = ABC_CALLOC( Gia_Obj_t, nObjs );
+    p->pMuxes     = pZip->fMuxes ? ABC_CALLOC( unsigned, nObjs ) : NULL;
+    p->nObjs      = nObjs;
+    p->nObjsAlloc = nObjs;
+    for ( i = 0; i < nObjs; i++ )
+    {
+        pObj = p->pObjs + i;
+        Type = Gia_AigerReadUnsigned( &pPos );
+        if ( Type == 0 )
+        {
+            pObj->fTerm  = 1;
+            pObj->iDiff0 = GIA_NONE;
+        }
+        else if ( Type == 1 )
+        {
+            Code = Gia_AigerReadUnsigned( &pPos );
+            pObj->fTerm   = 1;
+            pObj->iDiff0  = Code >> 1;
+            pObj->fCompl0 = Code & 1;
+        }
+        else if ( Type == 2 )
+        {
+            pObj->iDiff0  = GIA_NONE;
+            pObj->iDiff1  = Gia_AigerReadUnsigned( &pPos );
+            Code = Gia_AigerReadUnsigned( &pPos );
+            pObj->fCompl0 = Code & 1;
+            pObj->fCompl1 = Code >> 1;
+        }
+        else
+        {
+            Type -= 3;
+            pObj->iDiff0  = Type >> 1;
+            pObj->fCompl0 = Type & 1;
+            Code = Gia_AigerReadUnsigned( &pPos );
+            pObj->iDiff1  = (int)pObj->iDiff0 - Gia_ZipUnzig( Code >> 1 );
+            pObj->fCompl1 = Code & 1;
+            if ( pZip->fMuxes && (Code = Gia_AigerReadUnsigned( &pPos )) )
+                p->pMuxes[i] = Abc_Var2Lit( i - (int)((Code - 1) >> 1), (Code - 1) & 1 );
+        }
+        pObj->fPhase = 0;
+    }
+    for ( i = 0; i < nObjs; i++ )
+        p->pObjs[i].fPhase = (pPos[i / 8] >> (i % 8)) & 1;
+    pPos += (nObjs + 7) / 8;
+    if ( pZip->fMapping )
+        pPos = Gia_ZipReadMapping( p, pPos );
+    if ( pZip->fSibls )
+        pPos = Gia_ZipReadSibls( p, pPos );
+    assert( pPos == pZip->pData + pZip->nData );
+    // restore the CI/CO numbers
+    Vec_IntForEachEntry( p->vCis, iObj, i )
+        p->pObjs[iObj].iDiff1 = i;
+    Vec_IntForEachEntry( p->vCos, iObj, i )
+        p->pObjs[iObj].iDiff1 = i;
+    ABC_FREE( pZip->pData );
+    ABC_FREE( pZip );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Deletes the container together with the manager.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ZipFree( Gia_Zip_t * pZip )
+{
+    Gia_ManStop( pZip->pShell );
+    ABC_FREE( pZip->pData );
+    ABC_FREE( pZip );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the memory used by the container and by the original manager.]
+
+  Description [Includes the object array and the attributes kept in the
+  manager (or all attributes, for the original manager).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ZipSize( Gia_Zip_t * pZip, int * pnSizeOrig )
+{
+    if ( pnSizeOrig )
+        *pnSizeOrig = (int)sizeof(Gia_Obj_t) * pZip->nObjs + pZip->nShellOrig;
+    return pZip->nData + pZip->nShell;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -354,6 +354,56 @@ void Hop_ObjPrintEqn( FILE * pFile, Hop_Obj_t * pObj, Vec_Vec_t * vLevels, int L
     return;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Prints Eqn formula for the AIG rooted at this node.]
+
+  Description [Same as Hop_ObjPrintEqn() but appends the formula 
+  to the string instead of writing it into the file.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Hop_ObjPrintEqnStr( Vec_Str_t * vStr, Hop_Obj_t * pObj, Vec_Vec_t * vLevels, int Level )
+{
+    Vec_Ptr_t * vSuper;
+    Hop_Obj_t * pFanin;
+    int fCompl, i;
+    // store the complemented attribute
+    fCompl = Hop_IsComplement(pObj);
+    pObj = Hop_Regular(pObj);
+    // constant case
+    if ( Hop_ObjIsConst1(pObj) )
+    {
+        Vec_StrPush( vStr, (char)('0' + !fCompl) );
+        return;
+    }
+    // PI case
+    if ( Hop_ObjIsPi(pObj) )
+    {
+        if ( fCompl )
+            Vec_StrPush( vStr, '!' );
+        Vec_StrPrintStr( vStr, (char*)pObj->pData );
+        return;
+    }
+    // AND case
+    Vec_VecExpand( vLevels, Level );
+    vSuper = Vec_VecEntry(vLevels, Level);
+    Hop_ObjCollectMulti( pObj, vSuper );
+    if ( Level > 0 )
+        Vec_StrPush( vStr, '(' );
+    Vec_PtrForEachEntry( Hop_Obj_t *, vSuper, pFanin, i )
+    {
+        Hop_ObjPrintEqnStr( vStr, Hop_NotCond(pFanin, fCompl), vLevels, Level+1 );
+        if ( i < Vec_PtrSize(vSuper) - 1 )
+            Vec_StrPrintStr( vStr, fCompl? " + " : " * " );
+    }
+    if ( Level > 0 )
+        Vec_StrPush( vStr, ')' );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Prints Verilog formula for the AIG rooted at this node.]
@@ -442,6 +492,99 @@ void Hop_ObjPrintVerilog( FILE * pFile, Hop_Obj_t * pObj, Vec_Vec_t * vLevels, i
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Prints Verilog formula for the AIG rooted at this node.]
+
+  Description [Same as Hop_ObjPrintVerilog() but appends the formula 
+  to the string instead of writing it into the file.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Hop_ObjPrintVerilogStr( Vec_Str_t * vStr, Hop_Obj_t * pObj, Vec_Vec_t * vLevels, int Level, int fOnlyAnds )
+{
+    Vec_Ptr_t * vSuper;
+    Hop_Obj_t * pFanin, * pFanin0, * pFanin1, * pFaninC;
+    int fCompl, i;
+    // store the complemented attribute
+    fCompl = Hop_IsComplement(pObj);
+    pObj = Hop_Regular(pObj);
+    // constant case
+    if ( Hop_ObjIsConst1(pObj) )
+    {
+        Vec_StrPrintStr( vStr, !fCompl ? "1\'b1" : "1\'b0" );
+        return;
+    }
+    // PI case
+    if ( Hop_ObjIsPi(pObj) )
+    {
+        if ( fCompl )
+            Vec_StrPush( vStr, '~' );
+        Vec_StrPrintStr( vStr, (char*)pObj->pData );
+        return;
+    }
+    // EXOR case
+    if ( !fOnlyAnds && Hop_ObjIsExor(pObj) )
+    {
+        Vec_VecExpand( vLevels, Level );
+        vSuper = Vec_VecEntry( vLevels, Level );
+        Hop_ObjCollectMulti( pObj, vSuper );
+        if ( Level > 0 )
+            Vec_StrPush( vStr, '(' );
+        Vec_PtrForEachEntry( Hop_Obj_t *, vSuper, pFanin, i )
+        {
+            Hop_ObjPrintVerilogStr( vStr, Hop_NotCond(pFanin, (fCompl && i==0)), vLevels, Level+1, fOnlyAnds );
+            if ( i < Vec_PtrSize(vSuper) - 1 )
+                Vec_StrPrintStr( vStr, " ^ " );
+        }
+        if ( Level > 0 )
+            Vec_StrPush( vStr, ')' );
+        return;
+    }
+    // MUX case
+    if ( !fOnlyAnds && Hop_ObjIsMuxType(pObj) )
+    {
+        if ( Level > 0 )
+            Vec_StrPush( vStr, '(' );
+        if ( Hop_ObjRecognizeExor( pObj, &pFanin0, &pFanin1 ) )
+        {
+            Hop_ObjPrintVerilogStr( vStr, Hop_NotCond(pFanin0, fCompl), vLevels, Level+1, fOnlyAnds );
+            Vec_StrPrintStr( vStr, " ^ " );
+            Hop_ObjPrintVerilogStr( vStr, pFanin1, vLevels, Level+1, fOnlyAnds );
+        }
+        else 
+        {
+            pFaninC = Hop_ObjRecognizeMux( pObj, &pFanin1, &pFanin0 );
+            Hop_ObjPrintVerilogStr( vStr, pFaninC, vLevels, Level+1, fOnlyAnds );
+            Vec_StrPrintStr( vStr, " ? " );
+            Hop_ObjPrintVerilogStr( vStr, Hop_NotCond(pFanin1, fCompl), vLevels, Level+1, fOnlyAnds );
+            Vec_StrPrintStr( vStr, " : " );
+            Hop_ObjPrintVerilogStr( vStr, Hop_NotCond(pFanin0, fCompl), vLevels, Level+1, fOnlyAnds );
+        }
+        if ( Level > 0 )
+            Vec_StrPush( vStr, ')' );
+        return;
+    }
+    // AND case
+    Vec_VecExpand( vLevels, Level );
+    vSuper = Vec_VecEntry(vLevels, Level);
+    Hop_ObjCollectMulti( pObj, vSuper );
+    if ( Level > 0 )
+        Vec_StrPush( vStr, '(' );
+    Vec_PtrForEachEntry( Hop_Obj_t *, vSuper, pFanin, i )
+    {
+        Hop_ObjPrintVerilogStr( vStr, Hop_NotCond(pFanin, fCompl), vLevels, Level+1, fOnlyAnds );
+        if ( i < Vec_PtrSize(vSuper) - 1 )
+            Vec_StrPrintStr( vStr, fCompl ? " | " : " & " );
+    }
+    if ( Level > 0 )
+        Vec_StrPush( vStr, ')' );
+}
+
+
 /**Function*************************************************************
 
   Synopsis    [Prints node in HAIG.]
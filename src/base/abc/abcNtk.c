@@ -129,6 +129,9 @@ Abc_Ntk_t * Abc_NtkStartFrom( Abc_Ntk_t * pNtk, Abc_NtkType_t Type, Abc_NtkFunc_
     // map the constant nodes
     if ( Abc_NtkIsStrash(pNtk) && Abc_NtkIsStrash(pNtkNew) )
         Abc_AigConst1(pNtk)->pCopy = Abc_AigConst1(pNtkNew);
+    // reserve the names of CIs/COs/boxes
+    if ( fCopyNames )
+        Nm_ManReserve( pNtkNew->pManName, Abc_NtkCiNum(pNtk) + Abc_NtkCoNum(pNtk) + Abc_NtkBoxNum(pNtk), 0 );
     // clone CIs/CIs/boxes
     Abc_NtkForEachPi( pNtk, pObj, i )
         Abc_NtkDupObj( pNtkNew, pObj, fCopyNames );
@@ -1493,6 +1496,7 @@ void Abc_NtkDelete( Abc_Ntk_t * pNtk )
     Vec_IntFreeP( &pNtk->vTopo );
     Vec_IntFreeP( &pNtk->vFins );
     Vec_IntFreeP( &pNtk->vOrigNodeIds );
+    Vec_IntFreeP( &pNtk->vOrchGains );
     ABC_FREE( pNtk );
 }
 
@@ -408,6 +408,8 @@ static int Abc_CommandAbc9ReadVer            ( Abc_Frame_t * pAbc, int argc, cha
 static int Abc_CommandAbc9WriteVer           ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Write              ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9WriteLut           ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandAbc9WriteSnap          ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandAbc9ReadSnap           ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Ps                 ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9PFan               ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Pms                ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -440,6 +442,7 @@ static int Abc_CommandAbc9ReadSim            ( Abc_Frame_t * pAbc, int argc, cha
 static int Abc_CommandAbc9WriteSim           ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9PrintSim           ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9GenSim             ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandAbc9SimBench           ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9SimRsb             ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Resim              ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9SpecI              ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -455,6 +458,7 @@ static int Abc_CommandAbc9Dc2                ( Abc_Frame_t * pAbc, int argc, cha
 static int Abc_CommandAbc9Dsd                ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Bidec              ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Shrink             ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int Abc_CommandAbc9Orchestrate        ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Fx                 ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Extract            ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int Abc_CommandAbc9Balance            ( Abc_Frame_t * pAbc, int argc, char ** argv );
@@ -827,7 +831,7 @@ void Abc_FrameUpdateGia( Abc_Frame_t * pAbc, Gia_Man_t * pNew )
     }
     // update
     if ( pAbc->pGia2 )
-        Gia_ManStop( pAbc->pGia2 );
+        Abc_FrameGiaUndoPush( pAbc, pAbc->pGia2 );
     pAbc->pGia2 = pAbc->pGia;
     pAbc->pGia  = pNew;
 }
@@ -849,6 +853,7 @@ Gia_Man_t * Abc_FrameGetGia( Abc_Frame_t * pAbc )
     if ( pAbc->pGia2 )
         Gia_ManStop( pAbc->pGia2 );
     pAbc->pGia2 = NULL;
+    Abc_FrameGiaUndoClear( pAbc );
     pGia = pAbc->pGia;
     pAbc->pGia = NULL;
     return pGia;
@@ -1205,6 +1210,8 @@ void Abc_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "ABC9",         "&w",            Abc_CommandAbc9Write,        0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&write",        Abc_CommandAbc9Write,        0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&wlut",         Abc_CommandAbc9WriteLut,     0 );
+    Cmd_CommandAdd( pAbc, "ABC9",         "&write_snap",   Abc_CommandAbc9WriteSnap,    0 );
+    Cmd_CommandAdd( pAbc, "ABC9",         "&read_snap",    Abc_CommandAbc9ReadSnap,     0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&ps",           Abc_CommandAbc9Ps,           0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&pfan",         Abc_CommandAbc9PFan,         0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&pms",          Abc_CommandAbc9Pms,          0 );
@@ -1237,6 +1244,7 @@ void Abc_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "ABC9",         "&sim_write",    Abc_CommandAbc9WriteSim,     0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&sim_print",    Abc_CommandAbc9PrintSim,     0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&sim_gen",      Abc_CommandAbc9GenSim,       0 );
+    Cmd_CommandAdd( pAbc, "ABC9",         "&sim_bench",    Abc_CommandAbc9SimBench,     0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&simrsb",       Abc_CommandAbc9SimRsb,       0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&resim",        Abc_CommandAbc9Resim,        0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&speci",        Abc_CommandAbc9SpecI,        0 );
@@ -1252,6 +1260,7 @@ void Abc_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "ABC9",         "&dsd",          Abc_CommandAbc9Dsd,          0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&bidec",        Abc_CommandAbc9Bidec,        0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&shrink",       Abc_CommandAbc9Shrink,       0 );
+    Cmd_CommandAdd( pAbc, "ABC9",         "&orchestrate",  Abc_CommandAbc9Orchestrate,  0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&fx",           Abc_CommandAbc9Fx,           0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&extract",      Abc_CommandAbc9Extract,      0 );
     Cmd_CommandAdd( pAbc, "ABC9",         "&b",            Abc_CommandAbc9Balance,      0 );
@@ -1488,6 +1497,7 @@ void Abc_End( Abc_Frame_t * pAbc )
     Gia_ManStopP( &pAbc->pGiaBest );
     Gia_ManStopP( &pAbc->pGiaBest2 );
     Gia_ManStopP( &pAbc->pGiaSaved );
+    Abc_FrameGiaUndoClear( pAbc );
     if ( Abc_NtkRecIsRunning3() )
         Abc_NtkRecStop3();
 }
@@ -7551,6 +7561,10 @@ int Abc_CommandOrchestrate( Abc_Frame_t * pAbc, int argc, char ** argv )
     int nCutsMax; //rs option
     int nNodesMax; //rs option
     int nLevelsOdc; //rs option
+    int nCacheRadius; //gain cache option
+    int nThreads; //the number of threads
+    char * pPolicyFile = NULL; //the per-node policy
+    char * pDecisionFile = NULL; //the decisions made under the policy
 
     int fPrecompute; //rewrite option (not enabled)
     int fPlaceEnable; //rewrite option (not enabled)
@@ -7561,8 +7575,11 @@ int Abc_CommandOrchestrate( Abc_Frame_t * pAbc, int argc, char ** argv )
     extern void Rwr_Precompute();
 
     //local greedy
-    extern int Abc_NtkOrchLocal( Abc_Ntk_t * pNtk, int fUseZeros_rwr, int fUseZeros_ref, int fPlaceEnable, int nCutsMax, int nNodesMax, int nLevelsOdc, int fUpdateLevel, int fVerbose, int fVeryVerbose, int nNodeSizeMax, int nConeSizeMax, int fUseDcs );
+    extern int Abc_NtkOrchCacheStart( Abc_Ntk_t * pNtk, int nRadius, int * pPars, int nPars, int fVerbose );
+    extern int Abc_NtkOrchLocal( Abc_Ntk_t * pNtk, int fUseZeros_rwr, int fUseZeros_ref, int fPlaceEnable, int nCutsMax, int nNodesMax, int nLevelsOdc, int fUpdateLevel, int fVerbose, int fVeryVerbose, int nNodeSizeMax, int nConeSizeMax, int fUseDcs, int nThreads );
     //priority orch
+    //policy orch
+    extern int Abc_NtkOrchSA( Abc_Ntk_t * pNtk, Vec_Int_t **pGain_rwr, Vec_Int_t **pGain_res,Vec_Int_t **pGain_ref, Vec_Int_t **PolicyList, char * DecisionFile, int fUseZeros_rwr, int fUseZeros_ref, int fPlaceEnable, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int fVerbose, int fVeryVerbose, int nNodeSizeMax, int nConeSizeMax, int fUseDcs );
     extern int Abc_NtkOchestration( Abc_Ntk_t * pNtk, Vec_Int_t **pGain_rwr, Vec_Int_t **pGain_res,Vec_Int_t **pGain_ref, int sOpsOrder, int fUseZeros_rwr, int fUseZeros_ref, int fPlaceEnable, int nCutsMax, int nNodesMax, int nLevelsOdc, int fUpdateLevel, int fVerbose, int fVeryVerbose, int nNodeSizeMax, int nConeSizeMax, int fUseDcs );
     // set defaults
     nNodeSizeMax = 10;
@@ -7578,9 +7595,11 @@ int Abc_CommandOrchestrate( Abc_Frame_t * pAbc, int argc, char ** argv )
     nCutsMax     =  8;
     nNodesMax    =  1;
     nLevelsOdc   =  0;
+    nCacheRadius =  0;
+    nThreads     =  1;
 
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "KNFZzlvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KNFCPpdZzlvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -7617,6 +7636,46 @@ int Abc_CommandOrchestrate( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( nLevelsOdc < 0 )
                 goto usage;
             break;
+        case 'C':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-C\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nCacheRadius = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nCacheRadius < 0 )
+                goto usage;
+            break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nThreads < 1 || nThreads > 99 )
+                goto usage;
+            break;
+        case 'p':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-p\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pPolicyFile = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
+        case 'd':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-d\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pDecisionFile = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
         case 'l':
             fUpdateLevel ^= 1;
             break;
@@ -7674,9 +7733,40 @@ int Abc_CommandOrchestrate( Abc_Frame_t * pAbc, int argc, char ** argv )
         return 1;
     }
 
-    // modify the current network
-    pDup = Abc_NtkDup( pNtk );
-    RetValue = Abc_NtkOrchLocal( pNtk, fUseZeros_rwr, fUseZeros_ref, fPlaceEnable, nCutsMax, nNodesMax, nLevelsOdc, fUpdateLevel, fVerbose, fVeryVerbose, nNodeSizeMax, nConeSizeMax, fUseDcs );
+    // apply the policy given by the driver program
+    if ( pPolicyFile )
+    {
+        Vec_Int_t * vPolicy, * vGainRwr, * vGainRes, * vGainRef;
+        vPolicy = Abc_OrchDataRead( strcmp(pPolicyFile, "-") ? pPolicyFile : NULL, ABC_ORCH_DATA_DECS, NULL );
+        if ( vPolicy == NULL )
+        {
+            Abc_Print( -1, "The policy is not available.\n" );
+            return 1;
+        }
+        if ( Vec_IntSize(vPolicy) < Abc_NtkObjNumMax(pNtk) )
+        {
+            Abc_Print( -1, "The policy has %d entries while the network has %d objects.\n", Vec_IntSize(vPolicy), Abc_NtkObjNumMax(pNtk) );
+            Vec_IntFree( vPolicy );
+            return 1;
+        }
+        // the gains cached by the greedy passes do not apply
+        Abc_NtkOrchCacheStart( pNtk, 0, NULL, 0, 0 );
+        pDup = Abc_NtkDup( pNtk );
+        RetValue = Abc_NtkOrchSA( pNtk, &vGainRwr, &vGainRes, &vGainRef, &vPolicy, pDecisionFile, fUseZeros_rwr, fUseZeros_ref, fPlaceEnable, nCutsMax, nNodesMax, nLevelsOdc, fUpdateLevel, fVerbose, fVeryVerbose, nNodeSizeMax, nConeSizeMax, fUseDcs );
+        Vec_IntFree( vGainRwr );
+        Vec_IntFree( vGainRes );
+        Vec_IntFree( vGainRef );
+        Vec_IntFree( vPolicy );
+    }
+    else
+    {
+        // reuse the gains from the previous pass (or drop them if the cache is off)
+        int pPars[9] = { fUseZeros_rwr, fUseZeros_ref, nCutsMax, nNodesMax, nLevelsOdc, fUpdateLevel, nNodeSizeMax, nConeSizeMax, fUseDcs };
+        Abc_NtkOrchCacheStart( pNtk, nCacheRadius, pPars, 9, fVerbose );
+        // modify the current network
+        pDup = Abc_NtkDup( pNtk );
+        RetValue = Abc_NtkOrchLocal( pNtk, fUseZeros_rwr, fUseZeros_ref, fPlaceEnable, nCutsMax, nNodesMax, nLevelsOdc, fUpdateLevel, fVerbose, fVeryVerbose, nNodeSizeMax, nConeSizeMax, fUseDcs, nThreads );
+    }
     if ( RetValue == -1 )
     {
         Abc_FrameReplaceCurrentNetwork( pAbc, pDup );
@@ -7694,11 +7784,17 @@ int Abc_CommandOrchestrate( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: orchestrate [-KNFZzlvwh]\n" );
+    Abc_Print( -2, "usage: orchestrate [-KNFCP <num>] [-pd <file>] [-Zzlvwh]\n" );
     Abc_Print( -2, "\t           performs technology-independent AIG synthesis using orchestration method (currently orchestrating rw/rf/rs)\n" );
     Abc_Print( -2, "\t-K <num> : (resub)the max cut size (%d <= num <= %d) [default = %d]\n", RS_CUT_MIN, RS_CUT_MAX, nCutsMax );
     Abc_Print( -2, "\t-N <num> : (resub)the max number of nodes to add (0 <= num <= 3) [default = %d]\n", nNodesMax );
     Abc_Print( -2, "\t-F <num> : (resub)the number of fanout levels for ODC computation [default = %d]\n", nLevelsOdc );
+    Abc_Print( -2, "\t-C <num> : the TFI/TFO radius for reusing gains from the previous pass (0 = no reuse) [default = %d]\n", nCacheRadius );
+    Abc_Print( -2, "\t-P <num> : the number of threads evaluating the nodes concurrently (1 <= num <= 99) [default = %d]\n", nThreads );
+    Abc_Print( -2, "\t           (the result is the same as with one thread; with -F, one thread is used)\n" );
+    Abc_Print( -2, "\t-p <file>: apply the per-node policy (0-5, one entry per object ID) instead of the greedy choice\n" );
+    Abc_Print( -2, "\t           (binary if the extension is .orch; \"-\" uses the policy given by Abc_FrameSetOrchData())\n" );
+    Abc_Print( -2, "\t-d <file>: with -p, record the decisions made (without -d, they are kept in memory for Abc_FrameReadOrchData())\n" );
     Abc_Print( -2, "\t-l       : (resub/rw/refactor)toggle preserving the number of levels [default = %s]\n", fUpdateLevel? "yes": "no" );
     Abc_Print( -2, "\t-z       : (rw)toggle using zero-cost replacements [default = %s]\n", fUseZeros_rwr? "yes": "no" );
     Abc_Print( -2, "\t-Z       : (refactor)toggle using zero-cost replacements [default = %s]\n", fUseZeros_ref? "yes": "no" );
@@ -7865,7 +7961,8 @@ usage:
     Abc_Print( -2, "\t           performs technology-independent AIG random synthesis (node level) for RTL augmentation\n" );
     Abc_Print( -2, "\t-z       : toggle using zero-cost replacements for rwr for aigaug [default = %s]\n", fUseZeros_rwr? "yes": "no" );
     Abc_Print( -2, "\t-Z       : toggle using zero-cost replacements for ref for aigaug [default = %s]\n", fUseZeros_ref? "yes": "no" );
-    Abc_Print( -2, "\t-d       : record random synthesis decision made during augmentation [required filename; e.g., test.csv]\n");
+    Abc_Print( -2, "\t-d       : record random synthesis decision made during augmentation [e.g., test.csv; binary if the extension is .orch]\n");
+    Abc_Print( -2, "\t           (without -d, the decisions are kept in memory for Abc_FrameReadOrchData())\n");
     Abc_Print( -2, "\t-s       : set the random seed for random augmentation\n");
     Abc_Print( -2, "\t-v       : toggle verbose printout [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h       : print the command usage\n");
@@ -23010,7 +23107,7 @@ int Abc_CommandSeqSweep2( Abc_Frame_t * pAbc, int argc, char ** argv )
     // set defaults
     Ssw_ManSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "PQFCLSIVMNXcmplkodsefqvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "PQKFCLSIVMNXcmplkodsefqvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -23036,6 +23133,17 @@ int Abc_CommandSeqSweep2( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nOverSize < 0 )
                 goto usage;
             break;
+        case 'K':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-K\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs < 1 )
+                goto usage;
+            break;
         case 'F':
             if ( globalUtilOptind >= argc )
             {
@@ -23256,10 +23364,11 @@ int Abc_CommandSeqSweep2( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: scorr [-PQFCLSIVMNX <num>] [-cmplkodsefqvwh]\n" );
+    Abc_Print( -2, "usage: scorr [-PQKFCLSIVMNX <num>] [-cmplkodsefqvwh]\n" );
     Abc_Print( -2, "\t         performs sequential sweep using K-step induction\n" );
     Abc_Print( -2, "\t-P num : max partition size (0 = no partitioning) [default = %d]\n", pPars->nPartSize );
     Abc_Print( -2, "\t-Q num : partition overlap (0 = no overlap) [default = %d]\n", pPars->nOverSize );
+    Abc_Print( -2, "\t-K num : the number of threads solving partitions or batches of candidates [default = %d]\n", pPars->nProcs );
     Abc_Print( -2, "\t-F num : number of time frames for induction (1=simple) [default = %d]\n", pPars->nFramesK );
     Abc_Print( -2, "\t-C num : max number of conflicts at a node (0=inifinite) [default = %d]\n", pPars->nBTLimit );
     Abc_Print( -2, "\t-L num : max number of levels to consider (0=all) [default = %d]\n", pPars->nMaxLevs );
@@ -27193,7 +27302,7 @@ int Abc_CommandAbc9Satoko( Abc_Frame_t * pAbc, int argc, char ** argv )
     satoko_opts_t opts;
     satoko_default_opts(&opts);
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "Csivh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CIsievh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -27208,12 +27317,26 @@ int Abc_CommandAbc9Satoko( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( opts.conf_limit < 0 )
                 goto usage;
             break;
+        case 'I':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-I\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            opts.inpr_interval = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( (int)opts.inpr_interval < 0 )
+                goto usage;
+            break;
         case 's':
             fSplit ^= 1;
             break;
         case 'i':
             fIncrem ^= 1;
             break;
+        case 'e':
+            opts.f_bve ^= 1;
+            break;
         case 'v':
             opts.verbose ^= 1;
             break;
@@ -27238,11 +27361,13 @@ int Abc_CommandAbc9Satoko( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &satoko [-C num] [-sivh] <file.cnf>\n" );
+    Abc_Print( -2, "usage: &satoko [-CI num] [-sievh] <file.cnf>\n" );
     Abc_Print( -2, "\t             run Satoko by Bruno Schmitt\n" );
     Abc_Print( -2, "\t-C num     : limit on the number of conflicts [default = %d]\n", opts.conf_limit );
+    Abc_Print( -2, "\t-I num     : the number of conflicts between inprocessing rounds (0 = none) [default = %d]\n", opts.inpr_interval );
     Abc_Print( -2, "\t-s         : split multi-output miter into individual outputs [default = %s]\n", fSplit? "yes": "no" );
     Abc_Print( -2, "\t-i         : split multi-output miter and solve incrementally [default = %s]\n", fIncrem? "yes": "no" );
+    Abc_Print( -2, "\t-e         : toggle bounded variable elimination during inprocessing [default = %s]\n", opts.f_bve? "yes": "no" );
     Abc_Print( -2, "\t-v         : prints verbose information [default = %s]\n", opts.verbose? "yes": "no" );
     Abc_Print( -2, "\t<file.cnf> : (optional) CNF file to solve\n");
     Abc_Print( -2, "\t-h         : print the command usage\n");
@@ -28265,7 +28390,7 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c;
     Saig_ParBmcSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "SFTHGCDJIPQRLWaxdursgvzh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "SFTHGCDJIPQRKLWaxdursgvzh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -28401,6 +28526,17 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nLearnedPerce < 0 )
                 goto usage;
             break;
+        case 'K':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-K\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs <= 0 )
+                goto usage;
+            break;
         case 'L':
             if ( globalUtilOptind >= argc )
             {
@@ -28511,7 +28647,7 @@ int Abc_CommandBmc3( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: bmc3 [-SFTHGCDJIPQR num] [-LW file] [-axdursgvzh]\n" );
+    Abc_Print( -2, "usage: bmc3 [-SFTHGCDJIPQRK num] [-LW file] [-axdursgvzh]\n" );
     Abc_Print( -2, "\t         performs bounded model checking with dynamic unrolling\n" );
     Abc_Print( -2, "\t-S num : the starting time frame [default = %d]\n", pPars->nStart );
     Abc_Print( -2, "\t-F num : the max number of time frames (0 = unused) [default = %d]\n",      pPars->nFramesMax );
@@ -28525,6 +28661,7 @@ usage:
     Abc_Print( -2, "\t-P num : the max number of learned clauses to keep (0=unused) [default = %d]\n", pPars->nLearnedStart );
     Abc_Print( -2, "\t-Q num : delta value for learned clause removal [default = %d]\n",          pPars->nLearnedDelta );
     Abc_Print( -2, "\t-R num : percentage to keep for learned clause removal [default = %d]\n",   pPars->nLearnedPerce );
+    Abc_Print( -2, "\t-K num : the number of solver threads (not used with -JHWsg) [default = %d]\n", pPars->nProcs );
     Abc_Print( -2, "\t-L file: the log file name [default = %s]\n",                               pLogFileName ? pLogFileName : "no logging" );
     Abc_Print( -2, "\t-W file: the log file name with per-output details [default = %s]\n",       pPars->pLogFileName ? pPars->pLogFileName : "no logging" );
     Abc_Print( -2, "\t-a     : solve all outputs (do not stop when one is SAT) [default = %s]\n", pPars->fSolveAll? "yes": "no" );
@@ -30255,7 +30392,7 @@ int Abc_CommandPdr( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c;
     Pdr_ManSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "MFCDQTHGSLIaxrmuyfqipdegjonctkvwzh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "MFCDQTHGSPLIaxrmuyfqipdegjonctkvwzh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -30358,6 +30495,17 @@ int Abc_CommandPdr( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nRandomSeed < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nWorkers = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nWorkers < 1 )
+                goto usage;
+            break;
         case 'L':
             if ( globalUtilOptind >= argc )
             {
@@ -30467,6 +30615,8 @@ int Abc_CommandPdr( Abc_Frame_t * pAbc, int argc, char ** argv )
         pNtkFlop = Abc_NtkDup( pNtk );
         Abc_NtkAddLatch( pNtkFlop, Abc_AigConst1(pNtkFlop), ABC_INIT_ONE );
     }
+    if ( pPars->nWorkers > 1 && (pPars->fSolveAll || pPars->fUseAbs) )
+        Abc_Print( 0, "Parallel workers (-P) are not supported with \"-a\" and \"-t\". Using one worker.\n" );
     // run the procedure
     pPars->fUseBridge = pAbc->fBridgeMode;
     pNtkUsed = pNtkFlop ? pNtkFlop : pNtk;
@@ -30483,7 +30633,7 @@ int Abc_CommandPdr( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: pdr [-MFCDQTHGS <num>] [-LI <file>] [-axrmuyfqipdegjonctkvwzh]\n" );
+    Abc_Print( -2, "usage: pdr [-MFCDQTHGSP <num>] [-LI <file>] [-axrmuyfqipdegjonctkvwzh]\n" );
     Abc_Print( -2, "\t         model checking using property directed reachability (aka IC3)\n" );
     Abc_Print( -2, "\t         pioneered by Aaron R. Bradley (http://theory.stanford.edu/~arbrad/)\n" );
     Abc_Print( -2, "\t         with improvements by Niklas Een (http://een.se/niklas/)\n" );
@@ -30496,6 +30646,7 @@ usage:
     Abc_Print( -2, "\t-H num : runtime limit per output, in milliseconds (with \"-a\") [default = %d]\n",    pPars->nTimeOutOne );
     Abc_Print( -2, "\t-G num : runtime gap since the last CEX (0 = no limit) [default = %d]\n",              pPars->nTimeOutGap );
     Abc_Print( -2, "\t-S num : * value to seed the SAT solver with [default = %d]\n",                          pPars->nRandomSeed );
+    Abc_Print( -2, "\t-P num : the number of parallel workers sharing lemmas [default = %d]\n",              pPars->nWorkers );
     Abc_Print( -2, "\t-L file: the log file name [default = %s]\n",                                          pLogFileName ? pLogFileName : "no logging" );
     Abc_Print( -2, "\t-I file: the invariant file name [default = %s]\n",                                    pPars->pInvFileName ? pPars->pInvFileName : "default name" );
     Abc_Print( -2, "\t-a     : toggle solving all outputs even if one of them is SAT [default = %s]\n",      pPars->fSolveAll? "yes": "no" );
@@ -31620,8 +31771,9 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fSkipStrash = 0;
     int fNewReader = 0;
     int fDetectXors = 0;
+    int fSkipNames = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "csxmnlpvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "csyxmnlpvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -31631,6 +31783,9 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 's':
             fSkipStrash ^= 1;
             break;
+        case 'y':
+            fSkipNames ^= 1;
+            break;
         case 'x':
             fDetectXors ^= 1;
             break;
@@ -31689,7 +31844,7 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
 //        Abc3_ReadShowHie( FileName, fSkipStrash );
     else
     {
-        pAig = Gia_AigerRead( FileName, fGiaSimple, fSkipStrash, 0 );
+        pAig = Gia_AigerReadExt( FileName, fGiaSimple, fSkipStrash, fSkipNames, 0 );
         if ( fDetectXors )
         {
             Gia_Man_t * pTemp;
@@ -31702,10 +31857,11 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &r [-csxmnlvh] <file>\n" );
+    Abc_Print( -2, "usage: &r [-csyxmnlvh] <file>\n" );
     Abc_Print( -2, "\t         reads the current AIG from the AIGER file\n" );
     Abc_Print( -2, "\t-c     : toggles reading simple AIG [default = %s]\n", fGiaSimple? "yes": "no" );
     Abc_Print( -2, "\t-s     : toggles structural hashing while reading [default = %s]\n", !fSkipStrash? "yes": "no" );
+    Abc_Print( -2, "\t-y     : toggles skipping the symbol table while reading [default = %s]\n", fSkipNames? "yes": "no" );
     Abc_Print( -2, "\t-x     : toggles detecting XORs while reading [default = %s]\n", fDetectXors? "yes": "no" );
     Abc_Print( -2, "\t-m     : toggles reading MiniAIG rather than AIGER file [default = %s]\n", fMiniAig? "yes": "no" );
     Abc_Print( -2, "\t-n     : toggles reading MiniAIG as a set of supergates [default = %s]\n", fMiniAig2? "yes": "no" );
@@ -32945,6 +33101,124 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandAbc9WriteSnap( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    char * pFileName;
+    char ** pArgvNew;
+    int c, nArgcNew;
+    int fVerbose = 0;
+    abctime clk = Abc_Clock();
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "vh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    pArgvNew = argv + globalUtilOptind;
+    nArgcNew = argc - globalUtilOptind;
+    if ( nArgcNew != 1 )
+    {
+        Abc_Print( -1, "There is no file name.\n" );
+        return 1;
+    }
+    pFileName = argv[globalUtilOptind];
+    if ( pAbc->pGia == NULL )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9WriteSnap(): There is no AIG to write.\n" );
+        return 1;
+    }
+    if ( !Gia_ManSnapWrite( pAbc->pGia, pFileName ) )
+        return 1;
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Snapshot writing time", Abc_Clock() - clk );
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: &write_snap [-vh] <file>\n" );
+    Abc_Print( -2, "\t         writes the current AIG with all its attributes into a binary snapshot\n" );
+    Abc_Print( -2, "\t-v     : toggle verbose output [default = %s]\n", fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    Abc_Print( -2, "\t<file> : the file name\n");
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandAbc9ReadSnap( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    Gia_Man_t * pAig;
+    char * pFileName;
+    char ** pArgvNew;
+    int c, nArgcNew;
+    int fVerbose = 0;
+    abctime clk = Abc_Clock();
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "vh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    pArgvNew = argv + globalUtilOptind;
+    nArgcNew = argc - globalUtilOptind;
+    if ( nArgcNew != 1 )
+    {
+        Abc_Print( -1, "There is no file name.\n" );
+        return 1;
+    }
+    pFileName = argv[globalUtilOptind];
+    pAig = Gia_ManSnapRead( pFileName );
+    if ( pAig == NULL )
+        return 1;
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Snapshot reading time", Abc_Clock() - clk );
+    Abc_FrameUpdateGia( pAbc, pAig );
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: &read_snap [-vh] <file>\n" );
+    Abc_Print( -2, "\t         reads the AIG with all its attributes from a binary snapshot\n" );
+    Abc_Print( -2, "\t-v     : toggle verbose output [default = %s]\n", fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    Abc_Print( -2, "\t<file> : the file name\n");
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -35699,6 +35973,117 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandAbc9SimBench( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    int c, nWords = 64, nRounds = 10, Isa = -1, nThreads = 1, fLevels = 0, fVerbose = 0, fSame;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "WRIPLvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'W':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-W\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nWords = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nWords <= 0 )
+                goto usage;
+            break;
+        case 'R':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-R\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nRounds = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nRounds <= 0 )
+                goto usage;
+            break;
+        case 'I':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-I\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            Isa = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( Isa < 0 || Isa > 3 )
+                goto usage;
+            break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nThreads = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nThreads <= 0 )
+                goto usage;
+            break;
+        case 'L':
+            fLevels ^= 1;
+            break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( Isa >= 0 )
+    {
+        Isa = Gia_ManSimPatSetIsa( Isa );
+        Abc_Print( 1, "The simulator uses %s kernels.\n", Gia_ManSimPatIsaName(Isa) );
+        return 0;
+    }
+    if ( pAbc->pGia == NULL )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9SimBench(): There is no AIG.\n" );
+        return 1;
+    }
+    if ( Gia_ManCiNum(pAbc->pGia) == 0 )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9SimBench(): The AIG has no inputs.\n" );
+        return 0;
+    }
+    Abc_Random(1);
+    if ( nThreads > 1 )
+        fSame = Gia_ManSimPatBenchPar( pAbc->pGia, nWords, nRounds, nThreads, fLevels, fVerbose );
+    else
+        fSame = Gia_ManSimPatBench( pAbc->pGia, nWords, nRounds, fVerbose );
+    return !fSame;
+
+usage:
+    Abc_Print( -2, "usage: &sim_bench [-WRIP num] [-Lvh]\n" );
+    Abc_Print( -2, "\t         measures the throughput of random simulation with each instruction set\n" );
+    Abc_Print( -2, "\t-W num : the number of 64-bit words of simulation info [default = %d]\n", nWords );
+    Abc_Print( -2, "\t-R num : the number of simulation rounds [default = %d]\n",              nRounds );
+    Abc_Print( -2, "\t-I num : select kernels (0 = best, 1 = scalar, 2 = AVX2, 3 = AVX-512) and quit [default = %s]\n", Gia_ManSimPatIsaName(Gia_ManSimPatGetIsa()) );
+    Abc_Print( -2, "\t-P num : the number of threads (compared against serial simulation) [default = %d]\n", nThreads );
+    Abc_Print( -2, "\t-L     : toggle splitting the nodes of each level, rather than the words, among threads [default = %s]\n", fLevels? "yes": "no" );
+    Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -37008,6 +37393,115 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    []
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_CommandAbc9Orchestrate( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    Gia_Man_t * pTemp;
+    int c, nIters = 1, nCutRef = 10, nCutRes = 8, nDivsMax = 150;
+    int fKeepLevel = 0, fUseZeros = 0, fVerbose = 0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "NKRDlzvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'N':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-N\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nIters = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nIters < 1 )
+                goto usage;
+            break;
+        case 'K':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-K\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nCutRef = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nCutRef < 2 || nCutRef > 16 )
+                goto usage;
+            break;
+        case 'R':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-R\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nCutRes = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nCutRes < 2 || nCutRes > 16 )
+                goto usage;
+            break;
+        case 'D':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-D\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nDivsMax = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nDivsMax < 2 )
+                goto usage;
+            break;
+        case 'l':
+            fKeepLevel ^= 1;
+            break;
+        case 'z':
+            fUseZeros ^= 1;
+            break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( pAbc->pGia == NULL )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9Orchestrate(): There is no AIG.\n" );
+        return 1;
+    }
+    if ( Gia_ManBufNum(pAbc->pGia) || Gia_ManHasChoices(pAbc->pGia) )
+    {
+        Abc_Print( -1, "Abc_CommandAbc9Orchestrate(): The AIG should not have buffers or choices.\n" );
+        return 1;
+    }
+    pTemp = Gia_ManOrchestrate( pAbc->pGia, nIters, nCutRef, nCutRes, nDivsMax, fKeepLevel, fUseZeros, fVerbose );
+    Abc_FrameUpdateGia( pAbc, pTemp );
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: &orchestrate [-NKRD num] [-lzvh]\n" );
+    Abc_Print( -2, "\t           for each node, applies rewriting, resubstitution and refactoring\n" );
+    Abc_Print( -2, "\t           and keeps the result with the largest gain\n" );
+    Abc_Print( -2, "\t-N num   : the max number of passes [default = %d]\n", nIters );
+    Abc_Print( -2, "\t-K num   : the cut size for refactoring (2 <= num <= 16) [default = %d]\n", nCutRef );
+    Abc_Print( -2, "\t-R num   : the cut size for resubstitution (2 <= num <= 16) [default = %d]\n", nCutRes );
+    Abc_Print( -2, "\t-D num   : the max number of divisors for resubstitution [default = %d]\n", nDivsMax );
+    Abc_Print( -2, "\t-l       : toggle preserving the levels of the nodes [default = %s]\n", fKeepLevel? "yes": "no" );
+    Abc_Print( -2, "\t-z       : toggle using zero-cost replacements [default = %s]\n", fUseZeros? "yes": "no" );
+    Abc_Print( -2, "\t-v       : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h       : print the command usage\n");
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -38651,7 +39145,7 @@ usage:
     Abc_Print( -2, "\t-F num : the number of timeframes in inductive case [default = %d]\n", pPars->nFrames );
     Abc_Print( -2, "\t-G num : the number of timeframes in the prefix [default = %d]\n", pPars->nPrefix );
     Abc_Print( -2, "\t-X num : the number of iterations of little or no improvement [default = %d]\n", pPars->nLimitMax );
-    Abc_Print( -2, "\t-P num : the number of concurrent processes [default = %d]\n", pPars->nProcs );
+    Abc_Print( -2, "\t-P num : the number of threads solving partitions or batches of candidates [default = %d]\n", pPars->nProcs );
     Abc_Print( -2, "\t-S num : the number of flops in one partition [default = %d]\n", pPars->nPartSize );
     Abc_Print( -2, "\t-Z num : the average flop include frequency [default = %d]\n", nFlopIncFreq );
     Abc_Print( -2, "\t-p     : toggle using partitioning for the input AIG [default = %s]\n", fPartition? "yes": "no" );
@@ -38744,13 +39238,14 @@ int Abc_CommandAbc9Sat( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     extern Vec_Int_t * Cbs2_ManSolveMiterNc( Gia_Man_t * pAig, int nConfs, Vec_Str_t ** pvStatus, int fVerbose );
     extern Vec_Int_t * Cbs3_ManSolveMiterNc( Gia_Man_t * pAig, int nConfs, int nRestarts, Vec_Str_t ** pvStatus, int fVerbose );
+    extern void Cec_ManSatPropBench( Gia_Man_t * p, int nRounds, int fVerbose );
     Cec_ParSat_t ParsSat, * pPars = &ParsSat;
     Gia_Man_t * pTemp;
     int c;
-    int fNewSolver = 0, fNewSolver2 = 0, fCSat = 0, f0Proved = 0, nRestarts = 1;
+    int fNewSolver = 0, fNewSolver2 = 0, fCSat = 0, f0Proved = 0, nRestarts = 1, nBenchRounds = 0;
     Cec_ManSatSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "JCRSNanmtcxyzvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "JCRSNBanmtcxyzvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -38809,6 +39304,17 @@ int Abc_CommandAbc9Sat( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nCallsRecycle < 0 )
                 goto usage;
             break;
+        case 'B':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-B\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nBenchRounds = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nBenchRounds < 0 )
+                goto usage;
+            break;
         case 'a':
             pPars->fSaveCexes ^= 1;
             break;
@@ -38845,6 +39351,11 @@ int Abc_CommandAbc9Sat( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( -1, "Abc_CommandAbc9Sat(): There is no AIG.\n" );
         return 1;
     }
+    if ( nBenchRounds )
+    {
+        Cec_ManSatPropBench( pAbc->pGia, nBenchRounds, pPars->fVerbose );
+        return 0;
+    }
     if ( fCSat )
     {
         Vec_Int_t * vCounters;
@@ -38876,13 +39387,14 @@ int Abc_CommandAbc9Sat( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &sat [-JCRSN <num>] [-anmctxzvh]\n" );
+    Abc_Print( -2, "usage: &sat [-JCRSNB <num>] [-anmctxzvh]\n" );
     Abc_Print( -2, "\t         performs SAT solving for the combinational outputs\n" );
     Abc_Print( -2, "\t-J num : the SAT solver type [default = %d]\n", pPars->SolverType );
     Abc_Print( -2, "\t-C num : the max number of conflicts at a node [default = %d]\n", pPars->nBTLimit );
     Abc_Print( -2, "\t-R num : the max number of restarts at a node [default = %d]\n", nRestarts );
     Abc_Print( -2, "\t-S num : the min number of variables to recycle the solver [default = %d]\n", pPars->nSatVarMax );
     Abc_Print( -2, "\t-N num : the min number of calls to recycle the solver [default = %d]\n", pPars->nCallsRecycle );
+    Abc_Print( -2, "\t-B num : benchmark propagation on the CNF with num rounds of random decisions [default = %d]\n", nBenchRounds );
     Abc_Print( -2, "\t-a     : toggle solving all outputs and saving counter-examples [default = %s]\n", pPars->fSaveCexes? "yes": "no" );
     Abc_Print( -2, "\t-n     : toggle using non-chronological backtracking [default = %s]\n", pPars->fNonChrono? "yes": "no" );
     Abc_Print( -2, "\t-m     : toggle miter vs. any circuit [default = %s]\n", pPars->fCheckMiter? "miter": "circuit" );
@@ -38988,7 +39500,7 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fCbs = 1, approxLim = 600, subBatchSz = 1, adaRecycle = 500, nMaxNodes = 0;
     Cec4_ManSetParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "JWRILDCNPMFrmdckngxysopwqvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "JWRILDCNPTMFrmdckngxysopwqvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -39091,6 +39603,17 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nGenIters < 0 )
                 goto usage;
             break;
+        case 'T':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-T\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs <= 0 )
+                goto usage;
+            break;
         case 'M':
             if ( globalUtilOptind >= argc )
             {
@@ -39192,7 +39715,7 @@ int Abc_CommandAbc9Fraig( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &fraig [-JWRILDCNPM <num>] [-F filename] [-rmdckngxysopwvh]\n" );
+    Abc_Print( -2, "usage: &fraig [-JWRILDCNPTM <num>] [-F filename] [-rmdckngxysopwvh]\n" );
     Abc_Print( -2, "\t         performs combinational SAT sweeping\n" );
     Abc_Print( -2, "\t-J num : the solver type [default = %d]\n", pPars->jType );
     Abc_Print( -2, "\t-W num : the number of simulation words [default = %d]\n", pPars->nWords );
@@ -39203,6 +39726,7 @@ usage:
     Abc_Print( -2, "\t-C num : the max number of conflicts at a node [default = %d]\n", pPars->nBTLimit );
     Abc_Print( -2, "\t-N num : the min number of calls to recycle the solver [default = %d]\n", pPars->nCallsRecycle );
     Abc_Print( -2, "\t-P num : the number of pattern generation iterations [default = %d]\n", pPars->nGenIters );
+    Abc_Print( -2, "\t-T num : the number of threads for SAT sweeping (with -x) [default = %d]\n", pPars->nProcs );
     Abc_Print( -2, "\t-M num : the node count limit to call the old sweeper [default = %d]\n", nMaxNodes );
     Abc_Print( -2, "\t-F file: the file name to dump primary output information [default = none]\n" );
     Abc_Print( -2, "\t-r     : toggle the use of AIG rewriting [default = %s]\n", pPars->fRewriting? "yes": "no" );
@@ -39798,7 +40322,7 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c, nArgcNew, fUseSim = 0, fUseNewX = 0, fUseNewY = 0, fMiter = 0, fDualOutput = 0, fDumpMiter = 0;
     Cec_ManCecSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "CTnmdasxytvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CTPnmdasxytvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -39824,6 +40348,17 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->TimeLimit < 0 )
                 goto usage;
             break;
+        case 'P':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-P\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs <= 0 )
+                goto usage;
+            break;
         case 'n':
             pPars->fNaive ^= 1;
             break;
@@ -40054,8 +40589,8 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
         else if ( fUseNewX )
         {
             abctime clk = Abc_Clock();
-            extern Gia_Man_t * Cec4_ManSimulateTest3( Gia_Man_t * p, int nBTLimit, int fVerbose );
-            Gia_Man_t * pNew = Cec4_ManSimulateTest3( pMiter, pPars->nBTLimit, pPars->fVerbose );
+            extern Gia_Man_t * Cec4_ManSimulateTest3Par( Gia_Man_t * p, int nBTLimit, int nProcs, int fVerbose );
+            Gia_Man_t * pNew = Cec4_ManSimulateTest3Par( pMiter, pPars->nBTLimit, pPars->nProcs, pPars->fVerbose );
             if ( Gia_ManAndNum(pNew) == 0 )
                 Abc_Print( 1, "Networks are equivalent.  " );
             else
@@ -40088,10 +40623,11 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &cec [-CT num] [-nmdasxytvwh]\n" );
+    Abc_Print( -2, "usage: &cec [-CTP num] [-nmdasxytvwh]\n" );
     Abc_Print( -2, "\t         new combinational equivalence checker\n" );
     Abc_Print( -2, "\t-C num : the max number of conflicts at a node [default = %d]\n", pPars->nBTLimit );
     Abc_Print( -2, "\t-T num : approximate runtime limit in seconds [default = %d]\n", pPars->TimeLimit );
+    Abc_Print( -2, "\t-P num : the number of threads for SAT sweeping (with -x) [default = %d]\n", pPars->nProcs );
     Abc_Print( -2, "\t-n     : toggle using naive SAT-based checking [default = %s]\n", pPars->fNaive? "yes":"no");
     Abc_Print( -2, "\t-m     : toggle miter vs. two circuits [default = %s]\n", fMiter? "miter":"two circuits");
     Abc_Print( -2, "\t-d     : toggle using dual output miter [default = %s]\n", fDualOutput? "yes":"no");
@@ -46013,19 +46549,61 @@ usage:
 ***********************************************************************/
 int Abc_CommandAbc9Undo( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
-    int c;
+    Gia_Zip_t * pZip;
+    int c, i, nSize, nSizeOrig, nSizeAll = 0, nSizeOrigAll = 0, fPrint = 0, fSetLimit = 0;
     // set defaults
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "h" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Nph" ) ) != EOF )
     {
         switch ( c )
         {
+        case 'N':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-N\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pAbc->nGiaUndo = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pAbc->nGiaUndo < 0 )
+                goto usage;
+            fSetLimit = 1;
+            break;
+        case 'p':
+            fPrint ^= 1;
+            break;
         case 'h':
             goto usage;
         default:
             goto usage;
         }
     }
+    if ( fSetLimit )
+    {
+        // drop the oldest copies exceeding the new limit
+        while ( pAbc->vGiaUndo && Vec_PtrSize(pAbc->vGiaUndo) > pAbc->nGiaUndo )
+        {
+            Gia_ZipFree( (Gia_Zip_t *)Vec_PtrEntry(pAbc->vGiaUndo, 0) );
+            Vec_PtrDrop( pAbc->vGiaUndo, 0 );
+        }
+    }
+    if ( fPrint )
+    {
+        int nSaved = pAbc->vGiaUndo ? Vec_PtrSize(pAbc->vGiaUndo) : 0;
+        for ( i = 0; i < nSaved; i++ )
+        {
+            pZip = (Gia_Zip_t *)Vec_PtrEntry( pAbc->vGiaUndo, i );
+            nSize = Gia_ZipSize( pZip, &nSizeOrig );
+            nSizeAll += nSize;
+            nSizeOrigAll += nSizeOrig;
+        }
+        Abc_Print( 1, "Undo: Previous = %s.  Compressed = %d (out of %d).  ", pAbc->pGia2 ? "yes" : "no", nSaved, pAbc->nGiaUndo );
+        Abc_Print( 1, "Memory = %.2f MB (uncompressed %.2f MB).\n", 1.0*nSizeAll/(1<<20), 1.0*nSizeOrigAll/(1<<20) );
+        return 0;
+    }
+    // changing the limit does not undo the last transformation
+    if ( fSetLimit )
+        return 0;
     if ( pAbc->pGia == NULL )
     {
         Abc_Print( -1, "Abc_CommandAbc9Undo(): There is no design.\n" );
@@ -46038,13 +46616,16 @@ int Abc_CommandAbc9Undo( Abc_Frame_t * pAbc, int argc, char ** argv )
     }
     Gia_ManStop( pAbc->pGia );
     pAbc->pGia = pAbc->pGia2;
-    pAbc->pGia2 = NULL;
+    pAbc->pGia2 = Abc_FrameGiaUndoPop( pAbc );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &undo [-h]\n" );
+    Abc_Print( -2, "usage: &undo [-N num] [-ph]\n" );
     Abc_Print( -2, "\t        reverses the previous AIG transformation\n" );
-    Abc_Print( -2, "\t-h    : print the command usage\n");
+    Abc_Print( -2, "\t        (earlier AIGs are kept compressed and can be restored by repeated undo)\n" );
+    Abc_Print( -2, "\t-N num : sets the number of compressed AIGs to keep, without undoing [default = %d]\n", pAbc->nGiaUndo );
+    Abc_Print( -2, "\t-p     : prints the memory used by the saved AIGs, without undoing [default = %s]\n", fPrint? "yes": "no" );
+    Abc_Print( -2, "\t-h     : print the command usage\n");
     return 1;
 }
 
@@ -47418,6 +47999,9 @@ int Abc_CommandAbc9SplitProve( Abc_Frame_t * pAbc, int argc, char ** argv )
 usage:
     Abc_Print( -2, "usage: &splitprove [-PTIL num] [-svwh]\n" );
     Abc_Print( -2, "\t         proves CEC problem by case-splitting\n" );
+    Abc_Print( -2, "\t         (the engines stop as soon as one of them or scorr solves the problem,\n" );
+    Abc_Print( -2, "\t         or when scorr reduces the miter, and restart on the reduced miter;\n" );
+    Abc_Print( -2, "\t         no other results are exchanged while the engines are running)\n" );
     Abc_Print( -2, "\t-P num : the number of concurrent processes [default = %d]\n",          nProcs );
     Abc_Print( -2, "\t-T num : runtime limit in seconds per subproblem [default = %d]\n",     nTimeOut );
     Abc_Print( -2, "\t-I num : the max number of iterations (0 = infinity) [default = %d]\n", nIterMax );
@@ -47525,6 +48109,9 @@ int Abc_CommandAbc9SProve( Abc_Frame_t * pAbc, int argc, char ** argv )
 usage:
     Abc_Print( -2, "usage: &sprove [-PTUW num] [-svwh]\n" );
     Abc_Print( -2, "\t         proves CEC problem by case-splitting\n" );
+    Abc_Print( -2, "\t         (the engines stop as soon as one of them or scorr solves the problem,\n" );
+    Abc_Print( -2, "\t         or when scorr reduces the miter, and restart on the reduced miter;\n" );
+    Abc_Print( -2, "\t         no other results are exchanged while the engines are running)\n" );
     Abc_Print( -2, "\t-P num : the number of concurrent processes [default = %d]\n",          nProcs );
     Abc_Print( -2, "\t-T num : runtime limit in seconds per subproblem [default = %d]\n",     nTimeOut );
     Abc_Print( -2, "\t-U num : runtime limit in seconds per subproblem [default = %d]\n",     nTimeOut2 );
@@ -1914,6 +1914,7 @@ int Abc_NtkDSat( Abc_Ntk_t * pNtk, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimit
     assert( Abc_NtkLatchNum(pNtk) == 0 );
 //    assert( Abc_NtkPoNum(pNtk) == 1 );
     pMan = Abc_NtkToDar( pNtk, 0, 0 );
+    Cnf_CacheAttach( pMan, Abc_FrameReadCnfCache() );
     RetValue = Fra_FraigSat( pMan, nConfLimit, nInsLimit, nLearnedStart, nLearnedDelta, nLearnedPerce, fAlignPol, fAndOuts, fNewSolver, fVerbose ); 
     pNtk->pModel = (int *)pMan->pData, pMan->pData = NULL;
     Aig_ManStop( pMan );
@@ -2034,6 +2035,7 @@ int Abc_NtkDarCec( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int nConfLimit, int fPa
         Abc_Print( 1, "Converting miter into AIG has failed.\n" );
         return -1;
     }
+    Cnf_CacheAttach( pMan, Abc_FrameReadCnfCache() );
     // perform verification
     RetValue = Fra_FraigCec( &pMan, 100000, fVerbose );
     // transfer model if given
@@ -2928,6 +2930,7 @@ int Abc_NtkDarProve( Abc_Ntk_t * pNtk, Fra_Sec_t * pSecPar, int nBmcFramesMax, i
         return -1;
     }
     assert( pMan->nRegs > 0 );
+    Cnf_CacheAttach( pMan, Abc_FrameReadCnfCache() );
 
     if ( pSecPar->fTryBmc )
     {
@@ -26,6 +26,8 @@
 #include "map/mio/mio.h"
 #include "aig/aig/aig.h"
 #include "aig/gia/gia.h"
+#include "base/main/main.h"
+#include "sat/cnf/cnf.h"
 
 #ifdef ABC_USE_CUDD
 #include "bdd/extrab/extraBdd.h"
@@ -538,6 +540,7 @@ int Abc_NtkIvyProve( Abc_Ntk_t ** ppNtk, void * pPars )
     // if SAT only, solve without iteration
 //    RetValue = Abc_NtkMiterSat( pNtk, 2*(ABC_INT64_T)pParams->nMiteringLimitStart, (ABC_INT64_T)0, 0, NULL, NULL );
     pMan2 = Abc_NtkToDar( pNtk, 0, 0 );
+    Cnf_CacheAttach( pMan2, Abc_FrameReadCnfCache() );
     RetValue = Fra_FraigSat( pMan2, (ABC_INT64_T)pParams->nMiteringLimitStart, (ABC_INT64_T)0, 0, 0, 0, 1, 0, 0, 0 ); 
     pNtk->pModel = (int *)pMan2->pData, pMan2->pData = NULL;
     Aig_ManStop( pMan2 );
@@ -580,6 +583,7 @@ int Abc_NtkIvyProve( Abc_Ntk_t ** ppNtk, void * pPars )
     if ( RetValue < 0 )
     {
         pMan2 = Abc_NtkToDar( pNtk, 0, 0 );
+        Cnf_CacheAttach( pMan2, Abc_FrameReadCnfCache() );
         // dump the miter before entering high-effort solving
         if ( pParams->fVerbose )
         {
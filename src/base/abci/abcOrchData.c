@@ -0,0 +1,356 @@
+/**CFile****************************************************************
+
+  FileName    [abcOrchData.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Network and node package.]
+
+  Synopsis    [Exchanging orchestration data (edge lists, node features, decisions).]
+
+  Author      [Berkeley Logic Synthesis and Verification Group]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "base/abc/abc.h"
+#include "base/main/mainInt.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The binary file is a 32-byte header followed by nRows * nCols 32-bit
+// integers in the byte order of the host:
+//   "ORCH", version, kind (ABC_ORCH_DATA_*), nRows, nCols, 3 reserved words.
+// The file is recognized by the extension ".orch"; other file names are
+// written and read as text (one row per line, as before).
+
+#define ABC_ORCH_DATA_MAGIC    0x4843524F   // "ORCH"
+#define ABC_ORCH_DATA_VERSION  1
+#define ABC_ORCH_DATA_HEAD     8            // the number of header words
+
+static char * s_OrchDataSeps[ABC_ORCH_DATA_NUM] = { " ", ", ", "" };
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the file uses the binary format.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_OrchDataIsBinary( char * pFileName )
+{
+    char * pDot = pFileName ? strrchr( pFileName, '.' ) : NULL;
+    return pDot && !strcmp( pDot, ".orch" );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes orchestration data.]
+
+  Description [The data (vData) has nCols entries per row. If the file name
+  is NULL, the data is saved in the framework, where the driver program can
+  read it using Abc_FrameReadOrchData(). Otherwise, the data is written into
+  a binary (.orch) or a text file. Returns 1 on success.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_OrchDataWrite( char * pFileName, int Kind, Vec_Int_t * vData, int nCols )
+{
+    FILE * pFile;
+    int i, nRows = Vec_IntSize(vData) / nCols;
+    assert( Kind >= 0 && Kind < ABC_ORCH_DATA_NUM );
+    assert( Vec_IntSize(vData) % nCols == 0 );
+    if ( pFileName == NULL )
+    {
+        Abc_FrameSetOrchData( Abc_FrameGetGlobalFrame(), Kind, Vec_IntArray(vData), nRows, nCols );
+        return 1;
+    }
+    pFile = fopen( pFileName, Abc_OrchDataIsBinary(pFileName) ? "wb" : "w" );
+    if ( pFile == NULL )
+    {
+        printf( "Abc_OrchDataWrite(): Cannot open the output file \"%s\".\n", pFileName );
+        return 0;
+    }
+    if ( Abc_OrchDataIsBinary(pFileName) )
+    {
+        int pHead[ABC_ORCH_DATA_HEAD] = { ABC_ORCH_DATA_MAGIC, ABC_ORCH_DATA_VERSION, Kind, nRows, nCols, 0, 0, 0 };
+        fwrite( pHead, sizeof(int), ABC_ORCH_DATA_HEAD, pFile );
+        fwrite( Vec_IntArray(vData), sizeof(int), (size_t)Vec_IntSize(vData), pFile );
+    }
+    else
+    {
+        for ( i = 0; i < Vec_IntSize(vData); i++ )
+            fprintf( pFile, "%d%s", Vec_IntEntry(vData, i), (i + 1) % nCols ? s_OrchDataSeps[Kind] : "\n" );
+    }
+    fclose( pFile );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the binary file.]
+
+  Description [The file is memory-mapped (or read at once on Windows).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Int_t * Abc_OrchDataReadBinary( char * pFileName, int Kind, int * pnCols )
+{
+    Vec_Int_t * vData = NULL;
+    int * pHead;
+    size_t nBytes;
+    ABC_INT64_T nEntries;
+#ifndef _WIN32
+    struct stat Stat;
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd == -1 || fstat( fd, &Stat ) == -1 )
+    {
+        if ( fd != -1 ) close( fd );
+        printf( "Abc_OrchDataRead(): Cannot open the input file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    nBytes = (size_t)Stat.st_size;
+    pHead  = nBytes ? (int *)mmap( NULL, nBytes, PROT_READ, MAP_PRIVATE, fd, 0 ) : NULL;
+    close( fd );
+    if ( pHead == (int *)MAP_FAILED )
+        pHead = NULL;
+#else
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        printf( "Abc_OrchDataRead(): Cannot open the input file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    fseek( pFile, 0, SEEK_END );
+    nBytes = (size_t)ftell( pFile );
+    rewind( pFile );
+    pHead = ABC_ALLOC( int, nBytes / sizeof(int) + 1 );
+    if ( fread( pHead, 1, nBytes, pFile ) != nBytes )
+        nBytes = 0;
+    fclose( pFile );
+#endif
+    if ( pHead == NULL || nBytes < sizeof(int) * ABC_ORCH_DATA_HEAD || pHead[0] != ABC_ORCH_DATA_MAGIC || pHead[1] != ABC_ORCH_DATA_VERSION )
+        printf( "Abc_OrchDataRead(): The file \"%s\" is not an orchestration data file.\n", pFileName );
+    else if ( pHead[2] != Kind || pHead[3] < 0 || pHead[4] <= 0 )
+        printf( "Abc_OrchDataRead(): The file \"%s\" has wrong kind or size.\n", pFileName );
+    // the number of entries is computed in 64 bits and compared with the file size before allocating
+    else if ( (nEntries = (ABC_INT64_T)pHead[3] * pHead[4]) > (ABC_INT64_T)(nBytes / sizeof(int) - ABC_ORCH_DATA_HEAD) || nEntries > 0x7FFFFFFF )
+        printf( "Abc_OrchDataRead(): The file \"%s\" is truncated or too large.\n", pFileName );
+    else
+    {
+        vData = Vec_IntAlloc( (int)nEntries );
+        memcpy( Vec_IntArray(vData), pHead + ABC_ORCH_DATA_HEAD, sizeof(int) * (size_t)nEntries );
+        vData->nSize = (int)nEntries;
+        if ( pnCols ) *pnCols = pHead[4];
+    }
+#ifndef _WIN32
+    if ( pHead ) munmap( pHead, nBytes );
+#else
+    ABC_FREE( pHead );
+#endif
+    return vData;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads orchestration data.]
+
+  Description [If the file name is NULL, returns a copy of the data given
+  to the framework by the driver program (Abc_FrameSetOrchData()).
+  Otherwise, reads a binary (.orch) or a text file. Text files are parsed
+  as integers separated by spaces or commas, with one row per line.
+  The number of entries per row is returned in pnCols.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Abc_OrchDataRead( char * pFileName, int Kind, int * pnCols )
+{
+    Abc_Frame_t * pAbc = Abc_FrameGetGlobalFrame();
+    Vec_Int_t * vData;
+    char * pBuffer, * pCur, * pEnd;
+    int nCols = 0, nEntries = 0;
+    assert( Kind >= 0 && Kind < ABC_ORCH_DATA_NUM );
+    if ( pFileName == NULL )
+    {
+        if ( pAbc->vOrchData[Kind] == NULL )
+            return NULL;
+        if ( pnCols ) *pnCols = pAbc->pOrchCols[Kind];
+        return Vec_IntDup( pAbc->vOrchData[Kind] );
+    }
+    if ( Abc_OrchDataIsBinary(pFileName) )
+        return Abc_OrchDataReadBinary( pFileName, Kind, pnCols );
+    pBuffer = Extra_FileReadContents( pFileName );
+    if ( pBuffer == NULL )
+    {
+        printf( "Abc_OrchDataRead(): Cannot open the input file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    vData = Vec_IntAlloc( 1000 );
+    for ( pCur = pBuffer; *pCur; )
+    {
+        if ( *pCur == '-' || (*pCur >= '0' && *pCur <= '9') )
+        {
+            int Entry = (int)strtol( pCur, &pEnd, 10 );
+            if ( pEnd > pCur )
+            {
+                Vec_IntPush( vData, Entry );
+                pCur = pEnd;
+                nEntries++;
+                continue;
+            }
+        }
+        if ( *pCur++ == '\n' && nEntries )
+            nCols = nCols ? nCols : nEntries, nEntries = 0;
+    }
+    ABC_FREE( pBuffer );
+    if ( pnCols ) *pnCols = nCols ? nCols : Abc_MaxInt(nEntries, 1);
+    return vData;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Exchanges orchestration data with the driver program.]
+
+  Description [Abc_FrameSetOrchData() copies the data into the framework.
+  Abc_FrameReadOrchData() returns the data owned by the framework (it stays
+  valid until the next call to Abc_FrameSetOrchData() for the same kind).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_FrameSetOrchData( Abc_Frame_t * pAbc, int Kind, int * pData, int nRows, int nCols )
+{
+    assert( Kind >= 0 && Kind < ABC_ORCH_DATA_NUM );
+    Vec_IntFreeP( &pAbc->vOrchData[Kind] );
+    pAbc->vOrchData[Kind] = Vec_IntAllocArrayCopy( pData, nRows * nCols );
+    pAbc->pOrchCols[Kind] = nCols;
+}
+int * Abc_FrameReadOrchData( Abc_Frame_t * pAbc, int Kind, int * pnRows, int * pnCols )
+{
+    assert( Kind >= 0 && Kind < ABC_ORCH_DATA_NUM );
+    if ( pAbc->vOrchData[Kind] == NULL )
+        return NULL;
+    if ( pnRows ) *pnRows = Vec_IntSize(pAbc->vOrchData[Kind]) / pAbc->pOrchCols[Kind];
+    if ( pnCols ) *pnCols = pAbc->pOrchCols[Kind];
+    return Vec_IntArray( pAbc->vOrchData[Kind] );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the default parameters of the batch evaluation.]
+
+  Description [The defaults are those of the command "orchestrate". The
+  array pPars should have ABC_ORCH_PAR_NUM entries.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_FrameOrchSetDefaultPars( int * pPars )
+{
+    pPars[ABC_ORCH_PAR_ZEROS_RWR]  =  1;
+    pPars[ABC_ORCH_PAR_ZEROS_REF]  =  1;
+    pPars[ABC_ORCH_PAR_CUT_MAX]    =  8;
+    pPars[ABC_ORCH_PAR_STEPS_MAX]  =  1;
+    pPars[ABC_ORCH_PAR_LEVELS_ODC] =  0;
+    pPars[ABC_ORCH_PAR_UPDATE_LEV] =  1;
+    pPars[ABC_ORCH_PAR_NODE_MAX]   = 10;
+    pPars[ABC_ORCH_PAR_CONE_MAX]   = 16;
+    pPars[ABC_ORCH_PAR_USE_DCS]    =  0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates a batch of policies on the current network.]
+
+  Description [The policies are given as nPolicies rows of nEntries
+  decisions each, indexed by the object IDs of the current network (which
+  should be structurally hashed). The network is left unchanged. The area
+  and delay after applying each policy are written into pArea and pDelay.
+  The parameters (pPars, indexed by ABC_ORCH_PAR_*) are set by the caller;
+  if pPars is NULL, the defaults of the command "orchestrate" are used.
+  Returns the number of successful runs, or -1 if there is no AIG.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_FrameOrchEvalBatch( Abc_Frame_t * pAbc, int * pPolicies, int nPolicies, int nEntries, int * pPars, int * pArea, int * pDelay )
+{
+    extern int Abc_NtkOrchEvalBatch( Abc_Ntk_t * pNtk, Vec_Ptr_t * vPolicies, Vec_Int_t * vArea, Vec_Int_t * vDelay, int fUseZeros_rwr, int fUseZeros_ref, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int nNodeSizeMax, int nConeSizeMax, int fUseDcs, int fVerbose );
+    Abc_Ntk_t * pNtk = Abc_FrameReadNtk( pAbc );
+    Vec_Ptr_t * vPolicies;
+    Vec_Int_t * vArea, * vDelay;
+    int pDefs[ABC_ORCH_PAR_NUM];
+    int i, RetValue;
+    if ( pNtk == NULL || !Abc_NtkIsStrash(pNtk) )
+    {
+        printf( "Abc_FrameOrchEvalBatch(): The current network is not an AIG.\n" );
+        return -1;
+    }
+    if ( pPars == NULL )
+    {
+        Abc_FrameOrchSetDefaultPars( pDefs );
+        pPars = pDefs;
+    }
+    vPolicies = Vec_PtrAlloc( nPolicies );
+    for ( i = 0; i < nPolicies; i++ )
+        Vec_PtrPush( vPolicies, Vec_IntAllocArrayCopy( pPolicies + (size_t)i * nEntries, nEntries ) );
+    vArea  = Vec_IntAlloc( nPolicies );
+    vDelay = Vec_IntAlloc( nPolicies );
+    RetValue = Abc_NtkOrchEvalBatch( pNtk, vPolicies, vArea, vDelay, pPars[ABC_ORCH_PAR_ZEROS_RWR], pPars[ABC_ORCH_PAR_ZEROS_REF],
+        pPars[ABC_ORCH_PAR_CUT_MAX], pPars[ABC_ORCH_PAR_STEPS_MAX], pPars[ABC_ORCH_PAR_LEVELS_ODC], pPars[ABC_ORCH_PAR_UPDATE_LEV],
+        pPars[ABC_ORCH_PAR_NODE_MAX], pPars[ABC_ORCH_PAR_CONE_MAX], pPars[ABC_ORCH_PAR_USE_DCS], 0 );
+    memcpy( pArea,  Vec_IntArray(vArea),  sizeof(int) * nPolicies );
+    memcpy( pDelay, Vec_IntArray(vDelay), sizeof(int) * nPolicies );
+    Vec_PtrFreeFree( vPolicies );
+    Vec_IntFree( vArea );
+    Vec_IntFree( vDelay );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
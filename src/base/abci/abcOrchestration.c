@@ -24,6 +24,17 @@
 #include "bool/dec/dec.h"
 #include "opt/rwr/rwr.h"
 #include "bool/kit/kit.h"
+#include "base/main/main.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
 
 ABC_NAMESPACE_IMPL_START
 
@@ -132,6 +143,13 @@ static int           Abc_CutVolumeCheck( Abc_Obj_t * pNode, Vec_Ptr_t * vLeaves
 
 extern abctime s_ResubTime;
 
+// the gain cache attached to the network (pNtk->vOrchGains) starts with
+// the network checksum, the object count, the radius, and the parameter
+// signature, followed by the gains of each object
+#define ABC_ORCH_CACHE_HEAD      4   // the number of header entries
+#define ABC_ORCH_CACHE_GAINS     3   // rwr, res, ref
+#define ABC_ORCH_CACHE_NONE      ABC_INFINITY
+
 typedef struct Abc_ManRef_t_   Abc_ManRef_t;
 struct Abc_ManRef_t_
 {
@@ -164,6 +182,250 @@ struct Abc_ManRef_t_
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the structural checksum of the AIG.]
+
+  Description [Used to detect that the network was modified by a command
+  other than orchestration since the gain cache was saved.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static unsigned Abc_OrchCacheChecksum( Abc_Ntk_t * pNtk )
+{
+    Abc_Obj_t * pObj, * pFanin;
+    unsigned Sum = (unsigned)Abc_NtkObjNumMax(pNtk);
+    int i, k;
+    Abc_NtkForEachObj( pNtk, pObj, i )
+    {
+        Sum = (Sum * 0x9E3779B1) ^ (unsigned)(4 * pObj->Id + pObj->Type);
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            Sum = (Sum * 0x9E3779B1) ^ (unsigned)(2 * pFanin->Id + Abc_ObjFaninC(pObj, k));
+    }
+    return Sum;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts or revalidates the persistent gain cache.]
+
+  Description [The cache is attached to the network (pNtk->vOrchGains) and
+  survives between orchestration passes. For each node it stores the gains
+  of the last evaluation that did not lead to an update. The entry is dropped
+  when a node within nRadius levels in the TFI/TFO of the node is replaced.
+  The cache is reset if the radius or the parameters (pPars) change, or if
+  the network was modified elsewhere. If nRadius is 0, the cache is freed.
+  Returns the number of reused entries.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkOrchCacheStart( Abc_Ntk_t * pNtk, int nRadius, int * pPars, int nPars, int fVerbose )
+{
+    Vec_Int_t * vCache = pNtk->vOrchGains;
+    unsigned ParSig = (unsigned)nRadius;
+    int i, Entry, nReused = 0;
+    if ( nRadius <= 0 )
+    {
+        Vec_IntFreeP( &pNtk->vOrchGains );
+        return 0;
+    }
+    for ( i = 0; i < nPars; i++ )
+        ParSig = (ParSig * 0x9E3779B1) ^ (unsigned)pPars[i];
+    if ( vCache && (unsigned)Vec_IntEntry(vCache, 0) == Abc_OrchCacheChecksum(pNtk) &&
+         Vec_IntEntry(vCache, 1) == Abc_NtkObjNumMax(pNtk) &&
+         Vec_IntEntry(vCache, 2) == nRadius && (unsigned)Vec_IntEntry(vCache, 3) == ParSig )
+    {
+        Vec_IntForEachEntryStart( vCache, Entry, i, ABC_ORCH_CACHE_HEAD )
+            nReused += ((i - ABC_ORCH_CACHE_HEAD) % ABC_ORCH_CACHE_GAINS == 0 && Entry != ABC_ORCH_CACHE_NONE);
+    }
+    else
+    {
+        Vec_IntFreeP( &pNtk->vOrchGains );
+        vCache = pNtk->vOrchGains = Vec_IntAlloc( ABC_ORCH_CACHE_HEAD + ABC_ORCH_CACHE_GAINS * Abc_NtkObjNumMax(pNtk) );
+        Vec_IntFill( vCache, ABC_ORCH_CACHE_HEAD + ABC_ORCH_CACHE_GAINS * Abc_NtkObjNumMax(pNtk), ABC_ORCH_CACHE_NONE );
+        Vec_IntWriteEntry( vCache, 0, (int)Abc_OrchCacheChecksum(pNtk) );
+        Vec_IntWriteEntry( vCache, 1, Abc_NtkObjNumMax(pNtk) );
+        Vec_IntWriteEntry( vCache, 2, nRadius );
+        Vec_IntWriteEntry( vCache, 3, (int)ParSig );
+    }
+    if ( fVerbose )
+        printf( "Gain cache: radius = %d. Reused entries = %d (out of %d nodes).\n", nRadius, nReused, Abc_NtkNodeNum(pNtk) );
+    return nReused;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Looks up the cached gains of the node.]
+
+  Description [Returns 1 if the node was evaluated in an earlier pass without
+  leading to an update and nothing changed around it since then. In this case,
+  the gains (rwr, res, ref) are copied into pGains.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_OrchCacheLookup( Abc_Ntk_t * pNtk, Abc_Obj_t * pNode, int * pGains )
+{
+    int * pEntry, Index = ABC_ORCH_CACHE_HEAD + ABC_ORCH_CACHE_GAINS * pNode->Id;
+    if ( pNtk->vOrchGains == NULL || Index >= Vec_IntSize(pNtk->vOrchGains) )
+        return 0;
+    pEntry = Vec_IntEntryP( pNtk->vOrchGains, Index );
+    if ( pEntry[0] == ABC_ORCH_CACHE_NONE )
+        return 0;
+    if ( pGains )
+        memcpy( pGains, pEntry, sizeof(int) * ABC_ORCH_CACHE_GAINS );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the gains of a node that was evaluated but not updated.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_OrchCacheRecord( Abc_Ntk_t * pNtk, Abc_Obj_t * pNode, int GainRwr, int GainRes, int GainRef )
+{
+    int * pEntry, Index = ABC_ORCH_CACHE_HEAD + ABC_ORCH_CACHE_GAINS * pNode->Id;
+    if ( pNtk->vOrchGains == NULL )
+        return;
+    Vec_IntFillExtra( pNtk->vOrchGains, Index + ABC_ORCH_CACHE_GAINS, ABC_ORCH_CACHE_NONE );
+    pEntry = Vec_IntEntryP( pNtk->vOrchGains, Index );
+    pEntry[0] = GainRwr;
+    pEntry[1] = GainRes;
+    pEntry[2] = GainRef;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Drops the cached gains in the TFI/TFO of the node.]
+
+  Description [Performs breadth-first traversal in both directions, up to
+  the cache radius, so that every node is visited once.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_OrchCacheInvalidate( Abc_Obj_t * pRoot )
+{
+    Abc_Ntk_t * pNtk = pRoot->pNtk;
+    Vec_Ptr_t * vFront = Vec_PtrAlloc( 16 );
+    Vec_Ptr_t * vNext  = Vec_PtrAlloc( 16 ), * vTemp;
+    Abc_Obj_t * pObj, * pNext;
+    int nRadius = Vec_IntEntry( pNtk->vOrchGains, 2 );
+    int fFanouts, d, i, k, Index;
+    for ( fFanouts = 0; fFanouts < 2; fFanouts++ )
+    {
+        Abc_NtkIncrementTravId( pNtk );
+        Abc_NodeSetTravIdCurrent( pRoot );
+        Vec_PtrFill( vFront, 1, pRoot );
+        for ( d = 0; d <= nRadius && Vec_PtrSize(vFront) > 0; d++ )
+        {
+            Vec_PtrClear( vNext );
+            Vec_PtrForEachEntry( Abc_Obj_t *, vFront, pObj, i )
+            {
+                Index = ABC_ORCH_CACHE_HEAD + ABC_ORCH_CACHE_GAINS * pObj->Id;
+                if ( Index < Vec_IntSize(pNtk->vOrchGains) )
+                    Vec_IntWriteEntry( pNtk->vOrchGains, Index, ABC_ORCH_CACHE_NONE );
+                if ( d == nRadius )
+                    continue;
+                if ( fFanouts )
+                {
+                    Abc_ObjForEachFanout( pObj, pNext, k )
+                        if ( !Abc_NodeIsTravIdCurrent(pNext) )
+                            Abc_NodeSetTravIdCurrent( pNext ), Vec_PtrPush( vNext, pNext );
+                }
+                else
+                {
+                    Abc_ObjForEachFanin( pObj, pNext, k )
+                        if ( !Abc_NodeIsTravIdCurrent(pNext) )
+                            Abc_NodeSetTravIdCurrent( pNext ), Vec_PtrPush( vNext, pNext );
+                }
+            }
+            vTemp = vFront; vFront = vNext; vNext = vTemp;
+        }
+    }
+    Vec_PtrFree( vFront );
+    Vec_PtrFree( vNext );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Updates the network while keeping the gain cache consistent.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_OrchUpdateNetwork( Abc_Obj_t * pRoot, Dec_Graph_t * pGraph, int fUpdateLevel, int nGain )
+{
+    if ( pRoot->pNtk->vOrchGains )
+        Abc_OrchCacheInvalidate( pRoot );
+    return Dec_GraphUpdateNetwork( pRoot, pGraph, fUpdateLevel, nGain );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reassigns object IDs while remapping the gain cache.]
+
+  Description [Saves the checksum of the resulting network, which is used
+  to validate the cache at the start of the next pass.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_OrchReassignIds( Abc_Ntk_t * pNtk )
+{
+    Vec_Int_t * vOld = pNtk->vOrchGains;
+    Vec_Ptr_t * vObjs;
+    Abc_Obj_t * pObj;
+    int i, Index;
+    if ( vOld == NULL )
+    {
+        Abc_NtkReassignIds( pNtk );
+        return;
+    }
+    // remember the objects by their old IDs
+    vObjs = Vec_PtrDup( pNtk->vObjs );
+    Abc_NtkReassignIds( pNtk );
+    pNtk->vOrchGains = Vec_IntAlloc( ABC_ORCH_CACHE_HEAD + ABC_ORCH_CACHE_GAINS * Abc_NtkObjNumMax(pNtk) );
+    Vec_IntFill( pNtk->vOrchGains, ABC_ORCH_CACHE_HEAD + ABC_ORCH_CACHE_GAINS * Abc_NtkObjNumMax(pNtk), ABC_ORCH_CACHE_NONE );
+    Vec_IntWriteEntry( pNtk->vOrchGains, 0, (int)Abc_OrchCacheChecksum(pNtk) );
+    Vec_IntWriteEntry( pNtk->vOrchGains, 1, Abc_NtkObjNumMax(pNtk) );
+    Vec_IntWriteEntry( pNtk->vOrchGains, 2, Vec_IntEntry(vOld, 2) );
+    Vec_IntWriteEntry( pNtk->vOrchGains, 3, Vec_IntEntry(vOld, 3) );
+    Vec_PtrForEachEntry( Abc_Obj_t *, vObjs, pObj, i )
+    {
+        Index = ABC_ORCH_CACHE_HEAD + ABC_ORCH_CACHE_GAINS * i;
+        if ( pObj == NULL || Index >= Vec_IntSize(vOld) )
+            continue;
+        memcpy( Vec_IntEntryP(pNtk->vOrchGains, ABC_ORCH_CACHE_HEAD + ABC_ORCH_CACHE_GAINS * pObj->Id),
+                Vec_IntEntryP(vOld, Index), sizeof(int) * ABC_ORCH_CACHE_GAINS );
+    }
+    Vec_PtrFree( vObjs );
+    Vec_IntFree( vOld );
+}
+
 /** Function***********************************************************
  Rewrite
 **********************************************************************/
@@ -259,7 +521,7 @@ Rwr_ManAddTimeTotal( pManRwr, Abc_Clock() - clkStart );
     pNtk->pManCut = NULL;
 
     {
-    Abc_NtkReassignIds( pNtk );
+    Abc_OrchReassignIds( pNtk );
     }
     if ( fUpdateLevel )
         Abc_NtkStopReverseLevels( pNtk );
@@ -542,7 +804,7 @@ pManRef->timeTotal = Abc_Clock() - clkStart;
         Abc_NtkManRefPrintStats_1( pManRef );
     Abc_NtkManCutStop( pManCut );
     Abc_NtkManRefStop_1( pManRef );
-    Abc_NtkReassignIds( pNtk );
+    Abc_OrchReassignIds( pNtk );
     if ( RetValue != -1 )
     {
         if ( fUpdateLevel )
@@ -712,7 +974,7 @@ pManRes->timeTotal = Abc_Clock() - clkStart;
     }
 
     // put the nodes into the DFS order and reassign their IDs
-    Abc_NtkReassignIds( pNtk );
+    Abc_OrchReassignIds( pNtk );
 //    Abc_AigCheckFaninOrder( pNtk->pManFunc );
     // fix the levels
     if ( fUpdateLevel )
@@ -2663,107 +2925,436 @@ Vec_Ptr_t * Abc_CutFactorLarge( Abc_Obj_t * pNode, int nLeavesMax )
 }
 
 
-int Abc_NtkOrchSA( Abc_Ntk_t * pNtk, Vec_Int_t **pGain_rwr, Vec_Int_t **pGain_res,Vec_Int_t **pGain_ref, Vec_Int_t **PolicyList, char * DecisionFile, int fUseZeros_rwr, int fUseZeros_ref, int fPlaceEnable, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int fVerbose, int fVeryVerbose, int nNodeSizeMax, int nConeSizeMax, int fUseDcs )
+/**Function*************************************************************
+
+  Synopsis    [Saves and loads a replacement.]
+
+  Description [The saved copy refers to the leaves by their literals
+  (object ID and complementation), so that it can be loaded into any
+  network whose object IDs are the same. If fCompl is set, the saved
+  copy is complemented.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Dec_Graph_t * Abc_OrchGraphSave( Dec_Graph_t * pGraph, int fCompl )
 {
-    ProgressBar * pProgress;
-    // For resub
-    Abc_ManRes_t * pManRes;
-    Abc_ManCut_t * pManCutRes;
-    Odc_Man_t * pManOdc = NULL;
-    Dec_Graph_t * pFFormRes;
-    Vec_Ptr_t * vLeaves;
-    // For rewrite
-    Cut_Man_t * pManCutRwr;
-    Rwr_Man_t * pManRwr;
-    Dec_Graph_t * pGraph;
-    // For refactor
-    Abc_ManRef_t * pManRef;
-    Abc_ManCut_t * pManCutRef;
-    Dec_Graph_t * pFFormRef;
-    Vec_Ptr_t * vFanins;
-    Vec_Int_t * DecisionMask = Vec_IntAlloc(1);
+    Dec_Graph_t * pNew = ABC_ALLOC( Dec_Graph_t, 1 );
+    int i;
+    *pNew = *pGraph;
+    pNew->nCap   = Abc_MaxInt( pGraph->nSize, 1 );
+    pNew->pNodes = ABC_ALLOC( Dec_Node_t, pNew->nCap );
+    if ( pGraph->nSize )
+        memcpy( pNew->pNodes, pGraph->pNodes, sizeof(Dec_Node_t) * pGraph->nSize );
+    for ( i = 0; i < pGraph->nLeaves; i++ )
+        pNew->pNodes[i].iFunc = Abc_ObjToLit( (Abc_Obj_t *)pGraph->pNodes[i].pFunc );
+    if ( fCompl )
+        Dec_GraphComplement( pNew );
+    return pNew;
+}
+static Dec_Graph_t * Abc_OrchGraphLoad( Dec_Graph_t * pSaved, Abc_Ntk_t * pNtk )
+{
+    Dec_Graph_t * pNew = ABC_ALLOC( Dec_Graph_t, 1 );
+    int i;
+    *pNew = *pSaved;
+    pNew->pNodes = ABC_ALLOC( Dec_Node_t, pNew->nCap );
+    if ( pSaved->nSize )
+        memcpy( pNew->pNodes, pSaved->pNodes, sizeof(Dec_Node_t) * pSaved->nSize );
+    for ( i = 0; i < pSaved->nLeaves; i++ )
+        pNew->pNodes[i].pFunc = Abc_ObjFromLit( pNtk, pSaved->pNodes[i].iFunc );
+    return pNew;
+}
 
-    Abc_Obj_t * pNode;
-    FILE *fpt;
-    abctime clk, clkStart = Abc_Clock();
-    abctime s_ResubTime;
-    int i, nNodes, nGain, fCompl, RetValue = 1;
-    int ops_rwr = 0;
-    int ops_res = 0;
-    int ops_ref = 0;
-    int ops_null = 0;
-    int sOpsOrder = 0;
-    assert( Abc_NtkIsStrash(pNtk) );
 
-    // cleanup the AIG
-    Abc_AigCleanup((Abc_Aig_t *)pNtk->pManFunc);
+/**Function*************************************************************
 
-    // start the managers resub
-    pManCutRes = Abc_NtkManCutStart( nCutMax, 100000, 100000, 100000 );
-    pManRes = Abc_ManResubStart( nCutMax, ABC_RS_DIV1_MAX );
-    if ( nLevelsOdc > 0 )
-    pManOdc = Abc_NtkDontCareAlloc( nCutMax, nLevelsOdc, fVerbose, fVeryVerbose );
-    // start the managers refactor
-    pManCutRef = Abc_NtkManCutStart( nNodeSizeMax, nConeSizeMax, 2, 1000 );
-    pManRef = Abc_NtkManRefStart_1( nNodeSizeMax, nConeSizeMax, fUseDcs, fVerbose );
-    pManRef->vLeaves   = Abc_NtkManCutReadCutLarge( pManCutRef );
-    // start the managers rewrite
-    pManRwr = Rwr_ManStart( 0 );
-    if ( pManRwr == NULL )
-        return 0;
+  Synopsis    [Starts the managers used by the policy-driven orchestration.]
 
-    // compute the reverse levels if level update is requested
-    if ( fUpdateLevel )
-        Abc_NtkStartReverseLevels( pNtk, 0 );
-    if ( Abc_NtkLatchNum(pNtk) ) {
-        Abc_NtkForEachLatch(pNtk, pNode, i)
-            pNode->pNext = (Abc_Obj_t *)pNode->pData;
+  Description [The managers do not depend on the network, so they can be
+  shared by many runs (see Abc_NtkOrchEvalBatch()). If fShare is set, the
+  first run also computes the cuts and the resubstitution candidates of the
+  network it starts from (see Abc_OrchManShareStart()), and the following
+  runs reuse them where their network still has the same structure.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#define ABC_ORCH_SHARE_OBJS_MAX  (1<<24)  // the max number of objects recorded for resubstitution
+
+typedef struct Abc_OrchMan_t_ Abc_OrchMan_t;
+struct Abc_OrchMan_t_
+{
+    Abc_ManRes_t *   pManRes;      // resub
+    Abc_ManCut_t *   pManCutRes;
+    Odc_Man_t *      pManOdc;
+    Rwr_Man_t *      pManRwr;      // rewrite
+    Abc_ManRef_t *   pManRef;      // refactor
+    Abc_ManCut_t *   pManCutRef;
+    // the data computed once for the starting network
+    int              fShare;       // computes and reuses the data
+    int              nObjsShr;     // the number of objects of the starting network
+    Vec_Int_t *      vFaninsShr;   // the fanin literals of its nodes (-1 for other objects)
+    Cut_Man_t *      pCutsShr;     // the cuts of its nodes
+    Vec_Str_t *      vCutsSame;    // marks the nodes of the current run having the same cuts
+    Vec_Int_t *      vResStarts;   // the beginning of the objects of each node in vResObjs
+    Vec_Int_t *      vResObjs;     // the objects read by resubstitution (see Abc_OrchManResSig())
+    Vec_Wrd_t *      vResSigs;     // the signature of these objects
+    Vec_Int_t *      vResGains;    // the gain of resubstitution
+    Vec_Ptr_t *      vResGraphs;   // the replacement saved by Abc_OrchGraphSave() (or NULL)
+    int              nCutsShared;  // the number of nodes whose cuts were reused
+    int              nResShared;   // the number of nodes whose resubstitution was reused
+};
+static Abc_OrchMan_t * Abc_OrchManStart( int nCutMax, int nLevelsOdc, int nNodeSizeMax, int nConeSizeMax, int fUseDcs, int fVerbose, int fVeryVerbose )
+{
+    Abc_OrchMan_t * p = ABC_CALLOC( Abc_OrchMan_t, 1 );
+    p->pManCutRes = Abc_NtkManCutStart( nCutMax, 100000, 100000, 100000 );
+    p->pManRes    = Abc_ManResubStart( nCutMax, ABC_RS_DIV1_MAX );
+    if ( nLevelsOdc > 0 )
+        p->pManOdc = Abc_NtkDontCareAlloc( nCutMax, nLevelsOdc, fVerbose, fVeryVerbose );
+    p->pManCutRef = Abc_NtkManCutStart( nNodeSizeMax, nConeSizeMax, 2, 1000 );
+    p->pManRef    = Abc_NtkManRefStart_1( nNodeSizeMax, nConeSizeMax, fUseDcs, fVerbose );
+    p->pManRef->vLeaves = Abc_NtkManCutReadCutLarge( p->pManCutRef );
+    p->pManRwr    = Rwr_ManStart( 0 );
+    return p;
+}
+static void Abc_OrchManStop( Abc_OrchMan_t * p )
+{
+    Dec_Graph_t * pGraph;
+    int i;
+    Abc_ManResubStop( p->pManRes );
+    Abc_NtkManCutStop( p->pManCutRes );
+    if ( p->pManOdc ) Abc_NtkDontCareFree( p->pManOdc );
+    Rwr_ManStop( p->pManRwr );
+    Abc_NtkManCutStop( p->pManCutRef );
+    Abc_NtkManRefStop_1( p->pManRef );
+    if ( p->pCutsShr )
+    {
+        Cut_ManStop( p->pCutsShr );
+        Vec_IntFree( p->vFaninsShr );
+        Vec_StrFree( p->vCutsSame );
+        Vec_PtrForEachEntry( Dec_Graph_t *, p->vResGraphs, pGraph, i )
+            if ( pGraph ) Dec_GraphFree( pGraph );
+        Vec_PtrFree( p->vResGraphs );
+        Vec_IntFree( p->vResStarts );
+        Vec_IntFree( p->vResObjs );
+        Vec_WrdFree( p->vResSigs );
+        Vec_IntFree( p->vResGains );
     }
-clk = Abc_Clock();
-    pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk );
-Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
-    pNtk->pManCut = pManCutRwr;
+    ABC_FREE( p );
+}
 
-    if ( fVeryVerbose )
-        Rwr_ScoresClean( pManRwr );
+/**Function*************************************************************
 
-    pManRes->nNodesBeg = Abc_NtkNodeNum(pNtk);
-    pManRwr->nNodesBeg = Abc_NtkNodeNum(pNtk);
-    pManRef->nNodesBeg = Abc_NtkNodeNum(pNtk);
+  Synopsis    [Computes the signature of the objects read by resubstitution.]
 
-    nNodes = Abc_NtkObjNumMax(pNtk);
-    //printf("nNodes: %d\n", nNodes);
-    if (pGain_res) *pGain_res = Vec_IntAlloc(1);
-    if (pGain_ref) *pGain_ref = Vec_IntAlloc(1);
-    if (pGain_rwr) *pGain_rwr = Vec_IntAlloc(1);
-    for(int i=0; i < nNodes; i++){Vec_IntPush(DecisionMask, atoi("-1"));}
+  Description [The objects (pObjs) are given by their IDs and a flag, which
+  is set for the fanouts of the divisors. Resubstitution reads the level and
+  the fanins of these fanouts, while for the other objects (the nodes of the
+  window and the divisors) it also reads the fanouts. Returns 0 if one of
+  the objects was removed.]
+               
+  SideEffects []
 
-    pProgress = Extra_ProgressBarStart( stdout, nNodes );
-    fpt = fopen(DecisionFile, "w");
+  SeeAlso     []
 
-    Abc_NtkForEachNode( pNtk, pNode, i )
+***********************************************************************/
+static inline word Abc_OrchSigAdd( word Sig, int Value )
+{
+    Sig = (Sig ^ (word)(unsigned)Value) * ABC_CONST(0x9E3779B97F4A7C15);
+    return Sig ^ (Sig >> 29);
+}
+static int Abc_OrchManResSig( Abc_Obj_t * pRoot, int * pObjs, int nObjs, int fUpdateLevel, word * pSig )
+{
+    Abc_Obj_t * pObj, * pFanout;
+    word Sig = Abc_OrchSigAdd( 0, fUpdateLevel ? Abc_ObjRequiredLevel(pRoot) : ABC_INFINITY );
+    int i, k;
+    for ( i = 0; i < nObjs; i++ )
     {
-        int iterNode = pNode->Id;
-        Extra_ProgressBarUpdate( pProgress, i, NULL );
-        if ( Abc_NodeIsPersistant(pNode) )
+        pObj = Abc_NtkObj( pRoot->pNtk, pObjs[i] >> 1 );
+        if ( pObj == NULL )
+            return 0;
+        Sig = Abc_OrchSigAdd( Sig, pObj->Id );
+        Sig = Abc_OrchSigAdd( Sig, pObj->Type );
+        Sig = Abc_OrchSigAdd( Sig, pObj->Level );
+        if ( Abc_ObjIsNode(pObj) )
         {
-            //fprintf(fpt, "%d, %d\n", iterNode, -99);
-            Vec_IntPush((*pGain_res), -99);
-            Vec_IntPush((*pGain_ref), -99);
-            Vec_IntPush((*pGain_rwr), -99);
-            continue;
+            Sig = Abc_OrchSigAdd( Sig, Abc_Var2Lit(Abc_ObjFaninId0(pObj), Abc_ObjFaninC0(pObj)) );
+            Sig = Abc_OrchSigAdd( Sig, Abc_Var2Lit(Abc_ObjFaninId1(pObj), Abc_ObjFaninC1(pObj)) );
         }
-        if ( Abc_ObjFanoutNum(pNode) > 1000 )
-        {
-            //fprintf(fpt, "%d, %d\n", iterNode, -99);
-            Vec_IntPush((*pGain_res), -99);
-            Vec_IntPush((*pGain_ref), -99);
-            Vec_IntPush((*pGain_rwr), -99);
+        if ( pObjs[i] & 1 )
             continue;
-        }
-        if ( i >= nNodes )
-            break;
-
+        Sig = Abc_OrchSigAdd( Sig, Abc_ObjFanoutNum(pObj) );
+        if ( Abc_ObjFanoutNum(pObj) > 100 ) // the fanouts are not used (see Abc_ManResubCollectDivs())
+            continue;
+        Abc_ObjForEachFanout( pObj, pFanout, k )
+            Sig = Abc_OrchSigAdd( Sig, pFanout->Id );
+    }
+    *pSig = Sig;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the data shared by the runs.]
+
+  Description [Is called by the first run on the network it starts from.
+  Computes the cuts of all nodes used by rewriting and evaluates
+  resubstitution of all nodes. For each node, it records the objects read
+  while doing this (the nodes visited when computing the cut, the divisors
+  and their fanouts) and their signature. The result of resubstitution
+  depends only on these objects, so a later run can reuse it if the
+  signature has not changed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_OrchManShareStart( Abc_OrchMan_t * p, Abc_Ntk_t * pNtk, int nStepsMax, int fUpdateLevel )
+{
+    Abc_Obj_t * pObj, * pFanout;
+    Vec_Ptr_t * vLeaves, * vObjs;
+    Dec_Graph_t * pGraph;
+    word Sig;
+    int i, k, j, iStart;
+    assert( p->pCutsShr == NULL && p->pManOdc == NULL );
+    p->nObjsShr   = Abc_NtkObjNumMax( pNtk );
+    p->vFaninsShr = Vec_IntStartFull( 2 * p->nObjsShr );
+    Abc_NtkForEachNode( pNtk, pObj, i )
+    {
+        Vec_IntWriteEntry( p->vFaninsShr, 2*i,   Abc_Var2Lit(Abc_ObjFaninId0(pObj), Abc_ObjFaninC0(pObj)) );
+        Vec_IntWriteEntry( p->vFaninsShr, 2*i+1, Abc_Var2Lit(Abc_ObjFaninId1(pObj), Abc_ObjFaninC1(pObj)) );
+    }
+    // compute the cuts
+    p->pCutsShr  = Abc_NtkStartCutManForRewrite( pNtk );
+    p->vCutsSame = Vec_StrAlloc( p->nObjsShr );
+    Abc_NtkForEachNode( pNtk, pObj, i )
+        Abc_NodeGetCutsRecursive( p->pCutsShr, pObj, 0, 0 );
+    // evaluate resubstitution
+    p->vResStarts = Vec_IntAlloc( p->nObjsShr + 1 );
+    p->vResObjs   = Vec_IntAlloc( 1000 );
+    p->vResSigs   = Vec_WrdStart( p->nObjsShr );
+    p->vResGains  = Vec_IntStartFull( p->nObjsShr );
+    p->vResGraphs = Vec_PtrStart( p->nObjsShr );
+    for ( i = 0; i < p->nObjsShr; i++ )
+    {
+        Vec_IntPush( p->vResStarts, Vec_IntSize(p->vResObjs) );
+        pObj = Abc_NtkObj( pNtk, i );
+        if ( pObj == NULL || !Abc_ObjIsNode(pObj) || Abc_NodeIsPersistant(pObj) || Abc_ObjFanoutNum(pObj) > 1000 )
+            continue;
+        if ( Vec_IntSize(p->vResObjs) > ABC_ORCH_SHARE_OBJS_MAX )
+            continue;
+        vLeaves = Abc_NodeFindCut( p->pManCutRes, pObj, 0 );
+        pGraph  = Abc_ManResubEval( p->pManRes, pObj, vLeaves, nStepsMax, fUpdateLevel, 0 );
+        Vec_IntWriteEntry( p->vResGains, i, p->pManRes->nLastGain );
+        if ( pGraph )
+        {
+            Vec_PtrWriteEntry( p->vResGraphs, i, Abc_OrchGraphSave(pGraph, 0) );
+            Dec_GraphFree( pGraph );
+        }
+        // collect the objects read
+        Abc_NtkIncrementTravId( pNtk );
+        for ( k = 0; k < 2; k++ )
+        {
+            vObjs = k ? p->pManRes->vDivs : Abc_NtkManCutReadVisited( p->pManCutRes );
+            Vec_PtrForEachEntry( Abc_Obj_t *, vObjs, pFanout, j )
+                if ( !Abc_NodeIsTravIdCurrent(pFanout) )
+                {
+                    Abc_NodeSetTravIdCurrent( pFanout );
+                    Vec_IntPush( p->vResObjs, Abc_Var2Lit(pFanout->Id, 0) );
+                }
+        }
+        iStart = Vec_IntEntryLast( p->vResStarts );
+        for ( k = iStart; k < Vec_IntSize(p->vResObjs); k++ )
+        {
+            Abc_Obj_t * pDiv = Abc_NtkObj( pNtk, Abc_Lit2Var(Vec_IntEntry(p->vResObjs, k)) );
+            if ( Abc_LitIsCompl(Vec_IntEntry(p->vResObjs, k)) || Abc_ObjFanoutNum(pDiv) > 100 )
+                continue;
+            Abc_ObjForEachFanout( pDiv, pFanout, j )
+                if ( !Abc_NodeIsTravIdCurrent(pFanout) )
+                {
+                    Abc_NodeSetTravIdCurrent( pFanout );
+                    Vec_IntPush( p->vResObjs, Abc_Var2Lit(pFanout->Id, 1) );
+                }
+        }
+        Abc_OrchManResSig( pObj, Vec_IntEntryP(p->vResObjs, iStart), Vec_IntSize(p->vResObjs) - iStart, fUpdateLevel, &Sig );
+        Vec_WrdWriteEntry( p->vResSigs, i, Sig );
+    }
+    Vec_IntPush( p->vResStarts, Vec_IntSize(p->vResObjs) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reuses the result of resubstitution computed for the starting network.]
+
+  Description [Returns 1 if the objects read by resubstitution of the node
+  are the same as in the starting network. In this case, the gain is set
+  in the resubstitution manager and the replacement (or NULL) in ppGraph.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_OrchManShareResub( Abc_OrchMan_t * p, Abc_Obj_t * pNode, int fUpdateLevel, Dec_Graph_t ** ppGraph )
+{
+    Dec_Graph_t * pSaved;
+    word Sig;
+    int iStart;
+    if ( pNode->Id >= p->nObjsShr ||
+         Vec_IntEntry(p->vFaninsShr, 2*pNode->Id)   != Abc_Var2Lit(Abc_ObjFaninId0(pNode), Abc_ObjFaninC0(pNode)) ||
+         Vec_IntEntry(p->vFaninsShr, 2*pNode->Id+1) != Abc_Var2Lit(Abc_ObjFaninId1(pNode), Abc_ObjFaninC1(pNode)) )
+        return 0;
+    iStart = Vec_IntEntry( p->vResStarts, pNode->Id );
+    if ( iStart == Vec_IntEntry(p->vResStarts, pNode->Id + 1) )
+        return 0;
+    if ( !Abc_OrchManResSig( pNode, Vec_IntEntryP(p->vResObjs, iStart), Vec_IntEntry(p->vResStarts, pNode->Id + 1) - iStart, fUpdateLevel, &Sig ) )
+        return 0;
+    if ( Sig != Vec_WrdEntry(p->vResSigs, pNode->Id) )
+        return 0;
+    pSaved = (Dec_Graph_t *)Vec_PtrEntry( p->vResGraphs, pNode->Id );
+    *ppGraph = pSaved ? Abc_OrchGraphLoad( pSaved, pNode->pNtk ) : NULL;
+    p->pManRes->nLastGain = Vec_IntEntry( p->vResGains, pNode->Id );
+    p->nResShared++;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the cuts of the node for rewriting.]
+
+  Description [Does the same as Abc_NodeGetCutsRecursive(), except that
+  the cuts of a node are copied from the starting network if the node has
+  the same fanins there and the cuts of the fanins are the same. The cuts
+  of a node are kept when the cone below it changes, so the copied cuts
+  remain the same until the fanins of the node change, which happens only
+  when its cuts are freed (see Abc_AigAndDelete()). Returns 1 if the cuts
+  of the node are the same as in the starting network.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_OrchManShareCuts_rec( Abc_OrchMan_t * p, Cut_Man_t * pManCut, Abc_Obj_t * pObj )
+{
+    int fSame0, fSame1, fSame;
+    if ( Abc_ObjIsCi(pObj) )
+        return 1;
+    if ( Abc_NodeReadCuts(pManCut, pObj) )
+        return Vec_StrEntry( p->vCutsSame, pObj->Id );
+    fSame0 = Abc_OrchManShareCuts_rec( p, pManCut, Abc_ObjFanin0(pObj) );
+    fSame1 = Abc_OrchManShareCuts_rec( p, pManCut, Abc_ObjFanin1(pObj) );
+    fSame  = fSame0 && fSame1 && pObj->Id < p->nObjsShr &&
+        Vec_IntEntry(p->vFaninsShr, 2*pObj->Id)   == Abc_Var2Lit(Abc_ObjFaninId0(pObj), Abc_ObjFaninC0(pObj)) &&
+        Vec_IntEntry(p->vFaninsShr, 2*pObj->Id+1) == Abc_Var2Lit(Abc_ObjFaninId1(pObj), Abc_ObjFaninC1(pObj));
+    if ( fSame )
+    {
+        Cut_NodeCopyCuts( pManCut, p->pCutsShr, pObj->Id );
+        p->nCutsShared++;
+    }
+    else
+        Abc_NodeGetCuts( pManCut, pObj, 0, 0 );
+    Vec_StrSetEntry( p->vCutsSame, pObj->Id, (char)fSame );
+    return fSame;
+}
+
+static int Abc_NtkOrchSA_int( Abc_Ntk_t * pNtk, Abc_OrchMan_t * pMan, Vec_Int_t **pGain_rwr, Vec_Int_t **pGain_res,Vec_Int_t **pGain_ref, Vec_Int_t **PolicyList, Vec_Int_t * DecisionMask, int fUseZeros_rwr, int fUseZeros_ref, int fPlaceEnable, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int fVerbose, int fVeryVerbose, int nNodeSizeMax, int nConeSizeMax, int fUseDcs )
+{
+    ProgressBar * pProgress;
+    // For resub
+    Abc_ManRes_t * pManRes = pMan->pManRes;
+    Abc_ManCut_t * pManCutRes = pMan->pManCutRes;
+    Odc_Man_t * pManOdc = pMan->pManOdc;
+    Dec_Graph_t * pFFormRes;
+    Vec_Ptr_t * vLeaves;
+    // For rewrite
+    Cut_Man_t * pManCutRwr;
+    Rwr_Man_t * pManRwr = pMan->pManRwr;
+    Dec_Graph_t * pGraph;
+    // For refactor
+    Abc_ManRef_t * pManRef = pMan->pManRef;
+    Abc_ManCut_t * pManCutRef = pMan->pManCutRef;
+    Dec_Graph_t * pFFormRef;
+    Vec_Ptr_t * vFanins;
+
+    Abc_Obj_t * pNode;
+    abctime clk, clkStart = Abc_Clock();
+    abctime s_ResubTime;
+    int i, nNodes, nGain, fCompl, RetValue = 1;
+    int ops_rwr = 0;
+    int ops_res = 0;
+    int ops_ref = 0;
+    int ops_null = 0;
+    int sOpsOrder = 0;
+    assert( Abc_NtkIsStrash(pNtk) );
+
+    // cleanup the AIG
+    Abc_AigCleanup((Abc_Aig_t *)pNtk->pManFunc);
+    if ( pManRwr == NULL )
+        return 0;
+
+    // compute the reverse levels if level update is requested
+    if ( fUpdateLevel )
+        Abc_NtkStartReverseLevels( pNtk, 0 );
+    if ( Abc_NtkLatchNum(pNtk) ) {
+        Abc_NtkForEachLatch(pNtk, pNode, i)
+            pNode->pNext = (Abc_Obj_t *)pNode->pData;
+    }
+clk = Abc_Clock();
+    pManCutRwr = Abc_NtkStartCutManForRewrite( pNtk );
+Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
+    pNtk->pManCut = pManCutRwr;
+    if ( pMan->fShare )
+    {
+        if ( pMan->pCutsShr == NULL )
+            Abc_OrchManShareStart( pMan, pNtk, nStepsMax, fUpdateLevel );
+        Vec_StrFill( pMan->vCutsSame, Abc_NtkObjNumMax(pNtk), 0 );
+    }
+
+    if ( fVeryVerbose )
+        Rwr_ScoresClean( pManRwr );
+
+    pManRes->nNodesBeg = Abc_NtkNodeNum(pNtk);
+    pManRwr->nNodesBeg = Abc_NtkNodeNum(pNtk);
+    pManRef->nNodesBeg = Abc_NtkNodeNum(pNtk);
+
+    nNodes = Abc_NtkObjNumMax(pNtk);
+    //printf("nNodes: %d\n", nNodes);
+    if (pGain_res) *pGain_res = Vec_IntAlloc(1);
+    if (pGain_ref) *pGain_ref = Vec_IntAlloc(1);
+    if (pGain_rwr) *pGain_rwr = Vec_IntAlloc(1);
+    Vec_IntFill( DecisionMask, nNodes, -1 );
+
+    pProgress = Extra_ProgressBarStart( stdout, nNodes );
+
+    Abc_NtkForEachNode( pNtk, pNode, i )
+    {
+        int iterNode = pNode->Id;
+        Extra_ProgressBarUpdate( pProgress, i, NULL );
+        if ( Abc_NodeIsPersistant(pNode) )
+        {
+            //fprintf(fpt, "%d, %d\n", iterNode, -99);
+            Vec_IntPush((*pGain_res), -99);
+            Vec_IntPush((*pGain_ref), -99);
+            Vec_IntPush((*pGain_rwr), -99);
+            continue;
+        }
+        if ( Abc_ObjFanoutNum(pNode) > 1000 )
+        {
+            //fprintf(fpt, "%d, %d\n", iterNode, -99);
+            Vec_IntPush((*pGain_res), -99);
+            Vec_IntPush((*pGain_ref), -99);
+            Vec_IntPush((*pGain_rwr), -99);
+            continue;
+        }
+        if ( i >= nNodes )
+            break;
+
 //refactor
 clk = Abc_Clock();
         vFanins = Abc_NodeFindCut( pManCutRef, pNode, fUseDcs );
@@ -2773,20 +3364,25 @@ clk = Abc_Clock();
 pManRef->timeRes += Abc_Clock() - clk;
         Vec_IntPush((*pGain_ref), pManRef->nLastGain);
 //resub
-        vLeaves = Abc_NodeFindCut( pManCutRes, pNode, 0 );
-pManRes->timeCut += Abc_Clock() - clk;
-        if ( pManOdc )
+        if ( !pMan->pCutsShr || !Abc_OrchManShareResub( pMan, pNode, fUpdateLevel, &pFFormRes ) )
         {
+            vLeaves = Abc_NodeFindCut( pManCutRes, pNode, 0 );
+pManRes->timeCut += Abc_Clock() - clk;
+            if ( pManOdc )
+            {
 clk = Abc_Clock();
-            Abc_NtkDontCareClear( pManOdc );
-            Abc_NtkDontCareCompute( pManOdc, pNode, vLeaves, pManRes->pCareSet );
+                Abc_NtkDontCareClear( pManOdc );
+                Abc_NtkDontCareCompute( pManOdc, pNode, vLeaves, pManRes->pCareSet );
 pManRes->timeTruth += Abc_Clock() - clk;
-        }
+            }
 clk = Abc_Clock();
-        pFFormRes = Abc_ManResubEval( pManRes, pNode, vLeaves, nStepsMax, fUpdateLevel, fVerbose );
+            pFFormRes = Abc_ManResubEval( pManRes, pNode, vLeaves, nStepsMax, fUpdateLevel, fVerbose );
 pManRes->timeRes += Abc_Clock() - clk;
+        }
         Vec_IntPush((*pGain_res), pManRes->nLastGain);
 //rewrite
+        if ( pMan->pCutsShr )
+            Abc_OrchManShareCuts_rec( pMan, pManCutRwr, pNode );
         nGain = Rwr_NodeRewrite( pManRwr, pManCutRwr, pNode, fUpdateLevel, fUseZeros_rwr, fPlaceEnable );
         Vec_IntPush( (*pGain_rwr), nGain);
         //fprintf(fpt, "%d, %s, %d, %s, %d, %s, %d\n", pNode->Id, "Oches_Res", pManRes->nLastGain, "Oches_Ref", pManRef->nLastGain, "Oches_Rwr", nGain);
@@ -2809,7 +3405,7 @@ pManRes->timeRes += Abc_Clock() - clk;
             Abc_AigUpdateReset( (Abc_Aig_t *)pNtk->pManFunc );
         if ( fCompl ) Dec_GraphComplement( pGraph );
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
+        Abc_OrchUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
 Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
         if ( fCompl ) Dec_GraphComplement( pGraph );
         ops_rwr++;
@@ -2825,7 +3421,7 @@ Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
             continue;
         pManRes->nTotalGain += pManRes->nLastGain;
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
+        Abc_OrchUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
 pManRes->timeNtk += Abc_Clock() - clk;
         Dec_GraphFree( pFFormRes );
         ops_res++;
@@ -2839,7 +3435,7 @@ pManRes->timeNtk += Abc_Clock() - clk;
         if ( pFFormRef == NULL )
             continue;
 clk = Abc_Clock();
-        if ( !Dec_GraphUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
+        if ( !Abc_OrchUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
                  {
                      Dec_GraphFree( pFFormRef );
                      RetValue = -1;
@@ -2871,7 +3467,7 @@ pManRef->timeNtk += Abc_Clock() - clk;
             Abc_AigUpdateReset( (Abc_Aig_t *)pNtk->pManFunc );
         if ( fCompl ) Dec_GraphComplement( pGraph );
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
+        Abc_OrchUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
 Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
         if ( fCompl ) Dec_GraphComplement( pGraph );
         ops_rwr++;
@@ -2885,7 +3481,7 @@ Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
         if ( pFFormRef == NULL )
             continue;
 clk = Abc_Clock();
-        if ( !Dec_GraphUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
+        if ( !Abc_OrchUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
                  {
                      Dec_GraphFree( pFFormRef );
                      RetValue = -1;
@@ -2905,7 +3501,7 @@ pManRef->timeNtk += Abc_Clock() - clk;
             continue;
         pManRes->nTotalGain += pManRes->nLastGain;
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
+        Abc_OrchUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
 pManRes->timeNtk += Abc_Clock() - clk; 
         Dec_GraphFree( pFFormRes );
         ops_res++;
@@ -2930,7 +3526,7 @@ pManRes->timeNtk += Abc_Clock() - clk;
             continue;
         pManRes->nTotalGain += pManRes->nLastGain;
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
+        Abc_OrchUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
 pManRes->timeNtk += Abc_Clock() - clk;
         Dec_GraphFree( pFFormRes );
         ops_res++;
@@ -2947,7 +3543,7 @@ pManRes->timeNtk += Abc_Clock() - clk;
             Abc_AigUpdateReset( (Abc_Aig_t *)pNtk->pManFunc );
         if ( fCompl ) Dec_GraphComplement( pGraph );
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
+        Abc_OrchUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
 Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
         if ( fCompl ) Dec_GraphComplement( pGraph );
         ops_rwr++;
@@ -2961,7 +3557,7 @@ Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
         if ( pFFormRef == NULL )
             continue;
 clk = Abc_Clock();
-        if ( !Dec_GraphUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
+        if ( !Abc_OrchUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
                  {
                      Dec_GraphFree( pFFormRef );
                      RetValue = -1;
@@ -2991,7 +3587,7 @@ pManRef->timeNtk += Abc_Clock() - clk;
             continue;
         pManRes->nTotalGain += pManRes->nLastGain;
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
+        Abc_OrchUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
 pManRes->timeNtk += Abc_Clock() - clk;
         Dec_GraphFree( pFFormRes );
         ops_res++;
@@ -3005,7 +3601,7 @@ pManRes->timeNtk += Abc_Clock() - clk;
        if ( pFFormRef == NULL )
             continue;
 clk = Abc_Clock();
-        if ( !Dec_GraphUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
+        if ( !Abc_OrchUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
                  {
                      Dec_GraphFree( pFFormRef );
                      RetValue = -1;
@@ -3027,7 +3623,7 @@ pManRef->timeNtk += Abc_Clock() - clk;
             Abc_AigUpdateReset( (Abc_Aig_t *)pNtk->pManFunc );
         if ( fCompl ) Dec_GraphComplement( pGraph );
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
+        Abc_OrchUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
 Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
         if ( fCompl ) Dec_GraphComplement( pGraph );
         ops_rwr++;
@@ -3052,7 +3648,7 @@ Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
         if ( pFFormRef == NULL )
             continue;
 clk = Abc_Clock();
-        if ( !Dec_GraphUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
+        if ( !Abc_OrchUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
                  {
                      Dec_GraphFree( pFFormRef );
                      RetValue = -1;
@@ -3074,7 +3670,7 @@ pManRef->timeNtk += Abc_Clock() - clk;
             Abc_AigUpdateReset( (Abc_Aig_t *)pNtk->pManFunc );
         if ( fCompl ) Dec_GraphComplement( pGraph );
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
+        Abc_OrchUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
 Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
         if ( fCompl ) Dec_GraphComplement( pGraph );
         ops_rwr++;
@@ -3089,7 +3685,7 @@ Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
             continue;
         pManRes->nTotalGain += pManRes->nLastGain;
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
+        Abc_OrchUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
 pManRes->timeNtk += Abc_Clock() - clk;
         Dec_GraphFree( pFFormRes );
         ops_res++;
@@ -3113,7 +3709,7 @@ pManRes->timeNtk += Abc_Clock() - clk;
         if ( pFFormRef == NULL )
             continue;
 clk = Abc_Clock();
-        if ( !Dec_GraphUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
+        if ( !Abc_OrchUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
                  {
                      Dec_GraphFree( pFFormRef );
                      RetValue = -1;
@@ -3133,7 +3729,7 @@ pManRef->timeNtk += Abc_Clock() - clk;
             continue;
         pManRes->nTotalGain += pManRes->nLastGain;
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
+        Abc_OrchUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
 pManRes->timeNtk += Abc_Clock() - clk;
         Dec_GraphFree( pFFormRes );
         ops_res++;
@@ -3150,7 +3746,7 @@ pManRes->timeNtk += Abc_Clock() - clk;
             Abc_AigUpdateReset( (Abc_Aig_t *)pNtk->pManFunc );
         if ( fCompl ) Dec_GraphComplement( pGraph );
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
+        Abc_OrchUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
 Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
         if ( fCompl ) Dec_GraphComplement( pGraph );
         ops_rwr++;
@@ -3167,8 +3763,6 @@ Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
       }
 
     }
-    for (int i=0; i<nNodes; i++){fprintf(fpt, "%d\n", (DecisionMask)->pArray[i]);}
-    fclose(fpt);
     /*
     printf("size of vector %d\n", (**pGain_res).nSize);
     printf("Nodes with rewrite: %d\n", ops_rwr);
@@ -3194,18 +3788,9 @@ pManRef->timeTotal = Abc_Clock() - clkStart;
     if ( fVeryVerbose )
         Rwr_ScoresReport( pManRwr );
 
-    Abc_ManResubStop( pManRes );
-    Abc_NtkManCutStop( pManCutRes );
-
-    Rwr_ManStop( pManRwr );
     Cut_ManStop( pManCutRwr );
     pNtk->pManCut = NULL;
 
-   Abc_NtkManCutStop( pManCutRef );
-    Abc_NtkManRefStop_1( pManRef );
-
-    if ( pManOdc ) Abc_NtkDontCareFree( pManOdc );
-
     Abc_NtkForEachObj( pNtk, pNode, i )
         pNode->pData = NULL;
 
@@ -3213,7 +3798,7 @@ pManRef->timeTotal = Abc_Clock() - clkStart;
         Abc_NtkForEachLatch(pNtk, pNode, i)
             pNode->pData = pNode->pNext, pNode->pNext = NULL;
     }
-    Abc_NtkReassignIds( pNtk );
+    Abc_OrchReassignIds( pNtk );
     if ( fUpdateLevel )
         Abc_NtkStopReverseLevels( pNtk );
     else
@@ -3227,8 +3812,742 @@ s_ResubTime = Abc_Clock() - clkStart;
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Applies the policy to the network.]
+
+  Description [The policy (PolicyList) gives the operation for each node ID.
+  The decisions made are saved into DecisionFile (see Abc_OrchDataWrite()).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkOrchSA( Abc_Ntk_t * pNtk, Vec_Int_t **pGain_rwr, Vec_Int_t **pGain_res,Vec_Int_t **pGain_ref, Vec_Int_t **PolicyList, char * DecisionFile, int fUseZeros_rwr, int fUseZeros_ref, int fPlaceEnable, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int fVerbose, int fVeryVerbose, int nNodeSizeMax, int nConeSizeMax, int fUseDcs )
+{
+    Abc_OrchMan_t * pMan = Abc_OrchManStart( nCutMax, nLevelsOdc, nNodeSizeMax, nConeSizeMax, fUseDcs, fVerbose, fVeryVerbose );
+    Vec_Int_t * DecisionMask = Vec_IntAlloc( Abc_NtkObjNumMax(pNtk) );
+    int RetValue = Abc_NtkOrchSA_int( pNtk, pMan, pGain_rwr, pGain_res, pGain_ref, PolicyList, DecisionMask, fUseZeros_rwr, fUseZeros_ref, fPlaceEnable, nCutMax, nStepsMax, nLevelsOdc, fUpdateLevel, fVerbose, fVeryVerbose, nNodeSizeMax, nConeSizeMax, fUseDcs );
+    Abc_OrchDataWrite( DecisionFile, ABC_ORCH_DATA_DECS, DecisionMask, 1 );
+    Vec_IntFree( DecisionMask );
+    Abc_OrchManStop( pMan );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Records the object IDs of the copy of the network.]
+
+  Description [The copy is given by the pCopy fields of pNtk.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_OrchBatchSaveIds( Abc_Ntk_t * pNtk, Vec_Int_t * vCopyIds )
+{
+    Abc_Obj_t * pObj;
+    int i;
+    Vec_IntFill( vCopyIds, Abc_NtkObjNumMax(pNtk), -1 );
+    Abc_NtkForEachObj( pNtk, pObj, i )
+        if ( pObj->pCopy )
+            Vec_IntWriteEntry( vCopyIds, i, Abc_ObjRegular(pObj->pCopy)->Id );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the run left its copy of the network unchanged.]
+
+  Description [This is the case if no decision was applied (vDecs), no object
+  was removed, and the objects of the copy kept the IDs they had after
+  duplication, so that the next run on the same copy visits the nodes in
+  the same order as it would on a new copy.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_OrchBatchCopyIsUnchanged( Abc_Ntk_t * pNtk, Abc_Ntk_t * pCopy, Vec_Int_t * vDecs, Vec_Int_t * vCopyIds )
+{
+    Abc_Obj_t * pObj;
+    int i, Entry;
+    Vec_IntForEachEntry( vDecs, Entry, i )
+        if ( Entry != -1 )
+            return 0;
+    // the dangling nodes and the choices are removed by the run
+    if ( Abc_NtkObjNum(pCopy) != Abc_NtkObjNum(pNtk) || Abc_NtkGetChoiceNum(pNtk) )
+        return 0;
+    Abc_NtkForEachObj( pNtk, pObj, i )
+        if ( pObj->pCopy && Vec_IntEntry(vCopyIds, i) != Abc_ObjRegular(pObj->pCopy)->Id )
+            return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates many policies on the same network.]
+
+  Description [Each policy (an entry of vPolicies, indexed by the object IDs
+  of pNtk) is applied to a fresh copy of the network. The managers, including
+  the precomputed rewriting library, are started once and shared by all runs.
+  The cuts used by rewriting and the results of resubstitution are computed
+  once for the starting network and reused by each run for the nodes whose
+  neighborhood it has not changed yet, which gives the same result as
+  computing them again. The copy of the network is made on write: a run
+  that does not change the network leaves its copy to the next run.
+  The area (the number of AND nodes) and the delay (the number of AIG
+  levels) of each result are returned in vArea and vDelay (-1 if the run
+  failed). The network pNtk is not changed. Returns the number of
+  successful runs.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkOrchEvalBatch( Abc_Ntk_t * pNtk, Vec_Ptr_t * vPolicies, Vec_Int_t * vArea, Vec_Int_t * vDelay, int fUseZeros_rwr, int fUseZeros_ref, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int nNodeSizeMax, int nConeSizeMax, int fUseDcs, int fVerbose )
+{
+    Abc_OrchMan_t * pMan;
+    Vec_Int_t * vPolicy, * vPolicyCopy, * vDecs;
+    Vec_Int_t * vGainRwr, * vGainRes, * vGainRef;
+    Vec_Int_t * vCopyIds;
+    Abc_Ntk_t * pCopy = NULL;
+    Abc_Obj_t * pObj;
+    abctime clk = Abc_Clock();
+    int i, k, RetValue, nDone = 0, nCopies = 0;
+    assert( Abc_NtkIsStrash(pNtk) );
+    pMan        = Abc_OrchManStart( nCutMax, nLevelsOdc, nNodeSizeMax, nConeSizeMax, fUseDcs, 0, 0 );
+    pMan->fShare = (pMan->pManOdc == NULL && Vec_PtrSize(vPolicies) > 1);
+    vPolicyCopy = Vec_IntAlloc( Abc_NtkObjNumMax(pNtk) );
+    vDecs       = Vec_IntAlloc( Abc_NtkObjNumMax(pNtk) );
+    vCopyIds    = Vec_IntAlloc( Abc_NtkObjNumMax(pNtk) );
+    Vec_IntClear( vArea );
+    Vec_IntClear( vDelay );
+    Vec_PtrForEachEntry( Vec_Int_t *, vPolicies, vPolicy, i )
+    {
+        // copy the network unless the copy used by the previous run is unchanged
+        if ( pCopy == NULL )
+        {
+            pCopy = Abc_NtkDup( pNtk );
+            Abc_OrchBatchSaveIds( pNtk, vCopyIds );
+            nCopies++;
+        }
+        // translate the policy into the object IDs of the copy
+        Vec_IntFill( vPolicyCopy, Abc_NtkObjNumMax(pCopy), -1 );
+        Abc_NtkForEachObj( pNtk, pObj, k )
+            if ( pObj->pCopy && k < Vec_IntSize(vPolicy) )
+                Vec_IntWriteEntry( vPolicyCopy, Abc_ObjRegular(pObj->pCopy)->Id, Vec_IntEntry(vPolicy, k) );
+        RetValue = Abc_NtkOrchSA_int( pCopy, pMan, &vGainRwr, &vGainRes, &vGainRef, &vPolicyCopy, vDecs, fUseZeros_rwr, fUseZeros_ref, 0, nCutMax, nStepsMax, nLevelsOdc, fUpdateLevel, 0, 0, nNodeSizeMax, nConeSizeMax, fUseDcs );
+        Vec_IntPush( vArea,  RetValue == 1 ? Abc_NtkNodeNum(pCopy) : -1 );
+        Vec_IntPush( vDelay, RetValue == 1 ? Abc_AigLevel(pCopy)   : -1 );
+        nDone += (RetValue == 1);
+        Vec_IntFree( vGainRwr );
+        Vec_IntFree( vGainRes );
+        Vec_IntFree( vGainRef );
+        if ( RetValue != 1 || !Abc_OrchBatchCopyIsUnchanged( pNtk, pCopy, vDecs, vCopyIds ) )
+            Abc_NtkDelete( pCopy ), pCopy = NULL;
+    }
+    if ( pCopy )
+        Abc_NtkDelete( pCopy );
+    Vec_IntFree( vPolicyCopy );
+    Vec_IntFree( vDecs );
+    Vec_IntFree( vCopyIds );
+    if ( fVerbose )
+    {
+        printf( "Evaluated %d policies (%d successful) using %d copies. ", Vec_PtrSize(vPolicies), nDone, nCopies );
+        printf( "Reused cuts = %d. Reused resub = %d. ", pMan->nCutsShared, pMan->nResShared );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Abc_OrchManStop( pMan );
+    return nDone;
+}
+
+#ifdef ABC_USE_PTHREADS
+
+#define ABC_ORCH_GAIN_KEEP    (-ABC_INFINITY)   // refactoring left the gain of the previous node
+
+// the result of evaluating one node speculatively
+typedef struct Abc_OrchRes_t_ Abc_OrchRes_t;
+struct Abc_OrchRes_t_
+{
+    int              GainRwr;      // the gain of rewriting (-1 if there is no candidate)
+    int              GainRes;      // the gain of resubstitution
+    int              GainRef;      // the gain of refactoring (or ABC_ORCH_GAIN_KEEP)
+    Dec_Graph_t *    pGraphRwr;    // the candidates saved by Abc_OrchGraphSave() (or NULL)
+    Dec_Graph_t *    pGraphRes;
+    Dec_Graph_t *    pGraphRef;
+};
+
+typedef struct Abc_OrchPar_t_ Abc_OrchPar_t;
+typedef struct Abc_OrchWrk_t_ Abc_OrchWrk_t;
+struct Abc_OrchWrk_t_
+{
+    Abc_OrchPar_t *  pPar;         // the parallel manager
+    int              iWrk;         // the number of this worker
+    int              fFailed;      // the replica no longer matches the network
+    Abc_Ntk_t *      pRep;         // the replica of the network
+    Vec_Int_t *      vCutsNew;     // the nodes whose cuts were computed speculatively
+    // managers
+    Abc_ManRes_t *   pManRes;
+    Abc_ManCut_t *   pManCutRes;
+    Cut_Man_t *      pManCutRwr;
+    Rwr_Man_t *      pManRwr;
+    Abc_ManRef_t *   pManRef;
+    Abc_ManCut_t *   pManCutRef;
+};
+
+struct Abc_OrchPar_t_
+{
+    // parameters
+    int              nStepsMax;
+    int              fUpdateLevel;
+    int              fUseZeros_rwr;
+    int              fUseZeros_ref;
+    int              fUseDcs;
+    // the current round
+    Vec_Int_t *      vBatch;       // the nodes evaluated in this round
+    Vec_Int_t *      vHits;        // the nodes skipped in this round because of the gain cache
+    Abc_OrchRes_t *  pRes;         // the results (one for each node in vBatch)
+    int              nResAlloc;    // the number of allocated results
+    // the changes committed by the main thread in the previous round
+    Vec_Int_t *      vLog;         // 2*Id if the cuts of the node were computed, 2*k+1 for the k-th update
+    Vec_Ptr_t *      vLogGraphs;   // the replacements saved by Abc_OrchGraphSave()
+    Vec_Int_t *      vLogInfo;     // the root, the gain, the object count, and the node count after each update
+    // workers
+    int              nWorkers;     // the number of workers
+    Abc_OrchWrk_t *  pWrks;        // the workers
+    pthread_t *      pThreads;     // the worker threads
+    pthread_cond_t   CondStart;    // signals the workers that a round is ready
+    pthread_cond_t   CondDone;     // signals the main thread that a round is evaluated
+    pthread_mutex_t  Mutex;        // protects the round counter and the busy counter
+    int              iRound;       // the number of rounds given to the workers
+    int              nBusy;        // the number of workers evaluating the current round
+    int              fExit;        // the workers should quit
+    // statistics
+    int              nRounds;      // the number of rounds
+    int              nEvals;       // the number of nodes evaluated by the workers
+    int              nUsed;        // the number of results committed by the main thread
+    abctime          clkStart;     // the time when the workers started
+};
+
+static void          Abc_OrchParFree( Abc_OrchPar_t * p );
+
+/**Function*************************************************************
+
+  Synopsis    [Duplicates the network while preserving the object IDs.]
+
+  Description [Besides the IDs, the replica has the same order of fanins
+  and fanouts and the same levels, so the evaluators and the updates make
+  exactly the same choices on it as on the original network. Returns NULL
+  if such a replica cannot be derived.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Ntk_t * Abc_OrchNtkReplicate( Abc_Ntk_t * pNtk )
+{
+    Abc_Ntk_t * pRep;
+    Abc_Obj_t * pObj, * pNew;
+    Vec_Ptr_t * vObjs;
+    int i, k;
+    // the hash table of the replica is derived assuming that the fanins are ordered
+    Abc_NtkForEachNode( pNtk, pObj, i )
+        if ( Abc_ObjFaninId0(pObj) > Abc_ObjFaninId1(pObj) )
+            return NULL;
+    pRep = Abc_NtkDup( pNtk );
+    if ( Abc_NtkObjNum(pRep) != Abc_NtkObjNum(pNtk) )
+    {
+        Abc_NtkDelete( pRep );
+        return NULL;
+    }
+    // give each object the ID of its original
+    vObjs = Vec_PtrStart( Abc_NtkObjNumMax(pNtk) );
+    Abc_NtkForEachObj( pNtk, pObj, i )
+    {
+        pNew = Abc_ObjRegular( pObj->pCopy );
+        pNew->Id = pObj->Id;
+        Vec_PtrWriteEntry( vObjs, i, pNew );
+    }
+    Vec_PtrFree( pRep->vObjs );
+    pRep->vObjs = vObjs;
+    // copy the order of fanins and fanouts
+    Abc_NtkForEachObj( pNtk, pObj, i )
+    {
+        pNew = Abc_NtkObj( pRep, i );
+        if ( Abc_ObjFaninNum(pNew) != Abc_ObjFaninNum(pObj) || Abc_ObjFanoutNum(pNew) != Abc_ObjFanoutNum(pObj) )
+        {
+            Abc_NtkDelete( pRep );
+            return NULL;
+        }
+        for ( k = 0; k < Abc_ObjFaninNum(pObj); k++ )
+            pNew->vFanins.pArray[k] = pObj->vFanins.pArray[k];
+        for ( k = 0; k < Abc_ObjFanoutNum(pObj); k++ )
+            pNew->vFanouts.pArray[k] = pObj->vFanouts.pArray[k];
+        pNew->fCompl0  = pObj->fCompl0;
+        pNew->fCompl1  = pObj->fCompl1;
+        pNew->fPersist = pObj->fPersist;
+        pNew->Level    = pObj->Level;
+    }
+    Abc_AigRehash( (Abc_Aig_t *)pRep->pManFunc );
+    return pRep;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the cuts of the node for rewriting.]
+
+  Description [Same as Abc_NodeGetCutsRecursive() but records the nodes
+  whose cuts are computed, so that they can be dropped later.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_OrchParGetCuts_rec( Cut_Man_t * pManCut, Abc_Obj_t * pObj, Vec_Int_t * vCutsNew )
+{
+    if ( Abc_NodeReadCuts( pManCut, pObj ) )
+        return;
+    Abc_OrchParGetCuts_rec( pManCut, Abc_ObjFanin0(pObj), vCutsNew );
+    Abc_OrchParGetCuts_rec( pManCut, Abc_ObjFanin1(pObj), vCutsNew );
+    Abc_NodeGetCuts( pManCut, pObj, 0, 0 );
+    Vec_IntPush( vCutsNew, pObj->Id );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Brings the replica of the worker up to date.]
+
+  Description [Drops the cuts computed speculatively in the previous round
+  and repeats the cut computations and the updates of the main thread in
+  the same order. This way, the replica and its cut manager are the same
+  as the network and the cut manager of the main thread. Returns 0 if the
+  replica diverged.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_OrchWrkReplay( Abc_OrchWrk_t * pWrk )
+{
+    Abc_OrchPar_t * p = pWrk->pPar;
+    Dec_Graph_t * pGraph;
+    int i, Entry, RetValue, * pInfo;
+    Vec_IntForEachEntry( pWrk->vCutsNew, Entry, i )
+        Cut_NodeFreeCuts( pWrk->pManCutRwr, Entry );
+    Vec_IntClear( pWrk->vCutsNew );
+    Vec_IntForEachEntry( p->vLog, Entry, i )
+    {
+        if ( (Entry & 1) == 0 )
+        {
+            Abc_NodeGetCutsRecursive( pWrk->pManCutRwr, Abc_NtkObj(pWrk->pRep, Entry >> 1), 0, 0 );
+            continue;
+        }
+        pInfo    = Vec_IntEntryP( p->vLogInfo, 4 * (Entry >> 1) );
+        pGraph   = Abc_OrchGraphLoad( (Dec_Graph_t *)Vec_PtrEntry(p->vLogGraphs, Entry >> 1), pWrk->pRep );
+        RetValue = Dec_GraphUpdateNetwork( Abc_NtkObj(pWrk->pRep, pInfo[0]), pGraph, p->fUpdateLevel, pInfo[1] );
+        Dec_GraphFree( pGraph );
+        if ( !RetValue || Abc_NtkObjNumMax(pWrk->pRep) != pInfo[2] || Abc_NtkNodeNum(pWrk->pRep) != pInfo[3] )
+            return 0;
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates the nodes of the round assigned to the worker.]
+
+  Description [Makes the same calls as the serial loop of Abc_NtkOrchLocal()
+  and saves the gains and the candidates, leaving the decision to the main
+  thread.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_OrchWrkEval( Abc_OrchWrk_t * pWrk )
+{
+    Abc_OrchPar_t * p = pWrk->pPar;
+    Abc_OrchRes_t * pRes;
+    Dec_Graph_t * pGraph;
+    Vec_Ptr_t * vLeaves, * vFanins;
+    Abc_Obj_t * pNode;
+    int k;
+    for ( k = pWrk->iWrk; k < Vec_IntSize(p->vBatch); k += p->nWorkers )
+    {
+        pNode = Abc_NtkObj( pWrk->pRep, Vec_IntEntry(p->vBatch, k) );
+        pRes  = p->pRes + k;
+        // refactor
+        pWrk->pManRef->nLastGain = ABC_ORCH_GAIN_KEEP;
+        vFanins = Abc_NodeFindCut( pWrk->pManCutRef, pNode, p->fUseDcs );
+        pGraph  = Abc_NodeRefactor_1( pWrk->pManRef, pNode, vFanins, p->fUpdateLevel, p->fUseZeros_ref, p->fUseDcs, 0 );
+        pRes->GainRef   = pWrk->pManRef->nLastGain;
+        pRes->pGraphRef = pGraph ? Abc_OrchGraphSave( pGraph, 0 ) : NULL;
+        if ( pGraph ) Dec_GraphFree( pGraph );
+        // resub
+        vLeaves = Abc_NodeFindCut( pWrk->pManCutRes, pNode, 0 );
+        pGraph  = Abc_ManResubEval( pWrk->pManRes, pNode, vLeaves, p->nStepsMax, p->fUpdateLevel, 0 );
+        pRes->GainRes   = pWrk->pManRes->nLastGain;
+        pRes->pGraphRes = pGraph ? Abc_OrchGraphSave( pGraph, 0 ) : NULL;
+        if ( pGraph ) Dec_GraphFree( pGraph );
+        // rewrite (the cuts are computed here to record the nodes whose cuts are new)
+        Abc_OrchParGetCuts_rec( pWrk->pManCutRwr, pNode, pWrk->vCutsNew );
+        pRes->GainRwr   = Rwr_NodeRewrite( pWrk->pManRwr, pWrk->pManCutRwr, pNode, p->fUpdateLevel, p->fUseZeros_rwr, 0 );
+        pRes->pGraphRwr = pRes->GainRwr >= 0 ? Abc_OrchGraphSave( (Dec_Graph_t *)Rwr_ManReadDecs(pWrk->pManRwr), Rwr_ManReadCompl(pWrk->pManRwr) ) : NULL;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [The worker thread.]
+
+  Description [Waits for a round, updates the replica, and evaluates the
+  nodes of the round, until the manager is stopped.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Abc_OrchWorkerThread( void * pArg )
+{
+    Abc_OrchWrk_t * pWrk = (Abc_OrchWrk_t *)pArg;
+    Abc_OrchPar_t * p = pWrk->pPar;
+    int iRound = 0, fExit;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        while ( !p->fExit && p->iRound == iRound )
+            pthread_cond_wait( &p->CondStart, &p->Mutex );
+        iRound = p->iRound;
+        fExit  = p->fExit;
+        pthread_mutex_unlock( &p->Mutex );
+        if ( fExit )
+            break;
+        if ( !pWrk->fFailed && !Abc_OrchWrkReplay( pWrk ) )
+            pWrk->fFailed = 1;
+        if ( !pWrk->fFailed )
+            Abc_OrchWrkEval( pWrk );
+        pthread_mutex_lock( &p->Mutex );
+        if ( --p->nBusy == 0 )
+            pthread_cond_signal( &p->CondDone );
+        pthread_mutex_unlock( &p->Mutex );
+    }
+    pthread_exit( NULL );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the workers.]
+
+  Description [Should be called after the cut manager for rewriting is
+  started and the reverse levels are computed, before any node is
+  evaluated. Returns NULL if the nodes should be evaluated serially.
+  This is the case when don't-cares are used, because their computation
+  depends on the global random number generator.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_OrchPar_t * Abc_OrchParStart( Abc_Ntk_t * pNtk, int nThreads, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int fUseZeros_rwr, int fUseZeros_ref, int nNodeSizeMax, int nConeSizeMax, int fUseDcs )
+{
+    Abc_OrchPar_t * p;
+    Abc_OrchWrk_t * pWrk;
+    Abc_Obj_t * pObj, * pNew;
+    int i, k, status;
+    if ( nThreads < 2 || nLevelsOdc > 0 || Abc_NtkLatchNum(pNtk) > 0 || Abc_NtkGetChoiceNum(pNtk) > 0 )
+        return NULL;
+    p = ABC_CALLOC( Abc_OrchPar_t, 1 );
+    p->nStepsMax     = nStepsMax;
+    p->fUpdateLevel  = fUpdateLevel;
+    p->fUseZeros_rwr = fUseZeros_rwr;
+    p->fUseZeros_ref = fUseZeros_ref;
+    p->fUseDcs       = fUseDcs;
+    p->vBatch        = Vec_IntAlloc( 64 * nThreads );
+    p->vHits         = Vec_IntAlloc( 100 );
+    p->vLog          = Vec_IntAlloc( 1000 );
+    p->vLogGraphs    = Vec_PtrAlloc( 100 );
+    p->vLogInfo      = Vec_IntAlloc( 400 );
+    p->nWorkers      = nThreads;
+    p->pWrks         = ABC_CALLOC( Abc_OrchWrk_t, nThreads );
+    p->pThreads      = ABC_CALLOC( pthread_t, nThreads );
+    p->clkStart      = Abc_Clock();
+    for ( i = 0; i < nThreads; i++ )
+    {
+        pWrk = p->pWrks + i;
+        pWrk->pPar = p;
+        pWrk->iWrk = i;
+        pWrk->pRep = Abc_OrchNtkReplicate( pNtk );
+        if ( pWrk->pRep == NULL )
+            break;
+        pWrk->vCutsNew   = Vec_IntAlloc( 1000 );
+        // the managers are started here because some of them use global data
+        pWrk->pManCutRes = Abc_NtkManCutStart( nCutMax, 100000, 100000, 100000 );
+        pWrk->pManRes    = Abc_ManResubStart( nCutMax, ABC_RS_DIV1_MAX );
+        pWrk->pManCutRef = Abc_NtkManCutStart( nNodeSizeMax, nConeSizeMax, 2, 1000 );
+        pWrk->pManRef    = Abc_NtkManRefStart_1( nNodeSizeMax, nConeSizeMax, fUseDcs, 0 );
+        pWrk->pManRef->vLeaves = Abc_NtkManCutReadCutLarge( pWrk->pManCutRef );
+        pWrk->pManRwr    = Rwr_ManStart( 0 );
+        if ( fUpdateLevel )
+            Abc_NtkStartReverseLevels( pWrk->pRep, 0 );
+        pWrk->pManCutRwr = Abc_NtkStartCutManForRewrite( pWrk->pRep );
+        pWrk->pRep->pManCut = pWrk->pManCutRwr;
+        // the levels should be the same as in the network
+        Abc_NtkForEachObj( pNtk, pObj, k )
+        {
+            pNew = Abc_NtkObj( pWrk->pRep, k );
+            if ( pNew->Level != pObj->Level || (fUpdateLevel && Abc_ObjReverseLevel(pNew) != Abc_ObjReverseLevel(pObj)) )
+                break;
+        }
+        if ( k < Abc_NtkObjNumMax(pNtk) )
+            break;
+    }
+    if ( i < nThreads )
+    {
+        p->nWorkers = i + (p->pWrks[i].pRep != NULL);
+        Abc_OrchParFree( p );
+        return NULL;
+    }
+    pthread_mutex_init( &p->Mutex, NULL );
+    pthread_cond_init( &p->CondStart, NULL );
+    pthread_cond_init( &p->CondDone, NULL );
+    for ( i = 0; i < p->nWorkers; i++ )
+    {
+        status = pthread_create( p->pThreads + i, NULL, Abc_OrchWorkerThread, (void *)(p->pWrks + i) );  assert( status == 0 );
+    }
+    return p;
+}
+static void Abc_OrchParFree( Abc_OrchPar_t * p )
+{
+    Abc_OrchWrk_t * pWrk;
+    Dec_Graph_t * pGraph;
+    int i;
+    for ( i = 0; i < p->nWorkers; i++ )
+    {
+        pWrk = p->pWrks + i;
+        if ( pWrk->pManRes == NULL )
+        {
+            if ( pWrk->pRep ) Abc_NtkDelete( pWrk->pRep );
+            continue;
+        }
+        Abc_ManResubStop( pWrk->pManRes );
+        Abc_NtkManCutStop( pWrk->pManCutRes );
+        Rwr_ManStop( pWrk->pManRwr );
+        Cut_ManStop( pWrk->pManCutRwr );
+        pWrk->pRep->pManCut = NULL;
+        Abc_NtkManCutStop( pWrk->pManCutRef );
+        Abc_NtkManRefStop_1( pWrk->pManRef );
+        Abc_NtkDelete( pWrk->pRep );
+        Vec_IntFree( pWrk->vCutsNew );
+    }
+    Vec_PtrForEachEntry( Dec_Graph_t *, p->vLogGraphs, pGraph, i )
+        Dec_GraphFree( pGraph );
+    Vec_PtrFree( p->vLogGraphs );
+    Vec_IntFree( p->vLogInfo );
+    Vec_IntFree( p->vLog );
+    Vec_IntFree( p->vHits );
+    Vec_IntFree( p->vBatch );
+    ABC_FREE( p->pRes );
+    ABC_FREE( p->pThreads );
+    ABC_FREE( p->pWrks );
+    ABC_FREE( p );
+}
+static void Abc_OrchParStop( Abc_OrchPar_t * p, int fVerbose )
+{
+    int i;
+    pthread_mutex_lock( &p->Mutex );
+    p->fExit = 1;
+    pthread_cond_broadcast( &p->CondStart );
+    pthread_mutex_unlock( &p->Mutex );
+    for ( i = 0; i < p->nWorkers; i++ )
+        pthread_join( p->pThreads[i], NULL );
+    pthread_cond_destroy( &p->CondStart );
+    pthread_cond_destroy( &p->CondDone );
+    pthread_mutex_destroy( &p->Mutex );
+    if ( fVerbose )
+    {
+        printf( "Evaluated %d nodes speculatively using %d threads in %d rounds. Used results = %d. ", p->nEvals, p->nWorkers, p->nRounds, p->nUsed );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - p->clkStart );
+    }
+    Abc_OrchParFree( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates the nodes of the round by the workers.]
+
+  Description [Returns when all workers are done. Returns 0 if a replica
+  diverged from the network.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_OrchParEvalRound( Abc_OrchPar_t * p )
+{
+    Dec_Graph_t * pGraph;
+    int i;
+    if ( p->nResAlloc < Vec_IntSize(p->vBatch) )
+    {
+        p->nResAlloc = Vec_IntSize(p->vBatch);
+        p->pRes = ABC_REALLOC( Abc_OrchRes_t, p->pRes, p->nResAlloc );
+    }
+    memset( p->pRes, 0, sizeof(Abc_OrchRes_t) * Vec_IntSize(p->vBatch) );
+    pthread_mutex_lock( &p->Mutex );
+    p->nBusy = p->nWorkers;
+    p->iRound++;
+    pthread_cond_broadcast( &p->CondStart );
+    while ( p->nBusy > 0 )
+        pthread_cond_wait( &p->CondDone, &p->Mutex );
+    pthread_mutex_unlock( &p->Mutex );
+    // the log is no longer needed
+    Vec_PtrForEachEntry( Dec_Graph_t *, p->vLogGraphs, pGraph, i )
+        Dec_GraphFree( pGraph );
+    Vec_PtrClear( p->vLogGraphs );
+    Vec_IntClear( p->vLogInfo );
+    Vec_IntClear( p->vLog );
+    p->nRounds++;
+    p->nEvals += Vec_IntSize(p->vBatch);
+    for ( i = 0; i < p->nWorkers; i++ )
+        if ( p->pWrks[i].fFailed )
+            return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs the greedy pass using speculative evaluation.]
+
+  Description [In each round, the workers evaluate the next batch of nodes
+  concurrently, each on its own replica of the network. The main thread
+  then takes the results in the order of node IDs and makes the same
+  decisions as the serial loop of Abc_NtkOrchLocal(), until the first
+  update. Up to this point, the network is the same as the one seen by
+  the workers, so their results are exact. The update is committed using
+  the candidate found by the worker and ends the round; the remaining
+  results are dropped and the nodes are evaluated again in the next round,
+  after the workers repeated the update on their replicas. The result is
+  the same as that of the serial loop. Returns -1 if an update failed.
+  Otherwise, returns 1 and sets *piNext to the first node ID that was not
+  considered (this is less than nNodes if a replica diverged).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_NtkOrchLocalPar( Abc_OrchPar_t * p, Abc_Ntk_t * pNtk, Cut_Man_t * pManCutRwr, Abc_ManRes_t * pManRes, Abc_ManRef_t * pManRef, int nNodes, ProgressBar * pProgress, int * piNext, int * pnCacheHits )
+{
+    Abc_OrchRes_t * pRes;
+    Abc_Obj_t * pNode;
+    Dec_Graph_t * pGraph, * pSaved;
+    int i, k, Id, iStop, iType, nGain, RetValue = 1, iNext = 0, nBatch = 4 * p->nWorkers;
+    while ( iNext < nNodes && RetValue == 1 )
+    {
+        Extra_ProgressBarUpdate( pProgress, iNext, NULL );
+        // collect the nodes that the serial loop would evaluate
+        Vec_IntClear( p->vBatch );
+        Vec_IntClear( p->vHits );
+        for ( i = iNext; i < nNodes && Vec_IntSize(p->vBatch) < nBatch; i++ )
+        {
+            pNode = Abc_NtkObj( pNtk, i );
+            if ( pNode == NULL || !Abc_ObjIsNode(pNode) || Abc_NodeIsPersistant(pNode) || Abc_ObjFanoutNum(pNode) > 1000 )
+                continue;
+            if ( Abc_OrchCacheLookup( pNtk, pNode, NULL ) )
+                Vec_IntPush( p->vHits, i );
+            else
+                Vec_IntPush( p->vBatch, i );
+        }
+        iStop = i;
+        if ( Vec_IntSize(p->vBatch) > 0 && !Abc_OrchParEvalRound( p ) )
+            break;
+        // commit the results in the order of node IDs until the first update
+        Vec_IntForEachEntry( p->vBatch, Id, k )
+        {
+            pNode = Abc_NtkObj( pNtk, Id );
+            pRes  = p->pRes + k;
+            // compute the cuts as the serial loop would (Rwr_NodeRewrite)
+            Abc_NodeGetCutsRecursive( pManCutRwr, pNode, 0, 0 );
+            Vec_IntPush( p->vLog, 2 * Id );
+            // refactoring does not reset the gain if there is no candidate
+            if ( pRes->GainRef != ABC_ORCH_GAIN_KEEP )
+                pManRef->nLastGain = pRes->GainRef;
+            pManRes->nLastGain = pRes->GainRes;
+            nGain = pRes->GainRwr;
+            if ( nGain >= 0 && nGain >= pManRes->nLastGain && nGain >= pManRef->nLastGain )
+                pSaved = pRes->pGraphRwr, pRes->pGraphRwr = NULL, iType = 0;
+            else if ( pManRes->nLastGain >= 0 && pManRes->nLastGain >= nGain && pManRes->nLastGain >= pManRef->nLastGain )
+                pSaved = pRes->pGraphRes, pRes->pGraphRes = NULL, iType = 1, nGain = pManRes->nLastGain;
+            else if ( pManRef->nLastGain >= 0 && pManRef->nLastGain >= nGain && pManRef->nLastGain >= pManRes->nLastGain )
+                pSaved = pRes->pGraphRef, pRes->pGraphRef = NULL, iType = 2, nGain = pManRef->nLastGain;
+            else
+                pSaved = NULL, iType = -1;
+            if ( pSaved == NULL )
+            {
+                Abc_OrchCacheRecord( pNtk, pNode, pRes->GainRwr, pManRes->nLastGain, pManRef->nLastGain );
+                continue;
+            }
+            // update the network (only the failure of refactoring is reported, as in the serial loop)
+            if ( iType == 1 )
+                pManRes->nTotalGain += nGain;
+            pGraph = Abc_OrchGraphLoad( pSaved, pNtk );
+            if ( !Abc_OrchUpdateNetwork( pNode, pGraph, p->fUpdateLevel, nGain ) && iType == 2 )
+                RetValue = -1;
+            Dec_GraphFree( pGraph );
+            Vec_IntPush( p->vLog, 2 * Vec_PtrSize(p->vLogGraphs) + 1 );
+            Vec_PtrPush( p->vLogGraphs, pSaved );
+            Vec_IntPush( p->vLogInfo, Id );
+            Vec_IntPush( p->vLogInfo, nGain );
+            Vec_IntPush( p->vLogInfo, Abc_NtkObjNumMax(pNtk) );
+            Vec_IntPush( p->vLogInfo, Abc_NtkNodeNum(pNtk) );
+            iStop = Id + 1;
+            break;
+        }
+        p->nUsed += Abc_MinInt( k + 1, Vec_IntSize(p->vBatch) );
+        // drop the remaining results
+        for ( k = 0; k < Vec_IntSize(p->vBatch); k++ )
+        {
+            pRes = p->pRes + k;
+            if ( pRes->pGraphRwr ) Dec_GraphFree( pRes->pGraphRwr );
+            if ( pRes->pGraphRes ) Dec_GraphFree( pRes->pGraphRes );
+            if ( pRes->pGraphRef ) Dec_GraphFree( pRes->pGraphRef );
+        }
+        Vec_IntForEachEntry( p->vHits, Id, k )
+            *pnCacheHits += (Id < iStop);
+        // take more nodes in the next round if fewer updates happen
+        if ( iStop == i )
+            nBatch = Abc_MinInt( 2 * nBatch, 64 * p->nWorkers );
+        else
+            nBatch = Abc_MaxInt( nBatch / 2, p->nWorkers );
+        iNext = iStop;
+    }
+    *piNext = iNext;
+    return RetValue;
+}
+
+#else // pthreads are not used
+
+typedef struct Abc_OrchPar_t_ Abc_OrchPar_t;
+static Abc_OrchPar_t * Abc_OrchParStart( Abc_Ntk_t * pNtk, int nThreads, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int fUseZeros_rwr, int fUseZeros_ref, int nNodeSizeMax, int nConeSizeMax, int fUseDcs ) { return NULL; }
+static void            Abc_OrchParStop( Abc_OrchPar_t * p, int fVerbose ) {}
+static int             Abc_NtkOrchLocalPar( Abc_OrchPar_t * p, Abc_Ntk_t * pNtk, Cut_Man_t * pManCutRwr, Abc_ManRes_t * pManRes, Abc_ManRef_t * pManRef, int nNodes, ProgressBar * pProgress, int * piNext, int * pnCacheHits ) { return 1; }
+
+#endif // pthreads are used
+
+
 // local greedy orchestration
-int Abc_NtkOrchLocal( Abc_Ntk_t * pNtk, int fUseZeros_rwr, int fUseZeros_ref, int fPlaceEnable, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int fVerbose, int fVeryVerbose, int nNodeSizeMax, int nConeSizeMax, int fUseDcs )
+int Abc_NtkOrchLocal( Abc_Ntk_t * pNtk, int fUseZeros_rwr, int fUseZeros_ref, int fPlaceEnable, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int fVerbose, int fVeryVerbose, int nNodeSizeMax, int nConeSizeMax, int fUseDcs, int nThreads )
 {
     ProgressBar * pProgress;
     // For resub
@@ -3259,6 +4578,9 @@ int Abc_NtkOrchLocal( Abc_Ntk_t * pNtk, int fUseZeros_rwr, int fUseZeros_ref, in
     int ops_res = 0;
     int ops_ref = 0;
     int ops_null = 0;
+    int nCacheHits = 0;
+    int iParNext = 0;
+    Abc_OrchPar_t * pPar = NULL;
     assert( Abc_NtkIsStrash(pNtk) );
 
     // cleanup the AIG
@@ -3293,6 +4615,12 @@ clk = Abc_Clock();
 Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
     pNtk->pManCut = pManCutRwr;
 
+    // start the workers evaluating the nodes speculatively
+    if ( nThreads > 1 && !fPlaceEnable )
+        pPar = Abc_OrchParStart( pNtk, nThreads, nCutMax, nStepsMax, nLevelsOdc, fUpdateLevel, fUseZeros_rwr, fUseZeros_ref, nNodeSizeMax, nConeSizeMax, fUseDcs );
+    if ( fVerbose && nThreads > 1 && pPar == NULL )
+        printf( "Warning: The nodes are evaluated by one thread.\n" );
+
     if ( fVeryVerbose )
         Rwr_ScoresClean( pManRwr );
 
@@ -3312,11 +4640,23 @@ Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
 
     pProgress = Extra_ProgressBarStart( stdout, nNodes );
 
+    // consider the nodes concurrently (the serial loop takes over if a replica diverged)
+    if ( pPar )
+    {
+        RetValue = Abc_NtkOrchLocalPar( pPar, pNtk, pManCutRwr, pManRes, pManRef, nNodes, pProgress, &iParNext, &nCacheHits );
+        Abc_OrchParStop( pPar, fVerbose );
+        if ( RetValue == -1 )
+            iParNext = nNodes;
+    }
+
     Abc_NtkForEachNode( pNtk, pNode, i )
     {
         //int iterNode = pNode->Id;
         //printf("Nodes ID: %d\n", pNode->Id);
         Extra_ProgressBarUpdate( pProgress, i, NULL );
+        // skip the nodes considered concurrently
+        if ( i < iParNext )
+            continue;
         // skip the constant node
 //        if ( Abc_NodeIsConst(pNode) )
 //            continue;
@@ -3334,6 +4674,13 @@ Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
         // stop if all nodes have been tried once
         if ( i >= nNodes )
             break;
+        // skip the nodes whose last evaluation did not lead to an update
+        if ( Abc_OrchCacheLookup( pNtk, pNode, NULL ) )
+        {
+            nCacheHits++;
+            ops_null++;
+            continue;
+        }
         
 clk = Abc_Clock();
 
@@ -3379,7 +4726,7 @@ pManRes->timeRes += Abc_Clock() - clk;
                 Abc_AigUpdateReset( (Abc_Aig_t *)pNtk->pManFunc );
             if ( fCompl ) Dec_GraphComplement( pGraph );
 clk = Abc_Clock();
-            Dec_GraphUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
+            Abc_OrchUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
 Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
             if ( fCompl ) Dec_GraphComplement( pGraph );
             ops_rwr++;
@@ -3389,10 +4736,13 @@ Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
         if (((! (pManRes->nLastGain < 0)) && (! (pManRes->nLastGain < nGain)) && (! (pManRes->nLastGain < pManRef->nLastGain)))){
         // update with Resub
             if ( pFFormRes == NULL )
+            {
+                Abc_OrchCacheRecord( pNtk, pNode, nGain, pManRes->nLastGain, pManRef->nLastGain );
                 continue;
+            }
             pManRes->nTotalGain += pManRes->nLastGain;
 clk = Abc_Clock();
-            Dec_GraphUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
+            Abc_OrchUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
 pManRes->timeNtk += Abc_Clock() - clk;
             Dec_GraphFree( pFFormRes );
             ops_res++;
@@ -3402,9 +4752,12 @@ pManRes->timeNtk += Abc_Clock() - clk;
         if (((! (pManRef->nLastGain < 0)) && (! (pManRef->nLastGain < nGain)) && (! (pManRef->nLastGain < pManRes->nLastGain)))){
         // update with Refactor
             if ( pFFormRef == NULL )
+            {
+                Abc_OrchCacheRecord( pNtk, pNode, nGain, pManRes->nLastGain, pManRef->nLastGain );
                 continue;
+            }
 clk = Abc_Clock();
-            if ( !Dec_GraphUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
+            if ( !Abc_OrchUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
                  {
                      Dec_GraphFree( pFFormRef );
                      RetValue = -1;
@@ -3415,7 +4768,11 @@ pManRef->timeNtk += Abc_Clock() - clk;
             ops_ref++;
             continue;
         }
-        else{ops_null++; continue;}
+        else{
+            Abc_OrchCacheRecord( pNtk, pNode, nGain, pManRes->nLastGain, pManRef->nLastGain );
+            ops_null++; 
+            continue;
+        }
     }
 
     /*
@@ -3439,6 +4796,8 @@ pManRef->timeTotal = Abc_Clock() - clkStart;
     pManRef->nNodesEnd = Abc_NtkNodeNum(pNtk);
 
     // print statistics
+    if ( fVerbose && pNtk->vOrchGains )
+        printf( "Gain cache: skipped %d nodes evaluated in earlier passes.\n", nCacheHits );
     if ( fVerbose ){
         Abc_ManResubPrint( pManRes );
         Rwr_ManPrintStats( pManRwr );
@@ -3470,7 +4829,7 @@ pManRef->timeTotal = Abc_Clock() - clkStart;
     }
 
     // put the nodes into the DFS order and reassign their IDs
-    Abc_NtkReassignIds( pNtk );
+    Abc_OrchReassignIds( pNtk );
 //    Abc_AigCheckFaninOrder( pNtk->pManFunc );
 
     // fix the levels
@@ -3724,7 +5083,7 @@ pManRef->timeNtk += Abc_Clock() - clk;
             Abc_AigUpdateReset( (Abc_Aig_t *)pNtk->pManFunc );
         if ( fCompl ) Dec_GraphComplement( pGraph );
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
+        Abc_OrchUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
 Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
         if ( fCompl ) Dec_GraphComplement( pGraph );
         ops_rwr++;
@@ -3760,7 +5119,7 @@ pManRes->timeRes += Abc_Clock() - clk;
             //continue;
         pManRes->nTotalGain += pManRes->nLastGain;
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
+        Abc_OrchUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
 pManRes->timeNtk += Abc_Clock() - clk;
         Dec_GraphFree( pFFormRes );
         ops_res++;
@@ -3784,7 +5143,7 @@ pManRef->timeRes += Abc_Clock() - clk;
             //continue;
 clk = Abc_Clock();
         
-       Dec_GraphUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain);
+       Abc_OrchUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain);
 
 /*
         if ( !Dec_GraphUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
@@ -3823,7 +5182,7 @@ pManRef->timeNtk += Abc_Clock() - clk;
             Abc_AigUpdateReset( (Abc_Aig_t *)pNtk->pManFunc );
         if ( fCompl ) Dec_GraphComplement( pGraph );
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
+        Abc_OrchUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
 Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
         if ( fCompl ) Dec_GraphComplement( pGraph );
         ops_rwr++;
@@ -3844,7 +5203,7 @@ pManRef->timeRes += Abc_Clock() - clk;
         if ( pFFormRef != NULL ){
             //continue;
 clk = Abc_Clock();
-        if ( !Dec_GraphUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
+        if ( !Abc_OrchUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
                  {
                      Dec_GraphFree( pFFormRef );
                      RetValue = -1;
@@ -3878,7 +5237,7 @@ pManRes->timeRes += Abc_Clock() - clk;
             //continue;
         pManRes->nTotalGain += pManRes->nLastGain;
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
+        Abc_OrchUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
 pManRes->timeNtk += Abc_Clock() - clk;
         Dec_GraphFree( pFFormRes );
         ops_res++;
@@ -3920,7 +5279,7 @@ pManRes->timeRes += Abc_Clock() - clk;
             //continue;
         pManRes->nTotalGain += pManRes->nLastGain;
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
+        Abc_OrchUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
 pManRes->timeNtk += Abc_Clock() - clk;
         Dec_GraphFree( pFFormRes );
         ops_res++;
@@ -3940,7 +5299,7 @@ pManRes->timeNtk += Abc_Clock() - clk;
             Abc_AigUpdateReset( (Abc_Aig_t *)pNtk->pManFunc );
         if ( fCompl ) Dec_GraphComplement( pGraph );
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
+        Abc_OrchUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
 Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
         if ( fCompl ) Dec_GraphComplement( pGraph );
         ops_rwr++;
@@ -3961,7 +5320,7 @@ pManRef->timeRes += Abc_Clock() - clk;
         if ( pFFormRef != NULL ){
             //continue;
 clk = Abc_Clock();
-        if ( !Dec_GraphUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
+        if ( !Abc_OrchUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
                  {
                      Dec_GraphFree( pFFormRef );
                      RetValue = -1;
@@ -4007,7 +5366,7 @@ pManRes->timeRes += Abc_Clock() - clk;
             //continue;
         pManRes->nTotalGain += pManRes->nLastGain;
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
+        Abc_OrchUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
 pManRes->timeNtk += Abc_Clock() - clk;
         Dec_GraphFree( pFFormRes );
         ops_res++;
@@ -4028,7 +5387,7 @@ pManRef->timeRes += Abc_Clock() - clk;
         if ( pFFormRef != NULL ){
             //continue;
 clk = Abc_Clock();
-        if ( !Dec_GraphUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
+        if ( !Abc_OrchUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
                  {
                      Dec_GraphFree( pFFormRef );
                      RetValue = -1;
@@ -4052,7 +5411,7 @@ pManRef->timeNtk += Abc_Clock() - clk;
             Abc_AigUpdateReset( (Abc_Aig_t *)pNtk->pManFunc );
         if ( fCompl ) Dec_GraphComplement( pGraph );
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
+        Abc_OrchUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
 Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
         if ( fCompl ) Dec_GraphComplement( pGraph );
         ops_rwr++;
@@ -4087,7 +5446,7 @@ pManRef->timeRes += Abc_Clock() - clk;
         if ( pFFormRef != NULL ){
             //continue;
 clk = Abc_Clock();
-        if ( !Dec_GraphUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
+        if ( !Abc_OrchUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
                  {
                      Dec_GraphFree( pFFormRef );
                      RetValue = -1;
@@ -4112,7 +5471,7 @@ pManRef->timeNtk += Abc_Clock() - clk;
             Abc_AigUpdateReset( (Abc_Aig_t *)pNtk->pManFunc );
         if ( fCompl ) Dec_GraphComplement( pGraph );
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
+        Abc_OrchUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
 Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
         if ( fCompl ) Dec_GraphComplement( pGraph );
         ops_rwr++;
@@ -4141,7 +5500,7 @@ pManRes->timeRes += Abc_Clock() - clk;
             //continue;
         pManRes->nTotalGain += pManRes->nLastGain;
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
+        Abc_OrchUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
 pManRes->timeNtk += Abc_Clock() - clk;
         Dec_GraphFree( pFFormRes );
         ops_res++;
@@ -4174,7 +5533,7 @@ pManRef->timeRes += Abc_Clock() - clk;
         if ( pFFormRef != NULL ){
             //continue;
 clk = Abc_Clock();
-        if ( !Dec_GraphUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
+        if ( !Abc_OrchUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
                  {
                      Dec_GraphFree( pFFormRef );
                      RetValue = -1;
@@ -4208,7 +5567,7 @@ pManRes->timeRes += Abc_Clock() - clk;
             //continue;
         pManRes->nTotalGain += pManRes->nLastGain;
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
+        Abc_OrchUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
 pManRes->timeNtk += Abc_Clock() - clk;
         Dec_GraphFree( pFFormRes );
         ops_res++;
@@ -4228,7 +5587,7 @@ pManRes->timeNtk += Abc_Clock() - clk;
             Abc_AigUpdateReset( (Abc_Aig_t *)pNtk->pManFunc );
         if ( fCompl ) Dec_GraphComplement( pGraph );
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
+        Abc_OrchUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
 Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
         if ( fCompl ) Dec_GraphComplement( pGraph );
         ops_rwr++;
@@ -4297,7 +5656,7 @@ pManRef->timeTotal = Abc_Clock() - clkStart;
     }
 
     // put the nodes into the DFS order and reassign their IDs
-    Abc_NtkReassignIds( pNtk );
+    Abc_OrchReassignIds( pNtk );
 //    Abc_AigCheckFaninOrder( pNtk->pManFunc );
 
     // fix the levels
@@ -4528,7 +5887,7 @@ pManRes->timeRes += Abc_Clock() - clk;
             Abc_AigUpdateReset( (Abc_Aig_t *)pNtk->pManFunc );
         if ( fCompl ) Dec_GraphComplement( pGraph );
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
+        Abc_OrchUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
 Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
         if ( fCompl ) Dec_GraphComplement( pGraph );
         continue;
@@ -4545,7 +5904,7 @@ Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
             Abc_AigUpdateReset( (Abc_Aig_t *)pNtk->pManFunc );
         if ( fCompl ) Dec_GraphComplement( pGraph );
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain_zeros );
+        Abc_OrchUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain_zeros );
 Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
         if ( fCompl ) Dec_GraphComplement( pGraph );
         continue;
@@ -4559,7 +5918,7 @@ Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
         if ( pFFormRef == NULL )
             continue;
 clk = Abc_Clock();
-        if ( !Dec_GraphUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
+        if ( !Abc_OrchUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
                  {
                      Dec_GraphFree( pFFormRef );
                      RetValue = -1;
@@ -4578,7 +5937,7 @@ pManRef->timeNtk += Abc_Clock() - clk;
         if ( pFFormRef_zeros == NULL )
             continue;
 clk = Abc_Clock();
-        if ( !Dec_GraphUpdateNetwork( pNode, pFFormRef_zeros, fUpdateLevel, pManRef->nLastGain ) )
+        if ( !Abc_OrchUpdateNetwork( pNode, pFFormRef_zeros, fUpdateLevel, pManRef->nLastGain ) )
                  {
                      Dec_GraphFree( pFFormRef_zeros );
                      RetValue = -1;
@@ -4598,7 +5957,7 @@ pManRef->timeNtk += Abc_Clock() - clk;
             continue;
         pManRes->nTotalGain += pManRes->nLastGain;
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
+        Abc_OrchUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
 pManRes->timeNtk += Abc_Clock() - clk;
         Dec_GraphFree( pFFormRes );
         continue;
@@ -4662,7 +6021,7 @@ pManRef->timeTotal = Abc_Clock() - clkStart;
     }
 
     // put the nodes into the DFS order and reassign their IDs
-    Abc_NtkReassignIds( pNtk );
+    Abc_OrchReassignIds( pNtk );
 //    Abc_AigCheckFaninOrder( pNtk->pManFunc );
 
     // fix the levels
@@ -4917,7 +6276,7 @@ pManRes->timeRes += Abc_Clock() - clk;
             Abc_AigUpdateReset( (Abc_Aig_t *)pNtk->pManFunc );
         if ( fCompl ) Dec_GraphComplement( pGraph );
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
+        Abc_OrchUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
 Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
         if ( fCompl ) Dec_GraphComplement( pGraph );
         //printf("Nodes ID: %d\n", pNode->Id);
@@ -4951,7 +6310,7 @@ Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
         if ( pFFormRef == NULL )
             continue;
 clk = Abc_Clock();
-        if ( !Dec_GraphUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
+        if ( !Abc_OrchUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
                  {
                      Dec_GraphFree( pFFormRef );
                      RetValue = -1;
@@ -4993,7 +6352,7 @@ pManRef->timeNtk += Abc_Clock() - clk;
             continue;
         pManRes->nTotalGain += pManRes->nLastGain;
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
+        Abc_OrchUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
 pManRes->timeNtk += Abc_Clock() - clk;
         Dec_GraphFree( pFFormRes );
         fprintf(fpt, "%d, %d, %d, %d, %d\n", pNode->Id, rwr_ok, ref_ok, res_ok, decisionOps);
@@ -5059,7 +6418,7 @@ pManRef->timeTotal = Abc_Clock() - clkStart;
     }
 
     // put the nodes into the DFS order and reassign their IDs
-    Abc_NtkReassignIds( pNtk );
+    Abc_OrchReassignIds( pNtk );
 //    Abc_AigCheckFaninOrder( pNtk->pManFunc );
 
     // fix the levels
@@ -5077,6 +6436,26 @@ s_ResubTime = Abc_Clock() - clkStart;
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Appends the features of the node used by the GNN.]
+
+  Description [The features are the fanin complements followed by the
+  flags and the gains of rewriting, resubstitution and refactoring.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_OrchPushFeatures( Vec_Int_t * vFeats, Abc_Obj_t * pNode, int RwrOk, int GainRwr, int ResOk, int GainRes, int RefOk, int GainRef )
+{
+    Vec_IntPushTwo( vFeats, Abc_ObjFaninC0(pNode), Abc_ObjFaninC1(pNode) );
+    Vec_IntPushTwo( vFeats, RwrOk, GainRwr );
+    Vec_IntPushTwo( vFeats, ResOk, GainRes );
+    Vec_IntPushTwo( vFeats, RefOk, GainRef );
+}
+
 // rw rs rf embedding generation for GNN learning
 int Abc_NtkOrchGNN( Abc_Ntk_t * pNtk,  char * edgelistFile, char * featFile, int fUseZeros, int fUseZeros_rwr, int fUseZeros_ref, int fPlaceEnable, int nCutMax, int nStepsMax, int nLevelsOdc, int fUpdateLevel, int fVerbose, int fVeryVerbose, int nNodeSizeMax, int nConeSizeMax, int fUseDcs )
 {
@@ -5100,8 +6479,8 @@ int Abc_NtkOrchGNN( Abc_Ntk_t * pNtk,  char * edgelistFile, char * featFile, int
 
     Abc_Obj_t * pNode, * pFanin;
     int fanin_i;
-    FILE * f_el;
-    FILE * f_feats;
+    Vec_Int_t * vEdges;  // edge list
+    Vec_Int_t * vFeats;  // node features
     //FILE * fpt;
     abctime clk, clkStart = Abc_Clock();
     abctime s_ResubTime;
@@ -5163,14 +6542,14 @@ Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
 
     pProgress = Extra_ProgressBarStart( stdout, nNodes );
     //fpt = fopen("GNN_Embedding.csv", "w");
-    f_el = fopen(edgelistFile, "w");
-    f_feats = fopen(featFile, "w");
+    vEdges = Vec_IntAlloc( 4 * Abc_NtkNodeNum(pNtk) );
+    vFeats = Vec_IntAlloc( 8 * Abc_NtkNodeNum(pNtk) );
 
     Abc_NtkForEachNode( pNtk, pNode, i )
     {
         int iterNode = pNode->Id;
         Abc_ObjForEachFanin(pNode, pFanin, fanin_i){
-            fprintf(f_el, "%d %d\n", iterNode, Abc_ObjId(pFanin));
+            Vec_IntPushTwo( vEdges, iterNode, Abc_ObjId(pFanin) );
         }
         //printf("Nodes ID: %d\n", pNode->Id);
         rwr_ok = 0;
@@ -5185,7 +6564,7 @@ Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
         if ( Abc_NodeIsPersistant(pNode) )
         {   
             //fprintf(f_el, "%d %d\n", iterNode, Abc_ObjId(pFanin));
-            fprintf(f_feats, "%d, %d, %d, %d, %d, %d, %d, %d\n", Abc_ObjFaninC0(pNode), Abc_ObjFaninC1(pNode), -1, -1, -1, -1, -1, -1);
+            Abc_OrchPushFeatures( vFeats, pNode, -1, -1, -1, -1, -1, -1 );
             //fprintf(fpt, "%d, %d, %d, %d, %d, %d, %d, %d, %d,  %d\n", iterNode, Abc_ObjId(pFanin), Abc_ObjFaninC0(pNode), Abc_ObjFaninC1(pNode), -1, -1, -1, -1, -1, -1);
             continue;
         } 
@@ -5193,7 +6572,7 @@ Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
         if ( Abc_ObjFanoutNum(pNode) > 1000 )
         {
             //fprintf(f_el, "%d %d\n", iterNode, Abc_ObjId(pFanin));
-            fprintf(f_feats, "%d, %d, %d, %d, %d, %d, %d, %d\n", Abc_ObjFaninC0(pNode), Abc_ObjFaninC1(pNode), -1, -1, -1, -1, -1, -1);
+            Abc_OrchPushFeatures( vFeats, pNode, -1, -1, -1, -1, -1, -1 );
             //fprintf(fpt, "%d, %d, %d, %d, %d, %d, %d, %d, %d, %d\n", iterNode, Abc_ObjId(pFanin), Abc_ObjFaninC0(pNode), Abc_ObjFaninC1(pNode), -1, -1, -1, -1, -1, -1);
             continue;
         }
@@ -5240,7 +6619,7 @@ pManRes->timeRes += Abc_Clock() - clk;
         if (! (nGain < 0) ) {rwr_ok = 1;}
 
         //fprintf(f_el, "%d %d\n", iterNode, Abc_ObjId(pFanin));
-        fprintf(f_feats, "%d, %d, %d, %d, %d, %d, %d, %d\n", Abc_ObjFaninC0(pNode), Abc_ObjFaninC1(pNode), rwr_ok, nGain, res_ok, pManRes->nLastGain, ref_ok, pManRef->nLastGain);
+        Abc_OrchPushFeatures( vFeats, pNode, rwr_ok, nGain, res_ok, pManRes->nLastGain, ref_ok, pManRef->nLastGain );
         //fprintf(fpt, "%d, %d, %d, %d, %d, %d, %d, %d, %d, %d\n", iterNode, Abc_ObjId(pFanin), Abc_ObjFaninC0(pNode), Abc_ObjFaninC1(pNode), rwr_ok, nGain, res_ok, pManRes->nLastGain, ref_ok, pManRef->nLastGain);
         //printf("Res Ochestration: %d\n", pManRes->nLastGain);
         //printf("Ref Ochestration: %d\n", pManRef->nLastGain);
@@ -5250,9 +6629,10 @@ pManRes->timeRes += Abc_Clock() - clk;
      //}
      //continue; 
     }
-    fclose(f_el);
-    fclose(f_feats);
-    //fclose(fpt);
+    Abc_OrchDataWrite( edgelistFile, ABC_ORCH_DATA_EDGES, vEdges, 2 );
+    Vec_IntFree( vEdges );
+    Abc_OrchDataWrite( featFile, ABC_ORCH_DATA_FEATS, vFeats, 8 );
+    Vec_IntFree( vFeats );
     
     
     Extra_ProgressBarStop( pProgress );
@@ -5300,7 +6680,7 @@ pManRef->timeTotal = Abc_Clock() - clkStart;
     }
 
     // put the nodes into the DFS order and reassign their IDs
-    Abc_NtkReassignIds( pNtk );
+    Abc_OrchReassignIds( pNtk );
 //    Abc_AigCheckFaninOrder( pNtk->pManFunc );
 
     // fix the levels
@@ -5340,7 +6720,7 @@ int Abc_NtkOrchRand( Abc_Ntk_t * pNtk, Vec_Int_t **pGain_rwr, Vec_Int_t **pGain_
     Vec_Ptr_t * vFanins;
 
     Abc_Obj_t * pNode;
-    FILE *fpt;
+    Vec_Int_t * vDecs;
     abctime clk, clkStart = Abc_Clock();
     int i, nNodes, nNodes_after, nGain, fCompl;
     int RetValue = 1;
@@ -5412,7 +6792,6 @@ Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
     Vec_Int_t  *Valid_Ops = Vec_IntAlloc(1);
 
     pProgress = Extra_ProgressBarStart( stdout, nNodes );
-    fpt = fopen(DecisionFile, "w");
 
     Abc_NtkForEachNode( pNtk, pNode, i )
     {
@@ -5516,7 +6895,7 @@ int r = rand() % Valid_Len;
             Abc_AigUpdateReset( (Abc_Aig_t *)pNtk->pManFunc );
         if ( fCompl ) Dec_GraphComplement( pGraph );
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
+        Abc_OrchUpdateNetwork( pNode, pGraph, fUpdateLevel, nGain );
 Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
         if ( fCompl ) Dec_GraphComplement( pGraph );
         (*DecisionMask)->pArray[iterNode] = 0;
@@ -5528,7 +6907,7 @@ Rwr_ManAddTimeUpdate( pManRwr, Abc_Clock() - clk );
     // apply res
         pManRes->nTotalGain += pManRes->nLastGain;
 clk = Abc_Clock();
-        Dec_GraphUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
+        Abc_OrchUpdateNetwork( pNode, pFFormRes, fUpdateLevel, pManRes->nLastGain );
 pManRes->timeNtk += Abc_Clock() - clk;
         Dec_GraphFree( pFFormRes );
         (*DecisionMask)->pArray[iterNode] = 1;
@@ -5538,7 +6917,7 @@ pManRes->timeNtk += Abc_Clock() - clk;
     }
     else if ((Valid_Ops->pArray[r] == 2)){
 clk = Abc_Clock();
-        if ( !Dec_GraphUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
+        if ( !Abc_OrchUpdateNetwork( pNode, pFFormRef, fUpdateLevel, pManRef->nLastGain ) )
                  {
                      Dec_GraphFree( pFFormRef );
                      RetValue = -1;
@@ -5552,10 +6931,10 @@ pManRef->timeNtk += Abc_Clock() - clk;
         continue;
       }
     }
-    //fwrite((**DecisionMask).pArray, sizeof(int), sizeof((**DecisionMask).pArray), fpt);
-    for (int i = 0; i < (nNodes); i++){
-        fprintf(fpt, "%d\n", (*DecisionMask)->pArray[i]);}
-    fclose(fpt);
+    // save the decisions into a file or into the framework
+    vDecs = Vec_IntAllocArrayCopy( Vec_IntArray(*DecisionMask), nNodes );
+    Abc_OrchDataWrite( DecisionFile, ABC_ORCH_DATA_DECS, vDecs, 1 );
+    Vec_IntFree( vDecs );
 /*
     printf("size of vector %d\n", Valid_Len);
     printf("Nodes with rewrite: %d\n", ops_rwr);
@@ -5608,7 +6987,7 @@ pManRef->timeTotal = Abc_Clock() - clkStart;
     }
 
     // put the nodes into the DFS order and reassign their IDs
-    Abc_NtkReassignIds( pNtk );
+    Abc_OrchReassignIds( pNtk );
 //    Abc_AigCheckFaninOrder( pNtk->pManFunc );
 
     // fix the levels
@@ -93,6 +93,9 @@ static int IoCommandWriteResub  ( Abc_Frame_t * pAbc, int argc, char **argv );
 extern void Abc_FrameCopyLTLDataBase( Abc_Frame_t *pAbc, Abc_Ntk_t * pNtk );
 
 extern int glo_fMapped;
+extern int glo_nVerThreads;
+extern int glo_nBlifThreads;
+extern int glo_fVerVerbose;
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -506,6 +509,8 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fCheck;
     int fUseNewParser;
     int fSaveNames;
+    int fBench;
+    int nThreads;
     int c;
     extern Abc_Ntk_t * Io_ReadBlifAsAig( char * pFileName, int fCheck );
 
@@ -513,11 +518,24 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
     fReadAsAig = 0;
     fUseNewParser = 1;
     fSaveNames = 0;
+    fBench = 0;
+    nThreads = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "nmach" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Pnmabch" ) ) != EOF )
     {
         switch ( c )
         {
+            case 'P':
+                if ( globalUtilOptind >= argc )
+                {
+                    fprintf( pAbc->Err, "Command line switch \"-P\" should be followed by an integer.\n" );
+                    goto usage;
+                }
+                nThreads = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nThreads < 0 )
+                    goto usage;
+                break;
             case 'n':
                 fUseNewParser ^= 1;
                 break;
@@ -527,6 +545,9 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
             case 'a':
                 fReadAsAig ^= 1;
                 break;
+            case 'b':
+                fBench ^= 1;
+                break;
             case 'c':
                 fCheck ^= 1;
                 break;
@@ -540,11 +561,25 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
         goto usage;
     // get the input file name
     pFileName = argv[globalUtilOptind];
+    // compare the readers without changing the current network
+    if ( fBench )
+        return !Io_ReadBlifParBench( pFileName, Abc_MaxInt(nThreads, 1), 1 );
+    // the parallel reader replaces the new parser only
+    if ( nThreads > 1 && (fReadAsAig || !fUseNewParser) )
+    {
+        fprintf( pAbc->Err, "The parallel reader (-P) cannot be combined with switch \"-%c\".\n", fReadAsAig ? 'a' : 'n' );
+        return 1;
+    }
     // read the file using the corresponding file reader
     if ( fReadAsAig )
         pNtk = Io_ReadBlifAsAig( pFileName, fCheck );
     else if ( fUseNewParser )
+    {
+        // Io_ReadNetlist() uses the parallel reader for two or more threads
+        glo_nBlifThreads = nThreads;
         pNtk = Io_Read( pFileName, IO_FILE_BLIF, fCheck, 0 );
+        glo_nBlifThreads = 0;
+    }
     else
     {
         Abc_Ntk_t * pTemp;
@@ -567,12 +602,14 @@ int IoCommandReadBlif( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: read_blif [-nmach] <file>\n" );
+    fprintf( pAbc->Err, "usage: read_blif [-P num] [-nmabch] <file>\n" );
     fprintf( pAbc->Err, "\t         reads the network in binary BLIF format\n" );
     fprintf( pAbc->Err, "\t         (if this command does not work, try \"read\")\n" );
+    fprintf( pAbc->Err, "\t-P num : the number of threads of the parallel reader (0 or 1 = not used; not with -n or -a) [default = %d]\n", nThreads );
     fprintf( pAbc->Err, "\t-n     : toggle using old BLIF parser without hierarchy support [default = %s]\n", !fUseNewParser? "yes":"no" );
     fprintf( pAbc->Err, "\t-m     : toggle saving original circuit names into a file [default = %s]\n", fSaveNames? "yes":"no" );
     fprintf( pAbc->Err, "\t-a     : toggle creating AIG while reading the file [default = %s]\n", fReadAsAig? "yes":"no" );
+    fprintf( pAbc->Err, "\t-b     : toggle comparing the load time of the BLIF readers [default = %s]\n", fBench? "yes":"no" );
     fprintf( pAbc->Err, "\t-c     : toggle network check after reading [default = %s]\n", fCheck? "yes":"no" );
     fprintf( pAbc->Err, "\t-h     : prints the command summary\n" );
     fprintf( pAbc->Err, "\tfile   : the name of a file to read\n" );
@@ -1637,17 +1674,30 @@ int IoCommandReadVerilog( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     Abc_Ntk_t * pNtk;
     char * pFileName;
-    int fCheck, fBarBufs;
+    int fCheck, fBarBufs, nThreads, fVerbose;
     int c;
 
     fCheck = 1;
     fBarBufs = 0;
+    nThreads = 0;
+    fVerbose = 0;
     glo_fMapped = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "mcbh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Pmcbvh" ) ) != EOF )
     {
         switch ( c )
         {
+            case 'P':
+                if ( globalUtilOptind >= argc )
+                {
+                    fprintf( pAbc->Err, "Command line switch \"-P\" should be followed by an integer.\n" );
+                    goto usage;
+                }
+                nThreads = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nThreads < 0 )
+                    goto usage;
+                break;
             case 'm':
                 glo_fMapped ^= 1;
                 break;
@@ -1657,6 +1707,9 @@ int IoCommandReadVerilog( Abc_Frame_t * pAbc, int argc, char ** argv )
             case 'b':
                 fBarBufs ^= 1;
                 break;
+            case 'v':
+                fVerbose ^= 1;
+                break;
             case 'h':
                 goto usage;
             default:
@@ -1668,7 +1721,11 @@ int IoCommandReadVerilog( Abc_Frame_t * pAbc, int argc, char ** argv )
     // get the input file name
     pFileName = argv[globalUtilOptind];
     // read the file using the corresponding file reader
+    glo_nVerThreads = nThreads;
+    glo_fVerVerbose = fVerbose;
     pNtk = Io_Read( pFileName, IO_FILE_VERILOG, fCheck, fBarBufs );
+    glo_nVerThreads = 0;
+    glo_fVerVerbose = 0;
     if ( pNtk == NULL )
         return 1;
     // replace the current network
@@ -1677,11 +1734,13 @@ int IoCommandReadVerilog( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: read_verilog [-mcbh] <file>\n" );
+    fprintf( pAbc->Err, "usage: read_verilog [-P num] [-mcbvh] <file>\n" );
     fprintf( pAbc->Err, "\t         reads the network in Verilog (IWLS 2002/2005 subset)\n" );
+    fprintf( pAbc->Err, "\t-P num : the number of threads of the parallel parser (0 or 1 = not used) [default = %d]\n", nThreads );
     fprintf( pAbc->Err, "\t-m     : toggle reading mapped Verilog [default = %s]\n", glo_fMapped? "yes":"no" );
     fprintf( pAbc->Err, "\t-c     : toggle network check after reading [default = %s]\n", fCheck? "yes":"no" );
     fprintf( pAbc->Err, "\t-b     : toggle reading barrier buffers [default = %s]\n", fBarBufs? "yes":"no" );
+    fprintf( pAbc->Err, "\t-v     : toggle printing the runtime of the parallel parser [default = %s]\n", fVerbose? "yes":"no" );
     fprintf( pAbc->Err, "\t-h     : prints the command summary\n" );
     fprintf( pAbc->Err, "\tfile   : the name of a file to read\n" );
     return 1;
@@ -2011,13 +2070,24 @@ int IoCommandWrite( Abc_Frame_t * pAbc, int argc, char **argv )
 {
     char Command[1000];
     char * pFileName;
-    int c;
+    int c, nRounds = 0;
 
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "h" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Bh" ) ) != EOF )
     {
         switch ( c )
         {
+            case 'B':
+                if ( globalUtilOptind >= argc )
+                {
+                    Abc_Print( -1, "Command line switch \"-B\" should be followed by an integer.\n" );
+                    goto usage;
+                }
+                nRounds = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nRounds <= 0 )
+                    goto usage;
+                break;
             case 'h':
                 goto usage;
             default:
@@ -2047,14 +2117,22 @@ int IoCommandWrite( Abc_Frame_t * pAbc, int argc, char **argv )
         fprintf( pAbc->Out, "Empty network.\n" );
         return 0;
     }
+    // measure the throughput of the writers
+    if ( nRounds > 0 )
+    {
+        Io_WriteThroughput( pAbc->pNtkCur, pFileName, nRounds );
+        return 0;
+    }
     // call the corresponding file writer
     Io_Write( pAbc->pNtkCur, pFileName, Io_ReadFileType(pFileName) );
     return 0;
 
 usage:
-    fprintf( pAbc->Err, "usage: write [-h] <file>\n" );
+    fprintf( pAbc->Err, "usage: write [-B num] [-h] <file>\n" );
     fprintf( pAbc->Err, "\t         writes the current network into <file> by calling\n" );
     fprintf( pAbc->Err, "\t         the writer that matches the extension of <file>\n" );
+    fprintf( pAbc->Err, "\t-B num : benchmark the writers of the main formats by writing\n" );
+    fprintf( pAbc->Err, "\t         <file>.<ext> num times for each format and removing it [default = off]\n" );
     fprintf( pAbc->Err, "\t-h     : print the help massage\n" );
     fprintf( pAbc->Err, "\tfile   : the name of the file to write\n" );
     return 1;
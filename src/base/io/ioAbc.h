@@ -67,11 +67,53 @@ typedef enum {
     IO_FILE_UNKNOWN       
 } Io_FileType_t;
 
+// buffered output used by the BLIF, Verilog, EQN, and BENCH writers
+typedef struct Io_Buf_t_ Io_Buf_t;
+struct Io_Buf_t_
+{
+    FILE *           pFile;      // the output file (or NULL if the text is only collected)
+    Vec_Str_t *      vText;      // the text not yet written into the file
+    iword            nWritten;   // the number of bytes written into the file
+    int              fError;     // set when writing into the file has failed
+};
+
 ////////////////////////////////////////////////////////////////////////
 ///                      MACRO DEFINITIONS                           ///
 ////////////////////////////////////////////////////////////////////////
 
 #define  IO_WRITE_LINE_LENGTH    78    // the output line length
+#define  IO_WRITE_BUF_SIZE  (1<<20)   // the text size when the buffer is written into the file
+
+static inline void Io_BufChar( Io_Buf_t * p, char c )                  { Vec_StrPush( p->vText, c );                        }
+static inline void Io_BufNum( Io_Buf_t * p, int Num )                   { Vec_StrPrintNum( p->vText, Num );                  }
+static inline void Io_BufNumPad( Io_Buf_t * p, int Num, int nDigits )   { Vec_StrPrintNumStar( p->vText, Num, nDigits );     }
+static inline void Io_BufSpaces( Io_Buf_t * p, int nSpaces )            { while ( nSpaces-- > 0 ) Vec_StrPush( p->vText, ' ' ); }
+// makes room for nChars more characters (doubling the capacity, as Vec_StrPush does)
+static inline void Io_BufReserve( Io_Buf_t * p, int nChars )
+{
+    if ( Vec_StrSize(p->vText) + nChars > Vec_StrCap(p->vText) )
+        Vec_StrGrow( p->vText, Abc_MaxInt(2 * Vec_StrCap(p->vText), Vec_StrSize(p->vText) + nChars) );
+}
+static inline void Io_BufStrLen( Io_Buf_t * p, const char * pStr, int nChars )
+{
+    Io_BufReserve( p, nChars );
+    memcpy( Vec_StrLimit(p->vText), pStr, (size_t)nChars );
+    p->vText->nSize += nChars;
+}
+static inline void Io_BufStr( Io_Buf_t * p, const char * pStr ) { Io_BufStrLen( p, pStr, (int)strlen(pStr) ); }
+// the same as printing with "%-*s" and "%*s"
+static inline void Io_BufStrPad( Io_Buf_t * p, const char * pStr, int Width )
+{
+    int nChars = (int)strlen(pStr);
+    Io_BufStrLen( p, pStr, nChars );
+    Io_BufSpaces( p, Width - nChars );
+}
+static inline void Io_BufStrPadLeft( Io_Buf_t * p, const char * pStr, int Width )
+{
+    int nChars = (int)strlen(pStr);
+    Io_BufSpaces( p, Width - nChars );
+    Io_BufStrLen( p, pStr, nChars );
+}
 
 ////////////////////////////////////////////////////////////////////////
 ///                    FUNCTION DECLARATIONS                         ///
@@ -85,6 +127,9 @@ extern Abc_Ntk_t *        Io_ReadBaf( char * pFileName, int fCheck );
 extern Abc_Ntk_t *        Io_ReadBblif( char * pFileName, int fCheck );
 /*=== abcReadBlif.c ===========================================================*/
 extern Abc_Ntk_t *        Io_ReadBlif( char * pFileName, int fCheck );
+/*=== abcReadBlifPar.c ========================================================*/
+extern Abc_Ntk_t *        Io_ReadBlifPar( char * pFileName, int nThreads, int fCheck );
+extern int                Io_ReadBlifParBench( char * pFileName, int nThreads, int nRounds );
 /*=== abcReadBlifMv.c =========================================================*/
 extern Abc_Ntk_t *        Io_ReadBlifMv( char * pFileName, int fBlifMv, int fCheck );
 /*=== abcReadBench.c ==========================================================*/
@@ -155,6 +200,13 @@ extern Abc_Obj_t *        Io_ReadCreateConst( Abc_Ntk_t * pNtk, char * pName, in
 extern Abc_Obj_t *        Io_ReadCreateInv( Abc_Ntk_t * pNtk, char * pNameIn, char * pNameOut );
 extern Abc_Obj_t *        Io_ReadCreateBuf( Abc_Ntk_t * pNtk, char * pNameIn, char * pNameOut );
 extern FILE *             Io_FileOpen( const char * FileName, const char * PathVar, const char * Mode, int fVerbose );
+extern Io_Buf_t *         Io_BufStart( FILE * pFile );
+extern int                Io_BufFlush( Io_Buf_t * p );
+extern int                Io_BufStop( Io_Buf_t * p );
+extern void               Io_BufPrintf( Io_Buf_t * p, const char * pFormat, ... );
+extern int                Io_WriteThroughput( Abc_Ntk_t * pNtk, char * pFileName, int nRounds );
+
+static inline void Io_BufFlushIfFull( Io_Buf_t * p ) { if ( p->pFile && Vec_StrSize(p->vText) >= IO_WRITE_BUF_SIZE ) Io_BufFlush( p ); }
 
 /*=== ioJson.c ===========================================================*/
 extern void               Io_ReadJson( char * pFileName );
@@ -0,0 +1,761 @@
+/**CFile****************************************************************
+
+  FileName    [ioReadBlifPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Command processing package.]
+
+  Synopsis    [Parallel reader of flat BLIF files.]
+
+  Author      [Berkeley Logic Synthesis and Verification Group]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "ioAbc.h"
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define IO_BLIF_PAR_THR_MAX 64
+
+// the number of threads set by command "read_blif" (0 = not used)
+int glo_nBlifThreads = 0;
+
+// the types of parsed lines
+typedef enum {
+    IO_BLIF_PAR_NONE = 0,    // 0:  unused
+    IO_BLIF_PAR_MODEL,       // 1:  .model
+    IO_BLIF_PAR_INPUTS,      // 2:  .inputs
+    IO_BLIF_PAR_OUTPUTS,     // 3:  .outputs
+    IO_BLIF_PAR_LATCH,       // 4:  .latch
+    IO_BLIF_PAR_NAMES,       // 5:  .names with its cubes
+    IO_BLIF_PAR_END,         // 6:  .end
+    IO_BLIF_PAR_SKIP,        // 7:  unknown directive (skipped)
+    IO_BLIF_PAR_UNSUP,       // 8:  directive not supported by this reader
+    IO_BLIF_PAR_ERROR        // 9:  syntax error
+} Io_BlifParType_t;
+
+// the chunk of the file parsed by one thread
+// each record is: Type, Line, nTokens, (NameOffset, NameHash) * nTokens, Extra
+// where Extra is the offset of the SOP (.names), the initial value (.latch),
+// or the offset of the message (error)
+typedef struct Io_BlifParChunk_t_ Io_BlifParChunk_t;
+struct Io_BlifParChunk_t_
+{
+    char *           pBeg;       // the first character
+    char *           pEnd;       // the character after the last one
+    int              nLines;     // the number of lines in the chunk
+    int              LineBeg;    // the number of lines before the chunk
+    Vec_Int_t *      vRecs;      // the parsed records
+    Vec_Str_t *      vNames;     // the zero-terminated names and messages
+    Vec_Str_t *      vSops;      // the zero-terminated SOPs
+    Vec_Int_t *      vTokens;    // the tokens of the current line (offset, length)
+};
+
+// the entry of the name table used to link the nets
+typedef struct Io_BlifParEntry_t_ Io_BlifParEntry_t;
+struct Io_BlifParEntry_t_
+{
+    char *           pName;      // the name of the net
+    Abc_Obj_t *      pNet;       // the net
+    unsigned         Hash;       // the hash value of the name
+};
+
+// the name table (open addressing with linear probing, at most half full)
+typedef struct Io_BlifParTable_t_ Io_BlifParTable_t;
+struct Io_BlifParTable_t_
+{
+    Io_BlifParEntry_t * pEntries; // the entries
+    int              Mask;       // the table size minus one
+    int              nEntries;   // the number of used entries
+};
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the file into memory.]
+
+  Description [The file is memory-mapped (or read at once on Windows).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Io_BlifParMapFile( char * pFileName, size_t * pnBytes )
+{
+    char * pBuffer;
+#ifndef _WIN32
+    struct stat Stat;
+    int fd = open( pFileName, O_RDONLY );
+    if ( fd == -1 || fstat( fd, &Stat ) == -1 )
+    {
+        if ( fd != -1 ) close( fd );
+        return NULL;
+    }
+    *pnBytes = (size_t)Stat.st_size;
+    pBuffer  = *pnBytes ? (char *)mmap( NULL, *pnBytes, PROT_READ, MAP_PRIVATE, fd, 0 ) : NULL;
+    close( fd );
+    if ( pBuffer == (char *)MAP_FAILED )
+        pBuffer = NULL;
+#else
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    fseek( pFile, 0, SEEK_END );
+    *pnBytes = (size_t)ftell( pFile );
+    rewind( pFile );
+    pBuffer = ABC_ALLOC( char, *pnBytes + 1 );
+    if ( fread( pBuffer, 1, *pnBytes, pFile ) != *pnBytes )
+        ABC_FREE( pBuffer );
+    fclose( pFile );
+#endif
+    return pBuffer;
+}
+static void Io_BlifParUnmapFile( char * pBuffer, size_t nBytes )
+{
+#ifndef _WIN32
+    if ( pBuffer ) munmap( pBuffer, nBytes );
+#else
+    ABC_FREE( pBuffer );
+#endif
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Splits the file into chunks starting at the directives.]
+
+  Description [A chunk boundary is placed at the first line that starts
+  with a dot after the target position and does not continue the previous
+  line. As a result, the cubes of a .names line are in the same chunk.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_BlifParIsBoundary( char * pBeg, char * pCur )
+{
+    char * pPrev;
+    if ( pCur[0] != '.' || pCur == pBeg || pCur[-1] != '\n' )
+        return 0;
+    // skip the end of the previous line and check that it does not continue
+    for ( pPrev = pCur - 1; pPrev > pBeg && (pPrev[-1] == '\r' || pPrev[-1] == '\n'); pPrev-- )
+        if ( pPrev[-1] == '\n' )
+            return 1;
+    return pPrev == pBeg || pPrev[-1] != '\\';
+}
+static int Io_BlifParSplit( char * pBuffer, size_t nBytes, Io_BlifParChunk_t * pChunks, int nChunks )
+{
+    char * pEnd = pBuffer + nBytes, * pCur = pBuffer;
+    int i, nChunksReal = 0;
+    for ( i = 0; i < nChunks && pCur < pEnd; i++ )
+    {
+        char * pNext = pBuffer + (size_t)((double)nBytes * (i + 1) / nChunks);
+        if ( pNext < pCur )
+            pNext = pCur;
+        while ( pNext < pEnd && !(pNext > pCur && Io_BlifParIsBoundary(pBuffer, pNext)) )
+            pNext++;
+        pChunks[nChunksReal].pBeg = pCur;
+        pChunks[nChunksReal].pEnd = pNext;
+        nChunksReal++;
+        pCur = pNext;
+    }
+    return nChunksReal;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the tokens of the next logical line.]
+
+  Description [Skips comments, empty lines, and joins the lines ending
+  with a backslash. Returns 0 if there are no more lines in the chunk.
+  The line number of the first physical line is returned in pLine.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Io_BlifParReadLine( Io_BlifParChunk_t * p, char ** ppCur, int * pLine )
+{
+    char * pCur = *ppCur, * pEnd = p->pEnd, * pStart;
+    Vec_IntClear( p->vTokens );
+    while ( pCur < pEnd )
+    {
+        if ( *pCur == ' ' || *pCur == '\t' || *pCur == '\r' )
+            pCur++;
+        else if ( *pCur == '\n' )
+        {
+            p->nLines++, pCur++;
+            if ( Vec_IntSize(p->vTokens) )
+                break;
+        }
+        else if ( *pCur == '#' )
+        {
+            while ( pCur < pEnd && *pCur != '\n' )
+                pCur++;
+        }
+        else if ( *pCur == '\\' && (pCur + 1 == pEnd || pCur[1] == '\n' || pCur[1] == '\r') )
+        {
+            // continue the line
+            while ( pCur < pEnd && *pCur != '\n' )
+                pCur++;
+            if ( pCur < pEnd )
+                p->nLines++, pCur++;
+        }
+        else
+        {
+            if ( Vec_IntSize(p->vTokens) == 0 )
+                *pLine = p->nLines + 1;
+            for ( pStart = pCur; pCur < pEnd && *pCur != ' ' && *pCur != '\t' && *pCur != '\r' && *pCur != '\n' && *pCur != '#'; pCur++ )
+                if ( *pCur == '\\' && (pCur + 1 == pEnd || pCur[1] == '\n' || pCur[1] == '\r') )
+                    break;
+            Vec_IntPushTwo( p->vTokens, (int)(pStart - p->pBeg), (int)(pCur - pStart) );
+        }
+    }
+    *ppCur = pCur;
+    return Vec_IntSize(p->vTokens) > 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the records for the current line.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline unsigned Io_BlifParHash( char * pName, int nLength )
+{
+    unsigned Hash = 2166136261u;
+    int i;
+    for ( i = 0; i < nLength; i++ )
+        Hash = (Hash ^ (unsigned char)pName[i]) * 16777619u;
+    return Hash;
+}
+static inline char * Io_BlifParToken( Io_BlifParChunk_t * p, int i )
+{
+    return p->pBeg + Vec_IntEntry( p->vTokens, 2*i );
+}
+static inline int Io_BlifParTokenLen( Io_BlifParChunk_t * p, int i )
+{
+    return Vec_IntEntry( p->vTokens, 2*i+1 );
+}
+static void Io_BlifParAddRecord( Io_BlifParChunk_t * p, int Type, int Line, int iFirst, int nTokens )
+{
+    int i;
+    Vec_IntPush( p->vRecs, Type );
+    Vec_IntPush( p->vRecs, Line );
+    Vec_IntPush( p->vRecs, nTokens );
+    for ( i = iFirst; i < iFirst + nTokens; i++ )
+    {
+        char * pName = Io_BlifParToken( p, i );
+        int nLength = Io_BlifParTokenLen( p, i );
+        Vec_IntPush( p->vRecs, Vec_StrSize(p->vNames) );
+        Vec_IntPush( p->vRecs, (int)Io_BlifParHash(pName, nLength) );
+        Vec_StrPushBuffer( p->vNames, pName, nLength );
+        Vec_StrPush( p->vNames, '\0' );
+    }
+    Vec_IntPush( p->vRecs, 0 );
+}
+static void Io_BlifParAddError( Io_BlifParChunk_t * p, int Line, char * pMessage )
+{
+    Io_BlifParAddRecord( p, IO_BLIF_PAR_ERROR, Line, 0, 0 );
+    Vec_IntWriteEntry( p->vRecs, Vec_IntSize(p->vRecs)-1, Vec_StrSize(p->vNames) );
+    Vec_StrPrintStr( p->vNames, pMessage );
+    Vec_StrPush( p->vNames, '\0' );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses one chunk of the file.]
+
+  Description [Tokenizes the lines, hashes the names, and derives the SOPs
+  of the nodes. The nets are linked later, after all chunks are parsed.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Io_BlifParCloseNames( Io_BlifParChunk_t * p, int iSopStart )
+{
+    if ( Vec_StrSize(p->vSops) == iSopStart )
+        Vec_StrPrintStr( p->vSops, " 0\n" );
+    Vec_StrPush( p->vSops, '\0' );
+}
+static void Io_BlifParParseChunk( Io_BlifParChunk_t * p )
+{
+    char * pCur = p->pBeg, * pToken, Buffer[1000];
+    int Line = 0, nFanins = -1, iSopStart = -1, nTokens, Init;
+    while ( Io_BlifParReadLine(p, &pCur, &Line) )
+    {
+        nTokens = Vec_IntSize(p->vTokens) / 2;
+        pToken  = Io_BlifParToken( p, 0 );
+        if ( pToken[0] != '.' && nFanins >= 0 ) // the cube of the current node
+        {
+            if ( nTokens != 1 + (nFanins > 0) )
+            {
+                Io_BlifParAddError( p, Line, nFanins ? (char *)"The number of tokens in the cube is wrong." :
+                                                       (char *)"The number of tokens in the constant cube is wrong." );
+                Io_BlifParCloseNames( p, iSopStart );
+                nFanins = -1;
+                continue;
+            }
+            if ( nFanins > 0 )
+            {
+                char Char = Io_BlifParToken(p, 1)[0];
+                if ( Io_BlifParTokenLen(p, 0) != nFanins )
+                {
+                    sprintf( Buffer, "The number of fanins (%d) is different from SOP size (%d).", nFanins, Io_BlifParTokenLen(p, 0) );
+                    Io_BlifParAddError( p, Line, Buffer );
+                    Io_BlifParCloseNames( p, iSopStart );
+                    nFanins = -1;
+                    continue;
+                }
+                if ( Char != '0' && Char != '1' && Char != 'x' && Char != 'n' )
+                {
+                    Io_BlifParAddError( p, Line, (char *)"The output character in the constant cube is wrong." );
+                    Io_BlifParCloseNames( p, iSopStart );
+                    nFanins = -1;
+                    continue;
+                }
+                Vec_StrPushBuffer( p->vSops, pToken, nFanins );
+                Vec_StrPush( p->vSops, ' ' );
+                Vec_StrPush( p->vSops, Char );
+            }
+            else
+            {
+                Vec_StrPush( p->vSops, ' ' );
+                Vec_StrPush( p->vSops, pToken[0] );
+            }
+            Vec_StrPush( p->vSops, '\n' );
+            continue;
+        }
+        if ( nFanins >= 0 )
+            Io_BlifParCloseNames( p, iSopStart );
+        nFanins = -1;
+        if ( Io_BlifParTokenLen(p, 0) == 6 && !strncmp(pToken, ".names", 6) )
+        {
+            if ( nTokens < 2 )
+            {
+                Io_BlifParAddError( p, Line, (char *)"The .names line has less than two tokens." );
+                continue;
+            }
+            Io_BlifParAddRecord( p, IO_BLIF_PAR_NAMES, Line, 1, nTokens - 1 );
+            Vec_IntWriteEntry( p->vRecs, Vec_IntSize(p->vRecs)-1, Vec_StrSize(p->vSops) );
+            iSopStart = Vec_StrSize(p->vSops);
+            nFanins = nTokens - 2;
+        }
+        else if ( Io_BlifParTokenLen(p, 0) == 6 && !strncmp(pToken, ".latch", 6) )
+        {
+            if ( nTokens < 3 )
+            {
+                Io_BlifParAddError( p, Line, (char *)"The .latch line does not have enough tokens." );
+                continue;
+            }
+            Init = nTokens == 3 ? 2 : atoi( Io_BlifParToken(p, nTokens-1) );
+            if ( Init != 0 && Init != 1 && Init != 2 )
+            {
+                Io_BlifParAddError( p, Line, (char *)"The .latch line has an unknown reset value." );
+                continue;
+            }
+            Io_BlifParAddRecord( p, IO_BLIF_PAR_LATCH, Line, 1, 2 );
+            Vec_IntWriteEntry( p->vRecs, Vec_IntSize(p->vRecs)-1, Init );
+        }
+        else if ( Io_BlifParTokenLen(p, 0) == 7 && !strncmp(pToken, ".inputs", 7) )
+            Io_BlifParAddRecord( p, IO_BLIF_PAR_INPUTS, Line, 1, nTokens - 1 );
+        else if ( Io_BlifParTokenLen(p, 0) == 8 && !strncmp(pToken, ".outputs", 8) )
+            Io_BlifParAddRecord( p, IO_BLIF_PAR_OUTPUTS, Line, 1, nTokens - 1 );
+        else if ( Io_BlifParTokenLen(p, 0) == 6 && !strncmp(pToken, ".model", 6) )
+        {
+            if ( nTokens != 2 )
+            {
+                Io_BlifParAddError( p, Line, (char *)"The .model line does not have exactly two entries." );
+                continue;
+            }
+            Io_BlifParAddRecord( p, IO_BLIF_PAR_MODEL, Line, 1, 1 );
+        }
+        else if ( Io_BlifParTokenLen(p, 0) == 4 && !strncmp(pToken, ".end", 4) )
+            Io_BlifParAddRecord( p, IO_BLIF_PAR_END, Line, 0, 0 );
+        else if ( pToken[0] != '.' || (strncmp(pToken, ".default_", 9) && strncmp(pToken, ".input_", 7) &&
+                  strncmp(pToken, ".output_", 8) && strncmp(pToken, ".and_gate_delay", 15) &&
+                  strncmp(pToken, ".gate", 5) && strncmp(pToken, ".subckt", 7) && strncmp(pToken, ".exdc", 5) &&
+                  strncmp(pToken, ".blackbox", 9) && strncmp(pToken, ".mlatch", 7)) )
+            Io_BlifParAddRecord( p, IO_BLIF_PAR_SKIP, Line, 0, 1 );
+        else // the directives handled by the standard reader
+            Io_BlifParAddRecord( p, IO_BLIF_PAR_UNSUP, Line, 0, 1 );
+    }
+    if ( nFanins >= 0 )
+        Io_BlifParCloseNames( p, iSopStart );
+}
+
+#ifdef ABC_USE_PTHREADS
+static void * Io_BlifParWorkerThread( void * pArg )
+{
+    Io_BlifParChunk_t * p = (Io_BlifParChunk_t *)pArg;
+    Io_BlifParParseChunk( p );
+    return NULL;
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Finds or creates the net using the precomputed hash value.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Io_BlifParTableResize( Io_BlifParTable_t * p )
+{
+    Io_BlifParEntry_t * pOld = p->pEntries;
+    int i, k, nSizeOld = p->Mask + 1;
+    p->Mask     = 2 * nSizeOld - 1;
+    p->pEntries = ABC_CALLOC( Io_BlifParEntry_t, p->Mask + 1 );
+    for ( i = 0; i < nSizeOld; i++ )
+    {
+        if ( pOld[i].pName == NULL )
+            continue;
+        for ( k = pOld[i].Hash & p->Mask; p->pEntries[k].pName; k = (k + 1) & p->Mask )
+            ;
+        p->pEntries[k] = pOld[i];
+    }
+    ABC_FREE( pOld );
+}
+static Abc_Obj_t * Io_BlifParFindOrCreateNet( Abc_Ntk_t * pNtk, Io_BlifParTable_t * p, char * pName, unsigned Hash, int * pfFound )
+{
+    Io_BlifParEntry_t * pEntry;
+    int i;
+    for ( i = Hash & p->Mask; (pEntry = p->pEntries + i)->pName; i = (i + 1) & p->Mask )
+        if ( pEntry->Hash == Hash && !strcmp(pEntry->pName, pName) )
+        {
+            if ( pfFound ) *pfFound = 1;
+            return pEntry->pNet;
+        }
+    if ( pfFound ) *pfFound = 0;
+    // the table is sized for the driven nets; the undriven ones may need more room
+    if ( 2 * (p->nEntries + 1) > p->Mask + 1 )
+    {
+        Io_BlifParTableResize( p );
+        for ( i = Hash & p->Mask; (pEntry = p->pEntries + i)->pName; i = (i + 1) & p->Mask )
+            ;
+    }
+    p->nEntries++;
+    pEntry->pName = pName;
+    pEntry->Hash  = Hash;
+    pEntry->pNet  = Abc_NtkCreateNet( pNtk );
+    Nm_ManStoreIdName( pNtk->pManName, pEntry->pNet->Id, pEntry->pNet->Type, pName, NULL );
+    return pEntry->pNet;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the flat BLIF file using several threads.]
+
+  Description [The file is memory-mapped and split into chunks at the
+  directive lines. The chunks are tokenized and the names are hashed
+  in parallel. After that, the nets are linked in one pass over the
+  records, in the order of the file, so the resulting netlist is the
+  same as the one produced by Io_ReadBlif(). The files with hierarchy,
+  library gates, EXDC or timing information are read by Io_ReadBlifMv(),
+  the reader used by default, so that Io_Read() flattens the hierarchy
+  in the same way for both readers.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Ntk_t * Io_ReadBlifPar( char * pFileName, int nThreads, int fCheck )
+{
+    Io_BlifParChunk_t Chunks[IO_BLIF_PAR_THR_MAX];
+    Io_BlifParTable_t Table, * pTable = &Table;
+    Abc_Ntk_t * pNtk = NULL;
+    Abc_Obj_t * pNet, * pTerm, * pNode, * pLatch;
+    char * pBuffer, * pName, * pNames, * pPivot, ** ppNames = NULL;
+    size_t nBytes = 0;
+    int i, c, nChunks, nNetsMax = 0, nNamesMax = 0, fFound, fError = 0, fUnsup = 0, fModel = 0, fEnd = 0;
+    nThreads = Abc_MaxInt( 1, Abc_MinInt(nThreads, IO_BLIF_PAR_THR_MAX) );
+    pBuffer = Io_BlifParMapFile( pFileName, &nBytes );
+    if ( pBuffer == NULL )
+    {
+        printf( "Io_ReadBlifPar(): Cannot read the input file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    // split the file and parse the chunks
+    nChunks = Io_BlifParSplit( pBuffer, nBytes, Chunks, nThreads );
+    for ( c = 0; c < nChunks; c++ )
+    {
+        Chunks[c].nLines  = 0;
+        Chunks[c].vRecs   = Vec_IntAlloc( 1000 );
+        Chunks[c].vNames  = Vec_StrAlloc( 1000 );
+        Chunks[c].vSops   = Vec_StrAlloc( 1000 );
+        Chunks[c].vTokens = Vec_IntAlloc( 100 );
+    }
+#ifdef ABC_USE_PTHREADS
+    if ( nChunks > 1 )
+    {
+        pthread_t WorkerThread[IO_BLIF_PAR_THR_MAX];
+        for ( c = 0; c < nChunks; c++ )
+        {
+            int status = pthread_create( WorkerThread + c, NULL, Io_BlifParWorkerThread, (void *)(Chunks + c) );
+            assert( status == 0 );
+        }
+        for ( c = 0; c < nChunks; c++ )
+            pthread_join( WorkerThread[c], NULL );
+    }
+    else
+#endif
+    for ( c = 0; c < nChunks; c++ )
+        Io_BlifParParseChunk( Chunks + c );
+    // count the lines and the nets
+    for ( c = 0; c < nChunks; c++ )
+    {
+        int * pRec, * pLimit = Vec_IntLimit( Chunks[c].vRecs );
+        Chunks[c].LineBeg = c ? Chunks[c-1].LineBeg + Chunks[c-1].nLines : 0;
+        for ( pRec = Vec_IntArray(Chunks[c].vRecs); pRec < pLimit; pRec += 4 + 2 * pRec[2] )
+        {
+            nNetsMax   += pRec[0] == IO_BLIF_PAR_NAMES ? 1 : pRec[0] == IO_BLIF_PAR_LATCH ? 3 : pRec[2];
+            nNamesMax = Abc_MaxInt( nNamesMax, pRec[2] );
+            fUnsup |= (pRec[0] == IO_BLIF_PAR_UNSUP);
+            fUnsup |= (pRec[0] == IO_BLIF_PAR_MODEL && fEnd); // the second model
+            fEnd   |= (pRec[0] == IO_BLIF_PAR_END);
+        }
+    }
+    if ( fUnsup )
+    {
+        for ( c = 0; c < nChunks; c++ )
+        {
+            Vec_IntFree( Chunks[c].vRecs );
+            Vec_StrFree( Chunks[c].vNames );
+            Vec_StrFree( Chunks[c].vSops );
+            Vec_IntFree( Chunks[c].vTokens );
+        }
+        Io_BlifParUnmapFile( pBuffer, nBytes );
+        return Io_ReadBlifMv( pFileName, 0, fCheck );
+    }
+    // link the nets in the order of the file
+    pTable->Mask     = (1 << Abc_Base2Log(2 * nNetsMax + 2)) - 1;
+    pTable->pEntries = ABC_CALLOC( Io_BlifParEntry_t, pTable->Mask + 1 );
+    pTable->nEntries = 0;
+    ppNames = ABC_ALLOC( char *, nNamesMax + 1 );
+    pNtk   = Abc_NtkAlloc( ABC_NTK_NETLIST, ABC_FUNC_SOP, 1 );
+    // the number of names is known, so the name manager does not need resizing
+    Nm_ManReserve( pNtk->pManName, nNetsMax, 0 );
+    fEnd   = 0;
+    for ( c = 0; c < nChunks && !fError && !fEnd; c++ )
+    {
+        int * pRec, * pLimit = Vec_IntLimit( Chunks[c].vRecs );
+        pNames = Vec_StrArray( Chunks[c].vNames );
+        for ( pRec = Vec_IntArray(Chunks[c].vRecs); pRec < pLimit && !fError && !fEnd; pRec += 4 + 2 * pRec[2] )
+        {
+            int Type = pRec[0], Line = Chunks[c].LineBeg + pRec[1], nTokens = pRec[2], Extra = pRec[3 + 2 * nTokens];
+            int * pToks = pRec + 3;
+            if ( Type != IO_BLIF_PAR_MODEL && !fModel )
+            {
+                printf( "%s (line %d): Wrong input file format.\n", pFileName, Line );
+                fError = 1;
+            }
+            else if ( Type == IO_BLIF_PAR_MODEL )
+            {
+                for ( pPivot = pName = pNames + pToks[0]; *pName; pName++ )
+                    if ( *pName == '/' || *pName == '\\' )
+                        pPivot = pName+1;
+                pNtk->pName = Extra_UtilStrsav( pPivot );
+                fModel = 1;
+            }
+            else if ( Type == IO_BLIF_PAR_INPUTS )
+            {
+                for ( i = 0; i < nTokens; i++ )
+                {
+                    pNet = Io_BlifParFindOrCreateNet( pNtk, pTable, pNames + pToks[2*i], (unsigned)pToks[2*i+1], &fFound );
+                    if ( fFound )
+                        printf( "Warning: PI \"%s\" appears twice in the list.\n", pNames + pToks[2*i] );
+                    pTerm = Abc_NtkCreatePi( pNtk );
+                    Abc_ObjAddFanin( pNet, pTerm );
+                }
+            }
+            else if ( Type == IO_BLIF_PAR_OUTPUTS )
+            {
+                for ( i = 0; i < nTokens; i++ )
+                {
+                    pNet = Io_BlifParFindOrCreateNet( pNtk, pTable, pNames + pToks[2*i], (unsigned)pToks[2*i+1], &fFound );
+                    if ( fFound && Abc_ObjFaninNum(pNet) == 0 )
+                        printf( "Warning: PO \"%s\" appears twice in the list.\n", pNames + pToks[2*i] );
+                    pTerm = Abc_NtkCreatePo( pNtk );
+                    Abc_ObjAddFanin( pTerm, pNet );
+                }
+            }
+            else if ( Type == IO_BLIF_PAR_LATCH )
+            {
+                // the same as Io_ReadCreateLatch()
+                pNet = Io_BlifParFindOrCreateNet( pNtk, pTable, pNames + pToks[0], (unsigned)pToks[1], NULL );
+                pTerm = Abc_NtkCreateBi( pNtk );
+                Abc_ObjAddFanin( pTerm, pNet );
+                pLatch = Abc_NtkCreateLatch( pNtk );
+                Abc_ObjAddFanin( pLatch, pTerm );
+                pTerm = Abc_NtkCreateBo( pNtk );
+                Abc_ObjAddFanin( pTerm, pLatch );
+                pNet = Io_BlifParFindOrCreateNet( pNtk, pTable, pNames + pToks[2], (unsigned)pToks[3], NULL );
+                Abc_ObjAddFanin( pNet, pTerm );
+                Abc_ObjAssignName( pLatch, pNames + pToks[2], "L" );
+                if ( Extra == 0 )
+                    Abc_LatchSetInit0( pLatch );
+                else if ( Extra == 1 )
+                    Abc_LatchSetInit1( pLatch );
+                else
+                    Abc_LatchSetInitDc( pLatch );
+            }
+            else if ( Type == IO_BLIF_PAR_NAMES )
+            {
+                // the same as Io_ReadCreateNode()
+                pNode = Abc_NtkCreateNode( pNtk );
+                for ( i = 0; i < nTokens; i++ )
+                {
+                    ppNames[i] = pNames + pToks[2*i];
+                    pNet = Io_BlifParFindOrCreateNet( pNtk, pTable, ppNames[i], (unsigned)pToks[2*i+1], NULL );
+                    if ( i < nTokens - 1 )
+                        Abc_ObjAddFanin( pNode, pNet );
+                    else
+                        Abc_ObjAddFanin( pNet, pNode );
+                }
+                Abc_ObjSetData( pNode, Abc_SopRegister((Mem_Flex_t *)pNtk->pManFunc, Vec_StrEntryP(Chunks[c].vSops, Extra)) );
+            }
+            else if ( Type == IO_BLIF_PAR_END )
+                fEnd = 1;
+            else if ( Type == IO_BLIF_PAR_SKIP )
+                printf( "%s (line %d): Skipping directive \"%s\".\n", pFileName, Line, pNames + pToks[0] );
+            else if ( Type == IO_BLIF_PAR_ERROR )
+            {
+                printf( "%s (line %d): %s\n", pFileName, Line, pNames + Extra );
+                fError = 1;
+            }
+        }
+    }
+    if ( !fModel && !fError )
+    {
+        printf( "%s: Wrong input file format.\n", pFileName );
+        fError = 1;
+    }
+    // the names are copied by the name manager, so the buffers can be freed
+    ABC_FREE( pTable->pEntries );
+    ABC_FREE( ppNames );
+    for ( c = 0; c < nChunks; c++ )
+    {
+        Vec_IntFree( Chunks[c].vRecs );
+        Vec_StrFree( Chunks[c].vNames );
+        Vec_StrFree( Chunks[c].vSops );
+        Vec_IntFree( Chunks[c].vTokens );
+    }
+    Io_BlifParUnmapFile( pBuffer, nBytes );
+    if ( fError )
+    {
+        Abc_NtkDelete( pNtk );
+        return NULL;
+    }
+    Abc_NtkFinalizeRead( pNtk );
+    pNtk->pSpec = Extra_UtilStrsav( pFileName );
+    if ( fCheck && !Abc_NtkCheckRead( pNtk ) )
+    {
+        printf( "Io_ReadBlifPar: The network check has failed.\n" );
+        Abc_NtkDelete( pNtk );
+        return NULL;
+    }
+    return pNtk;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compares the load time of the BLIF readers.]
+
+  Description [Reads the file with the standard reader (Io_ReadBlif),
+  the BLIF-MV reader used by default (Io_ReadBlifMv), and the parallel
+  reader with the given number of threads. Prints the runtime and the
+  network statistics. Returns 1 if the networks have the same size.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Io_ReadBlifParBench( char * pFileName, int nThreads, int nRounds )
+{
+    char * pReaders[3] = { "Io_ReadBlif", "Io_ReadBlifMv", "Io_ReadBlifPar" };
+    int Sizes[3][3] = {{0}}, i, r, RetValue = 1;
+    for ( i = 0; i < 3; i++ )
+    {
+        abctime clk = Abc_Clock();
+        for ( r = 0; r < Abc_MaxInt(nRounds, 1); r++ )
+        {
+            Abc_Ntk_t * pNtk = NULL;
+            if ( i == 0 )
+                pNtk = Io_ReadBlif( pFileName, 0 );
+            else if ( i == 1 )
+                pNtk = Io_ReadBlifMv( pFileName, 0, 0 );
+            else
+                pNtk = Io_ReadBlifPar( pFileName, nThreads, 0 );
+            if ( pNtk == NULL )
+            {
+                printf( "%s cannot read the file \"%s\".\n", pReaders[i], pFileName );
+                return 0;
+            }
+            Sizes[i][0] = Abc_NtkNodeNum( pNtk );
+            Sizes[i][1] = Abc_NtkNetNum( pNtk );
+            Sizes[i][2] = Abc_NtkLatchNum( pNtk );
+            Abc_NtkDelete( pNtk );
+        }
+        printf( "%-15s: Nodes = %9d  Nets = %9d  Latches = %7d  ", pReaders[i], Sizes[i][0], Sizes[i][1], Sizes[i][2] );
+        Abc_PrintTime( 1, "Time", (Abc_Clock() - clk) / Abc_MaxInt(nRounds, 1) );
+        RetValue &= !memcmp( Sizes[i], Sizes[0], sizeof(int) * 3 );
+    }
+    if ( !RetValue )
+        printf( "The networks produced by the readers are different.\n" );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
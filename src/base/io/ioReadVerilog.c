@@ -30,6 +30,10 @@ ABC_NAMESPACE_IMPL_START
 
 //extern Abc_Des_t * Ver_ParseFile( char * pFileName, Abc_Des_t * pGateLib, int fCheck, int fUseMemMan );
 
+// the parameters of the parallel parser set by command "read_verilog"
+int glo_nVerThreads = 0;  // the number of threads (0 or 1 = not used)
+int glo_fVerVerbose = 0;  // printing the runtime of the parsing stages
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -52,7 +56,10 @@ Abc_Ntk_t * Io_ReadVerilog( char * pFileName, int fCheck )
     int i, RetValue;
 
     // parse the verilog file
-    pDesign = Ver_ParseFile( pFileName, NULL, fCheck, 1 );
+    if ( glo_nVerThreads > 1 )
+        pDesign = Ver_ParseFilePar( pFileName, NULL, fCheck, 1, glo_nVerThreads, glo_fVerVerbose );
+    else
+        pDesign = Ver_ParseFile( pFileName, NULL, fCheck, 1 );
     if ( pDesign == NULL )
         return NULL;
 
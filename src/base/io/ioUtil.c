@@ -29,6 +29,8 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+extern int glo_nBlifThreads;
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -133,7 +135,10 @@ Abc_Ntk_t * Io_ReadNetlist( char * pFileName, Io_FileType_t FileType, int fCheck
         return pNtk;
     }
     // read the new netlist
-    if ( FileType == IO_FILE_BLIF )
+    // with one thread, the parallel reader is slower than the default one
+    if ( FileType == IO_FILE_BLIF && glo_nBlifThreads > 1 )
+        pNtk = Io_ReadBlifPar( pFileName, glo_nBlifThreads, fCheck );
+    else if ( FileType == IO_FILE_BLIF )
 //        pNtk = Io_ReadBlif( pFileName, fCheck );
         pNtk = Io_ReadBlifMv( pFileName, 0, fCheck );
     else if ( Io_ReadFileType(pFileName) == IO_FILE_BLIFMV )
@@ -865,6 +870,151 @@ FILE * Io_FileOpen( const char * FileName, const char * PathVar, const char * Mo
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts the buffered output.]
+
+  Description [The text is collected in memory and written into the file
+  in large blocks when the buffer exceeds IO_WRITE_BUF_SIZE bytes.
+  If pFile is NULL, the text is only collected in memory.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Io_Buf_t * Io_BufStart( FILE * pFile )
+{
+    Io_Buf_t * p = ABC_CALLOC( Io_Buf_t, 1 );
+    p->pFile = pFile;
+    p->vText = Vec_StrAlloc( pFile ? IO_WRITE_BUF_SIZE + (1<<12) : (1<<12) );
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the collected text into the file.]
+
+  Description [Returns 0 if this or an earlier write has failed. After 
+  a failure, the text is discarded, so that the buffer does not grow.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Io_BufFlush( Io_Buf_t * p )
+{
+    size_t nBytes = (size_t)Vec_StrSize(p->vText);
+    if ( p->pFile == NULL || nBytes == 0 )
+        return !p->fError;
+    if ( !p->fError && fwrite( Vec_StrArray(p->vText), 1, nBytes, p->pFile ) != nBytes )
+        p->fError = 1;
+    if ( !p->fError )
+        p->nWritten += nBytes;
+    Vec_StrClear( p->vText );
+    return !p->fError;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the buffered output.]
+
+  Description [Writes the remaining text and flushes the file, which stays 
+  open. Returns 0 if writing into the file has failed, including the text 
+  written into it directly by fprintf().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Io_BufStop( Io_Buf_t * p )
+{
+    int RetValue = Io_BufFlush( p );
+    if ( p->pFile && (fflush( p->pFile ) != 0 || ferror( p->pFile )) )
+        RetValue = 0;
+    Vec_StrFree( p->vText );
+    ABC_FREE( p );
+    return RetValue;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Formatted output into the buffer.]
+
+  Description [Used for the rare lines, for which the dedicated
+  formatting procedures are not available.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Io_BufPrintf( Io_Buf_t * p, const char * pFormat, ... )
+{
+    va_list args;
+    int nAdded;
+    va_start( args, pFormat );
+    nAdded = vsnprintf( NULL, 0, pFormat, args );
+    va_end( args );
+    if ( nAdded <= 0 )
+        return;
+    Io_BufReserve( p, nAdded + 1 );
+    va_start( args, pFormat );
+    vsnprintf( Vec_StrLimit(p->vText), (size_t)nAdded + 1, pFormat, args );
+    va_end( args );
+    p->vText->nSize += nAdded;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Measures the writing throughput for the main formats.]
+
+  Description [Writes the network nRounds times into each format that 
+  is applicable to it, using pFileName with the format extension 
+  as the output file name. Prints the file size, the runtime, and 
+  the throughput. The files are removed after writing.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Io_WriteThroughput( Abc_Ntk_t * pNtk, char * pFileName, int nRounds )
+{
+    char * pExts[] = { "blif", "v", "eqn", "bench", "aig", NULL };
+    int    fAigs[] = {   0,     0,    0,      1,      1       };
+    char Buffer[1000];
+    FILE * pFile;
+    int i, r, nBytes, nWritten = 0;
+    abctime clk;
+    for ( i = 0; pExts[i]; i++ )
+    {
+        if ( fAigs[i] && !Abc_NtkIsStrash(pNtk) )
+            continue;
+        snprintf( Buffer, 1000, "%s.%s", pFileName, pExts[i] );
+        clk = Abc_Clock();
+        for ( r = 0; r < nRounds; r++ )
+            Io_Write( pNtk, Buffer, Io_ReadFileType(Buffer) );
+        clk = Abc_Clock() - clk;
+        pFile = fopen( Buffer, "rb" );
+        if ( pFile == NULL )
+        {
+            printf( "%-6s : Writing has failed.\n", pExts[i] );
+            continue;
+        }
+        fclose( pFile );
+        nBytes = Extra_FileSize( Buffer );
+        remove( Buffer );
+        printf( "%-6s : %10d bytes  ", pExts[i], nBytes );
+        printf( "%8.2f MB/s  ", clk ? 1.0 * nBytes * nRounds / (1<<20) / (1.0 * clk / CLOCKS_PER_SEC) : 0.0 );
+        ABC_PRT( "Time", clk / nRounds );
+        nWritten++;
+    }
+    return nWritten;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Tranform SF into PLA.]
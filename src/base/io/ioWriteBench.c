@@ -29,11 +29,18 @@ ABC_NAMESPACE_IMPL_START
 
 static int Io_WriteBenchCheckNames( Abc_Ntk_t * pNtk );
 
-static int Io_WriteBenchOne( FILE * pFile, Abc_Ntk_t * pNtk );
-static int Io_WriteBenchOneNode( FILE * pFile, Abc_Obj_t * pNode );
+static int Io_WriteBenchOne( Io_Buf_t * p, Abc_Ntk_t * pNtk );
+static int Io_WriteBenchOneNode( Io_Buf_t * p, Abc_Obj_t * pNode );
 
-static int Io_WriteBenchLutOne( FILE * pFile, Abc_Ntk_t * pNtk );
-static int Io_WriteBenchLutOneNode( FILE * pFile, Abc_Obj_t * pNode, Vec_Int_t * vTruth );
+static int Io_WriteBenchLutOne( Io_Buf_t * p, Abc_Ntk_t * pNtk );
+static int Io_WriteBenchLutOneNode( Io_Buf_t * p, Abc_Obj_t * pNode, Vec_Int_t * vTruth );
+
+// writes "%-11s = " with the name of the node
+static inline void Io_WriteBenchNodeName( Io_Buf_t * p, Abc_Obj_t * pNode )
+{
+    Io_BufStrPad( p, Abc_ObjName(Abc_ObjFanout0(pNode)), 11 );
+    Io_BufStr( p, " = " );
+}
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -54,6 +61,8 @@ int Io_WriteBench( Abc_Ntk_t * pNtk, const char * pFileName )
 {
     Abc_Ntk_t * pExdc;
     FILE * pFile;
+    Io_Buf_t * p;
+    int RetValue;
     assert( Abc_NtkIsSopNetlist(pNtk) );
     if ( !Io_WriteBenchCheckNames(pNtk) )
     {
@@ -66,16 +75,20 @@ int Io_WriteBench( Abc_Ntk_t * pNtk, const char * pFileName )
         fprintf( stdout, "Io_WriteBench(): Cannot open the output file.\n" );
         return 0;
     }
-    fprintf( pFile, "# Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
+    p = Io_BufStart( pFile );
+    Io_BufPrintf( p, "# Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
     // write the network
-    Io_WriteBenchOne( pFile, pNtk );
+    Io_WriteBenchOne( p, pNtk );
     // write EXDC network if it exists
     pExdc = Abc_NtkExdc( pNtk );
     if ( pExdc )
         printf( "Io_WriteBench: EXDC is not written (warning).\n" );
     // finalize the file
+    RetValue = Io_BufStop( p );
+    if ( !RetValue )
+        fprintf( stdout, "Io_WriteBench(): Writing into the output file \"%s\" has failed.\n", pFileName );
     fclose( pFile );
-    return 1;
+    return RetValue;
 }
 
 /**Function*************************************************************
@@ -89,7 +102,7 @@ int Io_WriteBench( Abc_Ntk_t * pNtk, const char * pFileName )
   SeeAlso     []
 
 ***********************************************************************/
-int Io_WriteBenchOne( FILE * pFile, Abc_Ntk_t * pNtk )
+int Io_WriteBenchOne( Io_Buf_t * p, Abc_Ntk_t * pNtk )
 {
     ProgressBar * pProgress;
     Abc_Obj_t * pNode;
@@ -97,19 +110,32 @@ int Io_WriteBenchOne( FILE * pFile, Abc_Ntk_t * pNtk )
 
     // write the PIs/POs/latches
     Abc_NtkForEachPi( pNtk, pNode, i )
-        fprintf( pFile, "INPUT(%s)\n", Abc_ObjName(Abc_ObjFanout0(pNode)) );
+    {
+        Io_BufStr( p, "INPUT(" );
+        Io_BufStr( p, Abc_ObjName(Abc_ObjFanout0(pNode)) );
+        Io_BufStr( p, ")\n" );
+    }
     Abc_NtkForEachPo( pNtk, pNode, i )
-        fprintf( pFile, "OUTPUT(%s)\n", Abc_ObjName(Abc_ObjFanin0(pNode)) );
+    {
+        Io_BufStr( p, "OUTPUT(" );
+        Io_BufStr( p, Abc_ObjName(Abc_ObjFanin0(pNode)) );
+        Io_BufStr( p, ")\n" );
+    }
     Abc_NtkForEachLatch( pNtk, pNode, i )
-        fprintf( pFile, "%-11s = DFF(%s)\n", 
-            Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout0(pNode))), Abc_ObjName(Abc_ObjFanin0(Abc_ObjFanin0(pNode))) );
+    {
+        Io_WriteBenchNodeName( p, Abc_ObjFanout0(pNode) );
+        Io_BufStr( p, "DFF(" );
+        Io_BufStr( p, Abc_ObjName(Abc_ObjFanin0(Abc_ObjFanin0(pNode))) );
+        Io_BufStr( p, ")\n" );
+    }
 
     // write internal nodes
     pProgress = Extra_ProgressBarStart( stdout, Abc_NtkObjNumMax(pNtk) );
     Abc_NtkForEachNode( pNtk, pNode, i )
     {
         Extra_ProgressBarUpdate( pProgress, i, NULL );
-        Io_WriteBenchOneNode( pFile, pNode );
+        Io_WriteBenchOneNode( p, pNode );
+        Io_BufFlushIfFull( p );
     }
     Extra_ProgressBarStop( pProgress );
     return 1;
@@ -127,37 +153,32 @@ int Io_WriteBenchOne( FILE * pFile, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-int Io_WriteBenchOneNode( FILE * pFile, Abc_Obj_t * pNode )
+int Io_WriteBenchOneNode( Io_Buf_t * p, Abc_Obj_t * pNode )
 {
     int nFanins;
 
     assert( Abc_ObjIsNode(pNode) );
     nFanins = Abc_ObjFaninNum(pNode);
+    Io_WriteBenchNodeName( p, pNode );
     if ( nFanins == 0 )
     {   // write the constant 1 node
         assert( Abc_NodeIsConst1(pNode) );
-        fprintf( pFile, "%-11s",          Abc_ObjName(Abc_ObjFanout0(pNode)) );
-        fprintf( pFile, " = vdd\n" );
+        Io_BufStr( p, "vdd\n" );
+        return 1;
     }
-    else if ( nFanins == 1 )
+    if ( nFanins == 1 )
     {   // write the interver/buffer
-        if ( Abc_NodeIsBuf(pNode) )
-        {
-            fprintf( pFile, "%-11s = BUFF(",  Abc_ObjName(Abc_ObjFanout0(pNode)) );
-            fprintf( pFile, "%s)\n",          Abc_ObjName(Abc_ObjFanin0(pNode)) );
-        }
-        else
-        {
-            fprintf( pFile, "%-11s = NOT(",   Abc_ObjName(Abc_ObjFanout0(pNode)) );
-            fprintf( pFile, "%s)\n",          Abc_ObjName(Abc_ObjFanin0(pNode)) );
-        }
+        Io_BufStr( p, Abc_NodeIsBuf(pNode) ? "BUFF(" : "NOT(" );
+        Io_BufStr( p, Abc_ObjName(Abc_ObjFanin0(pNode)) );
     }
     else
     {   // write the AND gate
-        fprintf( pFile, "%-11s",       Abc_ObjName(Abc_ObjFanout0(pNode)) );
-        fprintf( pFile, " = AND(%s, ", Abc_ObjName(Abc_ObjFanin0(pNode)) );
-        fprintf( pFile, "%s)\n",       Abc_ObjName(Abc_ObjFanin1(pNode)) );
+        Io_BufStr( p, "AND(" );
+        Io_BufStr( p, Abc_ObjName(Abc_ObjFanin0(pNode)) );
+        Io_BufStr( p, ", " );
+        Io_BufStr( p, Abc_ObjName(Abc_ObjFanin1(pNode)) );
     }
+    Io_BufStr( p, ")\n" );
     return 1;
 }
 
@@ -176,6 +197,8 @@ int Io_WriteBenchLut( Abc_Ntk_t * pNtk, char * pFileName )
 {
     Abc_Ntk_t * pExdc;
     FILE * pFile;
+    Io_Buf_t * p;
+    int RetValue;
     assert( Abc_NtkIsAigNetlist(pNtk) );
     if ( !Io_WriteBenchCheckNames(pNtk) )
     {
@@ -188,16 +211,20 @@ int Io_WriteBenchLut( Abc_Ntk_t * pNtk, char * pFileName )
         fprintf( stdout, "Io_WriteBench(): Cannot open the output file.\n" );
         return 0;
     }
-    fprintf( pFile, "# Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
+    p = Io_BufStart( pFile );
+    Io_BufPrintf( p, "# Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
     // write the network
-    Io_WriteBenchLutOne( pFile, pNtk );
+    Io_WriteBenchLutOne( p, pNtk );
     // write EXDC network if it exists
     pExdc = Abc_NtkExdc( pNtk );
     if ( pExdc )
         printf( "Io_WriteBench: EXDC is not written (warning).\n" );
     // finalize the file
+    RetValue = Io_BufStop( p );
+    if ( !RetValue )
+        fprintf( stdout, "Io_WriteBenchLut(): Writing into the output file \"%s\" has failed.\n", pFileName );
     fclose( pFile );
-    return 1;
+    return RetValue;
 }
 
 /**Function*************************************************************
@@ -211,7 +238,7 @@ int Io_WriteBenchLut( Abc_Ntk_t * pNtk, char * pFileName )
   SeeAlso     []
 
 ***********************************************************************/
-int Io_WriteBenchLutOne( FILE * pFile, Abc_Ntk_t * pNtk )
+int Io_WriteBenchLutOne( Io_Buf_t * p, Abc_Ntk_t * pNtk )
 {
     ProgressBar * pProgress;
     Abc_Obj_t * pNode;
@@ -220,12 +247,24 @@ int Io_WriteBenchLutOne( FILE * pFile, Abc_Ntk_t * pNtk )
 
     // write the PIs/POs/latches
     Abc_NtkForEachPi( pNtk, pNode, i )
-        fprintf( pFile, "INPUT(%s)\n", Abc_ObjName(Abc_ObjFanout0(pNode)) );
+    {
+        Io_BufStr( p, "INPUT(" );
+        Io_BufStr( p, Abc_ObjName(Abc_ObjFanout0(pNode)) );
+        Io_BufStr( p, ")\n" );
+    }
     Abc_NtkForEachPo( pNtk, pNode, i )
-        fprintf( pFile, "OUTPUT(%s)\n", Abc_ObjName(Abc_ObjFanin0(pNode)) );
+    {
+        Io_BufStr( p, "OUTPUT(" );
+        Io_BufStr( p, Abc_ObjName(Abc_ObjFanin0(pNode)) );
+        Io_BufStr( p, ")\n" );
+    }
     Abc_NtkForEachLatch( pNtk, pNode, i )
-        fprintf( pFile, "%-11s = DFFRSE( %s, gnd, gnd, gnd, gnd )\n", 
-            Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout0(pNode))), Abc_ObjName(Abc_ObjFanin0(Abc_ObjFanin0(pNode))) );
+    {
+        Io_WriteBenchNodeName( p, Abc_ObjFanout0(pNode) );
+        Io_BufStr( p, "DFFRSE( " );
+        Io_BufStr( p, Abc_ObjName(Abc_ObjFanin0(Abc_ObjFanin0(pNode))) );
+        Io_BufStr( p, ", gnd, gnd, gnd, gnd )\n" );
+    }
 //Abc_NtkLevel(pNtk);
     // write internal nodes
     vMemory = Vec_IntAlloc( 10000 );
@@ -233,7 +272,8 @@ int Io_WriteBenchLutOne( FILE * pFile, Abc_Ntk_t * pNtk )
     Abc_NtkForEachNode( pNtk, pNode, i )
     {
         Extra_ProgressBarUpdate( pProgress, i, NULL );
-        Io_WriteBenchLutOneNode( pFile, pNode, vMemory );
+        Io_WriteBenchLutOneNode( p, pNode, vMemory );
+        Io_BufFlushIfFull( p );
     }
     Extra_ProgressBarStop( pProgress );
     Vec_IntFree( vMemory );
@@ -252,11 +292,11 @@ int Io_WriteBenchLutOne( FILE * pFile, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-int Io_WriteBenchLutOneNode( FILE * pFile, Abc_Obj_t * pNode, Vec_Int_t * vTruth )
+int Io_WriteBenchLutOneNode( Io_Buf_t * p, Abc_Obj_t * pNode, Vec_Int_t * vTruth )
 {
     Abc_Obj_t * pFanin;
     unsigned * pTruth;
-    int i, nFanins;
+    int i, k, Digit, nFanins;
     assert( Abc_ObjIsNode(pNode) );
     nFanins = Abc_ObjFaninNum(pNode);
     assert( nFanins <= 15 );
@@ -264,46 +304,37 @@ int Io_WriteBenchLutOneNode( FILE * pFile, Abc_Obj_t * pNode, Vec_Int_t * vTruth
     pTruth = Hop_ManConvertAigToTruth( (Hop_Man_t *)pNode->pNtk->pManFunc, Hop_Regular((Hop_Obj_t *)pNode->pData), nFanins, vTruth, 0 );
     if ( Hop_IsComplement((Hop_Obj_t *)pNode->pData) )
         Extra_TruthNot( pTruth, pTruth, nFanins );
+    Io_WriteBenchNodeName( p, pNode );
     // consider simple cases
     if ( Extra_TruthIsConst0(pTruth, nFanins) )
     {
-        fprintf( pFile, "%-11s = gnd\n", Abc_ObjName(Abc_ObjFanout0(pNode)) );
+        Io_BufStr( p, "gnd\n" );
         return 1;
     }
     if ( Extra_TruthIsConst1(pTruth, nFanins) )
     {
-        fprintf( pFile, "%-11s = vdd\n", Abc_ObjName(Abc_ObjFanout0(pNode)) );
+        Io_BufStr( p, "vdd\n" );
         return 1;
     }
+    Io_BufStr( p, "LUT 0x" );
     if ( nFanins == 1 )
-    {
-        fprintf( pFile, "%-11s = LUT 0x%d ( %s )\n",  
-            Abc_ObjName(Abc_ObjFanout0(pNode)), 
-            Abc_NodeIsBuf(pNode)? 2 : 1,
-            Abc_ObjName(Abc_ObjFanin0(pNode)) );
-        return 1;
-    }
-    // write it in the hexadecimal form
-    fprintf( pFile, "%-11s = LUT 0x",  Abc_ObjName(Abc_ObjFanout0(pNode)) );
-    Extra_PrintHexadecimal( pFile, pTruth, nFanins );
-/*
-    {
-extern void Kit_DsdTest( unsigned * pTruth, int nVars );
-Abc_ObjForEachFanin( pNode, pFanin, i )
-printf( "%c%d ", 'a'+i, Abc_ObjFanin0(pFanin)->Level );
-printf( "\n" );
-Kit_DsdTest( pTruth, nFanins );
-    }
-    if ( pNode->Id % 1000 == 0 )
-    {
-        int x = 0;
-    }
-*/
+        Io_BufChar( p, (char)(Abc_NodeIsBuf(pNode)? '2' : '1') );
+    else // write it in the hexadecimal form (as Extra_PrintHexadecimal)
+        for ( k = (1 << nFanins) / 4 - 1; k >= 0; k-- )
+        {
+            Digit = ((pTruth[k/8] >> ((k%8) * 4)) & 15);
+            Io_BufChar( p, (char)(Digit < 10 ? '0' + Digit : 'a' + Digit - 10) );
+        }
     // write the fanins
-    fprintf( pFile, " (" );
+    Io_BufStr( p, " (" );
     Abc_ObjForEachFanin( pNode, pFanin, i )
-        fprintf( pFile, " %s%s", Abc_ObjName(pFanin), ((i==nFanins-1)? "" : ",") );
-    fprintf( pFile, " )\n" );
+    {
+        Io_BufChar( p, ' ' );
+        Io_BufStr( p, Abc_ObjName(pFanin) );
+        if ( i < nFanins - 1 )
+            Io_BufChar( p, ',' );
+    }
+    Io_BufStr( p, " )\n" );
     return 1;
 }
 
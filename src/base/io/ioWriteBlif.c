@@ -31,15 +31,15 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static void Io_NtkWrite( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches, int fBb2Wb, int fSeq );
-static void Io_NtkWriteOne( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches, int fBb2Wb, int fSeq );
-static void Io_NtkWritePis( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches );
-static void Io_NtkWritePos( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches );
-static void Io_NtkWriteSubckt( FILE * pFile, Abc_Obj_t * pNode );
+static void Io_NtkWrite( Io_Buf_t * p, Abc_Ntk_t * pNtk, int fWriteLatches, int fBb2Wb, int fSeq );
+static void Io_NtkWriteOne( Io_Buf_t * p, Abc_Ntk_t * pNtk, int fWriteLatches, int fBb2Wb, int fSeq );
+static void Io_NtkWritePis( Io_Buf_t * p, Abc_Ntk_t * pNtk, int fWriteLatches );
+static void Io_NtkWritePos( Io_Buf_t * p, Abc_Ntk_t * pNtk, int fWriteLatches );
+static void Io_NtkWriteSubckt( Io_Buf_t * p, Abc_Obj_t * pNode );
 static void Io_NtkWriteAsserts( FILE * pFile, Abc_Ntk_t * pNtk );
-static void Io_NtkWriteNodeFanins( FILE * pFile, Abc_Obj_t * pNode );
-static int  Io_NtkWriteNode( FILE * pFile, Abc_Obj_t * pNode, int Length );
-static void Io_NtkWriteLatch( FILE * pFile, Abc_Obj_t * pLatch );
+static void Io_NtkWriteNodeFanins( Io_Buf_t * p, Abc_Obj_t * pNode );
+static int  Io_NtkWriteNode( Io_Buf_t * p, Abc_Obj_t * pNode, int Length );
+static void Io_NtkWriteLatch( Io_Buf_t * p, Abc_Obj_t * pLatch );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -84,6 +84,7 @@ void Io_WriteBlifLogic( Abc_Ntk_t * pNtk, char * FileName, int fWriteLatches )
 void Io_WriteBlif( Abc_Ntk_t * pNtk, char * FileName, int fWriteLatches, int fBb2Wb, int fSeq )
 {
     FILE * pFile;
+    Io_Buf_t * p;
     Abc_Ntk_t * pNtkTemp;
     int i;
     assert( Abc_NtkIsNetlist(pNtk) );
@@ -94,9 +95,10 @@ void Io_WriteBlif( Abc_Ntk_t * pNtk, char * FileName, int fWriteLatches, int fBb
         fprintf( stdout, "Io_WriteBlif(): Cannot open the output file.\n" );
         return;
     }
-    fprintf( pFile, "# Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
+    p = Io_BufStart( pFile );
+    Io_BufPrintf( p, "# Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
     // write the master network
-    Io_NtkWrite( pFile, pNtk, fWriteLatches, fBb2Wb, fSeq );
+    Io_NtkWrite( p, pNtk, fWriteLatches, fBb2Wb, fSeq );
     // make sure there is no logic hierarchy
 //    assert( Abc_NtkWhiteboxNum(pNtk) == 0 );
     // write the hierarchy if present
@@ -106,10 +108,12 @@ void Io_WriteBlif( Abc_Ntk_t * pNtk, char * FileName, int fWriteLatches, int fBb
         {
             if ( pNtkTemp == pNtk )
                 continue;
-            fprintf( pFile, "\n\n" );
-            Io_NtkWrite( pFile, pNtkTemp, fWriteLatches, fBb2Wb, fSeq );
+            Io_BufStr( p, "\n\n" );
+            Io_NtkWrite( p, pNtkTemp, fWriteLatches, fBb2Wb, fSeq );
         }
     }
+    if ( !Io_BufStop( p ) )
+        fprintf( stdout, "Io_WriteBlif(): Writing into the output file \"%s\" has failed.\n", FileName );
     fclose( pFile );
 }
 
@@ -124,24 +128,26 @@ void Io_WriteBlif( Abc_Ntk_t * pNtk, char * FileName, int fWriteLatches, int fBb
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWrite( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches, int fBb2Wb, int fSeq )
+void Io_NtkWrite( Io_Buf_t * p, Abc_Ntk_t * pNtk, int fWriteLatches, int fBb2Wb, int fSeq )
 {
     Abc_Ntk_t * pExdc;
     assert( Abc_NtkIsNetlist(pNtk) );
     // write the model name
-    fprintf( pFile, ".model %s\n", Abc_NtkName(pNtk) );
+    Io_BufStr( p, ".model " );
+    Io_BufStr( p, Abc_NtkName(pNtk) );
+    Io_BufChar( p, '\n' );
     // write the network
-    Io_NtkWriteOne( pFile, pNtk, fWriteLatches, fBb2Wb, fSeq );
+    Io_NtkWriteOne( p, pNtk, fWriteLatches, fBb2Wb, fSeq );
     // write EXDC network if it exists
     pExdc = Abc_NtkExdc( pNtk );
     if ( pExdc )
     {
-        fprintf( pFile, "\n" );
-        fprintf( pFile, ".exdc\n" );
-        Io_NtkWriteOne( pFile, pExdc, fWriteLatches, fBb2Wb, fSeq );
+        Io_BufChar( p, '\n' );
+        Io_BufStr( p, ".exdc\n" );
+        Io_NtkWriteOne( p, pExdc, fWriteLatches, fBb2Wb, fSeq );
     }
     // finalize the file
-    fprintf( pFile, ".end\n" );
+    Io_BufStr( p, ".end\n" );
 }
 
 /**Function*************************************************************
@@ -155,33 +161,32 @@ void Io_NtkWrite( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches, int fBb2Wb,
   SeeAlso     [] 
 
 ***********************************************************************/
-void Io_NtkWriteConvertedBox( FILE * pFile, Abc_Ntk_t * pNtk, int fSeq )
+void Io_NtkWriteConvertedBox( Io_Buf_t * p, Abc_Ntk_t * pNtk, int fSeq )
 {
     Abc_Obj_t * pObj;
     int i, v;
     if ( fSeq )
     {
-        fprintf( pFile, ".attrib white box seq\n" );
+        Io_BufStr( p, ".attrib white box seq\n" );
     }
     else
     {
-        fprintf( pFile, ".attrib white box comb\n" );
-        fprintf( pFile, ".delay 1\n" );
+        Io_BufStr( p, ".attrib white box comb\n" );
+        Io_BufStr( p, ".delay 1\n" );
     }
     Abc_NtkForEachPo( pNtk, pObj, i )
     { 
         // write the .names line
-        fprintf( pFile, ".names" );
-        Io_NtkWritePis( pFile, pNtk, 1 );
-        if ( fSeq )
-            fprintf( pFile, " %s_in\n", Abc_ObjName(Abc_ObjFanin0(pObj)) );
-        else
-            fprintf( pFile, " %s\n", Abc_ObjName(Abc_ObjFanin0(pObj)) );
+        Io_BufStr( p, ".names" );
+        Io_NtkWritePis( p, pNtk, 1 );
+        Io_BufChar( p, ' ' );
+        Io_BufStr( p, Abc_ObjName(Abc_ObjFanin0(pObj)) );
+        Io_BufStr( p, fSeq ? "_in\n" : "\n" );
         for ( v = 0; v < Abc_NtkPiNum(pNtk); v++ )
-            fprintf( pFile, "1" );
-        fprintf( pFile, " 1\n" );
+            Io_BufChar( p, '1' );
+        Io_BufStr( p, " 1\n" );
         if ( fSeq )
-            fprintf( pFile, ".latch %s_in %s 1\n", Abc_ObjName(Abc_ObjFanin0(pObj)), Abc_ObjName(Abc_ObjFanin0(pObj)) );
+            Io_BufPrintf( p, ".latch %s_in %s 1\n", Abc_ObjName(Abc_ObjFanin0(pObj)), Abc_ObjName(Abc_ObjFanin0(pObj)) );
     }
 }
 
@@ -196,55 +201,59 @@ void Io_NtkWriteConvertedBox( FILE * pFile, Abc_Ntk_t * pNtk, int fSeq )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteOne( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches, int fBb2Wb, int fSeq )
+void Io_NtkWriteOne( Io_Buf_t * p, Abc_Ntk_t * pNtk, int fWriteLatches, int fBb2Wb, int fSeq )
 {
     ProgressBar * pProgress;
     Abc_Obj_t * pNode, * pLatch;
     int i, Length;
 
     // write the PIs
-    fprintf( pFile, ".inputs" );
-    Io_NtkWritePis( pFile, pNtk, fWriteLatches );
-    fprintf( pFile, "\n" );
+    Io_BufStr( p, ".inputs" );
+    Io_NtkWritePis( p, pNtk, fWriteLatches );
+    Io_BufChar( p, '\n' );
 
     // write the POs
-    fprintf( pFile, ".outputs" );
-    Io_NtkWritePos( pFile, pNtk, fWriteLatches );
-    fprintf( pFile, "\n" );
+    Io_BufStr( p, ".outputs" );
+    Io_NtkWritePos( p, pNtk, fWriteLatches );
+    Io_BufChar( p, '\n' );
 
     // write the blackbox
     if ( Abc_NtkHasBlackbox( pNtk ) )
     {
         if ( fBb2Wb )
-            Io_NtkWriteConvertedBox( pFile, pNtk, fSeq );
+            Io_NtkWriteConvertedBox( p, pNtk, fSeq );
         else
-            fprintf( pFile, ".blackbox\n" );
+            Io_BufStr( p, ".blackbox\n" );
         return;
     }
 
     // write the timing info
-    Io_WriteTimingInfo( pFile, pNtk );
+    Io_BufFlush( p );
+    Io_WriteTimingInfo( p->pFile, pNtk );
 
     // write the latches
     if ( fWriteLatches && !Abc_NtkIsComb(pNtk) )
     {
-        fprintf( pFile, "\n" );
+        Io_BufChar( p, '\n' );
         Abc_NtkForEachLatch( pNtk, pLatch, i )
-            Io_NtkWriteLatch( pFile, pLatch );
-        fprintf( pFile, "\n" );
+        {
+            Io_NtkWriteLatch( p, pLatch );
+            Io_BufFlushIfFull( p );
+        }
+        Io_BufChar( p, '\n' );
     }
 
     // write the subcircuits
 //    assert( Abc_NtkWhiteboxNum(pNtk) == 0 );
     if ( Abc_NtkBlackboxNum(pNtk) > 0 || Abc_NtkWhiteboxNum(pNtk) > 0 )
     {
-        fprintf( pFile, "\n" );
+        Io_BufChar( p, '\n' );
         Abc_NtkForEachBlackbox( pNtk, pNode, i )
-            Io_NtkWriteSubckt( pFile, pNode );
-        fprintf( pFile, "\n" );
+            Io_NtkWriteSubckt( p, pNode );
+        Io_BufChar( p, '\n' );
         Abc_NtkForEachWhitebox( pNtk, pNode, i )
-            Io_NtkWriteSubckt( pFile, pNode );
-        fprintf( pFile, "\n" );
+            Io_NtkWriteSubckt( p, pNode );
+        Io_BufChar( p, '\n' );
     }
 
     // write each internal node
@@ -253,8 +262,9 @@ void Io_NtkWriteOne( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches, int fBb2
     Abc_NtkForEachNode( pNtk, pNode, i )
     {
         Extra_ProgressBarUpdate( pProgress, i, NULL );
-        if ( Io_NtkWriteNode( pFile, pNode, Length ) ) // skip the next node
+        if ( Io_NtkWriteNode( p, pNode, Length ) ) // skip the next node
             i++;
+        Io_BufFlushIfFull( p );
     }
     Extra_ProgressBarStop( pProgress );
 }
@@ -271,7 +281,7 @@ void Io_NtkWriteOne( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches, int fBb2
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWritePis( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches )
+void Io_NtkWritePis( Io_Buf_t * p, Abc_Ntk_t * pNtk, int fWriteLatches )
 {
     Abc_Obj_t * pTerm, * pNet;
     int LineLength;
@@ -291,12 +301,13 @@ void Io_NtkWritePis( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches )
             AddedLength = strlen(Abc_ObjName(pNet)) + 1;
             if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
             { // write the line extender
-                fprintf( pFile, " \\\n" );
+                Io_BufStr( p, " \\\n" );
                 // reset the line length
                 LineLength  = 0;
                 NameCounter = 0;
             }
-            fprintf( pFile, " %s", Abc_ObjName(pNet) );
+            Io_BufChar( p, ' ' );
+            Io_BufStr( p, Abc_ObjName(pNet) );
             LineLength += AddedLength;
             NameCounter++;
         }
@@ -310,12 +321,13 @@ void Io_NtkWritePis( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches )
             AddedLength = strlen(Abc_ObjName(pNet)) + 1;
             if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
             { // write the line extender
-                fprintf( pFile, " \\\n" );
+                Io_BufStr( p, " \\\n" );
                 // reset the line length
                 LineLength  = 0;
                 NameCounter = 0;
             }
-            fprintf( pFile, " %s", Abc_ObjName(pNet) );
+            Io_BufChar( p, ' ' );
+            Io_BufStr( p, Abc_ObjName(pNet) );
             LineLength += AddedLength;
             NameCounter++;
         }
@@ -333,7 +345,7 @@ void Io_NtkWritePis( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWritePos( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches )
+void Io_NtkWritePos( Io_Buf_t * p, Abc_Ntk_t * pNtk, int fWriteLatches )
 {
     Abc_Obj_t * pTerm, * pNet;
     int LineLength;
@@ -353,12 +365,13 @@ void Io_NtkWritePos( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches )
             AddedLength = strlen(Abc_ObjName(pNet)) + 1;
             if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
             { // write the line extender
-                fprintf( pFile, " \\\n" );
+                Io_BufStr( p, " \\\n" );
                 // reset the line length
                 LineLength  = 0;
                 NameCounter = 0;
             }
-            fprintf( pFile, " %s", Abc_ObjName(pNet) );
+            Io_BufChar( p, ' ' );
+            Io_BufStr( p, Abc_ObjName(pNet) );
             LineLength += AddedLength;
             NameCounter++;
         }
@@ -372,12 +385,13 @@ void Io_NtkWritePos( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches )
             AddedLength = strlen(Abc_ObjName(pNet)) + 1;
             if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
             { // write the line extender
-                fprintf( pFile, " \\\n" );
+                Io_BufStr( p, " \\\n" );
                 // reset the line length
                 LineLength  = 0;
                 NameCounter = 0;
             }
-            fprintf( pFile, " %s", Abc_ObjName(pNet) );
+            Io_BufChar( p, ' ' );
+            Io_BufStr( p, Abc_ObjName(pNet) );
             LineLength += AddedLength;
             NameCounter++;
         }
@@ -395,28 +409,33 @@ void Io_NtkWritePos( FILE * pFile, Abc_Ntk_t * pNtk, int fWriteLatches )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteSubckt( FILE * pFile, Abc_Obj_t * pNode )
+void Io_NtkWriteSubckt( Io_Buf_t * p, Abc_Obj_t * pNode )
 {
     Abc_Ntk_t * pModel = (Abc_Ntk_t *)pNode->pData;
     Abc_Obj_t * pTerm;
     int i;
     // write the subcircuit
-//    fprintf( pFile, ".subckt %s %s", Abc_NtkName(pModel), Abc_ObjName(pNode) );
-    fprintf( pFile, ".subckt %s", Abc_NtkName(pModel) );
+//    fprintf( p, ".subckt %s %s", Abc_NtkName(pModel), Abc_ObjName(pNode) );
+    Io_BufStr( p, ".subckt " );
+    Io_BufStr( p, Abc_NtkName(pModel) );
     // write pairs of the formal=actual names
     Abc_NtkForEachPi( pModel, pTerm, i )
     {
-        fprintf( pFile, " %s", Abc_ObjName(Abc_ObjFanout0(pTerm)) );
+        Io_BufChar( p, ' ' );
+        Io_BufStr( p, Abc_ObjName(Abc_ObjFanout0(pTerm)) );
         pTerm = Abc_ObjFanin( pNode, i );
-        fprintf( pFile, "=%s", Abc_ObjName(Abc_ObjFanin0(pTerm)) );
+        Io_BufChar( p, '=' );
+        Io_BufStr( p, Abc_ObjName(Abc_ObjFanin0(pTerm)) );
     }
     Abc_NtkForEachPo( pModel, pTerm, i )
     {
-        fprintf( pFile, " %s", Abc_ObjName(Abc_ObjFanin0(pTerm)) );
+        Io_BufChar( p, ' ' );
+        Io_BufStr( p, Abc_ObjName(Abc_ObjFanin0(pTerm)) );
         pTerm = Abc_ObjFanout( pNode, i );
-        fprintf( pFile, "=%s", Abc_ObjName(Abc_ObjFanout0(pTerm)) );
+        Io_BufChar( p, '=' );
+        Io_BufStr( p, Abc_ObjName(Abc_ObjFanout0(pTerm)) );
     }
-    fprintf( pFile, "\n" );
+    Io_BufChar( p, '\n' );
 }
 
 /**Function*************************************************************
@@ -430,7 +449,7 @@ void Io_NtkWriteSubckt( FILE * pFile, Abc_Obj_t * pNode )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteLatch( FILE * pFile, Abc_Obj_t * pLatch )
+void Io_NtkWriteLatch( Io_Buf_t * p, Abc_Obj_t * pLatch )
 {
     Abc_Obj_t * pNetLi, * pNetLo;
     int Reset;
@@ -438,10 +457,14 @@ void Io_NtkWriteLatch( FILE * pFile, Abc_Obj_t * pLatch )
     pNetLo = Abc_ObjFanout0( Abc_ObjFanout0(pLatch) );
     Reset  = (int)(ABC_PTRUINT_T)Abc_ObjData( pLatch );
     // write the latch line
-    fprintf( pFile, ".latch" );
-    fprintf( pFile, " %10s",    Abc_ObjName(pNetLi) );
-    fprintf( pFile, " %10s",    Abc_ObjName(pNetLo) );
-    fprintf( pFile, "  %d\n",   Reset-1 );
+    Io_BufStr( p, ".latch" );
+    Io_BufChar( p, ' ' );
+    Io_BufStrPadLeft( p, Abc_ObjName(pNetLi), 10 );
+    Io_BufChar( p, ' ' );
+    Io_BufStrPadLeft( p, Abc_ObjName(pNetLo), 10 );
+    Io_BufStr( p, "  " );
+    Io_BufNum( p, Reset-1 );
+    Io_BufChar( p, '\n' );
 }
 
 
@@ -456,7 +479,7 @@ void Io_NtkWriteLatch( FILE * pFile, Abc_Obj_t * pLatch )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteNodeFanins( FILE * pFile, Abc_Obj_t * pNode )
+void Io_NtkWriteNodeFanins( Io_Buf_t * p, Abc_Obj_t * pNode )
 {
     Abc_Obj_t * pNet;
     int LineLength;
@@ -475,12 +498,13 @@ void Io_NtkWriteNodeFanins( FILE * pFile, Abc_Obj_t * pNode )
         AddedLength = strlen(pName) + 1;
         if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
         { // write the line extender
-            fprintf( pFile, " \\\n" );
+            Io_BufStr( p, " \\\n" );
             // reset the line length
             LineLength  = 0;
             NameCounter = 0;
         }
-        fprintf( pFile, " %s", pName );
+        Io_BufChar( p, ' ' );
+        Io_BufStr( p, pName );
         LineLength += AddedLength;
         NameCounter++;
     }
@@ -491,12 +515,13 @@ void Io_NtkWriteNodeFanins( FILE * pFile, Abc_Obj_t * pNode )
     AddedLength = strlen(pName) + 1;
     if ( NameCounter && LineLength + AddedLength > 75 )
     { // write the line extender
-        fprintf( pFile, " \\\n" );
+        Io_BufStr( p, " \\\n" );
         // reset the line length
         LineLength  = 0;
         NameCounter = 0;
     }
-    fprintf( pFile, " %s", pName );
+    Io_BufChar( p, ' ' );
+    Io_BufStr( p, pName );
 }
 
 /**Function*************************************************************
@@ -510,7 +535,7 @@ void Io_NtkWriteNodeFanins( FILE * pFile, Abc_Obj_t * pNode )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteSubcktFanins( FILE * pFile, Abc_Obj_t * pNode )
+void Io_NtkWriteSubcktFanins( Io_Buf_t * p, Abc_Obj_t * pNode )
 {
     Abc_Obj_t * pNet;
     int LineLength;
@@ -526,7 +551,8 @@ void Io_NtkWriteSubcktFanins( FILE * pFile, Abc_Obj_t * pNode )
     pName = Abc_ObjName(Abc_ObjFanout0(pNode));
     // get the line length after the output name is written
     AddedLength = strlen(pName) + 1;
-    fprintf( pFile, " m%d", Abc_ObjId(pNode) );
+    Io_BufStr( p, " m" );
+    Io_BufNum( p, Abc_ObjId(pNode) );
 
     // get the input names
     Abc_ObjForEachFanin( pNode, pNet, i )
@@ -537,12 +563,15 @@ void Io_NtkWriteSubcktFanins( FILE * pFile, Abc_Obj_t * pNode )
         AddedLength = strlen(pName) + 3;
         if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
         { // write the line extender
-            fprintf( pFile, " \\\n" );
+            Io_BufStr( p, " \\\n" );
             // reset the line length
             LineLength  = 0;
             NameCounter = 0;
         }
-        fprintf( pFile, " %c=%s", 'a'+i, pName );
+        Io_BufChar( p, ' ' );
+        Io_BufChar( p, (char)('a'+i) );
+        Io_BufChar( p, '=' );
+        Io_BufStr( p, pName );
         LineLength += AddedLength;
         NameCounter++;
     }
@@ -553,12 +582,13 @@ void Io_NtkWriteSubcktFanins( FILE * pFile, Abc_Obj_t * pNode )
     AddedLength = strlen(pName) + 3;
     if ( NameCounter && LineLength + AddedLength > 75 )
     { // write the line extender
-        fprintf( pFile, " \\\n" );
+        Io_BufStr( p, " \\\n" );
         // reset the line length
         LineLength  = 0;
         NameCounter = 0;
     }
-    fprintf( pFile, " %c=%s", 'o', pName );
+    Io_BufStr( p, " o=" );
+    Io_BufStr( p, pName );
 }
 
 
@@ -573,18 +603,27 @@ void Io_NtkWriteSubcktFanins( FILE * pFile, Abc_Obj_t * pNode )
   SeeAlso     []
 
 ***********************************************************************/
-int Io_NtkWriteNodeGate( FILE * pFile, Abc_Obj_t * pNode, int Length )
+int Io_NtkWriteNodeGate( Io_Buf_t * p, Abc_Obj_t * pNode, int Length )
 {
     static int fReport = 0;
     Mio_Gate_t * pGate = (Mio_Gate_t *)pNode->pData;
     Mio_Pin_t * pGatePin;
     Abc_Obj_t * pNode2;
     int i;
-    fprintf( pFile, " %-*s ", Length, Mio_GateReadName(pGate) );
+    Io_BufChar( p, ' ' );
+    Io_BufStrPad( p, Mio_GateReadName(pGate), Length );
+    Io_BufChar( p, ' ' );
     for ( pGatePin = Mio_GateReadPins(pGate), i = 0; pGatePin; pGatePin = Mio_PinReadNext(pGatePin), i++ )
-        fprintf( pFile, "%s=%s ", Mio_PinReadName(pGatePin), Abc_ObjName( Abc_ObjFanin(pNode,i) ) );
+    {
+        Io_BufStr( p, Mio_PinReadName(pGatePin) );
+        Io_BufChar( p, '=' );
+        Io_BufStr( p, Abc_ObjName( Abc_ObjFanin(pNode,i) ) );
+        Io_BufChar( p, ' ' );
+    }
     assert ( i == Abc_ObjFaninNum(pNode) );
-    fprintf( pFile, "%s=%s", Mio_GateReadOutName(pGate), Abc_ObjName( Abc_ObjFanout0(pNode) ) );
+    Io_BufStr( p, Mio_GateReadOutName(pGate) );
+    Io_BufChar( p, '=' );
+    Io_BufStr( p, Abc_ObjName( Abc_ObjFanout0(pNode) ) );
     if ( Mio_GateReadTwin(pGate) == NULL )
         return 0;
     pNode2 = Abc_NtkFetchTwinNode( pNode );
@@ -594,7 +633,10 @@ int Io_NtkWriteNodeGate( FILE * pFile, Abc_Obj_t * pNode, int Length )
             fReport = 1, printf( "Warning: Missing second output of gate(s) \"%s\".\n", Mio_GateReadName(pGate) );
         return 0;
     }
-    fprintf( pFile, " %s=%s", Mio_GateReadOutName((Mio_Gate_t *)pNode2->pData), Abc_ObjName( Abc_ObjFanout0(pNode2) ) );
+    Io_BufChar( p, ' ' );
+    Io_BufStr( p, Mio_GateReadOutName((Mio_Gate_t *)pNode2->pData) );
+    Io_BufChar( p, '=' );
+    Io_BufStr( p, Abc_ObjName( Abc_ObjFanout0(pNode2) ) );
     return 1;
 }
 
@@ -609,7 +651,7 @@ int Io_NtkWriteNodeGate( FILE * pFile, Abc_Obj_t * pNode, int Length )
   SeeAlso     []
 
 ***********************************************************************/
-int Io_NtkWriteNode( FILE * pFile, Abc_Obj_t * pNode, int Length )
+int Io_NtkWriteNode( Io_Buf_t * p, Abc_Obj_t * pNode, int Length )
 {
     int RetValue = 0;
     if ( Abc_NtkHasMapping(pNode->pNtk) )
@@ -617,25 +659,27 @@ int Io_NtkWriteNode( FILE * pFile, Abc_Obj_t * pNode, int Length )
         // write the .gate line
         if ( Abc_ObjIsBarBuf(pNode) )
         {
-            fprintf( pFile, ".barbuf " );
-            fprintf( pFile, "%s %s", Abc_ObjName(Abc_ObjFanin0(pNode)), Abc_ObjName(Abc_ObjFanout0(pNode)) );
-            fprintf( pFile, "\n" );
+            Io_BufStr( p, ".barbuf " );
+            Io_BufStr( p, Abc_ObjName(Abc_ObjFanin0(pNode)) );
+            Io_BufChar( p, ' ' );
+            Io_BufStr( p, Abc_ObjName(Abc_ObjFanout0(pNode)) );
+            Io_BufChar( p, '\n' );
         }
         else
         {
-            fprintf( pFile, ".gate" );
-            RetValue = Io_NtkWriteNodeGate( pFile, pNode, Length );
-            fprintf( pFile, "\n" );
+            Io_BufStr( p, ".gate" );
+            RetValue = Io_NtkWriteNodeGate( p, pNode, Length );
+            Io_BufChar( p, '\n' );
         }
     }
     else
     {
         // write the .names line
-        fprintf( pFile, ".names" );
-        Io_NtkWriteNodeFanins( pFile, pNode );
-        fprintf( pFile, "\n" );
+        Io_BufStr( p, ".names" );
+        Io_NtkWriteNodeFanins( p, pNode );
+        Io_BufChar( p, '\n' );
         // write the cubes
-        fprintf( pFile, "%s", (char*)Abc_ObjData(pNode) );
+        Io_BufStr( p, (char*)Abc_ObjData(pNode) );
     }
     return RetValue;
 }
@@ -651,12 +695,12 @@ int Io_NtkWriteNode( FILE * pFile, Abc_Obj_t * pNode, int Length )
   SeeAlso     []
 
 ***********************************************************************/
-int Io_NtkWriteNodeSubckt( FILE * pFile, Abc_Obj_t * pNode, int Length )
+int Io_NtkWriteNodeSubckt( Io_Buf_t * p, Abc_Obj_t * pNode, int Length )
 {
     int RetValue = 0;
-    fprintf( pFile, ".subckt" );
-    Io_NtkWriteSubcktFanins( pFile, pNode );
-    fprintf( pFile, "\n" );
+    Io_BufStr( p, ".subckt" );
+    Io_NtkWriteSubcktFanins( p, pNode );
+    Io_BufChar( p, '\n' );
     return RetValue;
 }
 
@@ -1312,6 +1356,7 @@ void Io_NtkWriteModelIntStruct( FILE * pFile, Abc_Obj_t * pNode, Vec_Int_t * vCo
 void Io_WriteBlifInt( Abc_Ntk_t * pNtk, char * FileName, char * pLutStruct, int fUseHie )
 {
     FILE * pFile;
+    Io_Buf_t * p;
     Vec_Int_t * vCover;
     Abc_Obj_t * pNode, * pLatch;
     int i;
@@ -1323,33 +1368,40 @@ void Io_WriteBlifInt( Abc_Ntk_t * pNtk, char * FileName, char * pLutStruct, int
         fprintf( stdout, "Io_WriteBlifInt(): Cannot open the output file.\n" );
         return;
     }
-    fprintf( pFile, "# Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
+    p = Io_BufStart( pFile );
+    Io_BufPrintf( p, "# Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
     // write the model name
-    fprintf( pFile, ".model %s\n", Abc_NtkName(pNtk) );
+    Io_BufStr( p, ".model " );
+    Io_BufStr( p, Abc_NtkName(pNtk) );
+    Io_BufChar( p, '\n' );
     // write the PIs
-    fprintf( pFile, ".inputs" );
-    Io_NtkWritePis( pFile, pNtk, 1 );
-    fprintf( pFile, "\n" );
+    Io_BufStr( p, ".inputs" );
+    Io_NtkWritePis( p, pNtk, 1 );
+    Io_BufChar( p, '\n' );
     // write the POs
-    fprintf( pFile, ".outputs" );
-    Io_NtkWritePos( pFile, pNtk, 1 );
-    fprintf( pFile, "\n" );
+    Io_BufStr( p, ".outputs" );
+    Io_NtkWritePos( p, pNtk, 1 );
+    Io_BufChar( p, '\n' );
     // write the latches
     if ( Abc_NtkLatchNum(pNtk) )
-        fprintf( pFile, "\n" );
+        Io_BufChar( p, '\n' );
     Abc_NtkForEachLatch( pNtk, pLatch, i )
-        Io_NtkWriteLatch( pFile, pLatch );
+        Io_NtkWriteLatch( p, pLatch );
     if ( Abc_NtkLatchNum(pNtk) )
-        fprintf( pFile, "\n" );
+        Io_BufChar( p, '\n' );
     // write the hierarchy
     vCover = Vec_IntAlloc( (1<<16) );
     if ( fUseHie )
     {
         // write each internal node
-        fprintf( pFile, "\n" );
+        Io_BufChar( p, '\n' );
         Abc_NtkForEachNode( pNtk, pNode, i )
-            Io_NtkWriteNodeSubckt( pFile, pNode, 0 );
-        fprintf( pFile, ".end\n\n" );
+        {
+            Io_NtkWriteNodeSubckt( p, pNode, 0 );
+            Io_BufFlushIfFull( p );
+        }
+        Io_BufStr( p, ".end\n\n" );
+        Io_BufFlush( p );
         // write models
         Abc_NtkForEachNode( pNtk, pNode, i )
             Io_NtkWriteModelIntStruct( pFile, pNode, vCover, pLutStruct );
@@ -1357,6 +1409,7 @@ void Io_WriteBlifInt( Abc_Ntk_t * pNtk, char * FileName, char * pLutStruct, int
     }
     else
     {
+        Io_BufFlush( p );
         // write each internal node
         Abc_NtkForEachNode( pNtk, pNode, i )
         {
@@ -1368,6 +1421,8 @@ void Io_WriteBlifInt( Abc_Ntk_t * pNtk, char * FileName, char * pLutStruct, int
         fprintf( pFile, ".end\n\n" );
     }
     Vec_IntFree( vCover );
+    if ( !Io_BufStop( p ) )
+        fprintf( stdout, "Io_WriteBlifInt(): Writing into the output file \"%s\" has failed.\n", FileName );
     fclose( pFile );
 }
 
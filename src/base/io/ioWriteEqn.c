@@ -27,9 +27,9 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static void Io_NtkWriteEqnOne( FILE * pFile, Abc_Ntk_t * pNtk );
-static void Io_NtkWriteEqnCis( FILE * pFile, Abc_Ntk_t * pNtk );
-static void Io_NtkWriteEqnCos( FILE * pFile, Abc_Ntk_t * pNtk );
+static void Io_NtkWriteEqnOne( Io_Buf_t * p, Abc_Ntk_t * pNtk );
+static void Io_NtkWriteEqnCis( Io_Buf_t * p, Abc_Ntk_t * pNtk );
+static void Io_NtkWriteEqnCos( Io_Buf_t * p, Abc_Ntk_t * pNtk );
 static int Io_NtkWriteEqnCheck( Abc_Ntk_t * pNtk );
 
 ////////////////////////////////////////////////////////////////////////
@@ -50,6 +50,7 @@ static int Io_NtkWriteEqnCheck( Abc_Ntk_t * pNtk );
 void Io_WriteEqn( Abc_Ntk_t * pNtk, char * pFileName )
 {
     FILE * pFile;
+    Io_Buf_t * p;
 
     assert( Abc_NtkIsAigNetlist(pNtk) );
     if ( Abc_NtkLatchNum(pNtk) > 0 )
@@ -66,11 +67,14 @@ void Io_WriteEqn( Abc_Ntk_t * pNtk, char * pFileName )
         fprintf( stdout, "Io_WriteEqn(): Cannot open the output file \"%s\".\n", pFileName );
         return;
     }
-    fprintf( pFile, "# Equations for \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
+    p = Io_BufStart( pFile );
+    Io_BufPrintf( p, "# Equations for \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
 
     // write the equations for the network
-    Io_NtkWriteEqnOne( pFile, pNtk );
-    fprintf( pFile, "\n" );
+    Io_NtkWriteEqnOne( p, pNtk );
+    Io_BufChar( p, '\n' );
+    if ( !Io_BufStop( p ) )
+        fprintf( stdout, "Io_WriteEqn(): Writing into the output file \"%s\" has failed.\n", pFileName );
     fclose( pFile );
 }
 
@@ -89,7 +93,7 @@ char * Io_NamePrepro( char * pName )
 {
     return strncmp(pName, "new_", 4) ? pName : pName + 4;    
 }
-void Io_NtkWriteEqnOne( FILE * pFile, Abc_Ntk_t * pNtk )
+void Io_NtkWriteEqnOne( Io_Buf_t * p, Abc_Ntk_t * pNtk )
 {
     Vec_Vec_t * vLevels;
     ProgressBar * pProgress;
@@ -97,14 +101,14 @@ void Io_NtkWriteEqnOne( FILE * pFile, Abc_Ntk_t * pNtk )
     int i, k;
 
     // write the PIs
-    fprintf( pFile, "INORDER =" );
-    Io_NtkWriteEqnCis( pFile, pNtk );
-    fprintf( pFile, ";\n" );
+    Io_BufStr( p, "INORDER =" );
+    Io_NtkWriteEqnCis( p, pNtk );
+    Io_BufStr( p, ";\n" );
 
     // write the POs
-    fprintf( pFile, "OUTORDER =" );
-    Io_NtkWriteEqnCos( pFile, pNtk );
-    fprintf( pFile, ";\n" );
+    Io_BufStr( p, "OUTORDER =" );
+    Io_NtkWriteEqnCos( p, pNtk );
+    Io_BufStr( p, ";\n" );
 
     // write each internal node
     vLevels = Vec_VecAlloc( 10 );
@@ -112,13 +116,15 @@ void Io_NtkWriteEqnOne( FILE * pFile, Abc_Ntk_t * pNtk )
     Abc_NtkForEachNode( pNtk, pNode, i )
     {
         Extra_ProgressBarUpdate( pProgress, i, NULL );
-        fprintf( pFile, "%s = ", Io_NamePrepro( Abc_ObjName(Abc_ObjFanout0(pNode)) ) );
+        Io_BufStr( p, Io_NamePrepro( Abc_ObjName(Abc_ObjFanout0(pNode)) ) );
+        Io_BufStr( p, " = " );
         // set the input names
         Abc_ObjForEachFanin( pNode, pFanin, k )
             Hop_IthVar((Hop_Man_t *)pNtk->pManFunc, k)->pData = Io_NamePrepro( Abc_ObjName(pFanin) );
         // write the formula
-        Hop_ObjPrintEqn( pFile, (Hop_Obj_t *)pNode->pData, vLevels, 0 );
-        fprintf( pFile, ";\n" );
+        Hop_ObjPrintEqnStr( p->vText, (Hop_Obj_t *)pNode->pData, vLevels, 0 );
+        Io_BufStr( p, ";\n" );
+        Io_BufFlushIfFull( p );
     }
     Extra_ProgressBarStop( pProgress );
     Vec_VecFree( vLevels );
@@ -136,7 +142,7 @@ void Io_NtkWriteEqnOne( FILE * pFile, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteEqnCis( FILE * pFile, Abc_Ntk_t * pNtk )
+void Io_NtkWriteEqnCis( Io_Buf_t * p, Abc_Ntk_t * pNtk )
 {
     Abc_Obj_t * pTerm, * pNet;
     int LineLength;
@@ -154,12 +160,13 @@ void Io_NtkWriteEqnCis( FILE * pFile, Abc_Ntk_t * pNtk )
         AddedLength = strlen(Abc_ObjName(pNet)) + 1;
         if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
         { // write the line extender
-            fprintf( pFile, " \n" );
+            Io_BufStr( p, " \n" );
             // reset the line length
             LineLength  = 0;
             NameCounter = 0;
         }
-        fprintf( pFile, " %s", Abc_ObjName(pNet) );
+        Io_BufChar( p, ' ' );
+        Io_BufStr( p, Abc_ObjName(pNet) );
         LineLength += AddedLength;
         NameCounter++;
     }
@@ -176,7 +183,7 @@ void Io_NtkWriteEqnCis( FILE * pFile, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_NtkWriteEqnCos( FILE * pFile, Abc_Ntk_t * pNtk )
+void Io_NtkWriteEqnCos( Io_Buf_t * p, Abc_Ntk_t * pNtk )
 {
     Abc_Obj_t * pTerm, * pNet;
     int LineLength;
@@ -194,12 +201,13 @@ void Io_NtkWriteEqnCos( FILE * pFile, Abc_Ntk_t * pNtk )
         AddedLength = strlen(Abc_ObjName(pNet)) + 1;
         if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
         { // write the line extender
-            fprintf( pFile, " \n" );
+            Io_BufStr( p, " \n" );
             // reset the line length
             LineLength  = 0;
             NameCounter = 0;
         }
-        fprintf( pFile, " %s", Abc_ObjName(pNet) );
+        Io_BufChar( p, ' ' );
+        Io_BufStr( p, Abc_ObjName(pNet) );
         LineLength += AddedLength;
         NameCounter++;
     }
@@ -29,15 +29,18 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-static void Io_WriteVerilogInt( FILE * pFile, Abc_Ntk_t * pNtk, int fOnlyAnds );
-static void Io_WriteVerilogPis( FILE * pFile, Abc_Ntk_t * pNtk, int Start );
-static void Io_WriteVerilogPos( FILE * pFile, Abc_Ntk_t * pNtk, int Start );
-static void Io_WriteVerilogWires( FILE * pFile, Abc_Ntk_t * pNtk, int Start );
-static void Io_WriteVerilogRegs( FILE * pFile, Abc_Ntk_t * pNtk, int Start );
-static void Io_WriteVerilogLatches( FILE * pFile, Abc_Ntk_t * pNtk );
-static void Io_WriteVerilogObjects( FILE * pFile, Abc_Ntk_t * pNtk, int fOnlyAnds );
+static void Io_WriteVerilogInt( Io_Buf_t * p, Abc_Ntk_t * pNtk, int fOnlyAnds );
+static void Io_WriteVerilogPis( Io_Buf_t * p, Abc_Ntk_t * pNtk, int Start );
+static void Io_WriteVerilogPos( Io_Buf_t * p, Abc_Ntk_t * pNtk, int Start );
+static void Io_WriteVerilogWires( Io_Buf_t * p, Abc_Ntk_t * pNtk, int Start );
+static void Io_WriteVerilogRegs( Io_Buf_t * p, Abc_Ntk_t * pNtk, int Start );
+static void Io_WriteVerilogLatches( Io_Buf_t * p, Abc_Ntk_t * pNtk );
+static void Io_WriteVerilogObjects( Io_Buf_t * p, Abc_Ntk_t * pNtk, int fOnlyAnds );
 static int  Io_WriteVerilogWiresCount( Abc_Ntk_t * pNtk );
-static char * Io_WriteVerilogGetName( char * pName );
+static int  Io_WriteVerilogNameLength( char * pName );
+static void Io_WriteVerilogName( Io_Buf_t * p, char * pName );
+static void Io_WriteVerilogNamePad( Io_Buf_t * p, char * pName, int Width );
+static char * Io_WriteVerilogNameDup( char * pName );
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
@@ -58,6 +61,7 @@ void Io_WriteVerilog( Abc_Ntk_t * pNtk, char * pFileName, int fOnlyAnds )
 {
     Abc_Ntk_t * pNetlist;
     FILE * pFile;
+    Io_Buf_t * p;
     int i;
     // can only write nodes represented using local AIGs
     if ( !Abc_NtkIsAigNetlist(pNtk) && !Abc_NtkIsMappedNetlist(pNtk) )
@@ -72,32 +76,35 @@ void Io_WriteVerilog( Abc_Ntk_t * pNtk, char * pFileName, int fOnlyAnds )
         fprintf( stdout, "Io_WriteVerilog(): Cannot open the output file \"%s\".\n", pFileName );
         return;
     }
+    p = Io_BufStart( pFile );
 
     // write the equations for the network
-    fprintf( pFile, "// Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
-    fprintf( pFile, "\n" );
+    Io_BufPrintf( p, "// Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
+    Io_BufChar( p, '\n' );
 
     // write modules
     if ( pNtk->pDesign )
     {
         // write the network first
-        Io_WriteVerilogInt( pFile, pNtk, fOnlyAnds );
+        Io_WriteVerilogInt( p, pNtk, fOnlyAnds );
         // write other things
         Vec_PtrForEachEntry( Abc_Ntk_t *, pNtk->pDesign->vModules, pNetlist, i )
         {
             assert( Abc_NtkIsNetlist(pNetlist) );
             if ( pNetlist == pNtk )
                 continue;
-            fprintf( pFile, "\n" );
-            Io_WriteVerilogInt( pFile, pNetlist, fOnlyAnds );
+            Io_BufChar( p, '\n' );
+            Io_WriteVerilogInt( p, pNetlist, fOnlyAnds );
         }
     }
     else
     {
-        Io_WriteVerilogInt( pFile, pNtk, fOnlyAnds );
+        Io_WriteVerilogInt( p, pNtk, fOnlyAnds );
     }
 
-    fprintf( pFile, "\n" );
+    Io_BufChar( p, '\n' );
+    if ( !Io_BufStop( p ) )
+        fprintf( stdout, "Io_WriteVerilog(): Writing into the output file \"%s\" has failed.\n", pFileName );
     fclose( pFile );
 }
 
@@ -112,64 +119,66 @@ void Io_WriteVerilog( Abc_Ntk_t * pNtk, char * pFileName, int fOnlyAnds )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_WriteVerilogInt( FILE * pFile, Abc_Ntk_t * pNtk, int fOnlyAnds )
+void Io_WriteVerilogInt( Io_Buf_t * p, Abc_Ntk_t * pNtk, int fOnlyAnds )
 {
     // write inputs and outputs
 //    fprintf( pFile, "module %s ( gclk,\n   ", Abc_NtkName(pNtk) );
-    fprintf( pFile, "module %s ( ", Io_WriteVerilogGetName(Abc_NtkName(pNtk)) );
+    Io_BufStr( p, "module " );
+    Io_WriteVerilogName( p, Abc_NtkName(pNtk) );
+    Io_BufStr( p, " ( " );
     // add the clock signal if it does not exist
     if ( Abc_NtkLatchNum(pNtk) > 0 && Nm_ManFindIdByName(pNtk->pManName, "clock", ABC_OBJ_PI) == -1 )
-        fprintf( pFile, "clock, " );
+        Io_BufStr( p, "clock, " );
     // write other primary inputs
-    fprintf( pFile, "\n   " );
+    Io_BufStr( p, "\n   " );
     if ( Abc_NtkPiNum(pNtk) > 0  )
     {
-        Io_WriteVerilogPis( pFile, pNtk, 3 );
-        fprintf( pFile, ",\n   " );
+        Io_WriteVerilogPis( p, pNtk, 3 );
+        Io_BufStr( p, ",\n   " );
     }
     if ( Abc_NtkPoNum(pNtk) > 0  )
-        Io_WriteVerilogPos( pFile, pNtk, 3 );
-    fprintf( pFile, "  );\n" );
+        Io_WriteVerilogPos( p, pNtk, 3 );
+    Io_BufStr( p, "  );\n" );
     // add the clock signal if it does not exist
     if ( Abc_NtkLatchNum(pNtk) > 0 && Nm_ManFindIdByName(pNtk->pManName, "clock", ABC_OBJ_PI) == -1 )
-        fprintf( pFile, "  input  clock;\n" );
+        Io_BufStr( p, "  input  clock;\n" );
     // write inputs, outputs, registers, and wires
     if ( Abc_NtkPiNum(pNtk) > 0  )
     {
 //        fprintf( pFile, "  input gclk," );
-        fprintf( pFile, "  input " );
-        Io_WriteVerilogPis( pFile, pNtk, 10 );
-        fprintf( pFile, ";\n" );
+        Io_BufStr( p, "  input " );
+        Io_WriteVerilogPis( p, pNtk, 10 );
+        Io_BufStr( p, ";\n" );
     }
     if ( Abc_NtkPoNum(pNtk) > 0  )
     {
-        fprintf( pFile, "  output" );
-        Io_WriteVerilogPos( pFile, pNtk, 5 );
-        fprintf( pFile, ";\n" );
+        Io_BufStr( p, "  output" );
+        Io_WriteVerilogPos( p, pNtk, 5 );
+        Io_BufStr( p, ";\n" );
     }
     // if this is not a blackbox, write internal signals
     if ( !Abc_NtkHasBlackbox(pNtk) )
     {
         if ( Abc_NtkLatchNum(pNtk) > 0 )
         {
-            fprintf( pFile, "  reg" );
-            Io_WriteVerilogRegs( pFile, pNtk, 4 );
-            fprintf( pFile, ";\n" );
+            Io_BufStr( p, "  reg" );
+            Io_WriteVerilogRegs( p, pNtk, 4 );
+            Io_BufStr( p, ";\n" );
         }
         if ( Io_WriteVerilogWiresCount(pNtk) > 0 )
         {
-            fprintf( pFile, "  wire" );
-            Io_WriteVerilogWires( pFile, pNtk, 4 );
-            fprintf( pFile, ";\n" );
+            Io_BufStr( p, "  wire" );
+            Io_WriteVerilogWires( p, pNtk, 4 );
+            Io_BufStr( p, ";\n" );
         }
         // write nodes
-        Io_WriteVerilogObjects( pFile, pNtk, fOnlyAnds );        
+        Io_WriteVerilogObjects( p, pNtk, fOnlyAnds );        
         // write registers
         if ( Abc_NtkLatchNum(pNtk) > 0 )
-            Io_WriteVerilogLatches( pFile, pNtk );
+            Io_WriteVerilogLatches( p, pNtk );
     }
     // finalize the file
-    fprintf( pFile, "endmodule\n\n" );
+    Io_BufStr( p, "endmodule\n\n" );
 } 
 
 /**Function*************************************************************
@@ -183,7 +192,7 @@ void Io_WriteVerilogInt( FILE * pFile, Abc_Ntk_t * pNtk, int fOnlyAnds )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_WriteVerilogPis( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
+void Io_WriteVerilogPis( Io_Buf_t * p, Abc_Ntk_t * pNtk, int Start )
 {
     Abc_Obj_t * pTerm, * pNet;
     int LineLength;
@@ -197,15 +206,17 @@ void Io_WriteVerilogPis( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
     {
         pNet = Abc_ObjFanout0(pTerm);
         // get the line length after this name is written
-        AddedLength = strlen(Io_WriteVerilogGetName(Abc_ObjName(pNet))) + 2;
+        AddedLength = Io_WriteVerilogNameLength(Abc_ObjName(pNet)) + 2;
         if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
         { // write the line extender
-            fprintf( pFile, "\n   " );
+            Io_BufStr( p, "\n   " );
             // reset the line length
             LineLength  = 3;
             NameCounter = 0;
         }
-        fprintf( pFile, " %s%s", Io_WriteVerilogGetName(Abc_ObjName(pNet)), (i==Abc_NtkPiNum(pNtk)-1)? "" : "," );
+        Io_BufChar( p, ' ' );
+        Io_WriteVerilogName( p, Abc_ObjName(pNet) );
+        Io_BufStr( p, (i==Abc_NtkPiNum(pNtk)-1)? "" : "," );
         LineLength += AddedLength;
         NameCounter++;
     }
@@ -222,7 +233,7 @@ void Io_WriteVerilogPis( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_WriteVerilogPos( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
+void Io_WriteVerilogPos( Io_Buf_t * p, Abc_Ntk_t * pNtk, int Start )
 {
     Abc_Obj_t * pTerm, * pNet, * pSkip;
     int LineLength;
@@ -252,15 +263,17 @@ void Io_WriteVerilogPos( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
         }
         
         // get the line length after this name is written
-        AddedLength = strlen(Io_WriteVerilogGetName(Abc_ObjName(pNet))) + 2;
+        AddedLength = Io_WriteVerilogNameLength(Abc_ObjName(pNet)) + 2;
         if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
         { // write the line extender
-            fprintf( pFile, "\n   " );
+            Io_BufStr( p, "\n   " );
             // reset the line length
             LineLength  = 3;
             NameCounter = 0;
         }
-        fprintf( pFile, " %s%s", Io_WriteVerilogGetName(Abc_ObjName(pNet)), (i==Abc_NtkPoNum(pNtk)-1)? "" : "," );
+        Io_BufChar( p, ' ' );
+        Io_WriteVerilogName( p, Abc_ObjName(pNet) );
+        Io_BufStr( p, (i==Abc_NtkPoNum(pNtk)-1)? "" : "," );
         LineLength += AddedLength;
         NameCounter++;
     }
@@ -285,7 +298,7 @@ void Io_WriteVerilogPos( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_WriteVerilogWires( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
+void Io_WriteVerilogWires( Io_Buf_t * p, Abc_Ntk_t * pNtk, int Start )
 {
     Abc_Obj_t * pObj, * pNet, * pBox, * pTerm;
     int LineLength;
@@ -302,6 +315,7 @@ void Io_WriteVerilogWires( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
     NameCounter = 0;
     Abc_NtkForEachNode( pNtk, pObj, i )
     {
+        Io_BufFlushIfFull( p );
         if ( i == 0 ) 
             continue;
         pNet = Abc_ObjFanout0(pObj);
@@ -309,15 +323,17 @@ void Io_WriteVerilogWires( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
             continue;
         Counter++;
         // get the line length after this name is written
-        AddedLength = strlen(Io_WriteVerilogGetName(Abc_ObjName(pNet))) + 2;
+        AddedLength = Io_WriteVerilogNameLength(Abc_ObjName(pNet)) + 2;
         if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
         { // write the line extender
-            fprintf( pFile, "\n   " );
+            Io_BufStr( p, "\n   " );
             // reset the line length
             LineLength  = 3;
             NameCounter = 0;
         }
-        fprintf( pFile, " %s%s", Io_WriteVerilogGetName(Abc_ObjName(pNet)), (Counter==nNodes)? "" : "," );
+        Io_BufChar( p, ' ' );
+        Io_WriteVerilogName( p, Abc_ObjName(pNet) );
+        Io_BufStr( p, (Counter==nNodes)? "" : "," );
         LineLength += AddedLength;
         NameCounter++;
     }
@@ -326,15 +342,17 @@ void Io_WriteVerilogWires( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
         pNet = Abc_ObjFanin0(Abc_ObjFanin0(pObj));
         Counter++;
         // get the line length after this name is written
-        AddedLength = strlen(Io_WriteVerilogGetName(Abc_ObjName(pNet))) + 2;
+        AddedLength = Io_WriteVerilogNameLength(Abc_ObjName(pNet)) + 2;
         if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
         { // write the line extender
-            fprintf( pFile, "\n   " );
+            Io_BufStr( p, "\n   " );
             // reset the line length
             LineLength  = 3;
             NameCounter = 0;
         }
-        fprintf( pFile, " %s%s", Io_WriteVerilogGetName(Abc_ObjName(pNet)), (Counter==nNodes)? "" : "," );
+        Io_BufChar( p, ' ' );
+        Io_WriteVerilogName( p, Abc_ObjName(pNet) );
+        Io_BufStr( p, (Counter==nNodes)? "" : "," );
         LineLength += AddedLength;
         NameCounter++;
     }
@@ -347,15 +365,17 @@ void Io_WriteVerilogWires( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
             pNet = Abc_ObjFanin0(pTerm);
             Counter++;
             // get the line length after this name is written
-            AddedLength = strlen(Io_WriteVerilogGetName(Abc_ObjName(pNet))) + 2;
+            AddedLength = Io_WriteVerilogNameLength(Abc_ObjName(pNet)) + 2;
             if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
             { // write the line extender
-                fprintf( pFile, "\n   " );
+                Io_BufStr( p, "\n   " );
                 // reset the line length
                 LineLength  = 3;
                 NameCounter = 0;
             }
-            fprintf( pFile, " %s%s", Io_WriteVerilogGetName(Abc_ObjName(pNet)), (Counter==nNodes)? "" : "," );
+            Io_BufChar( p, ' ' );
+            Io_WriteVerilogName( p, Abc_ObjName(pNet) );
+            Io_BufStr( p, (Counter==nNodes)? "" : "," );
             LineLength += AddedLength;
             NameCounter++;
         }
@@ -366,15 +386,17 @@ void Io_WriteVerilogWires( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
                 continue;
             Counter++;
             // get the line length after this name is written
-            AddedLength = strlen(Io_WriteVerilogGetName(Abc_ObjName(pNet))) + 2;
+            AddedLength = Io_WriteVerilogNameLength(Abc_ObjName(pNet)) + 2;
             if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
             { // write the line extender
-                fprintf( pFile, "\n   " );
+                Io_BufStr( p, "\n   " );
                 // reset the line length
                 LineLength  = 3;
                 NameCounter = 0;
             }
-            fprintf( pFile, " %s%s", Io_WriteVerilogGetName(Abc_ObjName(pNet)), (Counter==nNodes)? "" : "," );
+            Io_BufChar( p, ' ' );
+            Io_WriteVerilogName( p, Abc_ObjName(pNet) );
+            Io_BufStr( p, (Counter==nNodes)? "" : "," );
             LineLength += AddedLength;
             NameCounter++;
         }
@@ -393,7 +415,7 @@ void Io_WriteVerilogWires( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_WriteVerilogRegs( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
+void Io_WriteVerilogRegs( Io_Buf_t * p, Abc_Ntk_t * pNtk, int Start )
 {
     Abc_Obj_t * pLatch, * pNet;
     int LineLength;
@@ -413,15 +435,17 @@ void Io_WriteVerilogRegs( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
         pNet = Abc_ObjFanout0(Abc_ObjFanout0(pLatch));
         Counter++;
         // get the line length after this name is written
-        AddedLength = strlen(Io_WriteVerilogGetName(Abc_ObjName(pNet))) + 2;
+        AddedLength = Io_WriteVerilogNameLength(Abc_ObjName(pNet)) + 2;
         if ( NameCounter && LineLength + AddedLength + 3 > IO_WRITE_LINE_LENGTH )
         { // write the line extender
-            fprintf( pFile, "\n   " );
+            Io_BufStr( p, "\n   " );
             // reset the line length
             LineLength  = 3;
             NameCounter = 0;
         }
-        fprintf( pFile, " %s%s", Io_WriteVerilogGetName(Abc_ObjName(pNet)), (Counter==nNodes)? "" : "," );
+        Io_BufChar( p, ' ' );
+        Io_WriteVerilogName( p, Abc_ObjName(pNet) );
+        Io_BufStr( p, (Counter==nNodes)? "" : "," );
         LineLength += AddedLength;
         NameCounter++;
     }
@@ -438,7 +462,7 @@ void Io_WriteVerilogRegs( FILE * pFile, Abc_Ntk_t * pNtk, int Start )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_WriteVerilogLatches( FILE * pFile, Abc_Ntk_t * pNtk )
+void Io_WriteVerilogLatches( Io_Buf_t * p, Abc_Ntk_t * pNtk )
 {
     Abc_Obj_t * pLatch;
     int i;
@@ -447,13 +471,16 @@ void Io_WriteVerilogLatches( FILE * pFile, Abc_Ntk_t * pNtk )
     // write the latches
 //    fprintf( pFile, "  always @(posedge %s) begin\n", Io_WriteVerilogGetName(Abc_ObjFanout0(Abc_NtkPi(pNtk,0))) );
 //    fprintf( pFile, "  always begin\n" );
-    fprintf( pFile, "  always @ (posedge clock) begin\n" );
+    Io_BufStr( p, "  always @ (posedge clock) begin\n" );
     Abc_NtkForEachLatch( pNtk, pLatch, i )
     {
-        fprintf( pFile, "    %s", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout0(pLatch)))) );
-        fprintf( pFile, " <= %s;\n", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanin0(Abc_ObjFanin0(pLatch)))) );
+        Io_BufStr( p, "    " );
+        Io_WriteVerilogName( p, Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout0(pLatch))) );
+        Io_BufStr( p, " <= " );
+        Io_WriteVerilogName( p, Abc_ObjName(Abc_ObjFanin0(Abc_ObjFanin0(pLatch))) );
+        Io_BufStr( p, ";\n" );
     }
-    fprintf( pFile, "  end\n" );
+    Io_BufStr( p, "  end\n" );
     // check if there are initial values
     Abc_NtkForEachLatch( pNtk, pLatch, i )
         if ( Abc_LatchInit(pLatch) == ABC_INIT_ZERO || Abc_LatchInit(pLatch) == ABC_INIT_ONE )
@@ -461,15 +488,23 @@ void Io_WriteVerilogLatches( FILE * pFile, Abc_Ntk_t * pNtk )
     if ( i == Abc_NtkLatchNum(pNtk) )
         return;
     // write the initial values
-    fprintf( pFile, "  initial begin\n" );
+    Io_BufStr( p, "  initial begin\n" );
     Abc_NtkForEachLatch( pNtk, pLatch, i )
     {
         if ( Abc_LatchInit(pLatch) == ABC_INIT_ZERO )
-            fprintf( pFile, "    %s <= 1\'b0;\n", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout0(pLatch)))) );
+        {
+            Io_BufStr( p, "    " );
+            Io_WriteVerilogName( p, Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout0(pLatch))) );
+            Io_BufStr( p, " <= 1\'b0;\n" );
+        }
         else if ( Abc_LatchInit(pLatch) == ABC_INIT_ONE )
-            fprintf( pFile, "    %s <= 1\'b1;\n", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout0(pLatch)))) );
+        {
+            Io_BufStr( p, "    " );
+            Io_WriteVerilogName( p, Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout0(pLatch))) );
+            Io_BufStr( p, " <= 1\'b1;\n" );
+        }
     }
-    fprintf( pFile, "  end\n" );
+    Io_BufStr( p, "  end\n" );
 }
 
 /**Function*************************************************************
@@ -483,7 +518,7 @@ void Io_WriteVerilogLatches( FILE * pFile, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_WriteVerilogObjects( FILE * pFile, Abc_Ntk_t * pNtk, int fOnlyAnds )
+void Io_WriteVerilogObjects( Io_Buf_t * p, Abc_Ntk_t * pNtk, int fOnlyAnds )
 {
     int fUseSimpleGateNames = 0;
     Vec_Vec_t * vLevels;
@@ -500,19 +535,29 @@ void Io_WriteVerilogObjects( FILE * pFile, Abc_Ntk_t * pNtk, int fOnlyAnds )
         if ( Abc_ObjIsLatch(pObj) )
             continue;
         pNtkBox = (Abc_Ntk_t *)pObj->pData;
-        fprintf( pFile, "  %s box%0*d", pNtkBox->pName, nDigits, Counter++ );
-        fprintf( pFile, "(" );
+        Io_BufStr( p, "  " );
+        Io_BufStr( p, pNtkBox->pName );
+        Io_BufStr( p, " box" );
+        Io_BufNumPad( p, Counter++, nDigits );
+        Io_BufChar( p, '(' );
         Abc_NtkForEachPi( pNtkBox, pTerm, k )
         {
-            fprintf( pFile, ".%s",   Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(pTerm))) );
-            fprintf( pFile, "(%s), ", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanin0(Abc_ObjFanin(pObj,k)))) );
+            Io_BufChar( p, '.' );
+            Io_WriteVerilogName( p, Abc_ObjName(Abc_ObjFanout0(pTerm)) );
+            Io_BufChar( p, '(' );
+            Io_WriteVerilogName( p, Abc_ObjName(Abc_ObjFanin0(Abc_ObjFanin(pObj,k))) );
+            Io_BufStr( p, "), " );
         }
         Abc_NtkForEachPo( pNtkBox, pTerm, k )
         {
-            fprintf( pFile, ".%s",   Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanin0(pTerm))) );
-            fprintf( pFile, "(%s)%s", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout(pObj,k)))), k==Abc_NtkPoNum(pNtkBox)-1? "":", " );
+            Io_BufChar( p, '.' );
+            Io_WriteVerilogName( p, Abc_ObjName(Abc_ObjFanin0(pTerm)) );
+            Io_BufChar( p, '(' );
+            Io_WriteVerilogName( p, Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout(pObj,k))) );
+            Io_BufChar( p, ')' );
+            Io_BufStr( p, k==Abc_NtkPoNum(pNtkBox)-1? "":", " );
         }
-        fprintf( pFile, ");\n" );
+        Io_BufStr( p, ");\n" );
     }
     // write nodes
     if ( Abc_NtkHasMapping(pNtk) )
@@ -524,34 +569,54 @@ void Io_WriteVerilogObjects( FILE * pFile, Abc_Ntk_t * pNtk, int fOnlyAnds )
         {
             Mio_Gate_t * pGate = (Mio_Gate_t *)pObj->pData;
             Mio_Pin_t * pGatePin;
+            Io_BufFlushIfFull( p );
             if ( Abc_ObjFaninNum(pObj) == 0 && (!strcmp(Mio_GateReadName(pGate), "_const0_") || !strcmp(Mio_GateReadName(pGate), "_const1_")) )
             {
-                fprintf( pFile, "  %-*s %s = 1\'b%d;\n", Length, "assign", Io_WriteVerilogGetName(Abc_ObjName( Abc_ObjFanout0(pObj) )), !strcmp(Mio_GateReadName(pGate), "_const1_") );
+                Io_BufStr( p, "  " );
+                Io_BufStrPad( p, "assign", Length );
+                Io_BufChar( p, ' ' );
+                Io_WriteVerilogName( p, Abc_ObjName( Abc_ObjFanout0(pObj) ) );
+                Io_BufStr( p, " = 1\'b" );
+                Io_BufNum( p, !strcmp(Mio_GateReadName(pGate), "_const1_") );
+                Io_BufStr( p, ";\n" );
                 continue;
             }
             // write the node
             if ( fUseSimpleGateNames )
             {
-                fprintf( pFile, "%-*s ", Length, Mio_GateReadName(pGate) );
-                fprintf( pFile, "( %s", Io_WriteVerilogGetName(Abc_ObjName( Abc_ObjFanout0(pObj) )) );
+                Io_BufStrPad( p, Mio_GateReadName(pGate), Length );
+                Io_BufStr( p, " ( " );
+                Io_WriteVerilogName( p, Abc_ObjName( Abc_ObjFanout0(pObj) ) );
                 for ( pGatePin = Mio_GateReadPins(pGate), i = 0; pGatePin; pGatePin = Mio_PinReadNext(pGatePin), i++ )
-                    fprintf( pFile, ", %s", Io_WriteVerilogGetName(Abc_ObjName( Abc_ObjFanin(pObj,i) )) );
+                {
+                    Io_BufStr( p, ", " );
+                    Io_WriteVerilogName( p, Abc_ObjName( Abc_ObjFanin(pObj,i) ) );
+                }
                 assert ( i == Abc_ObjFaninNum(pObj) );
-                fprintf( pFile, " );\n" );
+                Io_BufStr( p, " );\n" );
             }
             else
             {
-                fprintf( pFile, "  %-*s g%0*d", Length, Mio_GateReadName(pGate), nDigits, Counter++ );
-                fprintf( pFile, "(" );
+                Io_BufStr( p, "  " );
+                Io_BufStrPad( p, Mio_GateReadName(pGate), Length );
+                Io_BufStr( p, " g" );
+                Io_BufNumPad( p, Counter++, nDigits );
+                Io_BufChar( p, '(' );
                 for ( pGatePin = Mio_GateReadPins(pGate), i = 0; pGatePin; pGatePin = Mio_PinReadNext(pGatePin), i++ )
                 {
-                    fprintf( pFile, ".%s", Io_WriteVerilogGetName(Mio_PinReadName(pGatePin)) );
-                    fprintf( pFile, "(%s), ", Io_WriteVerilogGetName(Abc_ObjName( Abc_ObjFanin(pObj,i) )) );
+                    Io_BufChar( p, '.' );
+                    Io_WriteVerilogName( p, Mio_PinReadName(pGatePin) );
+                    Io_BufChar( p, '(' );
+                    Io_WriteVerilogName( p, Abc_ObjName( Abc_ObjFanin(pObj,i) ) );
+                    Io_BufStr( p, "), " );
                 }
                 assert ( i == Abc_ObjFaninNum(pObj) );
-                fprintf( pFile, ".%s", Io_WriteVerilogGetName(Mio_GateReadOutName(pGate)) );
-                fprintf( pFile, "(%s)", Io_WriteVerilogGetName(Abc_ObjName( Abc_ObjFanout0(pObj) )) );
-                fprintf( pFile, ");\n" );
+                Io_BufChar( p, '.' );
+                Io_WriteVerilogName( p, Mio_GateReadOutName(pGate) );
+                Io_BufChar( p, '(' );
+                Io_WriteVerilogName( p, Abc_ObjName( Abc_ObjFanout0(pObj) ) );
+                Io_BufChar( p, ')' );
+                Io_BufStr( p, ");\n" );
             }
         }
     }
@@ -561,10 +626,14 @@ void Io_WriteVerilogObjects( FILE * pFile, Abc_Ntk_t * pNtk, int fOnlyAnds )
         vLevels = Vec_VecAlloc( 10 );
         Abc_NtkForEachNode( pNtk, pObj, i )
         {
+            Io_BufFlushIfFull( p );
             if ( Abc_ObjFaninNum(pObj) == 0 )
             {
-                fprintf( pFile, "  assign %s = ", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(pObj))) );
-                fprintf( pFile, "1\'b%d;\n", Abc_NodeIsConst1(pObj) );
+                Io_BufStr( p, "  assign " );
+                Io_WriteVerilogName( p, Abc_ObjName(Abc_ObjFanout0(pObj)) );
+                Io_BufStr( p, " = 1\'b" );
+                Io_BufNum( p, Abc_NodeIsConst1(pObj) );
+                Io_BufStr( p, ";\n" );
                 continue;
             }
             /*
@@ -583,21 +652,25 @@ void Io_WriteVerilogObjects( FILE * pFile, Abc_Ntk_t * pNtk, int fOnlyAnds )
             }
             */
             pFunc = (Hop_Obj_t *)pObj->pData;
-            fprintf( pFile, "  assign %s = ", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(pObj))) );
+            Io_BufStr( p, "  assign " );
+            Io_WriteVerilogName( p, Abc_ObjName(Abc_ObjFanout0(pObj)) );
+            Io_BufStr( p, " = " );
             // set the input names
             Abc_ObjForEachFanin( pObj, pFanin, k )
-                Hop_IthVar((Hop_Man_t *)pNtk->pManFunc, k)->pData = Extra_UtilStrsav(Io_WriteVerilogGetName(Abc_ObjName(pFanin)));
+                Hop_IthVar((Hop_Man_t *)pNtk->pManFunc, k)->pData = Io_WriteVerilogNameDup(Abc_ObjName(pFanin));
             // write the formula
-            Hop_ObjPrintVerilog( pFile, pFunc, vLevels, 0, fOnlyAnds );
+            Hop_ObjPrintVerilogStr( p->vText, pFunc, vLevels, 0, fOnlyAnds );
             if ( pObj->fPersist )
             {
                 Abc_Obj_t * pFan0 = Abc_ObjFanin0(Abc_ObjFanin(pObj, 0));
                 Abc_Obj_t * pFan1 = Abc_ObjFanin0(Abc_ObjFanin(pObj, 1));
                 int Cond = Abc_ObjIsNode(pFan0) && Abc_ObjIsNode(pFan1) && !pFan0->fPersist && !pFan1->fPersist;
-                fprintf( pFile, "; // MUXF7 %s\n", Cond ? "":"to be legalized" );
+                Io_BufStr( p, "; // MUXF7 " );
+                Io_BufStr( p, Cond ? "":"to be legalized" );
+                Io_BufChar( p, '\n' );
             }
             else
-            fprintf( pFile, ";\n" );
+            Io_BufStr( p, ";\n" );
             // clear the input names
             Abc_ObjForEachFanin( pObj, pFanin, k )
                 ABC_FREE( Hop_IthVar((Hop_Man_t *)pNtk->pManFunc, k)->pData );
@@ -652,34 +725,60 @@ int Io_WriteVerilogWiresCount( Abc_Ntk_t * pNtk )
 
   Synopsis    [Prepares the name for writing the Verilog file.]
 
-  Description []
+  Description [Names that are not valid Verilog identifiers are written
+  as escaped identifiers: the backslash, followed by the name, followed
+  by the space. Io_WriteVerilogNameLength() returns the number of 
+  characters written. These procedures do not use static storage.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-char * Io_WriteVerilogGetName( char * pName )
+static inline int Io_WriteVerilogNameIsSimple( char * pName )
+{
+    char * pCur;
+    if ( pName[0] >= '0' && pName[0] <= '9' )
+        return 0;
+    for ( pCur = pName; *pCur; pCur++ )
+        if ( !((*pCur >= 'a' && *pCur <= 'z') || 
+               (*pCur >= 'A' && *pCur <= 'Z') || 
+               (*pCur >= '0' && *pCur <= '9') || *pCur == '_') )
+            return 0;
+    return 1;
+}
+int Io_WriteVerilogNameLength( char * pName )
+{
+    return (int)strlen(pName) + (Io_WriteVerilogNameIsSimple(pName) ? 0 : 2);
+}
+void Io_WriteVerilogName( Io_Buf_t * p, char * pName )
+{
+    if ( Io_WriteVerilogNameIsSimple(pName) )
+    {
+        Io_BufStr( p, pName );
+        return;
+    }
+    Io_BufChar( p, '\\' );
+    Io_BufStr( p, pName );
+    Io_BufChar( p, ' ' );
+}
+static void Io_WriteVerilogNamePad( Io_Buf_t * p, char * pName, int Width )
+{
+    Io_BufSpaces( p, Width - Io_WriteVerilogNameLength(pName) );
+    Io_WriteVerilogName( p, pName );
+}
+static char * Io_WriteVerilogNameDup( char * pName )
 {
-    static char Buffer[500];
-    int i, Length = strlen(pName);
-    if ( pName[0] < '0' || pName[0] > '9' )
-    {
-        for ( i = 0; i < Length; i++ )
-            if ( !((pName[i] >= 'a' && pName[i] <= 'z') || 
-                 (pName[i] >= 'A' && pName[i] <= 'Z') || 
-                 (pName[i] >= '0' && pName[i] <= '9') || pName[i] == '_') )
-                 break;
-        if ( i == Length )
-            return pName;
-    }
-    // create Verilog style name
-    Buffer[0] = '\\';
-    for ( i = 0; i < Length; i++ )
-        Buffer[i+1] = pName[i];
-    Buffer[Length+1] = ' ';
-    Buffer[Length+2] = 0;
-    return Buffer;
+    char * pBuffer;
+    int Length = (int)strlen(pName);
+    if ( Io_WriteVerilogNameIsSimple(pName) )
+        return Abc_UtilStrsav( pName );
+    pBuffer = ABC_ALLOC( char, Length + 3 );
+    pBuffer[0] = '\\';
+    memcpy( pBuffer + 1, pName, (size_t)Length );
+    pBuffer[Length+1] = ' ';
+    pBuffer[Length+2] = 0;
+    return pBuffer;
 }
 
 
@@ -694,45 +793,51 @@ char * Io_WriteVerilogGetName( char * pName )
   SeeAlso     []
 
 ***********************************************************************/
-void Io_WriteLutModule( FILE * pFile, int nLutSize )
+void Io_WriteLutModule( Io_Buf_t * p, int nLutSize )
 {    
-    fprintf( pFile, "module lut%d #( parameter TT = %d\'h0 ) ( input [%d:0] in, output out );\n", nLutSize, 1<<nLutSize, nLutSize-1 );
-    fprintf( pFile, "    assign out = TT[in];\n" );
-    fprintf( pFile, "endmodule\n\n" );
+    Io_BufStr( p, "module lut" );
+    Io_BufNum( p, nLutSize );
+    Io_BufStr( p, " #( parameter TT = " );
+    Io_BufNum( p, 1<<nLutSize );
+    Io_BufStr( p, "\'h0 ) ( input [" );
+    Io_BufNum( p, nLutSize-1 );
+    Io_BufStr( p, ":0] in, output out );\n" );
+    Io_BufStr( p, "    assign out = TT[in];\n" );
+    Io_BufStr( p, "endmodule\n\n" );
 }
-void Io_WriteFixedModules( FILE * pFile )
+void Io_WriteFixedModules( Io_Buf_t * p )
 {    
-    fprintf( pFile, "module LUT6 #( parameter INIT = 64\'h0000000000000000 ) (\n" );
-    fprintf( pFile, "    output O,\n" );
-    fprintf( pFile, "    input I0,\n" );
-    fprintf( pFile, "    input I1,\n" );
-    fprintf( pFile, "    input I2,\n" );
-    fprintf( pFile, "    input I3,\n" );
-    fprintf( pFile, "    input I4,\n" );
-    fprintf( pFile, "    input I5\n" );
-    fprintf( pFile, ");\n" );
-    fprintf( pFile, "    assign O = INIT[ {I5, I4, I3, I2, I1, I0} ];\n" );
-    fprintf( pFile, "endmodule\n\n" );
-
-    fprintf( pFile, "module MUXF7 (\n" );
-    fprintf( pFile, "    output O,\n" );
-    fprintf( pFile, "    input I0,\n" );
-    fprintf( pFile, "    input I1,\n" );
-    fprintf( pFile, "    input S\n" );
-    fprintf( pFile, ");\n" );
-    fprintf( pFile, "    assign O = S ? I1 : I0;\n" );
-    fprintf( pFile, "endmodule\n\n" );
-
-    fprintf( pFile, "module MUXF8 (\n" );
-    fprintf( pFile, "    output O,\n" );
-    fprintf( pFile, "    input I0,\n" );
-    fprintf( pFile, "    input I1,\n" );
-    fprintf( pFile, "    input S\n" );
-    fprintf( pFile, ");\n" );
-    fprintf( pFile, "    assign O = S ? I1 : I0;\n" );
-    fprintf( pFile, "endmodule\n\n" );
+    Io_BufStr( p, "module LUT6 #( parameter INIT = 64\'h0000000000000000 ) (\n" );
+    Io_BufStr( p, "    output O,\n" );
+    Io_BufStr( p, "    input I0,\n" );
+    Io_BufStr( p, "    input I1,\n" );
+    Io_BufStr( p, "    input I2,\n" );
+    Io_BufStr( p, "    input I3,\n" );
+    Io_BufStr( p, "    input I4,\n" );
+    Io_BufStr( p, "    input I5\n" );
+    Io_BufStr( p, ");\n" );
+    Io_BufStr( p, "    assign O = INIT[ {I5, I4, I3, I2, I1, I0} ];\n" );
+    Io_BufStr( p, "endmodule\n\n" );
+
+    Io_BufStr( p, "module MUXF7 (\n" );
+    Io_BufStr( p, "    output O,\n" );
+    Io_BufStr( p, "    input I0,\n" );
+    Io_BufStr( p, "    input I1,\n" );
+    Io_BufStr( p, "    input S\n" );
+    Io_BufStr( p, ");\n" );
+    Io_BufStr( p, "    assign O = S ? I1 : I0;\n" );
+    Io_BufStr( p, "endmodule\n\n" );
+
+    Io_BufStr( p, "module MUXF8 (\n" );
+    Io_BufStr( p, "    output O,\n" );
+    Io_BufStr( p, "    input I0,\n" );
+    Io_BufStr( p, "    input I1,\n" );
+    Io_BufStr( p, "    input S\n" );
+    Io_BufStr( p, ");\n" );
+    Io_BufStr( p, "    assign O = S ? I1 : I0;\n" );
+    Io_BufStr( p, "endmodule\n\n" );
 }
-void Io_WriteVerilogObjectsLut( FILE * pFile, Abc_Ntk_t * pNtk, int nLutSize, int fFixed )
+void Io_WriteVerilogObjectsLut( Io_Buf_t * p, Abc_Ntk_t * pNtk, int nLutSize, int fFixed )
 {
     Abc_Ntk_t * pNtkBox;
     Abc_Obj_t * pObj, * pTerm;
@@ -746,27 +851,37 @@ void Io_WriteVerilogObjectsLut( FILE * pFile, Abc_Ntk_t * pNtk, int nLutSize, in
         if ( Abc_ObjIsLatch(pObj) )
             continue;
         pNtkBox = (Abc_Ntk_t *)pObj->pData;
-        fprintf( pFile, "  %s box%0*d", pNtkBox->pName, nDigits, Counter++ );
-        fprintf( pFile, "(" );
+        Io_BufStr( p, "  " );
+        Io_BufStr( p, pNtkBox->pName );
+        Io_BufStr( p, " box" );
+        Io_BufNumPad( p, Counter++, nDigits );
+        Io_BufChar( p, '(' );
         Abc_NtkForEachPi( pNtkBox, pTerm, k )
         {
-            fprintf( pFile, ".%s",   Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(pTerm))) );
-            fprintf( pFile, "(%s), ", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanin0(Abc_ObjFanin(pObj,k)))) );
+            Io_BufChar( p, '.' );
+            Io_WriteVerilogName( p, Abc_ObjName(Abc_ObjFanout0(pTerm)) );
+            Io_BufChar( p, '(' );
+            Io_WriteVerilogName( p, Abc_ObjName(Abc_ObjFanin0(Abc_ObjFanin(pObj,k))) );
+            Io_BufStr( p, "), " );
         }
         Abc_NtkForEachPo( pNtkBox, pTerm, k )
         {
-            fprintf( pFile, ".%s",   Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanin0(pTerm))) );
-            fprintf( pFile, "(%s)%s", Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout(pObj,k)))), k==Abc_NtkPoNum(pNtkBox)-1? "":", " );
+            Io_BufChar( p, '.' );
+            Io_WriteVerilogName( p, Abc_ObjName(Abc_ObjFanin0(pTerm)) );
+            Io_BufChar( p, '(' );
+            Io_WriteVerilogName( p, Abc_ObjName(Abc_ObjFanout0(Abc_ObjFanout(pObj,k))) );
+            Io_BufChar( p, ')' );
+            Io_BufStr( p, k==Abc_NtkPoNum(pNtkBox)-1? "":", " );
         }
-        fprintf( pFile, ");\n" );
+        Io_BufStr( p, ");\n" );
     }
 
     // find the longest signal name
     Abc_NtkForEachNode( pNtk, pObj, i )
     {
-        Length = Abc_MaxInt( Length, strlen(Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(pObj)))) );
+        Length = Abc_MaxInt( Length, Io_WriteVerilogNameLength(Abc_ObjName(Abc_ObjFanout0(pObj))) );
         Abc_ObjForEachFanin( pObj, pTerm, k )
-            Length = Abc_MaxInt( Length, strlen(Io_WriteVerilogGetName(Abc_ObjName(pTerm))) );
+            Length = Abc_MaxInt( Length, Io_WriteVerilogNameLength(Abc_ObjName(pTerm)) );
     }
 
     // write LUT instances
@@ -775,112 +890,145 @@ void Io_WriteVerilogObjectsLut( FILE * pFile, Abc_Ntk_t * pNtk, int nLutSize, in
     if ( fFixed )
     Abc_NtkForEachNode( pNtk, pObj, i )
     {
+        Io_BufFlushIfFull( p );
         if ( pObj->fPersist )
         {
             int One = Abc_ObjFanin0(Abc_ObjFanin(pObj, 1))->fPersist && Abc_ObjFanin0(Abc_ObjFanin(pObj, 2))->fPersist;
-            fprintf( pFile, "  MUXF%d                       ", 7+One );
-            fprintf( pFile, " mux_%0*d (", nDigits, Counter++ );
-            fprintf( pFile, " %*s", Length, Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(pObj))) );
+            Io_BufStr( p, "  MUXF" );
+            Io_BufNum( p, 7+One );
+            Io_BufStr( p, "                        mux_" );
+            Io_BufNumPad( p, Counter++, nDigits );
+            Io_BufStr( p, " ( " );
+            Io_WriteVerilogNamePad( p, Abc_ObjName(Abc_ObjFanout0(pObj)), Length );
             for ( k = Abc_ObjFaninNum(pObj) - 1; k >= 0; k-- )
-                fprintf( pFile, ", %*s", Length, Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanin(pObj, k))) );
-            fprintf( pFile, " );\n" );
+            {
+                Io_BufStr( p, ", " );
+                Io_WriteVerilogNamePad( p, Abc_ObjName(Abc_ObjFanin(pObj, k)), Length );
+            }
+            Io_BufStr( p, " );\n" );
         }
         else
         {
             word Truth = Abc_SopToTruth( (char *)pObj->pData, Abc_ObjFaninNum(pObj) );
-            fprintf( pFile, "  LUT6 #(64\'h" );
-            fprintf( pFile, "%08x%08x", (unsigned)(Truth >> 32), (unsigned)Truth );
-            fprintf( pFile, ") lut_%0*d (", nDigits, Counter++ );
-            fprintf( pFile, " %*s", Length, Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(pObj))) );
+            Io_BufStr( p, "  LUT6 #(64\'h" );
+            Io_BufPrintf( p, "%08x%08x", (unsigned)(Truth >> 32), (unsigned)Truth );
+            Io_BufStr( p, ") lut_" );
+            Io_BufNumPad( p, Counter++, nDigits );
+            Io_BufStr( p, " ( " );
+            Io_WriteVerilogNamePad( p, Abc_ObjName(Abc_ObjFanout0(pObj)), Length );
             for ( k = 0; k < Abc_ObjFaninNum(pObj); k++ )
-                fprintf( pFile, ", %*s", Length, Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanin(pObj, k))) );
+            {
+                Io_BufStr( p, ", " );
+                Io_WriteVerilogNamePad( p, Abc_ObjName(Abc_ObjFanin(pObj, k)), Length );
+            }
             for (      ; k < 6; k++ )
-                fprintf( pFile, ", %*s", Length, "1\'b0" );
-            fprintf( pFile, " );\n" );
+            {
+                Io_BufStr( p, ", " );
+                Io_BufStrPadLeft( p, "1\'b0", Length );
+            }
+            Io_BufStr( p, " );\n" );
         }
     }
     else
     Abc_NtkForEachNode( pNtk, pObj, i )
     {
         word Truth = Abc_SopToTruth( (char *)pObj->pData, Abc_ObjFaninNum(pObj) );
-        fprintf( pFile, "  lut%d #(%d\'h", nLutSize, 1<<nLutSize );
+        Io_BufFlushIfFull( p );
+        Io_BufStr( p, "  lut" );
+        Io_BufNum( p, nLutSize );
+        Io_BufStr( p, " #(" );
+        Io_BufNum( p, 1<<nLutSize );
+        Io_BufStr( p, "\'h" );
         if ( nLutSize == 6 )
-            fprintf( pFile, "%08x%08x", (unsigned)(Truth >> 32), (unsigned)Truth );
+            Io_BufPrintf( p, "%08x%08x", (unsigned)(Truth >> 32), (unsigned)Truth );
         else
-            fprintf( pFile, "%0*x", 1<<(nLutSize-2), Abc_InfoMask(1 << nLutSize) & (unsigned)Truth );
-        fprintf( pFile, ") lut_%0*d ( {", nDigits, Counter++ );
+            Io_BufPrintf( p, "%0*x", 1<<(nLutSize-2), Abc_InfoMask(1 << nLutSize) & (unsigned)Truth );
+        Io_BufStr( p, ") lut_" );
+        Io_BufNumPad( p, Counter++, nDigits );
+        Io_BufStr( p, " ( {" );
         for ( k = nLutSize - 1; k >= Abc_ObjFaninNum(pObj); k-- )
-            fprintf( pFile, "%*s, ", Length, "1\'b0" );
+        {
+            Io_BufStrPadLeft( p, "1\'b0", Length );
+            Io_BufStr( p, ", " );
+        }
         for ( k = Abc_ObjFaninNum(pObj) - 1; k >= 0; k-- )
-            fprintf( pFile, "%*s%s", Length, Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanin(pObj, k))), k==0 ? "":", " );
-        fprintf( pFile, "}, %*s );\n", Length, Io_WriteVerilogGetName(Abc_ObjName(Abc_ObjFanout0(pObj))) );
+        {
+            Io_WriteVerilogNamePad( p, Abc_ObjName(Abc_ObjFanin(pObj, k)), Length );
+            Io_BufStr( p, k==0 ? "":", " );
+        }
+        Io_BufStr( p, "}, " );
+        Io_WriteVerilogNamePad( p, Abc_ObjName(Abc_ObjFanout0(pObj)), Length );
+        Io_BufStr( p, " );\n" );
     }
 }
-void Io_WriteVerilogLutInt( FILE * pFile, Abc_Ntk_t * pNtk, int nLutSize, int fFixed )
+void Io_WriteVerilogLutInt( Io_Buf_t * p, Abc_Ntk_t * pNtk, int nLutSize, int fFixed )
 {
     // write inputs and outputs
 //    fprintf( pFile, "module %s ( gclk,\n   ", Abc_NtkName(pNtk) );
-    fprintf( pFile, "module %s ( ", Io_WriteVerilogGetName(Abc_NtkName(pNtk)) );
+    Io_BufStr( p, "module " );
+    Io_WriteVerilogName( p, Abc_NtkName(pNtk) );
+    Io_BufStr( p, " ( " );
     // add the clock signal if it does not exist
     if ( Abc_NtkLatchNum(pNtk) > 0 && Nm_ManFindIdByName(pNtk->pManName, "clock", ABC_OBJ_PI) == -1 )
-        fprintf( pFile, "clock, " );
+        Io_BufStr( p, "clock, " );
     // write other primary inputs
-    fprintf( pFile, "\n   " );
+    Io_BufStr( p, "\n   " );
     if ( Abc_NtkPiNum(pNtk) > 0  )
     {
-        Io_WriteVerilogPis( pFile, pNtk, 3 );
-        fprintf( pFile, ",\n   " );
+        Io_WriteVerilogPis( p, pNtk, 3 );
+        Io_BufStr( p, ",\n   " );
     }
     if ( Abc_NtkPoNum(pNtk) > 0  )
-        Io_WriteVerilogPos( pFile, pNtk, 3 );
-    fprintf( pFile, "  );\n\n" );
+        Io_WriteVerilogPos( p, pNtk, 3 );
+    Io_BufStr( p, "  );\n\n" );
     // add the clock signal if it does not exist
     if ( Abc_NtkLatchNum(pNtk) > 0 && Nm_ManFindIdByName(pNtk->pManName, "clock", ABC_OBJ_PI) == -1 )
-        fprintf( pFile, "  input  clock;\n" );
+        Io_BufStr( p, "  input  clock;\n" );
     // write inputs, outputs, registers, and wires
     if ( Abc_NtkPiNum(pNtk) > 0  )
     {
 //        fprintf( pFile, "  input gclk," );
-        fprintf( pFile, "  input " );
-        Io_WriteVerilogPis( pFile, pNtk, 10 );
-        fprintf( pFile, ";\n" );
+        Io_BufStr( p, "  input " );
+        Io_WriteVerilogPis( p, pNtk, 10 );
+        Io_BufStr( p, ";\n" );
     }
     if ( Abc_NtkPoNum(pNtk) > 0  )
     {
-        fprintf( pFile, "  output" );
-        Io_WriteVerilogPos( pFile, pNtk, 5 );
-        fprintf( pFile, ";\n\n" );
+        Io_BufStr( p, "  output" );
+        Io_WriteVerilogPos( p, pNtk, 5 );
+        Io_BufStr( p, ";\n\n" );
     }
     // if this is not a blackbox, write internal signals
     if ( !Abc_NtkHasBlackbox(pNtk) )
     {
         if ( Abc_NtkLatchNum(pNtk) > 0 )
         {
-            fprintf( pFile, "  reg" );
-            Io_WriteVerilogRegs( pFile, pNtk, 4 );
-            fprintf( pFile, ";\n\n" );
+            Io_BufStr( p, "  reg" );
+            Io_WriteVerilogRegs( p, pNtk, 4 );
+            Io_BufStr( p, ";\n\n" );
         }
         if ( Io_WriteVerilogWiresCount(pNtk) > 0 )
         {
-            fprintf( pFile, "  wire" );
-            Io_WriteVerilogWires( pFile, pNtk, 4 );
-            fprintf( pFile, ";\n\n" );
+            Io_BufStr( p, "  wire" );
+            Io_WriteVerilogWires( p, pNtk, 4 );
+            Io_BufStr( p, ";\n\n" );
         }
         // write nodes
-        Io_WriteVerilogObjectsLut( pFile, pNtk, nLutSize, fFixed );        
+        Io_WriteVerilogObjectsLut( p, pNtk, nLutSize, fFixed );        
         // write registers
         if ( Abc_NtkLatchNum(pNtk) > 0 )
         {
-            fprintf( pFile, "\n" );
-            Io_WriteVerilogLatches( pFile, pNtk );
+            Io_BufChar( p, '\n' );
+            Io_WriteVerilogLatches( p, pNtk );
         }
     }
     // finalize the file
-    fprintf( pFile, "\nendmodule\n\n" );
+    Io_BufStr( p, "\nendmodule\n\n" );
 } 
 void Io_WriteVerilogLut( Abc_Ntk_t * pNtk, char * pFileName, int nLutSize, int fFixed, int fNoModules )
 {
     FILE * pFile;
+    Io_Buf_t * p;
     Abc_Ntk_t * pNtkTemp;
     Abc_Obj_t * pObj; 
     int i, Counter = 0;
@@ -904,23 +1052,26 @@ void Io_WriteVerilogLut( Abc_Ntk_t * pNtk, char * pFileName, int nLutSize, int f
         fprintf( stdout, "Io_WriteVerilog(): Cannot open the output file \"%s\".\n", pFileName );
         return;
     }
+    p = Io_BufStart( pFile );
 
     // write the equations for the network
-    fprintf( pFile, "// Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
-    fprintf( pFile, "\n" );
+    Io_BufPrintf( p, "// Benchmark \"%s\" written by ABC on %s\n", pNtk->pName, Extra_TimeStamp() );
+    Io_BufChar( p, '\n' );
     if ( !fNoModules )
     {
         if ( fFixed )
-            Io_WriteFixedModules( pFile );
+            Io_WriteFixedModules( p );
         else
-            Io_WriteLutModule( pFile, nLutSize );
+            Io_WriteLutModule( p, nLutSize );
     }
     pNtkTemp = Abc_NtkToNetlist( pNtk );
     Abc_NtkToSop( pNtkTemp, -1, ABC_INFINITY );
-    Io_WriteVerilogLutInt( pFile, pNtkTemp, nLutSize, fFixed );
+    Io_WriteVerilogLutInt( p, pNtkTemp, nLutSize, fFixed );
     Abc_NtkDelete( pNtkTemp );
 
-    fprintf( pFile, "\n" );
+    Io_BufChar( p, '\n' );
+    if ( !Io_BufStop( p ) )
+        fprintf( stdout, "Io_WriteVerilogLut(): Writing into the output file \"%s\" has failed.\n", pFileName );
     fclose( pFile );
 }
 
@@ -29,6 +29,24 @@
 ///                         PARAMETERS                               ///
 ////////////////////////////////////////////////////////////////////////
 
+// kinds of orchestration data exchanged with the driver program
+#define ABC_ORCH_DATA_EDGES  0   // edge list (node ID, fanin ID)
+#define ABC_ORCH_DATA_FEATS  1   // node features (8 entries per node)
+#define ABC_ORCH_DATA_DECS   2   // decisions or policy (1 entry per node)
+#define ABC_ORCH_DATA_NUM    3
+
+// parameters of Abc_FrameOrchEvalBatch() (the same as those of the command "orchestrate")
+#define ABC_ORCH_PAR_ZEROS_RWR   0   // use zero-cost replacements in rewriting (-z)
+#define ABC_ORCH_PAR_ZEROS_REF   1   // use zero-cost replacements in refactoring (-Z)
+#define ABC_ORCH_PAR_CUT_MAX     2   // the max cut size of resubstitution (-K)
+#define ABC_ORCH_PAR_STEPS_MAX   3   // the max number of nodes added by resubstitution (-N)
+#define ABC_ORCH_PAR_LEVELS_ODC  4   // the number of fanout levels for ODC computation (-F)
+#define ABC_ORCH_PAR_UPDATE_LEV  5   // preserve the number of levels (-l)
+#define ABC_ORCH_PAR_NODE_MAX    6   // the max size of the refactored node
+#define ABC_ORCH_PAR_CONE_MAX    7   // the max size of the refactored cone
+#define ABC_ORCH_PAR_USE_DCS     8   // use don't-cares in refactoring
+#define ABC_ORCH_PAR_NUM         9
+
 ////////////////////////////////////////////////////////////////////////
 ///                         BASIC TYPES                              ///
 ////////////////////////////////////////////////////////////////////////
@@ -112,6 +130,11 @@ extern ABC_DLL void   Abc_FrameSetRetimingData( Abc_Frame_t * pAbc, int * pRst,
 
 // procedure to return sequential equivalences
 extern ABC_DLL int *  Abc_FrameReadMiniAigEquivClasses( Abc_Frame_t * pAbc );
+// procedures to exchange orchestration data (kinds are ABC_ORCH_DATA_*)
+extern ABC_DLL void   Abc_FrameSetOrchData( Abc_Frame_t * pAbc, int Kind, int * pData, int nRows, int nCols );
+extern ABC_DLL int *  Abc_FrameReadOrchData( Abc_Frame_t * pAbc, int Kind, int * pnRows, int * pnCols );
+extern ABC_DLL void   Abc_FrameOrchSetDefaultPars( int * pPars );
+extern ABC_DLL int    Abc_FrameOrchEvalBatch( Abc_Frame_t * pAbc, int * pPolicies, int nPolicies, int nEntries, int * pPars, int * pArea, int * pDelay );
 
 ABC_NAMESPACE_HEADER_END
 
@@ -105,6 +105,7 @@ extern ABC_DLL void *          Abc_FrameReadManDd();
 extern ABC_DLL void *          Abc_FrameReadManDec();                    
 extern ABC_DLL void *          Abc_FrameReadManDsd();           
 extern ABC_DLL void *          Abc_FrameReadManDsd2();           
+extern ABC_DLL void *          Abc_FrameReadCnfCache();           
 extern ABC_DLL Vec_Ptr_t *     Abc_FrameReadSignalNames();
 extern ABC_DLL char *          Abc_FrameReadSpecName();
          
@@ -168,6 +169,11 @@ extern ABC_DLL void            Abc_FrameSetMaxLoad( float Load );
 extern ABC_DLL void            Abc_FrameSetArrayMapping( int * p );
 extern ABC_DLL void            Abc_FrameSetBoxes( int * p );
 
+/*=== abcOrchData.c ===========================================================*/
+extern ABC_DLL int             Abc_OrchDataIsBinary( char * pFileName );
+extern ABC_DLL int             Abc_OrchDataWrite( char * pFileName, int Kind, Vec_Int_t * vData, int nCols );
+extern ABC_DLL Vec_Int_t *     Abc_OrchDataRead( char * pFileName, int Kind, int * pnCols );
+
 ABC_NAMESPACE_HEADER_END
 
 #endif
@@ -23,6 +23,7 @@
 #include "bool/dec/dec.h"
 #include "map/if/if.h"
 #include "aig/miniaig/ndr.h"
+#include "sat/cnf/cnf.h"
 
 #ifdef ABC_USE_CUDD
 #include "bdd/extrab/extraBdd.h"
@@ -66,6 +67,7 @@ void *      Abc_FrameReadManDd()                             { if ( s_GlobalFram
 void *      Abc_FrameReadManDec()                            { if ( s_GlobalFrame->pManDec == NULL ) s_GlobalFrame->pManDec = Dec_ManStart();                                        return s_GlobalFrame->pManDec; } 
 void *      Abc_FrameReadManDsd()                            { return s_GlobalFrame->pManDsd;      } 
 void *      Abc_FrameReadManDsd2()                           { return s_GlobalFrame->pManDsd2;     }
+void *      Abc_FrameReadCnfCache()                          { if ( s_GlobalFrame->pCnfCache == NULL ) s_GlobalFrame->pCnfCache = Cnf_CacheStart();                                  return s_GlobalFrame->pCnfCache; } 
 char *      Abc_FrameReadFlag( char * pFlag )                { return Cmd_FlagReadByName( s_GlobalFrame, pFlag );   }
 Vec_Ptr_t * Abc_FrameReadSignalNames()                       { return s_GlobalFrame->vSignalNames; }
 char *      Abc_FrameReadSpecName()                          { return s_GlobalFrame->pSpecName;    }
@@ -177,6 +179,8 @@ Abc_Frame_t * Abc_FrameAllocate()
     // set the starting step
     p->nSteps     =  1;
     p->fBatchMode =  0;
+    // the number of compressed AIGs kept for undo
+    p->nGiaUndo   = 10;
     // networks to be used by choice
     p->vStore = Vec_PtrAlloc( 16 );
     p->vAbcObjIds = Vec_IntAlloc( 0 );
@@ -206,6 +210,7 @@ void Abc_FrameDeallocate( Abc_Frame_t * p )
     extern void Rwt_ManGlobalStop();
     extern void undefine_cube_size();
 //    extern void Ivy_TruthManStop();
+    int i;
 //    Abc_HManStop();
 //    undefine_cube_size();
     Rwt_ManGlobalStop();
@@ -225,6 +230,7 @@ void Abc_FrameDeallocate( Abc_Frame_t * p )
     if ( p->pSave4    )  Aig_ManStop( (Aig_Man_t *)p->pSave4 );
     if ( p->pManDsd   )  If_DsdManFree( (If_DsdMan_t *)p->pManDsd, 0 );
     if ( p->pManDsd2  )  If_DsdManFree( (If_DsdMan_t *)p->pManDsd2, 0 );
+    if ( p->pCnfCache )  Cnf_CacheStop( p->pCnfCache );
     if ( p->pNtkBackup)  Abc_NtkDelete( p->pNtkBackup );
     if ( p->vPlugInComBinPairs ) 
     {
@@ -255,6 +261,8 @@ void Abc_FrameDeallocate( Abc_Frame_t * p )
     Vec_IntFreeP( &p->vCopyMiniLut );
     ABC_FREE( p->pArray );
     ABC_FREE( p->pBoxes );
+    for ( i = 0; i < ABC_ORCH_DATA_NUM; i++ )
+        Vec_IntFreeP( &p->vOrchData[i] );
     
 
     ABC_FREE( p );
@@ -610,6 +618,75 @@ void Abc_FrameDeleteAllNetworks( Abc_Frame_t * p )
     Gia_ManStopP( &p->pGiaBest );
     Gia_ManStopP( &p->pGiaBest2 );
     Gia_ManStopP( &p->pGiaSaved );
+    Abc_FrameGiaUndoClear( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Saves the AIG in the compressed form for undo.]
+
+  Description [Takes the ownership of the AIG. Only the last nGiaUndo
+  AIGs are kept; the oldest one is deleted when the limit is exceeded.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_FrameGiaUndoPush( Abc_Frame_t * p, Gia_Man_t * pGia )
+{
+    if ( p->nGiaUndo <= 0 )
+    {
+        Gia_ManStop( pGia );
+        return;
+    }
+    if ( p->vGiaUndo == NULL )
+        p->vGiaUndo = Vec_PtrAlloc( p->nGiaUndo );
+    Vec_PtrPush( p->vGiaUndo, Gia_ManZip(pGia) );
+    while ( Vec_PtrSize(p->vGiaUndo) > p->nGiaUndo )
+    {
+        Gia_ZipFree( (Gia_Zip_t *)Vec_PtrEntry(p->vGiaUndo, 0) );
+        Vec_PtrDrop( p->vGiaUndo, 0 );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restores the most recently saved AIG.]
+
+  Description [Returns NULL if there are no saved AIGs.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Abc_FrameGiaUndoPop( Abc_Frame_t * p )
+{
+    if ( p->vGiaUndo == NULL || Vec_PtrSize(p->vGiaUndo) == 0 )
+        return NULL;
+    return Gia_ManUnzip( (Gia_Zip_t *)Vec_PtrPop(p->vGiaUndo) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Deletes the saved AIGs.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_FrameGiaUndoClear( Abc_Frame_t * p )
+{
+    Gia_Zip_t * pZip; int i;
+    if ( p->vGiaUndo == NULL )
+        return;
+    Vec_PtrForEachEntry( Gia_Zip_t *, p->vGiaUndo, pZip, i )
+        Gia_ZipFree( pZip );
+    Vec_PtrFreeP( &p->vGiaUndo );
 }
 
 /**Function*************************************************************
@@ -96,6 +96,7 @@ struct Abc_Frame_t_
     void *          pManDec;       // decomposition manager
     void *          pManDsd;       // decomposition manager
     void *          pManDsd2;      // decomposition manager
+    void *          pCnfCache;     // CNF clauses shared by SAT-based commands
     // libraries for mapping
     void *          pLibLut;       // the current LUT library
     void *          pLibBox;       // the current box library
@@ -117,6 +118,8 @@ struct Abc_Frame_t_
     Gia_Man_t *     pGiaBest;      // copy of the above
     Gia_Man_t *     pGiaBest2;     // copy of the above
     Gia_Man_t *     pGiaSaved;     // copy of the above
+    Vec_Ptr_t *     vGiaUndo;      // compressed earlier copies (the oldest first)
+    int             nGiaUndo;      // the max number of compressed copies
     int             nBestLuts;     // best LUT count
     int             nBestEdges;    // best edge count
     int             nBestLevels;   // best level count
@@ -162,6 +165,8 @@ struct Abc_Frame_t_
     int *           pBoxes;
     void *          pNdr;
     int *           pNdrArray;
+    Vec_Int_t *     vOrchData[ABC_ORCH_DATA_NUM]; // orchestration data exchanged with the driver
+    int             pOrchCols[ABC_ORCH_DATA_NUM]; // the number of entries per row
 
     Abc_Frame_Callback_BmcFrameDone_Func pFuncOnFrameDone;
 };
@@ -202,6 +207,9 @@ extern ABC_DLL void            Abc_FrameAddInitializer( Abc_FrameInitializer_t*
 /*=== mvFrame.c =====================================================*/
 extern ABC_DLL Abc_Frame_t *   Abc_FrameAllocate();
 extern ABC_DLL void            Abc_FrameDeallocate( Abc_Frame_t * p );
+extern ABC_DLL void            Abc_FrameGiaUndoPush( Abc_Frame_t * p, Gia_Man_t * pGia );
+extern ABC_DLL Gia_Man_t *     Abc_FrameGiaUndoPop( Abc_Frame_t * p );
+extern ABC_DLL void            Abc_FrameGiaUndoClear( Abc_Frame_t * p );
 /*=== mvUtils.c =====================================================*/
 extern ABC_DLL char *          Abc_UtilsGetVersion( Abc_Frame_t * pAbc );
 extern ABC_DLL char *          Abc_UtilsGetUsersInput( Abc_Frame_t * pAbc );
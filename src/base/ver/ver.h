@@ -69,6 +69,7 @@ struct Ver_Man_t_
     Vec_Ptr_t *     vStackFn;
     Vec_Int_t *     vStackOp;
     Vec_Int_t *     vPerm;
+    Vec_Ptr_t *     vDefined;      // the modules defined in the file (used by the parallel parser)
 };
 
 
@@ -86,15 +87,22 @@ struct Ver_Man_t_
 
 /*=== verCore.c ========================================================*/
 extern Abc_Des_t *    Ver_ParseFile( char * pFileName, Abc_Des_t * pGateLib, int fCheck, int fUseMemMan );
+extern Ver_Man_t *    Ver_ParseStartStream( char * pFileName, Ver_Stream_t * pReader, Abc_Des_t * pGateLib );
+extern void           Ver_ParseStop( Ver_Man_t * p );
+extern int            Ver_ParseModule( Ver_Man_t * p );
+extern int            Ver_ParseAttachBoxes( Ver_Man_t * pMan );
 extern void           Ver_ParsePrintErrorMessage( Ver_Man_t * p );
 /*=== verFormula.c ========================================================*/
 extern void *         Ver_FormulaParser( char * pFormula, void * pMan, Vec_Ptr_t * vNames, Vec_Ptr_t * vStackFn, Vec_Int_t * vStackOp, char * pErrorMessage );
 extern void *         Ver_FormulaReduction( char * pFormula, void * pMan, Vec_Ptr_t * vNames, char * pErrorMessage );
+/*=== verPar.c ========================================================*/
+extern Abc_Des_t *    Ver_ParseFilePar( char * pFileName, Abc_Des_t * pGateLib, int fCheck, int fUseMemMan, int nThreads, int fVerbose );
 /*=== verParse.c ========================================================*/
 extern int            Ver_ParseSkipComments( Ver_Man_t * p );
 extern char *         Ver_ParseGetName( Ver_Man_t * p );
 /*=== verStream.c ========================================================*/
 extern Ver_Stream_t * Ver_StreamAlloc( char * pFileName );
+extern Ver_Stream_t * Ver_StreamAllocMem( char * pFileName, char * pBeg, char * pEnd, int LineBeg );
 extern void           Ver_StreamFree( Ver_Stream_t * p );
 extern char *         Ver_StreamGetFileName( Ver_Stream_t * p );
 extern int            Ver_StreamGetFileSize( Ver_Stream_t * p );
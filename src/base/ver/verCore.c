@@ -52,10 +52,8 @@ typedef enum {
 } Ver_GateType_t;
 
 static Ver_Man_t * Ver_ParseStart( char * pFileName, Abc_Des_t * pGateLib );
-static void Ver_ParseStop( Ver_Man_t * p );
 static void Ver_ParseFreeData( Ver_Man_t * p );
 static void Ver_ParseInternal( Ver_Man_t * p );
-static int  Ver_ParseModule( Ver_Man_t * p );
 static int  Ver_ParseSignal( Ver_Man_t * p, Abc_Ntk_t * pNtk, Ver_SignalType_t SigType );
 static int  Ver_ParseAlways( Ver_Man_t * p, Abc_Ntk_t * pNtk );
 static int  Ver_ParseInitial( Ver_Man_t * p, Abc_Ntk_t * pNtk );
@@ -65,7 +63,6 @@ static int  Ver_ParseFlopStandard( Ver_Man_t * pMan, Abc_Ntk_t * pNtk );
 static int  Ver_ParseGate( Ver_Man_t * p, Abc_Ntk_t * pNtk, Mio_Gate_t * pGate );
 static int  Ver_ParseBox( Ver_Man_t * pMan, Abc_Ntk_t * pNtk, Abc_Ntk_t * pNtkBox );
 static int  Ver_ParseConnectBox( Ver_Man_t * pMan, Abc_Obj_t * pBox );
-static int  Ver_ParseAttachBoxes( Ver_Man_t * pMan );
 
 static Abc_Obj_t * Ver_ParseCreatePi( Abc_Ntk_t * pNtk, char * pName );
 static Abc_Obj_t * Ver_ParseCreatePo( Abc_Ntk_t * pNtk, char * pName );
@@ -102,17 +99,32 @@ struct Ver_Bundle_t_
 
 ***********************************************************************/
 Ver_Man_t * Ver_ParseStart( char * pFileName, Abc_Des_t * pGateLib )
+{
+    Ver_Stream_t * pReader = Ver_StreamAlloc( pFileName );
+    if ( pReader == NULL )
+        return NULL;
+    return Ver_ParseStartStream( pFileName, pReader, pGateLib );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Start parser for the given stream.]
+
+  Description [The stream can be NULL if the parser is only used 
+  to process the hierarchy.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Ver_Man_t * Ver_ParseStartStream( char * pFileName, Ver_Stream_t * pReader, Abc_Des_t * pGateLib )
 {
     Ver_Man_t * p;
     p = ABC_ALLOC( Ver_Man_t, 1 );
     memset( p, 0, sizeof(Ver_Man_t) );
     p->pFileName = pFileName;
-    p->pReader   = Ver_StreamAlloc( pFileName );
-    if ( p->pReader == NULL )
-    {
-        ABC_FREE( p );
-        return NULL;
-    }
+    p->pReader   = pReader;
     p->Output    = stdout;
     p->vNames    = Vec_PtrAlloc( 100 );
     p->vStackFn  = Vec_PtrAlloc( 100 );
@@ -143,7 +155,10 @@ void Ver_ParseStop( Ver_Man_t * p )
 {
     if ( p->pProgress )
         Extra_ProgressBarStop( p->pProgress );
-    Ver_StreamFree( p->pReader );
+    if ( p->pReader )
+        Ver_StreamFree( p->pReader );
+    if ( p->vDefined )
+        Vec_PtrFree( p->vDefined );
     Vec_PtrFree( p->vNames   );
     Vec_PtrFree( p->vStackFn );
     Vec_IntFree( p->vStackOp );
@@ -168,6 +183,8 @@ Abc_Des_t * Ver_ParseFile( char * pFileName, Abc_Des_t * pGateLib, int fCheck, i
     Abc_Des_t * pDesign;
     // start the parser
     p = Ver_ParseStart( pFileName, pGateLib );
+    if ( p == NULL )
+        return NULL;
     p->fMapped    = glo_fMapped;
     p->fCheck     = fCheck;
     p->fUseMemMan = fUseMemMan;
@@ -411,6 +428,8 @@ int Ver_ParseModule( Ver_Man_t * pMan )
 
     // get the network with this name
     pNtk = Ver_ParseFindOrCreateNetwork( pMan, pWord );
+    if ( pMan->vDefined )
+        Vec_PtrPush( pMan->vDefined, pNtk );
 
     // make sure we stopped at the opening parenthesis
     if ( Ver_StreamPopChar(p) != '(' )
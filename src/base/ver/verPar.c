@@ -0,0 +1,553 @@
+/**CFile****************************************************************
+
+  FileName    [verPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Verilog parser.]
+
+  Synopsis    [Parallel parser of structural Verilog.]
+
+  Author      [Berkeley Logic Synthesis and Verification Group]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "ver.h"
+#include "base/main/main.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define VER_PAR_THR_MAX 64
+
+// the part of the file parsed by one thread
+// the part always starts with a module (or at the beginning of the file)
+// and ends before the next part, so it contains only complete modules
+typedef struct Ver_ParChunk_t_ Ver_ParChunk_t;
+struct Ver_ParChunk_t_
+{
+    char *           pBeg;       // the first character
+    char *           pEnd;       // the character after the last one
+    int              LineBeg;    // the number of lines before the chunk
+    int              nModules;   // the number of modules in the chunk
+    Ver_Man_t *      pMan;       // the parser with its own design
+    int              fOk;        // the chunk is parsed successfully
+    abctime          Time;       // the parsing time
+};
+
+static inline int Ver_ParIsIdChar( char c ) { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || (c >= '0' && c <= '9') || c == '_' || c == '$'; }
+
+extern int glo_fMapped;
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the file into memory.]
+
+  Description [The buffer is terminated by zero.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static char * Ver_ParReadFile( char * pFileName, iword * pnBytes )
+{
+    char * pBuffer;
+    FILE * pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    fseek( pFile, 0, SEEK_END );
+    *pnBytes = (iword)ftell( pFile );
+    rewind( pFile );
+    pBuffer = ABC_ALLOC( char, *pnBytes + 1 );
+    if ( *pnBytes > 0 && fread( pBuffer, (size_t)*pnBytes, 1, pFile ) != 1 )
+        ABC_FREE( pBuffer );
+    else
+        pBuffer[*pnBytes] = 0;
+    fclose( pFile );
+    return pBuffer;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds the beginnings of the modules.]
+
+  Description [Collects the offsets of the keywords "module" appearing
+  outside of comments, strings, and escaped identifiers, and the numbers
+  of lines before them.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Ver_ParIndexModules( char * pBuffer, char * pLimit, Vec_Wrd_t * vBegs, Vec_Int_t * vLines )
+{
+    char * pCur = pBuffer, * pTemp;
+    int nLines = 0;
+    while ( pCur < pLimit )
+    {
+        if ( *pCur == '\n' )
+            nLines++, pCur++;
+        else if ( pCur[0] == '/' && pCur[1] == '/' )
+        {
+            while ( pCur < pLimit && *pCur != '\n' )
+                pCur++;
+        }
+        else if ( pCur[0] == '/' && pCur[1] == '*' )
+        {
+            for ( pCur += 2; pCur < pLimit && !(pCur[0] == '*' && pCur[1] == '/'); pCur++ )
+                if ( *pCur == '\n' )
+                    nLines++;
+            pCur += 2;
+        }
+        else if ( *pCur == '\"' )
+        {
+            for ( pCur++; pCur < pLimit && *pCur != '\"'; pCur++ )
+                if ( *pCur == '\n' )
+                    nLines++;
+            pCur++;
+        }
+        else if ( *pCur == '\\' )
+        {
+            while ( pCur < pLimit && *pCur != ' ' && *pCur != '\t' && *pCur != '\r' && *pCur != '\n' )
+                pCur++;
+        }
+        else if ( Ver_ParIsIdChar(*pCur) )
+        {
+            for ( pTemp = pCur; pCur < pLimit && Ver_ParIsIdChar(*pCur); pCur++ );
+            if ( pCur - pTemp == 6 && !strncmp(pTemp, "module", 6) )
+            {
+                Vec_WrdPush( vBegs, (word)(pTemp - pBuffer) );
+                Vec_IntPush( vLines, nLines );
+            }
+        }
+        else
+            pCur++;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Splits the file into chunks of similar size.]
+
+  Description [Each chunk contains complete modules. Returns the number
+  of chunks.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Ver_ParSplit( char * pBuffer, iword nBytes, Vec_Wrd_t * vBegs, Vec_Int_t * vLines, Ver_ParChunk_t * pChunks, int nChunksMax )
+{
+    iword Target = nBytes / nChunksMax + 1;
+    int i, nChunks = 1;
+    pChunks[0].pBeg     = pBuffer;
+    pChunks[0].LineBeg  = 0;
+    pChunks[0].nModules = 0;
+    for ( i = 0; i < Vec_WrdSize(vBegs); i++ )
+    {
+        if ( i > 0 && nChunks < nChunksMax && (iword)Vec_WrdEntry(vBegs, i) >= nChunks * Target )
+        {
+            pChunks[nChunks-1].pEnd = pBuffer + Vec_WrdEntry(vBegs, i);
+            pChunks[nChunks].pBeg     = pBuffer + Vec_WrdEntry(vBegs, i);
+            pChunks[nChunks].LineBeg  = Vec_IntEntry(vLines, i);
+            pChunks[nChunks].nModules = 0;
+            nChunks++;
+        }
+        pChunks[nChunks-1].nModules++;
+    }
+    pChunks[nChunks-1].pEnd = pBuffer + nBytes;
+    return nChunks;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parses the modules of one chunk.]
+
+  Description [Mirrors the module loop of Ver_ParseInternal(). Boxes
+  instantiating modules of other chunks point to the placeholders
+  in the design of this chunk.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Ver_ParParseChunk( Ver_ParChunk_t * p )
+{
+    Ver_Man_t * pMan = p->pMan;
+    abctime clk = Abc_Clock();
+    char * pToken;
+    p->fOk = 0;
+    while ( 1 )
+    {
+        // get the next token
+        pToken = Ver_ParseGetName( pMan );
+        if ( pToken == NULL )
+            break;
+        if ( strcmp( pToken, "module" ) )
+        {
+            sprintf( pMan->sError, "Cannot read \"module\" directive." );
+            Ver_ParsePrintErrorMessage( pMan );
+            break;
+        }
+        // parse the module
+        if ( !Ver_ParseModule(pMan) )
+            break;
+    }
+    p->fOk = !pMan->fError && pMan->pDesign && !Ver_StreamIsOkey(pMan->pReader);
+    p->Time = Abc_Clock() - clk;
+}
+
+#ifdef ABC_USE_PTHREADS
+static void * Ver_ParWorkerThread( void * pArg )
+{
+    Ver_ParParseChunk( (Ver_ParChunk_t *)pArg );
+    return NULL;
+}
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the module that replaced the given one.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline Abc_Ntk_t * Ver_ParModuleFinal( Abc_Ntk_t * pNtk )
+{
+    while ( pNtk->pCopy != pNtk )
+        pNtk = pNtk->pCopy;
+    return pNtk;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Moves the modules of the chunk into the design.]
+
+  Description [The modules are added in the order of their first mention,
+  as done by the serial parser. A placeholder is replaced by the module
+  definition coming later. The functions of the nodes are transferred
+  into the AIG manager of the design. The replaced modules are collected
+  in vDead, and their pCopy points to the module replacing them.
+  The defined modules are marked by fHieVisited. Returns 0 if a module
+  is defined in two chunks.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Ver_ParMergeChunk( Abc_Des_t * pDesign, Ver_Man_t * pMan, Vec_Ptr_t * vDead )
+{
+    Abc_Des_t * pLocal = pMan->pDesign;
+    Abc_Ntk_t * pNtk, * pOld;
+    Abc_Obj_t * pObj;
+    const char * pKey;
+    int i, k;
+    Vec_PtrForEachEntry( Abc_Ntk_t *, pMan->vDefined, pNtk, i )
+        pNtk->fHieVisited = 1;
+    Vec_PtrForEachEntry( Abc_Ntk_t *, pLocal->vModules, pNtk, i )
+    {
+        pOld = Abc_DesFindModelByName( pDesign, pNtk->pName );
+        if ( pOld && pOld->fHieVisited && pNtk->fHieVisited )
+        {
+            printf( "Module \"%s\" is defined more than once.\n", pNtk->pName );
+            // keep the remaining modules in the design of the chunk
+            for ( k = i; k < Vec_PtrSize(pLocal->vModules); k++ )
+                Vec_PtrWriteEntry( pLocal->vModules, k - i, Vec_PtrEntry(pLocal->vModules, k) );
+            Vec_PtrShrink( pLocal->vModules, Vec_PtrSize(pLocal->vModules) - i );
+            return 0;
+        }
+        pNtk->pDesign = NULL;
+        // transfer the functions
+        if ( pNtk->ntkFunc == ABC_FUNC_AIG && pNtk->pManFunc == pLocal->pManFunc )
+        {
+            Abc_NtkForEachNode( pNtk, pObj, k )
+                pObj->pData = Hop_Transfer( (Hop_Man_t *)pLocal->pManFunc, (Hop_Man_t *)pDesign->pManFunc, (Hop_Obj_t *)pObj->pData, Abc_ObjFaninNum(pObj) );
+            pNtk->pManFunc = pDesign->pManFunc;
+        }
+        if ( pOld == NULL )
+        {
+            pNtk->Id = 0;
+            Abc_DesAddModel( pDesign, pNtk );
+            pNtk->pCopy = pNtk;
+        }
+        else if ( !pNtk->fHieVisited )
+        {
+            Vec_PtrPush( vDead, pNtk );
+            pNtk->pCopy = pOld;
+        }
+        else
+        {
+            // replace the placeholder by the definition
+            pKey = pOld->pName;
+            st__delete( pDesign->tModules, &pKey, NULL );
+            st__insert( pDesign->tModules, pNtk->pName, (char *)pNtk );
+            Vec_PtrWriteEntry( pDesign->vModules, pOld->Id, pNtk );
+            pNtk->Id = pOld->Id;
+            pNtk->pDesign = pDesign;
+            pNtk->pCopy = pNtk;
+            pOld->pCopy = pNtk;
+            pOld->pDesign = NULL;
+            Vec_PtrPush( vDead, pOld );
+        }
+    }
+    Vec_PtrClear( pLocal->vModules );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Frees the modules collected during merging.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Ver_ParFreeDead( Vec_Ptr_t * vDead )
+{
+    Abc_Ntk_t * pNtk;
+    int i;
+    Vec_PtrForEachEntry( Abc_Ntk_t *, vDead, pNtk, i )
+    {
+        assert( pNtk->ntkFunc == ABC_FUNC_BLACKBOX );
+        pNtk->pDesign = NULL;
+        Abc_NtkDelete( pNtk );
+    }
+    Vec_PtrClear( vDead );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Parallel file parser.]
+
+  Description [Reads the file, indexes the module boundaries, and splits
+  the file into nThreads chunks with complete modules. The chunks are
+  parsed in parallel, each into its own design. The designs are merged
+  and the hierarchy is resolved as in Ver_ParseFile(), which is called
+  if the modules cannot be merged.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Des_t * Ver_ParseFilePar( char * pFileName, Abc_Des_t * pGateLib, int fCheck, int fUseMemMan, int nThreads, int fVerbose )
+{
+    Ver_ParChunk_t Chunks[VER_PAR_THR_MAX];
+    Abc_Des_t * pDesign = NULL;
+    Ver_Man_t * pMan;
+    Vec_Wrd_t * vBegs;
+    Vec_Int_t * vLines;
+    Vec_Ptr_t * vDead;
+    Abc_Ntk_t * pNtk;
+    Abc_Obj_t * pObj;
+    char * pBuffer;
+    iword nBytes = 0;
+    int i, k, c, nChunks, fError = 0, fMerged = 1;
+    abctime clk, clkTotal = Abc_Clock(), clkParse = 0;
+    nThreads = Abc_MaxInt( 1, Abc_MinInt(nThreads, VER_PAR_THR_MAX) );
+    // read the file and index the modules
+    clk = Abc_Clock();
+    pBuffer = Ver_ParReadFile( pFileName, &nBytes );
+    if ( pBuffer == NULL )
+    {
+        printf( "Ver_ParseFilePar(): Cannot read the input file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    if ( fVerbose )
+        Abc_PrintTime( 1, "Reading file  ", Abc_Clock() - clk );
+    clk = Abc_Clock();
+    vBegs  = Vec_WrdAlloc( 1000 );
+    vLines = Vec_IntAlloc( 1000 );
+    Ver_ParIndexModules( pBuffer, pBuffer + nBytes, vBegs, vLines );
+    if ( Vec_WrdSize(vBegs) == 0 )
+    {
+        Vec_WrdFree( vBegs );
+        Vec_IntFree( vLines );
+        ABC_FREE( pBuffer );
+        return Ver_ParseFile( pFileName, pGateLib, fCheck, fUseMemMan );
+    }
+    nChunks = Ver_ParSplit( pBuffer, nBytes, vBegs, vLines, Chunks, nThreads );
+    if ( fVerbose )
+    {
+        printf( "File size = %.2f MB. Modules = %d. Chunks = %d.  ", 1.0*nBytes/(1<<20), Vec_WrdSize(vBegs), nChunks );
+        Abc_PrintTime( 1, "Indexing", Abc_Clock() - clk );
+    }
+    Vec_WrdFree( vBegs );
+    Vec_IntFree( vLines );
+    // parse the chunks
+    clk = Abc_Clock();
+    for ( c = 0; c < nChunks; c++ )
+    {
+        Chunks[c].pMan = Ver_ParseStartStream( pFileName, Ver_StreamAllocMem(pFileName, Chunks[c].pBeg, Chunks[c].pEnd, Chunks[c].LineBeg), pGateLib );
+        Chunks[c].pMan->fMapped    = glo_fMapped;
+        Chunks[c].pMan->fCheck     = fCheck;
+        Chunks[c].pMan->fUseMemMan = fUseMemMan;
+        Chunks[c].pMan->vDefined   = Vec_PtrAlloc( 100 );
+        if ( glo_fMapped )
+        {
+            Hop_ManStop( (Hop_Man_t *)Chunks[c].pMan->pDesign->pManFunc );
+            Chunks[c].pMan->pDesign->pManFunc = NULL;
+        }
+    }
+#ifdef ABC_USE_PTHREADS
+    if ( nChunks > 1 )
+    {
+        pthread_t WorkerThread[VER_PAR_THR_MAX];
+        for ( c = 0; c < nChunks; c++ )
+        {
+            int status = pthread_create( WorkerThread + c, NULL, Ver_ParWorkerThread, (void *)(Chunks + c) );
+            assert( status == 0 );
+        }
+        for ( c = 0; c < nChunks; c++ )
+            pthread_join( WorkerThread[c], NULL );
+    }
+    else
+#endif
+    for ( c = 0; c < nChunks; c++ )
+        Ver_ParParseChunk( Chunks + c );
+    for ( c = 0; c < nChunks; c++ )
+    {
+        fError |= !Chunks[c].fOk;
+        clkParse = Abc_MaxInt( clkParse, Chunks[c].Time );
+    }
+    if ( fVerbose )
+    {
+        for ( c = 0; c < nChunks; c++ )
+        {
+            printf( "Chunk %2d : Size = %8.2f MB. Modules = %6d.  ", c, 1.0*(Chunks[c].pEnd - Chunks[c].pBeg)/(1<<20), Chunks[c].nModules );
+            Abc_PrintTime( 1, "Time", Chunks[c].Time );
+        }
+        Abc_PrintTime( 1, "Parsing       ", Abc_Clock() - clk );
+    }
+    // merge the designs
+    clk = Abc_Clock();
+    vDead = Vec_PtrAlloc( 100 );
+    if ( !fError )
+    {
+        pDesign = Abc_DesCreate( pFileName );
+        pDesign->pLibrary = pGateLib;
+        pDesign->pGenlib  = Abc_FrameReadLibGen();
+        if ( glo_fMapped )
+        {
+            Hop_ManStop( (Hop_Man_t *)pDesign->pManFunc );
+            pDesign->pManFunc = NULL;
+        }
+        for ( c = 0; c < nChunks && fMerged; c++ )
+            fMerged = Ver_ParMergeChunk( pDesign, Chunks[c].pMan, vDead );
+        // point the boxes to the final modules
+        if ( fMerged )
+        {
+            Vec_PtrForEachEntry( Abc_Ntk_t *, pDesign->vModules, pNtk, i )
+                Abc_NtkForEachBlackbox( pNtk, pObj, k )
+                    if ( pObj->pData )
+                        pObj->pData = Ver_ParModuleFinal( (Abc_Ntk_t *)pObj->pData );
+        }
+        Vec_PtrForEachEntry( Abc_Ntk_t *, pDesign->vModules, pNtk, i )
+            pNtk->pCopy = NULL, pNtk->fHieVisited = 0;
+        Ver_ParFreeDead( vDead );
+        if ( !fMerged )
+        {
+            Abc_DesFree( pDesign, NULL );
+            pDesign = NULL;
+        }
+    }
+    Vec_PtrFree( vDead );
+    for ( c = 0; c < nChunks; c++ )
+    {
+        if ( Chunks[c].pMan->pDesign )
+            Abc_DesFree( Chunks[c].pMan->pDesign, NULL );
+        Ver_ParseStop( Chunks[c].pMan );
+    }
+    ABC_FREE( pBuffer );
+    if ( fVerbose && pDesign )
+        Abc_PrintTime( 1, "Merging       ", Abc_Clock() - clk );
+    if ( fError )
+        return NULL;
+    if ( !fMerged )
+    {
+        printf( "Ver_ParseFilePar(): Using the serial parser.\n" );
+        return Ver_ParseFile( pFileName, pGateLib, fCheck, fUseMemMan );
+    }
+    // process defined and undefined boxes
+    clk = Abc_Clock();
+    pMan = Ver_ParseStartStream( pFileName, NULL, pGateLib );
+    Abc_DesFree( pMan->pDesign, NULL );
+    pMan->pDesign   = pDesign;
+    pMan->fMapped   = glo_fMapped;
+    pMan->fCheck    = fCheck;
+    pMan->fTopLevel = 1;
+    if ( Ver_ParseAttachBoxes( pMan ) )
+    {
+        if ( fVerbose )
+            Abc_PrintTime( 1, "Hierarchy     ", Abc_Clock() - clk );
+        // connect the boxes and check
+        clk = Abc_Clock();
+        Vec_PtrForEachEntry( Abc_Ntk_t *, pMan->pDesign->vModules, pNtk, i )
+        {
+            // fix the dangling nets
+            Abc_NtkFinalizeRead( pNtk );
+            // check the network for correctness
+            if ( pMan->fCheck && !Abc_NtkCheckRead( pNtk ) )
+            {
+                sprintf( pMan->sError, "The network check has failed for network %s.", pNtk->pName );
+                Ver_ParsePrintErrorMessage( pMan );
+                break;
+            }
+        }
+        if ( fVerbose && pMan->pDesign )
+            Abc_PrintTime( 1, "Checking      ", Abc_Clock() - clk );
+    }
+    // save the result
+    pDesign = pMan->pDesign;
+    pMan->pDesign = NULL;
+    Ver_ParseStop( pMan );
+    if ( fVerbose )
+    {
+        printf( "The slowest of %d chunks is parsed in %.2f sec.  ", nChunks, 1.0*clkParse/CLOCKS_PER_SEC );
+        Abc_PrintTime( 1, "Total", Abc_Clock() - clkTotal );
+    }
+    return pDesign;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -52,6 +52,7 @@ struct Ver_Stream_t_
     int              nChars;        // the total number of characters in the word
     // status of the parser
     int              fStop;         // this flag goes high when the end of file is reached
+    int              fMemory;       // the buffer is given by the user and is not freed
 };
 
 static void Ver_StreamReload( Ver_Stream_t * p );
@@ -110,6 +111,37 @@ Ver_Stream_t * Ver_StreamAlloc( char * pFileName )
     return p;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Starts the reader for the given part of the file in memory.]
+
+  Description [The characters from pBeg to pEnd are read without copying.
+  The character at pEnd should be readable. LineBeg is the number of lines 
+  in the file before pBeg, which is used to report errors.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Ver_Stream_t * Ver_StreamAllocMem( char * pFileName, char * pBeg, char * pEnd, int LineBeg )
+{
+    Ver_Stream_t * p;
+    p = ABC_ALLOC( Ver_Stream_t, 1 );
+    memset( p, 0, sizeof(Ver_Stream_t) );
+    p->pFileName    = pFileName;
+    p->fMemory      = 1;
+    p->nFileSize    = pEnd - pBeg;
+    p->nFileRead    = pEnd - pBeg;
+    p->nBufferSize  = pEnd - pBeg;
+    p->pBuffer      = pBeg;
+    p->pBufferCur   = pBeg;
+    p->pBufferEnd   = pEnd;
+    p->pBufferStop  = pEnd;
+    p->nLineCounter = LineBeg + 1; // 1-based line counting
+    return p;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Loads new data into the file reader.]
@@ -158,7 +190,8 @@ void Ver_StreamFree( Ver_Stream_t * p )
 {
     if ( p->pFile )
         fclose( p->pFile );
-    ABC_FREE( p->pBuffer );
+    if ( !p->fMemory )
+        ABC_FREE( p->pBuffer );
     ABC_FREE( p );
 }
 
@@ -0,0 +1,43 @@
+#ifndef ABC__ext_lsv__lsv_h
+#define ABC__ext_lsv__lsv_h
+
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+#include "aig/gia/gia.h"
+#include "base/abc/abc.h"
+
+ABC_NAMESPACE_HEADER_START
+
+// The largest cut size supported by the cut engine. Leaves are kept in
+// fixed-size slots of the arena, so this bounds the arena stride.
+#define LSV_CUT_LEAF_MAX 8
+
+struct Lsv_CutPar_t {
+  int nLeafMax;   // the cut size (k)
+  int nThreads;   // the number of worker threads (1 = serial)
+  int fStream;    // print cuts level by level and free them when no longer used
+  int fVerbose;   // print statistics
+};
+
+// An AND graph flattened into integer arrays, indexed by object ID.
+// CIs have both fanins equal to -1; the constant node has no cuts.
+struct Lsv_CutGraph_t {
+  std::vector<int> vFanin0;
+  std::vector<int> vFanin1;
+  std::vector<int> vLevel;
+  std::vector<int> vFanoutLevel;  // the largest level of a fanout (-1 if none)
+  std::vector<int> vPrint;        // 1 if the object's cuts are printed
+  int nLevels = 0;
+};
+
+extern void Lsv_CutSetDefaultParams(Lsv_CutPar_t* pPars);
+extern int Lsv_CutGraphFromNtk(Abc_Ntk_t* pNtk, Lsv_CutGraph_t* pGraph);
+extern int Lsv_CutGraphFromGia(Gia_Man_t* p, Lsv_CutGraph_t* pGraph);
+extern int Lsv_CutEnumerate(Lsv_CutGraph_t* pGraph, Lsv_CutPar_t* pPars,
+                            FILE* pFile);
+
+ABC_NAMESPACE_HEADER_END
+
+#endif
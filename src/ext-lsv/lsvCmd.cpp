@@ -1,11 +1,14 @@
 #include "base/abc/abc.h"
 #include "base/main/main.h"
 #include "base/main/mainInt.h"
+#include "ext-lsv/lsv.h"
 
 static int Lsv_CommandPrintNodes(Abc_Frame_t* pAbc, int argc, char** argv);
+static int Lsv_CommandPrintCut(Abc_Frame_t* pAbc, int argc, char** argv);
 
 void init(Abc_Frame_t* pAbc) {
   Cmd_CommandAdd(pAbc, "LSV", "lsv_print_nodes", Lsv_CommandPrintNodes, 0);
+  Cmd_CommandAdd(pAbc, "LSV", "lsv_printcut", Lsv_CommandPrintCut, 0);
 }
 
 void destroy(Abc_Frame_t* pAbc) {}
@@ -57,4 +60,85 @@ usage:
   Abc_Print(-2, "\t        prints the nodes in the network\n");
   Abc_Print(-2, "\t-h    : print the command usage\n");
   return 1;
-}
\ No newline at end of file
+}
+
+int Lsv_CommandPrintCut(Abc_Frame_t* pAbc, int argc, char** argv) {
+  Abc_Ntk_t* pNtk = Abc_FrameReadNtk(pAbc);
+  Lsv_CutPar_t Pars, *pPars = &Pars;
+  Lsv_CutGraph_t Graph;
+  int c, fUseGia = 0;
+  Lsv_CutSetDefaultParams(pPars);
+  Extra_UtilGetoptReset();
+  while ((c = Extra_UtilGetopt(argc, argv, "Tgsvh")) != EOF) {
+    switch (c) {
+      case 'T':
+        if (globalUtilOptind >= argc) {
+          Abc_Print(-1, "Command line switch \"-T\" should be followed by an integer.\n");
+          goto usage;
+        }
+        pPars->nThreads = atoi(argv[globalUtilOptind]);
+        globalUtilOptind++;
+        if (pPars->nThreads < 1) goto usage;
+        break;
+      case 'g':
+        fUseGia ^= 1;
+        break;
+      case 's':
+        pPars->fStream ^= 1;
+        break;
+      case 'v':
+        pPars->fVerbose ^= 1;
+        break;
+      case 'h':
+        goto usage;
+      default:
+        goto usage;
+    }
+  }
+  if (globalUtilOptind + 1 != argc) {
+    Abc_Print(-1, "The cut size should be given on the command line.\n");
+    goto usage;
+  }
+  pPars->nLeafMax = atoi(argv[globalUtilOptind]);
+  if (pPars->nLeafMax < 1 || pPars->nLeafMax > LSV_CUT_LEAF_MAX) {
+    Abc_Print(-1, "The cut size should be between 1 and %d.\n", LSV_CUT_LEAF_MAX);
+    return 1;
+  }
+  if (fUseGia) {
+    if (!pAbc->pGia) {
+      Abc_Print(-1, "Empty GIA network.\n");
+      return 1;
+    }
+    if (!Lsv_CutGraphFromGia(pAbc->pGia, &Graph)) {
+      Abc_Print(-1, "The GIA contains a combinational loop.\n");
+      return 1;
+    }
+  } else {
+    if (!pNtk) {
+      Abc_Print(-1, "Empty network.\n");
+      return 1;
+    }
+    if (!Abc_NtkIsStrash(pNtk)) {
+      Abc_Print(-1, "The network should be an AIG (run \"strash\").\n");
+      return 1;
+    }
+    if (!Lsv_CutGraphFromNtk(pNtk, &Graph)) {
+      Abc_Print(-1, "The network contains a combinational loop.\n");
+      return 1;
+    }
+  }
+  fflush(stdout);
+  Lsv_CutEnumerate(&Graph, pPars, stdout);
+  return 0;
+
+usage:
+  Abc_Print(-2, "usage: lsv_printcut [-T num] [-gsvh] <k>\n");
+  Abc_Print(-2, "\t        enumerates the k-feasible cuts of every node in the AIG\n");
+  Abc_Print(-2, "\t-T num : the number of threads [default = %d]\n", pPars->nThreads);
+  Abc_Print(-2, "\t-g     : toggle using the GIA manager (&-space) [default = %s]\n", fUseGia ? "yes" : "no");
+  Abc_Print(-2, "\t-s     : toggle streaming output level by level [default = %s]\n", pPars->fStream ? "yes" : "no");
+  Abc_Print(-2, "\t-v     : toggle printing statistics [default = %s]\n", pPars->fVerbose ? "yes" : "no");
+  Abc_Print(-2, "\t-h     : print the command usage\n");
+  Abc_Print(-2, "\t<k>    : the cut size (1 <= k <= %d)\n", LSV_CUT_LEAF_MAX);
+  return 1;
+}
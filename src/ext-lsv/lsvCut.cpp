@@ -0,0 +1,458 @@
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include "ext-lsv/lsv.h"
+
+ABC_NAMESPACE_IMPL_START
+
+// Cuts are stored in flat per-level arenas. Each cut occupies a slot of
+// (1 + nLeafMax) integers: the number of leaves followed by the leaves in
+// increasing order. A parallel array keeps the 64-bit signature of each cut,
+// which is used to reject merges and dominance checks without touching leaves.
+struct Lsv_CutLevel_t {
+  std::vector<int> vCuts;
+  std::vector<uint64_t> vSigs;
+  int LastUse = -1;  // the last level that reads cuts of this level
+};
+
+struct Lsv_CutNode_t {
+  int Offset = 0;  // the first cut (in slots) in the level arena
+  int nCuts = 0;
+};
+
+// The output of one chunk of nodes computed by a worker.
+struct Lsv_CutChunk_t {
+  std::vector<int> vCuts;
+  std::vector<uint64_t> vSigs;
+  std::vector<int> vCounts;
+};
+
+struct Lsv_CutMan_t {
+  Lsv_CutGraph_t* pGraph;
+  Lsv_CutPar_t* pPars;
+  int nStride;
+  std::vector<Lsv_CutLevel_t> vLevels;
+  std::vector<Lsv_CutNode_t> vNodes;
+  std::vector<std::vector<int>> vLevelNodes;
+  long nCutsTotal = 0;
+  long nMergesTried = 0;
+  long nMergesSigSkip = 0;
+};
+
+// A minimal fork-join pool: Run() executes the job on all workers and on the
+// calling thread, and returns when every participant has finished.
+class Lsv_ThreadPool {
+ public:
+  explicit Lsv_ThreadPool(int nThreads) {
+    for (int i = 1; i < nThreads; i++)
+      vWorkers.emplace_back([this, i] { Loop(i); });
+  }
+  ~Lsv_ThreadPool() {
+    {
+      std::lock_guard<std::mutex> Lock(Mutex);
+      fStop = true;
+      Generation++;
+    }
+    CondStart.notify_all();
+    for (auto& Worker : vWorkers) Worker.join();
+  }
+  int Size() const { return (int)vWorkers.size() + 1; }
+  void Run(const std::function<void(int)>& Job) {
+    if (vWorkers.empty()) {
+      Job(0);
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> Lock(Mutex);
+      pJob = &Job;
+      nPending = (int)vWorkers.size();
+      Generation++;
+    }
+    CondStart.notify_all();
+    Job(0);
+    std::unique_lock<std::mutex> Lock(Mutex);
+    CondDone.wait(Lock, [this] { return nPending == 0; });
+    pJob = nullptr;
+  }
+
+ private:
+  void Loop(int iThread) {
+    long Seen = 0;
+    while (true) {
+      const std::function<void(int)>* pCur;
+      {
+        std::unique_lock<std::mutex> Lock(Mutex);
+        CondStart.wait(Lock, [&] { return Generation != Seen; });
+        Seen = Generation;
+        if (fStop) return;
+        pCur = pJob;
+      }
+      (*pCur)(iThread);
+      std::lock_guard<std::mutex> Lock(Mutex);
+      if (--nPending == 0) CondDone.notify_one();
+    }
+  }
+  std::vector<std::thread> vWorkers;
+  std::mutex Mutex;
+  std::condition_variable CondStart;
+  std::condition_variable CondDone;
+  const std::function<void(int)>* pJob = nullptr;
+  long Generation = 0;
+  int nPending = 0;
+  bool fStop = false;
+};
+
+// Buffered writer that formats integers by hand instead of calling printf
+// for every leaf.
+class Lsv_OutBuf {
+ public:
+  explicit Lsv_OutBuf(FILE* pFile) : pFile(pFile), vBuf(1 << 16), nUsed(0) {}
+  ~Lsv_OutBuf() { Flush(); }
+  void PutChar(char c) {
+    if (nUsed == (int)vBuf.size()) Flush();
+    vBuf[nUsed++] = c;
+  }
+  void PutInt(int Num) {
+    char Digits[16];
+    int n = 0;
+    unsigned Value = Num < 0 ? 0u - (unsigned)Num : (unsigned)Num;
+    do {
+      Digits[n++] = (char)('0' + Value % 10);
+      Value /= 10;
+    } while (Value);
+    if (Num < 0) Digits[n++] = '-';
+    if (nUsed + n > (int)vBuf.size()) Flush();
+    while (n) vBuf[nUsed++] = Digits[--n];
+  }
+  void Flush() {
+    if (nUsed) fwrite(vBuf.data(), 1, nUsed, pFile);
+    nUsed = 0;
+  }
+
+ private:
+  FILE* pFile;
+  std::vector<char> vBuf;
+  int nUsed;
+};
+
+static inline uint64_t Lsv_CutSigLeaf(int Leaf) {
+  return (uint64_t)1 << (Leaf & 63);
+}
+
+// Merges two sorted leaf arrays; returns the size or -1 if it exceeds nLeafMax.
+static inline int Lsv_CutMerge(const int* pC0, const int* pC1, int* pRes,
+                               int nLeafMax) {
+  int n0 = pC0[0], n1 = pC1[0], i = 1, k = 1, n = 0;
+  const int *pL0 = pC0, *pL1 = pC1;
+  while (i <= n0 && k <= n1) {
+    if (n == nLeafMax) return -1;
+    if (pL0[i] == pL1[k])
+      pRes[1 + n++] = pL0[i++], k++;
+    else if (pL0[i] < pL1[k])
+      pRes[1 + n++] = pL0[i++];
+    else
+      pRes[1 + n++] = pL1[k++];
+  }
+  while (i <= n0) {
+    if (n == nLeafMax) return -1;
+    pRes[1 + n++] = pL0[i++];
+  }
+  while (k <= n1) {
+    if (n == nLeafMax) return -1;
+    pRes[1 + n++] = pL1[k++];
+  }
+  pRes[0] = n;
+  return n;
+}
+
+// Returns 1 if the leaves of pSub are contained in the leaves of pSup.
+static inline int Lsv_CutIsSubset(const int* pSub, const int* pSup) {
+  int i = 1, k = 1;
+  if (pSub[0] > pSup[0]) return 0;
+  while (i <= pSub[0]) {
+    while (k <= pSup[0] && pSup[k] < pSub[i]) k++;
+    if (k > pSup[0] || pSup[k] != pSub[i]) return 0;
+    i++, k++;
+  }
+  return 1;
+}
+
+static inline const int* Lsv_CutNodeCuts(Lsv_CutMan_t* p, int Id,
+                                         const uint64_t** ppSigs) {
+  Lsv_CutLevel_t& Level = p->vLevels[p->pGraph->vLevel[Id]];
+  Lsv_CutNode_t& Node = p->vNodes[Id];
+  *ppSigs = Level.vSigs.data() + Node.Offset;
+  return Level.vCuts.data() + (size_t)Node.Offset * p->nStride;
+}
+
+// Computes the cuts of one object and appends them to the chunk.
+static void Lsv_CutComputeNode(Lsv_CutMan_t* p, int Id, Lsv_CutChunk_t* pChunk,
+                               long* pnTried, long* pnSkipped) {
+  Lsv_CutGraph_t* g = p->pGraph;
+  int nStride = p->nStride, nLeafMax = p->pPars->nLeafMax;
+  int Fan0 = g->vFanin0[Id], Fan1 = g->vFanin1[Id];
+  size_t Start = pChunk->vSigs.size();
+  // the trivial cut goes first
+  pChunk->vCuts.resize((Start + 1) * nStride);
+  pChunk->vCuts[Start * nStride] = 1;
+  pChunk->vCuts[Start * nStride + 1] = Id;
+  pChunk->vSigs.push_back(Lsv_CutSigLeaf(Id));
+  if (Fan0 >= 0) {
+    const uint64_t *pSigs0, *pSigs1;
+    const int* pCuts0 = Lsv_CutNodeCuts(p, Fan0, &pSigs0);
+    const int* pCuts1 = Lsv_CutNodeCuts(p, Fan1, &pSigs1);
+    int nCuts0 = p->vNodes[Fan0].nCuts, nCuts1 = p->vNodes[Fan1].nCuts;
+    int Merged[LSV_CUT_LEAF_MAX + 1];
+    for (int c1 = 0; c1 < nCuts1; c1++)
+      for (int c0 = 0; c0 < nCuts0; c0++) {
+        uint64_t Sig = pSigs0[c0] | pSigs1[c1];
+        (*pnTried)++;
+        if (__builtin_popcountll(Sig) > nLeafMax) {
+          (*pnSkipped)++;
+          continue;
+        }
+        if (Lsv_CutMerge(pCuts0 + (size_t)c0 * nStride,
+                         pCuts1 + (size_t)c1 * nStride, Merged, nLeafMax) < 0)
+          continue;
+        // skip the new cut if it is dominated by (or equal to) an old one
+        size_t nCur = pChunk->vSigs.size(), i, k;
+        int* pCuts = pChunk->vCuts.data();
+        for (i = Start + 1; i < nCur; i++)
+          if ((pChunk->vSigs[i] & ~Sig) == 0 &&
+              Lsv_CutIsSubset(pCuts + i * nStride, Merged))
+            break;
+        if (i < nCur) continue;
+        // remove the old cuts dominated by the new one
+        for (i = k = Start + 1; i < nCur; i++) {
+          if ((Sig & ~pChunk->vSigs[i]) == 0 &&
+              Lsv_CutIsSubset(Merged, pCuts + i * nStride))
+            continue;
+          if (k < i) {
+            std::copy(pCuts + i * nStride, pCuts + (i + 1) * nStride,
+                      pCuts + k * nStride);
+            pChunk->vSigs[k] = pChunk->vSigs[i];
+          }
+          k++;
+        }
+        pChunk->vSigs.resize(k + 1);
+        pChunk->vSigs[k] = Sig;
+        pChunk->vCuts.resize((k + 1) * nStride);
+        std::copy(Merged, Merged + 1 + Merged[0],
+                  pChunk->vCuts.data() + k * nStride);
+      }
+  }
+  pChunk->vCounts.push_back((int)(pChunk->vSigs.size() - Start));
+}
+
+static void Lsv_CutPrintNode(Lsv_CutMan_t* p, int Id, Lsv_OutBuf* pOut) {
+  const uint64_t* pSigs;
+  const int* pCuts = Lsv_CutNodeCuts(p, Id, &pSigs);
+  for (int c = 0; c < p->vNodes[Id].nCuts; c++) {
+    const int* pCut = pCuts + (size_t)c * p->nStride;
+    pOut->PutInt(Id);
+    pOut->PutChar(':');
+    for (int i = 1; i <= pCut[0]; i++) {
+      pOut->PutChar(' ');
+      pOut->PutInt(pCut[i]);
+    }
+    pOut->PutChar('\n');
+  }
+}
+
+static void Lsv_CutFreeLevel(Lsv_CutLevel_t* pLevel) {
+  std::vector<int>().swap(pLevel->vCuts);
+  std::vector<uint64_t>().swap(pLevel->vSigs);
+}
+
+void Lsv_CutSetDefaultParams(Lsv_CutPar_t* pPars) {
+  pPars->nLeafMax = 4;
+  pPars->nThreads = 1;
+  pPars->fStream = 0;
+  pPars->fVerbose = 0;
+}
+
+// Assigns levels to the objects and records, for each object, the largest
+// level of its fanouts. Uses an explicit stack since fanins may have larger
+// IDs than their fanouts in a logic network. Returns 0 on a combinational loop.
+static int Lsv_CutGraphLevelize(Lsv_CutGraph_t* g) {
+  int nObjs = (int)g->vFanin0.size();
+  std::vector<int> vStack;
+  g->vLevel.assign(nObjs, -1);  // -1 = not visited, -2 = on the DFS path
+  g->vFanoutLevel.assign(nObjs, -1);
+  g->nLevels = 0;
+  for (int Id = 0; Id < nObjs; Id++) {
+    if (g->vLevel[Id] >= 0) continue;
+    vStack.push_back(Id);
+    while (!vStack.empty()) {
+      int Top = vStack.back(), Fan0 = g->vFanin0[Top], Fan1 = g->vFanin1[Top];
+      if (g->vLevel[Top] >= 0) {
+        vStack.pop_back();
+        continue;
+      }
+      if (Fan0 < 0) {
+        g->vLevel[Top] = 0;
+        vStack.pop_back();
+        continue;
+      }
+      if (g->vLevel[Top] == -1) {
+        if (g->vLevel[Fan0] == -2 || g->vLevel[Fan1] == -2) return 0;
+        g->vLevel[Top] = -2;
+        if (g->vLevel[Fan0] == -1) vStack.push_back(Fan0);
+        if (g->vLevel[Fan1] == -1) vStack.push_back(Fan1);
+        continue;
+      }
+      g->vLevel[Top] = 1 + std::max(g->vLevel[Fan0], g->vLevel[Fan1]);
+      vStack.pop_back();
+    }
+  }
+  for (int Id = 0; Id < nObjs; Id++) {
+    g->nLevels = std::max(g->nLevels, g->vLevel[Id] + 1);
+    if (g->vFanin0[Id] < 0) continue;
+    int& Fo0 = g->vFanoutLevel[g->vFanin0[Id]];
+    int& Fo1 = g->vFanoutLevel[g->vFanin1[Id]];
+    Fo0 = std::max(Fo0, g->vLevel[Id]);
+    Fo1 = std::max(Fo1, g->vLevel[Id]);
+  }
+  return 1;
+}
+
+int Lsv_CutGraphFromNtk(Abc_Ntk_t* pNtk, Lsv_CutGraph_t* g) {
+  Abc_Obj_t* pObj;
+  int i, nObjs = Abc_NtkObjNumMax(pNtk);
+  assert(Abc_NtkIsStrash(pNtk));
+  g->vFanin0.assign(nObjs, -2);
+  g->vFanin1.assign(nObjs, -2);
+  g->vPrint.assign(nObjs, 0);
+  Abc_NtkForEachObj(pNtk, pObj, i) {
+    if (Abc_ObjIsCi(pObj)) {
+      g->vFanin0[i] = g->vFanin1[i] = -1;
+      g->vPrint[i] = 1;
+    } else if (Abc_ObjIsNode(pObj) && Abc_ObjFaninNum(pObj) == 2) {
+      g->vFanin0[i] = Abc_ObjFaninId0(pObj);
+      g->vFanin1[i] = Abc_ObjFaninId1(pObj);
+      g->vPrint[i] = 1;
+    }
+  }
+  // objects that have no cuts (constant, COs) are treated as CIs for
+  // levelizing, and never printed
+  for (i = 0; i < nObjs; i++)
+    if (g->vFanin0[i] == -2) g->vFanin0[i] = g->vFanin1[i] = -1;
+  return Lsv_CutGraphLevelize(g);
+}
+
+int Lsv_CutGraphFromGia(Gia_Man_t* p, Lsv_CutGraph_t* g) {
+  Gia_Obj_t* pObj;
+  int i, nObjs = Gia_ManObjNum(p);
+  g->vFanin0.assign(nObjs, -1);
+  g->vFanin1.assign(nObjs, -1);
+  g->vPrint.assign(nObjs, 0);
+  Gia_ManForEachObj1(p, pObj, i) {
+    if (Gia_ObjIsCi(pObj))
+      g->vPrint[i] = 1;
+    else if (Gia_ObjIsAnd(pObj)) {
+      g->vFanin0[i] = Gia_ObjFaninId0(pObj, i);
+      g->vFanin1[i] = Gia_ObjFaninId1(pObj, i);
+      g->vPrint[i] = 1;
+    }
+  }
+  return Lsv_CutGraphLevelize(g);
+}
+
+// Enumerates the k-feasible cuts of all printable objects, level by level.
+// Objects of one level only read cuts of lower levels, so they are split into
+// chunks and computed by the pool without locking; the chunks are then
+// appended to the level arena in order, which keeps the output deterministic.
+// In streaming mode, each level is printed as soon as it is computed, and the
+// arena of a level is freed once the last level reading it is done.
+int Lsv_CutEnumerate(Lsv_CutGraph_t* g, Lsv_CutPar_t* pPars, FILE* pFile) {
+  const int nChunkSize = 256;
+  abctime clk = Abc_Clock();
+  Lsv_CutMan_t Man, *p = &Man;
+  Lsv_OutBuf Out(pFile);
+  int nObjs = (int)g->vFanin0.size();
+  if (pPars->nLeafMax < 1 || pPars->nLeafMax > LSV_CUT_LEAF_MAX) return 0;
+  p->pGraph = g;
+  p->pPars = pPars;
+  p->nStride = 1 + pPars->nLeafMax;
+  p->vLevels.resize(g->nLevels);
+  p->vNodes.resize(nObjs);
+  p->vLevelNodes.resize(g->nLevels);
+  for (int Id = 0; Id < nObjs; Id++) {
+    Lsv_CutLevel_t& Level = p->vLevels[g->vLevel[Id]];
+    Level.LastUse = std::max(Level.LastUse, g->vFanoutLevel[Id]);
+    if (g->vPrint[Id]) p->vLevelNodes[g->vLevel[Id]].push_back(Id);
+  }
+  Lsv_ThreadPool Pool(std::max(1, pPars->nThreads));
+  std::vector<Lsv_CutChunk_t> vChunks;
+  std::vector<long> vTried(Pool.Size()), vSkipped(Pool.Size());
+  std::vector<std::vector<int>> vFreeAt(g->nLevels);
+  for (int l = 0; l < g->nLevels; l++)
+    vFreeAt[std::max(l, p->vLevels[l].LastUse)].push_back(l);
+  for (int l = 0; l < g->nLevels; l++) {
+    const std::vector<int>& vNodes = p->vLevelNodes[l];
+    int nChunks = ((int)vNodes.size() + nChunkSize - 1) / nChunkSize;
+    std::atomic<int> iNext(0);
+    if ((int)vChunks.size() < nChunks) vChunks.resize(nChunks);
+    Pool.Run([&](int iThread) {
+      for (int c; (c = iNext.fetch_add(1)) < nChunks;) {
+        Lsv_CutChunk_t& Chunk = vChunks[c];
+        Chunk.vCuts.clear();
+        Chunk.vSigs.clear();
+        Chunk.vCounts.clear();
+        int Stop = std::min((int)vNodes.size(), (c + 1) * nChunkSize);
+        for (int i = c * nChunkSize; i < Stop; i++)
+          Lsv_CutComputeNode(p, vNodes[i], &Chunk, &vTried[iThread],
+                             &vSkipped[iThread]);
+      }
+    });
+    // commit the chunks into the level arena
+    Lsv_CutLevel_t& Level = p->vLevels[l];
+    size_t nSlots = 0;
+    for (int c = 0; c < nChunks; c++) nSlots += vChunks[c].vSigs.size();
+    Level.vCuts.reserve(nSlots * p->nStride);
+    Level.vSigs.reserve(nSlots);
+    for (int c = 0, i = 0; c < nChunks; c++) {
+      Lsv_CutChunk_t& Chunk = vChunks[c];
+      int Offset = (int)Level.vSigs.size();
+      for (int Count : Chunk.vCounts) {
+        p->vNodes[vNodes[i]].Offset = Offset;
+        p->vNodes[vNodes[i]].nCuts = Count;
+        Offset += Count;
+        i++;
+      }
+      Level.vSigs.insert(Level.vSigs.end(), Chunk.vSigs.begin(),
+                         Chunk.vSigs.end());
+      Level.vCuts.insert(Level.vCuts.end(), Chunk.vCuts.begin(),
+                         Chunk.vCuts.end());
+    }
+    p->nCutsTotal += (long)Level.vSigs.size();
+    if (!pPars->fStream) continue;
+    for (int Id : vNodes) Lsv_CutPrintNode(p, Id, &Out);
+    // free the levels that are no longer read
+    for (int Freed : vFreeAt[l]) Lsv_CutFreeLevel(&p->vLevels[Freed]);
+  }
+  if (!pPars->fStream)
+    for (int Id = 0; Id < nObjs; Id++)
+      if (g->vPrint[Id]) Lsv_CutPrintNode(p, Id, &Out);
+  Out.Flush();
+  if (pPars->fVerbose) {
+    for (int i = 0; i < Pool.Size(); i++) {
+      p->nMergesTried += vTried[i];
+      p->nMergesSigSkip += vSkipped[i];
+    }
+    fflush(pFile);
+    Abc_Print(1,
+              "Levels = %d. Cuts = %ld. Merges = %ld. Rejected by "
+              "signature = %ld. Threads = %d.  ",
+              g->nLevels, p->nCutsTotal, p->nMergesTried, p->nMergesSigSkip,
+              Pool.Size());
+    Abc_PrintTime(1, "Time", Abc_Clock() - clk);
+  }
+  return 1;
+}
+
+ABC_NAMESPACE_IMPL_END
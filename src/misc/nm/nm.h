@@ -73,6 +73,7 @@ typedef struct Nm_Man_t_ Nm_Man_t;
 /*=== nmApi.c ==========================================================*/
 extern Nm_Man_t *   Nm_ManCreate( int nSize );
 extern void         Nm_ManFree( Nm_Man_t * p );
+extern void         Nm_ManReserve( Nm_Man_t * p, int nNames, int nIdMax );
 extern int          Nm_ManNumEntries( Nm_Man_t * p );
 extern char *       Nm_ManStoreIdName( Nm_Man_t * p, int ObjId, int Type, char * pName, char * pSuffix );
 extern void         Nm_ManDeleteIdName( Nm_Man_t * p, int ObjId );
@@ -27,6 +27,17 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// hashing for integers
+static unsigned Nm_HashNumber( int Num, int TableSize ) 
+{
+    unsigned Key = 0;
+    Key ^= ( Num        & 0xFF) * 7937;
+    Key ^= ((Num >>  8) & 0xFF) * 2971;
+    Key ^= ((Num >> 16) & 0xFF) * 911;
+    Key ^= ((Num >> 24) & 0xFF) * 353;
+    return Key % TableSize;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -48,15 +59,9 @@ Nm_Man_t * Nm_ManCreate( int nSize )
     // allocate the table
     p = ABC_ALLOC( Nm_Man_t, 1 );
     memset( p, 0, sizeof(Nm_Man_t) );
-    // set the parameters
-    p->nSizeFactor   = 2; // determined the limit on the grow of data before the table resizes
-    p->nGrowthFactor = 3; // determined how much the table grows after resizing
-    // allocate and clean the bins
-    p->nBins = Abc_PrimeCudd(nSize);
-    p->pBinsI2N = ABC_ALLOC( Nm_Entry_t *, p->nBins );
-    p->pBinsN2I = ABC_ALLOC( Nm_Entry_t *, p->nBins );
-    memset( p->pBinsI2N, 0, sizeof(Nm_Entry_t *) * p->nBins );
-    memset( p->pBinsN2I, 0, sizeof(Nm_Entry_t *) * p->nBins );
+    // allocate the entries and the tables (readers pass the expected
+    // number of names, so that bulk insertion does not resize the tables)
+    Nm_ManTableStart( p, nSize );
     // start the memory manager
     p->pMem = Extra_MmFlexStart();
     return p;
@@ -76,11 +81,28 @@ Nm_Man_t * Nm_ManCreate( int nSize )
 void Nm_ManFree( Nm_Man_t * p )
 {
     Extra_MmFlexStop( p->pMem );
-    ABC_FREE( p->pBinsI2N );
-    ABC_FREE( p->pBinsN2I );
+    Nm_ManTableStop( p );
     ABC_FREE( p );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Prepares the name manager for adding names in bulk.]
+
+  Description [After this call, nNames new names with object IDs less 
+  than nIdMax can be added without resizing the tables. Use 0 for nIdMax 
+  if the IDs are not known.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Nm_ManReserve( Nm_Man_t * p, int nNames, int nIdMax )
+{
+    Nm_ManTableReserve( p, nNames, nIdMax );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Returns the number of objects with names.]
@@ -112,26 +134,28 @@ int Nm_ManNumEntries( Nm_Man_t * p )
 char * Nm_ManStoreIdName( Nm_Man_t * p, int ObjId, int Type, char * pName, char * pSuffix )
 {
     Nm_Entry_t * pEntry;
-    int RetValue, nEntrySize;
+    char Buffer[1000], * pFull = pName;
+    int nName, nSuffix;
     // check if the object with this ID is already stored
     if ( (pEntry = Nm_ManTableLookupId(p, ObjId)) )
     {
         printf( "Nm_ManStoreIdName(): Entry with the same ID already exists.\n" );
         return NULL;
     }
-    // create a new entry
-    nEntrySize = sizeof(Nm_Entry_t) + strlen(pName) + (pSuffix?strlen(pSuffix):0) + 1;
-//    nEntrySize = (nEntrySize / 4 + ((nEntrySize % 4) > 0)) * 4;
-    nEntrySize = (nEntrySize / sizeof(char*) + ((nEntrySize % sizeof(char*)) > 0)) * sizeof(char*); // added by Saurabh on Sep 3, 2009
-    pEntry = (Nm_Entry_t *)Extra_MmFlexEntryFetch( p->pMem, nEntrySize );
-    pEntry->pNextI2N = pEntry->pNextN2I = pEntry->pNameSake = NULL;
-    pEntry->ObjId = ObjId;
-    pEntry->Type = Type;
-    sprintf( pEntry->Name, "%s%s", pName, pSuffix? pSuffix : "" );
+    // append the suffix
+    if ( pSuffix && *pSuffix )
+    {
+        nName = strlen(pName);
+        nSuffix = strlen(pSuffix);
+        pFull = nName + nSuffix < (int)sizeof(Buffer) ? Buffer : ABC_ALLOC( char, nName + nSuffix + 1 );
+        memcpy( pFull, pName, (size_t)nName );
+        memcpy( pFull + nName, pSuffix, (size_t)nSuffix + 1 );
+    }
     // add the entry to the hash table
-    RetValue = Nm_ManTableAdd( p, pEntry );
-    assert( RetValue == 1 );
-    return pEntry->Name;
+    pEntry = Nm_ManTableAdd( p, ObjId, Type, pFull );
+    if ( pFull != pName && pFull != Buffer )
+        ABC_FREE( pFull );
+    return pEntry->pName;
 }
 
 /**Function*************************************************************
@@ -178,7 +202,7 @@ char * Nm_ManCreateUniqueName( Nm_Man_t * p, int ObjId )
     Nm_Entry_t * pEntry;
     int i;
     if ( (pEntry = Nm_ManTableLookupId(p, ObjId)) )
-        return pEntry->Name;
+        return pEntry->pName;
     sprintf( NameStr, "n%d", ObjId );
     for ( i = 1; Nm_ManTableLookupName(p, NameStr, -1); i++ )
         sprintf( NameStr, "n%d_%d", ObjId, i );
@@ -200,7 +224,7 @@ char * Nm_ManFindNameById( Nm_Man_t * p, int ObjId )
 {
     Nm_Entry_t * pEntry;
     if ( (pEntry = Nm_ManTableLookupId(p, ObjId)) )
-        return pEntry->Name;
+        return pEntry->pName;
     return NULL;
 }
 
@@ -251,7 +275,9 @@ int Nm_ManFindIdByNameTwoTypes( Nm_Man_t * p, char * pName, int Type1, int Type2
 
   Synopsis    [Return the IDs of objects with names.]
 
-  Description []
+  Description [The IDs are hashed into nBins bins, which grow with the
+  number of names, and one ID is returned for each non-empty bin (that of
+  the entry stored last in the entry array).]
                
   SideEffects []
 
@@ -261,11 +287,16 @@ int Nm_ManFindIdByNameTwoTypes( Nm_Man_t * p, char * pName, int Type1, int Type2
 Vec_Int_t * Nm_ManReturnNameIds( Nm_Man_t * p )
 {
     Vec_Int_t * vNameIds;
-    int i;
+    int * pBins, i;
+    pBins = ABC_FALLOC( int, p->nBins );
+    for ( i = 0; i < p->nEntriesUsed; i++ )
+        if ( p->pEntries[i].ObjId != -1 )
+            pBins[Nm_HashNumber(p->pEntries[i].ObjId, p->nBins)] = p->pEntries[i].ObjId;
     vNameIds = Vec_IntAlloc( p->nEntries );
     for ( i = 0; i < p->nBins; i++ )
-        if ( p->pBinsI2N[i] )
-            Vec_IntPush( vNameIds, p->pBinsI2N[i]->ObjId );
+        if ( pBins[i] != -1 )
+            Vec_IntPush( vNameIds, pBins[i] );
+    ABC_FREE( pBins );
     return vNameIds;
 }
 
@@ -43,26 +43,41 @@ ABC_NAMESPACE_HEADER_START
 ///                         BASIC TYPES                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// Entries are kept in one array. Object IDs are mapped into entries by a
+// direct array, and names are mapped into entries by an open-addressing
+// index, which contains only the head entry of each name. Its namesakes
+// are linked through iNextSake in the order head, newest, ..., oldest,
+// so a lookup by name returns the head first. The names are stored
+// in the flexible memory manager without padding and are never moved,
+// because the callers keep the pointers returned by Nm_ManStoreIdName() and
+// Nm_ManFindNameById(); for the same reason, the names cannot be stored with
+// prefix compression. The hash values are not stored but recomputed when the
+// index is resized, and the types (small ABC object types) are kept in a
+// separate byte array, so that an entry takes 16 bytes on 64-bit platforms.
+
 typedef struct Nm_Entry_t_ Nm_Entry_t;
 struct Nm_Entry_t_
 {
-    unsigned         Type;          // object type
-    unsigned         ObjId;         // object ID
-    Nm_Entry_t *     pNextI2N;      // the next entry in the ID hash table
-    Nm_Entry_t *     pNextN2I;      // the next entry in the name hash table
-    Nm_Entry_t *     pNameSake;     // the next entry with the same name
-    char             Name[0];       // name of the object
+    char *           pName;         // name of the object (shared by namesakes)
+    int              ObjId;         // object ID (-1 if the entry is free)
+    int              iNextSake;     // the next entry with the same name (or the next free entry)
 };
 
 struct Nm_Man_t_
 {
-    Nm_Entry_t **    pBinsI2N;      // mapping IDs into names
-    Nm_Entry_t **    pBinsN2I;      // mapping names into IDs 
-    int              nBins;         // the number of bins in tables
-    int              nEntries;      // the number of entries
-    int              nSizeFactor;   // determined how much larger the table should be
-    int              nGrowthFactor; // determined how much the table grows after resizing
-    Extra_MmFlex_t * pMem;          // memory manager for entries (and names)
+    Nm_Entry_t *     pEntries;      // the array of entries
+    unsigned char *  pTypes;        // the types of entries
+    int              nEntriesAlloc; // the number of allocated entries
+    int              nEntriesUsed;  // the number of entries used so far, including free ones
+    int              iEntryFree;    // the list of free entries
+    int              nEntries;      // the number of live entries
+    int              nNames;        // the number of distinct names
+    int *            pIdToEntry;    // mapping IDs into entries
+    int              nIdsAlloc;     // the size of the ID mapping
+    int *            pTable;        // mapping names into the head entry with this name
+    int              nTableMask;    // the size of the table minus one
+    int              nBins;         // the number of bins used to sample the IDs (see Nm_ManReturnNameIds())
+    Extra_MmFlex_t * pMem;          // memory manager for names
 };
 
 ////////////////////////////////////////////////////////////////////////
@@ -74,7 +89,10 @@ struct Nm_Man_t_
 ////////////////////////////////////////////////////////////////////////
 
 /*=== nmTable.c ==========================================================*/
-extern int              Nm_ManTableAdd( Nm_Man_t * p, Nm_Entry_t * pEntry );
+extern void             Nm_ManTableStart( Nm_Man_t * p, int nSize );
+extern void             Nm_ManTableStop( Nm_Man_t * p );
+extern void             Nm_ManTableReserve( Nm_Man_t * p, int nNames, int nIdMax );
+extern Nm_Entry_t *     Nm_ManTableAdd( Nm_Man_t * p, int ObjId, int Type, char * pName );
 extern int              Nm_ManTableDelete( Nm_Man_t * p, int ObjId );
 extern Nm_Entry_t *     Nm_ManTableLookupId( Nm_Man_t * p, int ObjId );
 extern Nm_Entry_t *     Nm_ManTableLookupName( Nm_Man_t * p, char * pName, int Type );
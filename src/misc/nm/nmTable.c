@@ -27,82 +27,238 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-// hashing for integers
-static unsigned Nm_HashNumber( int Num, int TableSize ) 
+// hashing for strings (FNV-1a)
+static inline unsigned Nm_HashString( char * pName ) 
 {
-    unsigned Key = 0;
-    Key ^= ( Num        & 0xFF) * 7937;
-    Key ^= ((Num >>  8) & 0xFF) * 2971;
-    Key ^= ((Num >> 16) & 0xFF) * 911;
-    Key ^= ((Num >> 24) & 0xFF) * 353;
-    return Key % TableSize;
+    unsigned Key = 2166136261u;
+    for ( ; *pName; pName++ )
+        Key = (Key ^ (unsigned char)*pName) * 16777619u;
+    return Key;
 }
 
-// hashing for strings
-static unsigned Nm_HashString( char * pName, int TableSize ) 
+static void Nm_ManResize( Nm_Man_t * p, int nTableSize );
+
+// the index is kept at most 3/4 full
+static inline int Nm_ManTableSizeFor( int nNames )
 {
-    static int s_Primes[10] = { 
-        1291, 1699, 2357, 4177, 5147, 
-        5647, 6343, 7103, 7873, 8147
-    };
-    unsigned i, Key = 0;
-    for ( i = 0; pName[i] != '\0'; i++ )
-        Key ^= s_Primes[i%10]*pName[i]*pName[i];
-    return Key % TableSize;
+    int nTableSize = 16;
+    while ( 3 * (word)nTableSize < 4 * (word)nNames )
+        nTableSize <<= 1;
+    return nTableSize;
 }
 
-static void Nm_ManResize( Nm_Man_t * p );
-
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
 /**Function*************************************************************
 
-  Synopsis    [Adds an entry to two hash tables.]
+  Synopsis    [Allocates and deallocates the tables.]
 
-  Description []
+  Description [The tables are sized for nSize entries without resizing.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int Nm_ManTableAdd( Nm_Man_t * p, Nm_Entry_t * pEntry )
+void Nm_ManTableStart( Nm_Man_t * p, int nSize )
 {
-    Nm_Entry_t ** ppSpot, * pOther;
-    // resize the tables if needed
-    if ( p->nEntries > p->nBins * p->nSizeFactor )
-        Nm_ManResize( p );
-    // add the entry to the table Id->Name
-    assert( Nm_ManTableLookupId(p, pEntry->ObjId) == NULL );
-    ppSpot = p->pBinsI2N + Nm_HashNumber(pEntry->ObjId, p->nBins);
-    pEntry->pNextI2N = *ppSpot;
-    *ppSpot = pEntry;
+    int nTableSize = Nm_ManTableSizeFor( nSize );
+    p->nEntriesAlloc = Abc_MaxInt( nSize, 16 );
+    p->pEntries      = ABC_ALLOC( Nm_Entry_t, p->nEntriesAlloc );
+    p->pTypes        = ABC_ALLOC( unsigned char, p->nEntriesAlloc );
+    p->iEntryFree    = -1;
+    p->nIdsAlloc     = Abc_MaxInt( nSize, 16 );
+    p->pIdToEntry    = ABC_FALLOC( int, p->nIdsAlloc );
+    p->nTableMask    = nTableSize - 1;
+    p->pTable        = ABC_FALLOC( int, nTableSize );
+    p->nBins         = Abc_PrimeCudd( Abc_MaxInt(nSize, 1) );
+}
+void Nm_ManTableStop( Nm_Man_t * p )
+{
+    ABC_FREE( p->pEntries );
+    ABC_FREE( p->pTypes );
+    ABC_FREE( p->pIdToEntry );
+    ABC_FREE( p->pTable );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Resizes the arrays of entries and IDs.]
+
+  Description [The arrays grow by half, which wastes less memory than 
+  doubling, when the number of names is not known in advance.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Nm_ManGrowEntries( Nm_Man_t * p, int nEntriesAlloc )
+{
+    if ( nEntriesAlloc <= p->nEntriesAlloc )
+        return;
+    p->pEntries = ABC_REALLOC( Nm_Entry_t, p->pEntries, nEntriesAlloc );
+    p->pTypes   = ABC_REALLOC( unsigned char, p->pTypes, nEntriesAlloc );
+    p->nEntriesAlloc = nEntriesAlloc;
+}
+static void Nm_ManGrowIds( Nm_Man_t * p, int nIdsAlloc )
+{
+    if ( nIdsAlloc <= p->nIdsAlloc )
+        return;
+    p->pIdToEntry = ABC_REALLOC( int, p->pIdToEntry, nIdsAlloc );
+    memset( p->pIdToEntry + p->nIdsAlloc, 0xFF, sizeof(int) * (nIdsAlloc - p->nIdsAlloc) );
+    p->nIdsAlloc = nIdsAlloc;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prepares the tables for adding names in bulk.]
+
+  Description [After this call, nNames new names with IDs less than 
+  nIdMax can be added without resizing the tables. The IDs are not 
+  reserved if nIdMax is 0.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Nm_ManTableReserve( Nm_Man_t * p, int nNames, int nIdMax )
+{
+    int nTableSize = Nm_ManTableSizeFor( p->nNames + nNames );
+    Nm_ManGrowEntries( p, p->nEntriesUsed + nNames );
+    Nm_ManGrowIds( p, nIdMax );
+    if ( nTableSize > p->nTableMask + 1 )
+        Nm_ManResize( p, nTableSize );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds the slot of the name in the table.]
+
+  Description [Returns the slot with the head entry having this name
+  or the empty slot where such entry should be added.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Nm_ManTableSlot( Nm_Man_t * p, char * pName, unsigned Hash )
+{
+    int iSlot = Hash & p->nTableMask;
+    while ( p->pTable[iSlot] != -1 && strcmp(p->pEntries[p->pTable[iSlot]].pName, pName) )
+        iSlot = (iSlot + 1) & p->nTableMask;
+    return iSlot;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Removes the slot from the table.]
+
+  Description [Shifts back the following entries of the probe sequence, 
+  so that no tombstones are needed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Nm_ManTableRemoveSlot( Nm_Man_t * p, int iSlot )
+{
+    int iNext = iSlot, iHome;
+    while ( 1 )
+    {
+        iNext = (iNext + 1) & p->nTableMask;
+        if ( p->pTable[iNext] == -1 )
+            break;
+        iHome = Nm_HashString( p->pEntries[p->pTable[iNext]].pName ) & p->nTableMask;
+        // move the entry if its home is not in the cyclic range (iSlot, iNext]
+        if ( iSlot <= iNext ? (iHome <= iSlot || iHome > iNext) : (iHome <= iSlot && iHome > iNext) )
+        {
+            p->pTable[iSlot] = p->pTable[iNext];
+            iSlot = iNext;
+        }
+    }
+    p->pTable[iSlot] = -1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds an entry to the tables.]
+
+  Description [The name is copied, unless an entry with this name
+  already exists. In this case, the new entry is linked right after 
+  the head entry, so that the namesakes are visited newest first.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Nm_Entry_t * Nm_ManTableAdd( Nm_Man_t * p, int ObjId, int Type, char * pName )
+{
+    Nm_Entry_t * pEntry, * pHead;
+    int iEntry, iSlot;
+    assert( ObjId >= 0 );
+    assert( Type >= 0 && Type < 256 );
+    // resize the table if needed
+    if ( 4 * (word)(p->nNames + 1) > 3 * (word)(p->nTableMask + 1) )
+        Nm_ManResize( p, 2 * (p->nTableMask + 1) );
+    if ( p->nEntries > 2 * p->nBins )
+        p->nBins = Abc_PrimeCudd( 3 * p->nBins );
+    // get a new entry
+    if ( p->iEntryFree >= 0 )
+    {
+        iEntry = p->iEntryFree;
+        p->iEntryFree = p->pEntries[iEntry].iNextSake;
+    }
+    else
+    {
+        if ( p->nEntriesUsed == p->nEntriesAlloc )
+            Nm_ManGrowEntries( p, p->nEntriesAlloc + p->nEntriesAlloc / 2 );
+        iEntry = p->nEntriesUsed++;
+    }
+    pEntry = p->pEntries + iEntry;
+    pEntry->ObjId     = ObjId;
+    pEntry->iNextSake = -1;
+    p->pTypes[iEntry] = (unsigned char)Type;
+    // map the ID into the entry
+    if ( ObjId >= p->nIdsAlloc )
+        Nm_ManGrowIds( p, Abc_MaxInt( p->nIdsAlloc + p->nIdsAlloc / 2, ObjId + 1 ) );
+    assert( p->pIdToEntry[ObjId] == -1 );
+    p->pIdToEntry[ObjId] = iEntry;
     // check if an entry with the same name already exists
-    if ( (pOther = Nm_ManTableLookupName(p, pEntry->Name, -1)) )
+    iSlot = Nm_ManTableSlot( p, pName, Nm_HashString(pName) );
+    if ( p->pTable[iSlot] >= 0 )
     {
-        // entry with the same name already exists - add it to the ring
-        pEntry->pNameSake = pOther->pNameSake? pOther->pNameSake : pOther;
-        pOther->pNameSake = pEntry;
+        // share the name and add the entry after the head
+        pHead = p->pEntries + p->pTable[iSlot];
+        pEntry->pName     = pHead->pName;
+        pEntry->iNextSake = pHead->iNextSake;
+        pHead->iNextSake  = iEntry;
     }
     else
     {
-        // entry with the same name does not exist - add it to the table
-        ppSpot = p->pBinsN2I + Nm_HashString(pEntry->Name, p->nBins);
-        pEntry->pNextN2I = *ppSpot;
-        *ppSpot = pEntry;
+        // copy the name and add the entry to the table
+        int nBytes = strlen(pName) + 1;
+        pEntry->pName = Extra_MmFlexEntryFetch( p->pMem, nBytes );
+        memcpy( pEntry->pName, pName, (size_t)nBytes );
+        p->pTable[iSlot] = iEntry;
+        p->nNames++;
     }
-    // report successfully added entry
     p->nEntries++;
-    return 1;
+    return pEntry;
 }
 
 /**Function*************************************************************
 
-  Synopsis    [Deletes the entry from two hash tables.]
+  Synopsis    [Deletes the entry from the tables.]
 
-  Description []
+  Description [If the head entry is deleted, the oldest namesake becomes 
+  the head, while the order of the other namesakes does not change.]
                
   SideEffects []
 
@@ -111,49 +267,46 @@ int Nm_ManTableAdd( Nm_Man_t * p, Nm_Entry_t * pEntry )
 ***********************************************************************/
 int Nm_ManTableDelete( Nm_Man_t * p, int ObjId )
 {
-    Nm_Entry_t ** ppSpot, * pEntry, * pPrev;
-    int fRemoved;
-    p->nEntries--;
-    // remove the entry from the table Id->Name
+    Nm_Entry_t * pEntry, * pPrev;
+    int iSlot, iEntry, iLast;
+    // remove the ID mapping
     assert( Nm_ManTableLookupId(p, ObjId) != NULL );
-    ppSpot = p->pBinsI2N + Nm_HashNumber(ObjId, p->nBins);
-    while ( (*ppSpot)->ObjId != (unsigned)ObjId )
-        ppSpot = &(*ppSpot)->pNextI2N;
-    pEntry = *ppSpot; 
-    *ppSpot = (*ppSpot)->pNextI2N;
-    // remove the entry from the table Name->Id
-    ppSpot = p->pBinsN2I + Nm_HashString(pEntry->Name, p->nBins);
-    while ( *ppSpot && *ppSpot != pEntry )
-        ppSpot = &(*ppSpot)->pNextN2I;
-    // remember if we found this one in the list
-    fRemoved = (*ppSpot != NULL);
-    if ( *ppSpot )
-    {
-        assert( *ppSpot == pEntry );
-        *ppSpot = (*ppSpot)->pNextN2I;
-    }
-    // quit if this entry has no namesakes
-    if ( pEntry->pNameSake == NULL )
+    iEntry = p->pIdToEntry[ObjId];
+    pEntry = p->pEntries + iEntry;
+    p->pIdToEntry[ObjId] = -1;
+    // remove the entry from the list of namesakes
+    iSlot = Nm_ManTableSlot( p, pEntry->pName, Nm_HashString(pEntry->pName) );
+    assert( p->pTable[iSlot] != -1 );
+    if ( p->pTable[iSlot] == iEntry )
     {
-        assert( fRemoved );
-        return 1;
+        if ( pEntry->iNextSake >= 0 )
+        {
+            // unlink the oldest namesake and make it the head
+            for ( pPrev = pEntry; p->pEntries[pPrev->iNextSake].iNextSake >= 0; pPrev = p->pEntries + pPrev->iNextSake );
+            iLast = pPrev->iNextSake;
+            pPrev->iNextSake = -1;
+            if ( iLast != pEntry->iNextSake )
+                p->pEntries[iLast].iNextSake = pEntry->iNextSake;
+            p->pTable[iSlot] = iLast;
+        }
+        else
+        {
+            Nm_ManTableRemoveSlot( p, iSlot );
+            p->nNames--;
+        }
     }
-    // remove entry from the ring of namesakes
-    assert( pEntry->pNameSake != pEntry );
-    for ( pPrev = pEntry; pPrev->pNameSake != pEntry; pPrev = pPrev->pNameSake );
-    assert( !strcmp(pPrev->Name, pEntry->Name) );
-    assert( pPrev->pNameSake == pEntry );
-    if ( pEntry->pNameSake == pPrev ) // two entries in the ring
-        pPrev->pNameSake = NULL;
     else
-        pPrev->pNameSake = pEntry->pNameSake;
-    // reinsert the ring back if we removed its connection with the list in the table
-    if ( fRemoved )
     {
-        assert( pPrev->pNextN2I == NULL );
-        pPrev->pNextN2I = *ppSpot;
-        *ppSpot = pPrev;
+        for ( pPrev = p->pEntries + p->pTable[iSlot]; pPrev->iNextSake != iEntry; pPrev = p->pEntries + pPrev->iNextSake )
+            assert( pPrev->iNextSake >= 0 );
+        pPrev->iNextSake = pEntry->iNextSake;
     }
+    // recycle the entry (the name stays in memory)
+    pEntry->ObjId     = -1;
+    pEntry->pName     = NULL;
+    pEntry->iNextSake = p->iEntryFree;
+    p->iEntryFree     = iEntry;
+    p->nEntries--;
     return 1;
 }
 
@@ -170,18 +323,17 @@ int Nm_ManTableDelete( Nm_Man_t * p, int ObjId )
 ***********************************************************************/
 Nm_Entry_t * Nm_ManTableLookupId( Nm_Man_t * p, int ObjId )
 {
-    Nm_Entry_t * pEntry;
-    for ( pEntry = p->pBinsI2N[ Nm_HashNumber(ObjId, p->nBins) ]; pEntry; pEntry = pEntry->pNextI2N )
-        if ( pEntry->ObjId == (unsigned)ObjId )
-            return pEntry;
-    return NULL;
+    if ( ObjId < 0 || ObjId >= p->nIdsAlloc || p->pIdToEntry[ObjId] == -1 )
+        return NULL;
+    return p->pEntries + p->pIdToEntry[ObjId];
 }
 
 /**Function*************************************************************
 
   Synopsis    [Looks up the entry by name and type.]
 
-  Description []
+  Description [Visits the head entry, followed by its namesakes, newest
+  first. If Type is -1, returns the head entry with this name.]
                
   SideEffects []
 
@@ -190,20 +342,10 @@ Nm_Entry_t * Nm_ManTableLookupId( Nm_Man_t * p, int ObjId )
 ***********************************************************************/
 Nm_Entry_t * Nm_ManTableLookupName( Nm_Man_t * p, char * pName, int Type )
 {
-    Nm_Entry_t * pEntry, * pTemp;
-    for ( pEntry = p->pBinsN2I[ Nm_HashString(pName, p->nBins) ]; pEntry; pEntry = pEntry->pNextN2I )
-    {
-        // check the entry itself
-        if ( !strcmp(pEntry->Name, pName) && (Type == -1 || pEntry->Type == (unsigned)Type) )
-            return pEntry;
-        // if there is no namesakes, continue
-        if ( pEntry->pNameSake == NULL )
-            continue;
-        // check the list of namesakes
-        for ( pTemp = pEntry->pNameSake; pTemp != pEntry; pTemp = pTemp->pNameSake )
-            if ( !strcmp(pTemp->Name, pName) && (Type == -1 || pTemp->Type == (unsigned)Type) )
-                return pTemp;
-    }
+    int iEntry, iSlot = Nm_ManTableSlot( p, pName, Nm_HashString(pName) );
+    for ( iEntry = p->pTable[iSlot]; iEntry >= 0; iEntry = p->pEntries[iEntry].iNextSake )
+        if ( Type == -1 || (int)p->pTypes[iEntry] == Type )
+            return p->pEntries + iEntry;
     return NULL;
 }
 
@@ -220,83 +362,40 @@ Nm_Entry_t * Nm_ManTableLookupName( Nm_Man_t * p, char * pName, int Type )
 ***********************************************************************/
 void Nm_ManProfile( Nm_Man_t * p )
 {
-    Nm_Entry_t * pEntry;
-    int Counter, e;
-    printf( "I2N table: " );
-    for ( e = 0; e < p->nBins; e++ )
-    {
-        Counter = 0;
-        for ( pEntry = p->pBinsI2N[e]; pEntry; pEntry = pEntry->pNextI2N )
-            Counter++;
-        printf( "%d ", Counter );
-    }
-    printf( "\n" );
-    printf( "N2I table: " );
-    for ( e = 0; e < p->nBins; e++ )
-    {
-        Counter = 0;
-        for ( pEntry = p->pBinsN2I[e]; pEntry; pEntry = pEntry->pNextN2I )
-            Counter++;
-        printf( "%d ", Counter );
-    }
-    printf( "\n" );
+    int i, iSlot, nProbes = 0;
+    for ( i = 0; i <= p->nTableMask; i++ )
+        if ( p->pTable[i] != -1 )
+            for ( iSlot = Nm_HashString(p->pEntries[p->pTable[i]].pName) & p->nTableMask; iSlot != i; iSlot = (iSlot + 1) & p->nTableMask )
+                nProbes++;
+    printf( "Entries = %d. Names = %d. Table = %d. Extra probes per name = %.2f. Name memory = %.2f MB.\n", 
+        p->nEntries, p->nNames, p->nTableMask + 1, 1.0 * nProbes / Abc_MaxInt(p->nNames, 1), 
+        1.0 * Extra_MmFlexReadMemUsage(p->pMem) / (1 << 20) );
 }
 
 /**Function*************************************************************
 
   Synopsis    [Resizes the table.]
 
-  Description []
+  Description [The hash values are recomputed from the names.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Nm_ManResize( Nm_Man_t * p )
+void Nm_ManResize( Nm_Man_t * p, int nTableSize )
 {
-    Nm_Entry_t ** pBinsNewI2N, ** pBinsNewN2I, * pEntry, * pEntry2, ** ppSpot;
-    int nBinsNew, Counter, e;
-    abctime clk;
-
-clk = Abc_Clock();
-    // get the new table size
-    nBinsNew = Abc_PrimeCudd( p->nGrowthFactor * p->nBins ); 
-    // allocate a new array
-    pBinsNewI2N = ABC_ALLOC( Nm_Entry_t *, nBinsNew );
-    pBinsNewN2I = ABC_ALLOC( Nm_Entry_t *, nBinsNew );
-    memset( pBinsNewI2N, 0, sizeof(Nm_Entry_t *) * nBinsNew );
-    memset( pBinsNewN2I, 0, sizeof(Nm_Entry_t *) * nBinsNew );
-    // rehash entries in Id->Name table
-    Counter = 0;
-    for ( e = 0; e < p->nBins; e++ )
-        for ( pEntry = p->pBinsI2N[e], pEntry2 = pEntry? pEntry->pNextI2N : NULL; 
-              pEntry; pEntry = pEntry2, pEntry2 = pEntry? pEntry->pNextI2N : NULL )
-            {
-                ppSpot = pBinsNewI2N + Nm_HashNumber(pEntry->ObjId, nBinsNew);
-                pEntry->pNextI2N = *ppSpot;
-                *ppSpot = pEntry;
-                Counter++;
-            }
-    // rehash entries in Name->Id table
-    for ( e = 0; e < p->nBins; e++ )
-        for ( pEntry = p->pBinsN2I[e], pEntry2 = pEntry? pEntry->pNextN2I : NULL; 
-              pEntry; pEntry = pEntry2, pEntry2 = pEntry? pEntry->pNextN2I : NULL )
-            {
-                ppSpot = pBinsNewN2I + Nm_HashString(pEntry->Name, nBinsNew);
-                pEntry->pNextN2I = *ppSpot;
-                *ppSpot = pEntry;
-            }
-    assert( Counter == p->nEntries );
-//    printf( "Increasing the structural table size from %6d to %6d. ", p->nBins, nBinsNew );
-//    ABC_PRT( "Time", Abc_Clock() - clk );
-    // replace the table and the parameters
-    ABC_FREE( p->pBinsI2N );
-    ABC_FREE( p->pBinsN2I );
-    p->pBinsI2N = pBinsNewI2N;
-    p->pBinsN2I = pBinsNewN2I;
-    p->nBins = nBinsNew;
-//    Nm_ManProfile( p );
+    int * pTable = p->pTable, nTableSizeOld = p->nTableMask + 1, i, iSlot;
+    assert( nTableSize > nTableSizeOld );
+    p->nTableMask = nTableSize - 1;
+    p->pTable     = ABC_FALLOC( int, nTableSize );
+    for ( i = 0; i < nTableSizeOld; i++ )
+        if ( pTable[i] != -1 )
+        {
+            for ( iSlot = Nm_HashString(p->pEntries[pTable[i]].pName) & p->nTableMask; p->pTable[iSlot] != -1; iSlot = (iSlot + 1) & p->nTableMask );
+            p->pTable[iSlot] = pTable[i];
+        }
+    ABC_FREE( pTable );
 }
 
 
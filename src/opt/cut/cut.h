@@ -114,6 +114,7 @@ extern void             Cut_NodeWriteCutsNew( Cut_Man_t * p, int Node, Cut_Cut_t
 extern void             Cut_NodeWriteCutsOld( Cut_Man_t * p, int Node, Cut_Cut_t * pList );
 extern void             Cut_NodeWriteCutsTemp( Cut_Man_t * p, int Node, Cut_Cut_t * pList );
 extern void             Cut_NodeSetTriv( Cut_Man_t * p, int Node );
+extern void             Cut_NodeCopyCuts( Cut_Man_t * p, Cut_Man_t * pFrom, int Node );
 extern void             Cut_NodeTryDroppingCuts( Cut_Man_t * p, int Node );
 extern void             Cut_NodeFreeCuts( Cut_Man_t * p, int Node );
 /*=== cutCut.c ==========================================================*/
@@ -148,6 +148,36 @@ void Cut_NodeSetTriv( Cut_Man_t * p, int Node )
     Cut_NodeWriteCutsNew( p, Node, Cut_CutCreateTriv(p, Node) );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Copies the cuts of the node from another manager.]
+
+  Description [The managers should have the same parameters.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cut_NodeCopyCuts( Cut_Man_t * p, Cut_Man_t * pFrom, int Node )
+{
+    Cut_Cut_t * pList = NULL, ** ppTail = &pList, * pCut, * pCopy;
+    assert( p->EntrySize == pFrom->EntrySize );
+    assert( Cut_NodeReadCutsNew(p, Node) == NULL );
+    Cut_ListForEachCut( Cut_NodeReadCutsNew(pFrom, Node), pCut )
+    {
+        pCopy = Cut_CutAlloc( p );
+        memcpy( pCopy, pCut, (size_t)p->EntrySize );
+        if ( pCopy->nLeaves == 1 )
+            p->nCutsTriv++;
+        *ppTail = pCopy;
+        ppTail = &pCopy->pNext;
+    }
+    *ppTail = NULL;
+    Vec_PtrFillExtra( p->vCutsNew, Node + 1, NULL );
+    Cut_NodeWriteCutsNew( p, Node, pList );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Consider dropping cuts if they are useless by now.]
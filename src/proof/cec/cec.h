@@ -108,6 +108,7 @@ struct Cec_ParFra_t_
     int              nCallsRecycle; // calls to perform before recycling SAT solver
     int              nSatVarMax;    // the max number of SAT variables
     int              nGenIters;     // pattern generation iterations
+    int              nProcs;        // the number of threads for SAT sweeping
     int              fRewriting;    // enables AIG rewriting
     int              fCheckMiter;   // the circuit is the miter
 //    int              fFirstStop;    // stop on the first sat output
@@ -120,6 +121,7 @@ struct Cec_ParFra_t_
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
     int              iOutFail;      // the failed output
+    int              nProvedPar;    // the number of equivalences proved by parallel sweeping
     int              fBMiterInfo;   // printing BMiter information
     int              nPO;           // number of po in original design given a bmiter
     char *           pDumpName;     // file name to dump statistics
@@ -131,6 +133,7 @@ struct Cec_ParCec_t_
 {
     int              nBTLimit;      // conflict limit at a node
     int              TimeLimit;     // the runtime limit in seconds
+    int              nProcs;        // the number of threads for SAT sweeping
 //    int              fFirstStop;    // stop on the first sat output
     int              fUseSmartCnf;  // use smart CNF computation
     int              fRewriting;    // enables AIG rewriting
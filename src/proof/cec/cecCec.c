@@ -212,6 +212,52 @@ int Cec_ManHandleSpecialCases( Gia_Man_t * p, Cec_ParCec_t * pPars )
     return -1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Benchmarks propagation of the SAT solver on the CNF of the AIG.]
+
+  Description [Performs the given number of rounds of random decisions,
+  each followed by propagation, until a conflict or a complete assignment.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManSatPropBench( Gia_Man_t * p, int nRounds, int fVerbose )
+{
+    abctime clk = Abc_Clock(), clkProp;
+    Cnf_Dat_t * pCnf = (Cnf_Dat_t *)Mf_ManGenerateCnf( p, 8, 0, 0, 0, 0 );
+    sat_solver * pSat = (sat_solver *)Cnf_DataWriteIntoSolver( pCnf, 1, 0 );
+    int nConfls;
+    if ( pSat == NULL )
+    {
+        Abc_Print( 1, "The CNF is trivially UNSAT.\n" );
+        Cnf_DataFree( pCnf );
+        return;
+    }
+    Abc_Print( 1, "CNF: Vars = %d. Clauses = %d. Literals = %d.  ", pCnf->nVars, pCnf->nClauses, pCnf->nLiterals );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    clk = Abc_Clock();
+    nConfls = sat_solver_propagate_bench( pSat, nRounds );
+    clkProp = Abc_Clock() - clk;
+    if ( nConfls == -1 )
+    {
+        Abc_Print( 1, "The CNF is UNSAT after propagating the unit clauses.\n" );
+        sat_solver_delete( pSat );
+        Cnf_DataFree( pCnf );
+        return;
+    }
+    Abc_Print( 1, "Rounds = %d. Conflicts = %d. Propagations = %.0f. Inspects = %.0f. ",
+        nRounds, nConfls, (double)pSat->stats.propagations, (double)pSat->stats.inspects );
+    Abc_Print( 1, "Props/sec = %.2f M.  ", clkProp ? 1.0 * pSat->stats.propagations / clkProp * CLOCKS_PER_SEC / 1000000 : 0.0 );
+    Abc_PrintTime( 1, "Time", clkProp );
+    if ( fVerbose )
+        Sat_SolverPrintStats( stdout, pSat );
+    sat_solver_delete( pSat );
+    Cnf_DataFree( pCnf );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Performs naive checking.]
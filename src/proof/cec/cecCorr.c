@@ -20,6 +20,17 @@
 
 #include "cecInt.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -910,6 +921,106 @@ int Cec_ManLSCorrAnalyzeDependence( Gia_Man_t * p, Vec_Int_t * vEquivs, Vec_Str_
     return 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs of the speculatively reduced model in batches.]
+
+  Description [Divides the outputs into batches of consecutive outputs,
+  one for each thread, and solves each batch by a separate solver.
+  The counter-examples and the statuses of the batches are merged in
+  the order of the outputs, so that the classes are refined once for
+  all batches. Returns NULL if the outputs should be solved by one
+  solver.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifndef ABC_USE_PTHREADS
+
+Vec_Int_t * Cec_ManLSCorrSolveBatches( Gia_Man_t * pSrm, Cec_ParCor_t * pPars, Cec_ParSat_t * pParsSat, Vec_Str_t ** pvStatus ) { return NULL; }
+
+#else // pthreads are used
+
+#define CEC_CORR_THR_MAX 100
+typedef struct Cec_CorrThData_t_
+{
+    Gia_Man_t *      pBatch;       // the outputs of one batch
+    int              iFirst;       // the first output of the batch
+    int              nBTLimit;     // the conflict limit of the circuit-based solver
+    int              fUseCSat;     // use the circuit-based solver
+    Cec_ParSat_t     ParsSat;      // the parameters of the SAT solver
+    Vec_Int_t *      vCexStore;    // the counter-examples of the batch
+    Vec_Str_t *      vStatus;      // the statuses of the batch outputs
+} Cec_CorrThData_t;
+
+void * Cec_ManLSCorrWorkerThread( void * pArg )
+{
+    Cec_CorrThData_t * pThData = (Cec_CorrThData_t *)pArg;
+    if ( pThData->fUseCSat )
+        pThData->vCexStore = Cbs_ManSolveMiterNc( pThData->pBatch, pThData->nBTLimit, &pThData->vStatus, 0, 0 );
+    else
+        pThData->vCexStore = Cec_ManSatSolveMiter( pThData->pBatch, &pThData->ParsSat, &pThData->vStatus );
+    return NULL;
+}
+Vec_Int_t * Cec_ManLSCorrSolveBatches( Gia_Man_t * pSrm, Cec_ParCor_t * pPars, Cec_ParSat_t * pParsSat, Vec_Str_t ** pvStatus )
+{
+    Cec_CorrThData_t ThData[CEC_CORR_THR_MAX];
+    pthread_t WorkerThread[CEC_CORR_THR_MAX];
+    Vec_Int_t * vCexStore, * vOuts;
+    Vec_Str_t * vStatus;
+    int nOuts = Gia_ManPoNum(pSrm);
+    int nBatches = Abc_MinInt( Abc_MinInt(pPars->nProcs, CEC_CORR_THR_MAX), nOuts );
+    int i, k, iStart, nLits, status;
+    if ( nBatches < 2 )
+        return NULL;
+    // derive the batches before starting the threads, which do not touch the model
+    vOuts = Vec_IntStartNatural( nOuts );
+    for ( i = 0; i < nBatches; i++ )
+    {
+        ThData[i].iFirst    = i * nOuts / nBatches;
+        ThData[i].pBatch    = Gia_ManDupCones( pSrm, Vec_IntEntryP(vOuts, ThData[i].iFirst), (i+1) * nOuts / nBatches - ThData[i].iFirst, 0 );
+        ThData[i].nBTLimit  = pPars->nBTLimit;
+        ThData[i].fUseCSat  = pPars->fUseCSat;
+        ThData[i].ParsSat   = *pParsSat;
+        ThData[i].vCexStore = NULL;
+        ThData[i].vStatus   = NULL;
+        assert( Gia_ManCiNum(ThData[i].pBatch) == Gia_ManCiNum(pSrm) );
+    }
+    Vec_IntFree( vOuts );
+    for ( i = 0; i < nBatches; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Cec_ManLSCorrWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nBatches; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    // merge the results, renumbering the outputs of each batch
+    vStatus   = Vec_StrAlloc( nOuts );
+    vCexStore = Vec_IntAlloc( 10000 );
+    for ( i = 0; i < nBatches; i++ )
+    {
+        for ( k = 0; k < Vec_StrSize(ThData[i].vStatus); k++ )
+            Vec_StrPush( vStatus, Vec_StrEntry(ThData[i].vStatus, k) );
+        for ( iStart = 0; iStart < Vec_IntSize(ThData[i].vCexStore); )
+        {
+            Vec_IntPush( vCexStore, ThData[i].iFirst + Vec_IntEntry(ThData[i].vCexStore, iStart++) );
+            nLits = Vec_IntEntry( ThData[i].vCexStore, iStart++ );
+            Vec_IntPush( vCexStore, nLits );
+            for ( k = 0; k < nLits; k++ )
+                Vec_IntPush( vCexStore, Vec_IntEntry(ThData[i].vCexStore, iStart++) );
+        }
+        Vec_IntFree( ThData[i].vCexStore );
+        Vec_StrFree( ThData[i].vStatus );
+        Gia_ManStop( ThData[i].pBatch );
+    }
+    assert( Vec_StrSize(vStatus) == nOuts );
+    *pvStatus = vStatus;
+    return vCexStore;
+}
+
+#endif // pthreads are used
+
 /**Function*************************************************************
 
   Synopsis    [Internal procedure for register correspondence.]
@@ -1010,9 +1121,10 @@ int Cec_ManLSCorrespondenceClasses( Gia_Man_t * pAig, Cec_ParCor_t * pPars )
 //Gia_DumpAiger( pSrm, "corrsrm", r, 2 );
         // found counter-examples to speculation
         clk2 = Abc_Clock();
-        if ( pPars->fUseCSat )
+        vCexStore = pPars->nProcs > 1 ? Cec_ManLSCorrSolveBatches( pSrm, pPars, pParsSat, &vStatus ) : NULL;
+        if ( vCexStore == NULL && pPars->fUseCSat )
             vCexStore = Cbs_ManSolveMiterNc( pSrm, pPars->nBTLimit, &vStatus, 0, 0 );
-        else
+        else if ( vCexStore == NULL )
             vCexStore = Cec_ManSatSolveMiter( pSrm, pParsSat, &vStatus );
         Gia_ManStop( pSrm );
         clkSat += Abc_Clock() - clk2;
@@ -70,7 +70,7 @@ int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, in
   SeeAlso     []
 
 ***********************************************************************/
-int Cec_GiaProveOne( Gia_Man_t * p, int iEngine, int nTimeOut, int fVerbose )
+int Cec_GiaProveOne( Gia_Man_t * p, int iEngine, int nTimeOut, int(*pFuncStop)(int), int fVerbose )
 {
     abctime clk = Abc_Clock();   
     int RetValue = -1;
@@ -82,16 +82,20 @@ int Cec_GiaProveOne( Gia_Man_t * p, int iEngine, int nTimeOut, int fVerbose )
     {
         Ssw_RarPars_t Pars, * pPars = &Pars;
         Ssw_RarSetDefaultParams( pPars );
-        pPars->TimeOut = nTimeOut;
-        pPars->fSilent = 1;
+        pPars->TimeOut   = nTimeOut;
+        pPars->fSilent   = 1;
+        pPars->RunId     = iEngine;
+        pPars->pFuncStop = pFuncStop;
         RetValue = Ssw_RarSimulateGia( p, pPars );
     }
     else if ( iEngine == 1 )
     {
         Saig_ParBmc_t Pars, * pPars = &Pars;
         Saig_ParBmcSetDefaultParams( pPars );
-        pPars->nTimeOut = nTimeOut;
-        pPars->fSilent  = 1;
+        pPars->nTimeOut  = nTimeOut;
+        pPars->fSilent   = 1;
+        pPars->RunId     = iEngine;
+        pPars->pFuncStop = pFuncStop;
         Aig_Man_t * pAig = Gia_ManToAigSimple( p );
         RetValue = Saig_ManBmcScalable( pAig, pPars );
         p->pCexSeq = pAig->pSeqModel; pAig->pSeqModel = NULL;
@@ -101,8 +105,10 @@ int Cec_GiaProveOne( Gia_Man_t * p, int iEngine, int nTimeOut, int fVerbose )
     {
         Pdr_Par_t Pars, * pPars = &Pars;
         Pdr_ManSetDefaultParams( pPars );
-        pPars->nTimeOut = nTimeOut;
-        pPars->fSilent  = 1;
+        pPars->nTimeOut  = nTimeOut;
+        pPars->fSilent   = 1;
+        pPars->RunId     = iEngine;
+        pPars->pFuncStop = pFuncStop;
         Aig_Man_t * pAig = Gia_ManToAigSimple( p );
         RetValue = Pdr_ManSolve( pAig, pPars );
         p->pCexSeq = pAig->pSeqModel; pAig->pSeqModel = NULL;
@@ -115,6 +121,8 @@ int Cec_GiaProveOne( Gia_Man_t * p, int iEngine, int nTimeOut, int fVerbose )
         pPars->fUseGlucose = 1;
         pPars->nTimeOut    = nTimeOut;
         pPars->fSilent     = 1;
+        pPars->RunId       = iEngine;
+        pPars->pFuncStop   = pFuncStop;
         Aig_Man_t * pAig = Gia_ManToAigSimple( p );
         RetValue = Saig_ManBmcScalable( pAig, pPars );
         p->pCexSeq = pAig->pSeqModel; pAig->pSeqModel = NULL;
@@ -124,9 +132,11 @@ int Cec_GiaProveOne( Gia_Man_t * p, int iEngine, int nTimeOut, int fVerbose )
     {
         Pdr_Par_t Pars, * pPars = &Pars;
         Pdr_ManSetDefaultParams( pPars );
-        pPars->fUseAbs  = 1;
-        pPars->nTimeOut = nTimeOut;
-        pPars->fSilent  = 1;
+        pPars->fUseAbs   = 1;
+        pPars->nTimeOut  = nTimeOut;
+        pPars->fSilent   = 1;
+        pPars->RunId     = iEngine;
+        pPars->pFuncStop = pFuncStop;
         Aig_Man_t * pAig = Gia_ManToAigSimple( p );
         RetValue = Pdr_ManSolve( pAig, pPars );
         p->pCexSeq = pAig->pSeqModel; pAig->pSeqModel = NULL;
@@ -140,6 +150,8 @@ int Cec_GiaProveOne( Gia_Man_t * p, int iEngine, int nTimeOut, int fVerbose )
         pPars->nFramesAdd    =        1;  // the number of additional frames
         pPars->fNotVerbose   =        1;  // silent
         pPars->nTimeOut      = nTimeOut;  // timeout in seconds
+        pPars->RunId         =  iEngine;  // the engine id
+        pPars->pFuncStop     = pFuncStop; // the callback to terminate
         RetValue = Bmcg_ManPerform( p, pPars );
     }
     else assert( 0 );
@@ -184,6 +196,21 @@ Gia_Man_t * Cec_GiaScorrNew( Gia_Man_t * p )
 
 ***********************************************************************/
 #define PAR_THR_MAX 8
+
+// The channel shared by the engines and the main thread, which runs scorr.
+// The engines publish their verdicts. The main thread publishes the verdict
+// of scorr and each miter reduced by scorr, which contains the equivalences
+// it proved and has the outputs it proved replaced by constant 0. Every
+// engine polls the channel through its stop callback and terminates as soon
+// as the problem is solved or a miter smaller than its own is published,
+// in which case the next round of engines starts on the reduced miter.
+typedef struct Cec_ProveShr_t_
+{
+    int         RetValue;                  // the verdict (-1 = undecided)
+    int         iVersion;                  // the number of miters published
+    int         nProved;                   // the outputs proved by scorr
+} Cec_ProveShr_t;
+
 typedef struct Par_ThData_t_
 {
     Gia_Man_t * p;
@@ -192,11 +219,64 @@ typedef struct Par_ThData_t_
     int         nTimeOut;
     int         Result;
     int         fVerbose;
+    int         iVersion;                  // the miter solved by this engine
+    Cec_ProveShr_t * pShr;                 // the channel of this run
 } Par_ThData_t;
+
+// the data of the engine running in this thread, seen by its stop callback
+static __thread Par_ThData_t * s_pThData = NULL;
+
+static inline int  Cec_ProveShrLoad( int * pVar )
+{
+#if defined(__GNUC__)
+    return __atomic_load_n( pVar, __ATOMIC_ACQUIRE );
+#else
+    return *(volatile int *)pVar;
+#endif
+}
+static inline void Cec_ProveShrStore( int * pVar, int Value )
+{
+#if defined(__GNUC__)
+    __atomic_store_n( pVar, Value, __ATOMIC_RELEASE );
+#else
+    *(volatile int *)pVar = Value;
+#endif
+}
+int Cec_ProveShrStop( int RunId )
+{
+    Par_ThData_t * pThData = s_pThData;
+    if ( pThData == NULL )
+        return 0;
+    assert( pThData->iEngine == RunId );
+    if ( Cec_ProveShrLoad(&pThData->pShr->RetValue) != -1 )
+        return 1;
+    return Cec_ProveShrLoad(&pThData->pShr->iVersion) > pThData->iVersion;
+}
+void Cec_ProveShrSolved( Cec_ProveShr_t * pShr, int RetValue )
+{
+    if ( RetValue != -1 )
+        Cec_ProveShrStore( &pShr->RetValue, RetValue );
+}
+void Cec_ProveShrPublish( Cec_ProveShr_t * pShr, Gia_Man_t * p, Gia_Man_t * pNew )
+{
+    Gia_Obj_t * pObj; int i;
+    if ( Gia_ManAndNum(pNew) == 0 )
+    {
+        Cec_ProveShrSolved( pShr, 1 );
+        return;
+    }
+    pShr->nProved = 0;
+    Gia_ManForEachPo( pNew, pObj, i )
+        pShr->nProved += Gia_ObjFaninLit0p(pNew, pObj) == 0;
+    if ( Gia_ManAndNum(pNew) >= Gia_ManAndNum(p) )
+        return;
+    Cec_ProveShrStore( &pShr->iVersion, pShr->iVersion + 1 );
+}
 void * Cec_GiaProveWorkerThread( void * pArg )
 {
     Par_ThData_t * pThData = (Par_ThData_t *)pArg;
     volatile int * pPlace = &pThData->fWorking;
+    s_pThData = pThData;
     while ( 1 )
     {
         while ( *pPlace == 0 );
@@ -207,13 +287,14 @@ void * Cec_GiaProveWorkerThread( void * pArg )
             assert( 0 );
             return NULL;
         }
-        pThData->Result = Cec_GiaProveOne( pThData->p, pThData->iEngine, pThData->nTimeOut, pThData->fVerbose );
+        pThData->Result = Cec_GiaProveOne( pThData->p, pThData->iEngine, pThData->nTimeOut, Cec_ProveShrStop, pThData->fVerbose );
+        Cec_ProveShrSolved( pThData->pShr, pThData->Result );
         pThData->fWorking = 0;
     }
     assert( 0 );
     return NULL;
 }
-void Cec_GiaInitThreads( Par_ThData_t * ThData, int nProcs, Gia_Man_t * p, int nTimeOut, int fVerbose, pthread_t * WorkerThread )
+void Cec_GiaInitThreads( Par_ThData_t * ThData, int nProcs, Gia_Man_t * p, Cec_ProveShr_t * pShr, int nTimeOut, int fVerbose, pthread_t * WorkerThread )
 {
     int i, status;
     assert( nProcs <= PAR_THR_MAX );
@@ -225,6 +306,8 @@ void Cec_GiaInitThreads( Par_ThData_t * ThData, int nProcs, Gia_Man_t * p, int n
         ThData[i].fWorking = 0;
         ThData[i].Result   = -1;
         ThData[i].fVerbose = fVerbose;
+        ThData[i].iVersion = pShr->iVersion;
+        ThData[i].pShr     = pShr;
         if ( !WorkerThread )
             continue;
         status = pthread_create( WorkerThread + i, NULL,Cec_GiaProveWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
@@ -254,6 +337,7 @@ int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, in
     abctime clkScorr = 0, clkTotal = Abc_Clock();
     Par_ThData_t ThData[PAR_THR_MAX];
     pthread_t WorkerThread[PAR_THR_MAX];
+    Cec_ProveShr_t Shr, * pShr = &Shr;
     int i, RetValue = -1, RetEngine = -2;
     Abc_CexFreeP( &p->pCexComb );
     Abc_CexFreeP( &p->pCexSeq );        
@@ -264,23 +348,26 @@ int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, in
     fflush( stdout );
 
     assert( nProcs == 3 || nProcs == 5 );
-    Cec_GiaInitThreads( ThData, nProcs, p, nTimeOut, fVerbose, WorkerThread );
+    memset( pShr, 0, sizeof(Cec_ProveShr_t) );
+    pShr->RetValue = -1;
+    Cec_GiaInitThreads( ThData, nProcs, p, pShr, nTimeOut, fVerbose, WorkerThread );
 
     // meanwhile, perform scorr
     Gia_Man_t * pScorr = Cec_GiaScorrNew( p );
     clkScorr = Abc_Clock() - clkTotal;
     if ( Gia_ManAndNum(pScorr) == 0 )
         RetValue = 1, RetEngine = -1;
+    Cec_ProveShrPublish( pShr, p, pScorr );
     
     RetValue = Cec_GiaWaitThreads( ThData, nProcs, p, RetValue, &RetEngine );
     if ( RetValue == -1 )
     {
         abctime clkScorr2, clkStart = Abc_Clock();
         if ( !fSilent && fVerbose ) {
-            printf( "Reduced the miter from %d to %d nodes. ", Gia_ManAndNum(p), Gia_ManAndNum(pScorr) );
+            printf( "Reduced the miter from %d to %d nodes (%d outputs proved). ", Gia_ManAndNum(p), Gia_ManAndNum(pScorr), pShr->nProved );
             Abc_PrintTime( 1, "Time", clkScorr );
         }
-        Cec_GiaInitThreads( ThData, nProcs, pScorr, nTimeOut2, fVerbose, NULL );
+        Cec_GiaInitThreads( ThData, nProcs, pScorr, pShr, nTimeOut2, fVerbose, NULL );
 
         // meanwhile, perform scorr
         if ( Gia_ManAndNum(pScorr) < 100000 )
@@ -288,16 +375,17 @@ int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, in
             Gia_Man_t * pScorr2 = Cec_GiaScorrOld( pScorr );
             clkScorr2 = Abc_Clock() - clkStart;
             if ( Gia_ManAndNum(pScorr2) == 0 )
-                RetValue = 1;
+                RetValue = 1, RetEngine = -1;
+            Cec_ProveShrPublish( pShr, pScorr, pScorr2 );
         
             RetValue = Cec_GiaWaitThreads( ThData, nProcs, p, RetValue, &RetEngine );      
             if ( RetValue == -1 )
             {
                 if ( !fSilent && fVerbose ) {
-                    printf( "Reduced the miter from %d to %d nodes. ", Gia_ManAndNum(pScorr), Gia_ManAndNum(pScorr2) );
+                    printf( "Reduced the miter from %d to %d nodes (%d outputs proved). ", Gia_ManAndNum(pScorr), Gia_ManAndNum(pScorr2), pShr->nProved );
                     Abc_PrintTime( 1, "Time", clkScorr2 );
                 }
-                Cec_GiaInitThreads( ThData, nProcs, pScorr2, nTimeOut3, fVerbose, NULL );
+                Cec_GiaInitThreads( ThData, nProcs, pScorr2, pShr, nTimeOut3, fVerbose, NULL );
 
                 RetValue = Cec_GiaWaitThreads( ThData, nProcs, p, RetValue, &RetEngine );
                 // do something else      
@@ -313,6 +401,9 @@ int Cec_GiaProveTest( Gia_Man_t * p, int nProcs, int nTimeOut, int nTimeOut2, in
         ThData[i].p = NULL;
         ThData[i].fWorking = 1;
     }
+    // wait for them to exit, because they poll the data on this stack frame
+    for ( i = 0; i < nProcs; i++ )
+        pthread_join( WorkerThread[i], NULL );
     if ( !fSilent )
     {
         printf( "Problem \"%s\" is ", p->pSpec );
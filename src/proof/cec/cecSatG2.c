@@ -22,6 +22,16 @@
 #include "misc/util/utilTruth.h"
 #include "cec.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 #define USE_GLUCOSE2
 
 #ifdef USE_GLUCOSE2
@@ -105,6 +115,7 @@ struct Cec4_Man_t_
     int              iPosRead;       // candidate reading position
     int              iPosWrite;      // candidate writing position
     int              iLastConst;     // last const node proved
+    Vec_Int_t *      vProvedPar;     // representatives proved by parallel sweeping (-1 if none)
     // refinement
     Vec_Int_t *      vRefClasses;
     Vec_Int_t *      vRefNodes;
@@ -122,6 +133,7 @@ struct Cec4_Man_t_
     int              nCallsSince;
     int              nSimulates;
     int              nRecycles;
+    int              nProvedPar;
     int              nConflicts[2][3];
     int              nGates[2];
     int              nFaster[2];
@@ -219,6 +231,7 @@ void Cec4_ManSetParams( Cec_ParFra_t * pPars )
     pPars->nSatVarMax     =    1000;    // the max number of SAT variables before recycling SAT solver
     pPars->nCallsRecycle  =     500;    // calls to perform before recycling SAT solver
     pPars->nGenIters      =     100;    // pattern generation iterations
+    pPars->nProcs         =       1;    // the number of threads
     pPars->fBMiterInfo    =       0;    // printing BMiter information
 }
 
@@ -308,6 +321,7 @@ void Cec4_ManDestroy( Cec4_Man_t * p )
     Vec_IntFreeP( &p->vDisprPairs );
     Vec_BitFreeP( &p->vFails );
     Vec_IntFreeP( &p->vPairs );
+    Vec_IntFreeP( &p->vProvedPar );
     Vec_BitFreeP( &p->vCoDrivers );
     Vec_IntFreeP( &p->vRefClasses );
     Vec_IntFreeP( &p->vRefNodes );
@@ -1617,6 +1631,14 @@ int Cec4_ManSweepNode( Cec4_Man_t * p, int iObj, int iRepr )
     Gia_Obj_t * pRepr = Gia_ManObj( p->pAig, iRepr );
     int fCompl = Abc_LitIsCompl(pObj->Value) ^ Abc_LitIsCompl(pRepr->Value) ^ pObj->fPhase ^ pRepr->fPhase;
     int fEffort = p->vCoDrivers ? Vec_BitEntry(p->vCoDrivers, iObj) || Vec_BitEntry(p->vCoDrivers, iRepr) : 0;
+    if ( p->vProvedPar && Vec_IntEntry(p->vProvedPar, iObj) == iRepr ) // proved by parallel sweeping
+    {
+        pObj->Value = Abc_LitNotCond( pRepr->Value, fCompl );
+        Gia_ObjSetProved( p->pAig, iObj );
+        if ( iRepr == 0 )
+            p->iLastConst = iObj;
+        return 1;
+    }
     status = Cec4_ManSolveTwo( p, Abc_Lit2Var(pRepr->Value), Abc_Lit2Var(pObj->Value), fCompl, &fEasy, p->pPars->fVerbose, fEffort );
     if ( status == GLUCOSE_SAT )
     {
@@ -1825,6 +1847,370 @@ void Cec4_ManSimulateDumpInfo( Cec4_Man_t * pMan )
     Vec_WrdFree( vSims );
     Vec_WrdFree( vSimsPi );
 }
+/**Function*************************************************************
+
+  Synopsis    [Parallel SAT sweeping.]
+
+  Description [Before the sequential sweep, the candidate equivalences are
+  solved by several threads. Each class (or a chunk of a large class) is a
+  task, solved by the thread that takes it using its own SAT solver and the
+  CNF of the cones of the class members in the original AIG. The proved
+  pairs are remembered and later merged by the sequential sweep without
+  calling the SAT solver. The counter-examples found by all threads are
+  simulated together to refine the classes, after which the remaining
+  candidates are distributed again.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+#ifdef ABC_USE_PTHREADS
+
+#define CEC4_PAR_THR_MAX  100
+#define CEC4_PAR_CHUNK     64   // the max number of class members in one task
+#define CEC4_PAR_TASKS      8   // the number of tasks per thread in one round
+#define CEC4_PAR_LEVELS     2   // the number of logic levels solved in one round
+
+typedef struct Cec4_ParMan_t_ Cec4_ParMan_t;
+struct Cec4_ParMan_t_
+{
+    Gia_Man_t *      pAig;       // the AIG (not modified while the threads run)
+    Cec_ParFra_t *   pPars;      // parameters
+    Vec_Int_t *      vProved;    // the representatives of the members proved in the previous rounds
+    Vec_Int_t *      vTasks;     // tasks: the representative, followed by the members, followed by -1
+    Vec_Int_t *      vStarts;    // the first entry of each task
+    int              iNext;      // the next task to be taken
+    pthread_mutex_t  Mutex;      // protects iNext
+};
+
+typedef struct Cec4_ParThr_t_ Cec4_ParThr_t;
+struct Cec4_ParThr_t_
+{
+    Cec4_ParMan_t *  pMan;       // shared data
+    sat_solver *     pSat;       // the SAT solver of this thread
+    int *            pSatLits;   // the SAT literals of the AIG objects (-1 if none)
+    Vec_Int_t *      vUsed;      // the objects with SAT variables, in the order of variables
+    Vec_Int_t *      vProved;    // the proved pairs (representative, member)
+    Vec_Int_t *      vPats;      // the counter-examples (literal count, followed by CI literals)
+    Vec_Int_t *      vFailed;    // the undecided members
+    Vec_Int_t *      vDisproved; // the disproved pairs (representative, member)
+    int              nCalls;     // the number of SAT calls
+};
+
+static void Cec4_ParSolverRestart( Cec4_ParThr_t * p )
+{
+    if ( p->pSat )
+        sat_solver_stop( p->pSat );
+    p->pSat = sat_solver_start();
+    sat_solver_set_jftr( p->pSat, p->pMan->pPars->jType );
+    memset( p->pSatLits, 0xFF, sizeof(int) * Gia_ManObjNum(p->pMan->pAig) );
+    Vec_IntClear( p->vUsed );
+}
+static inline int Cec4_ParObjProvedLit( Cec4_ParThr_t * p, int iRepr, int iObj, int iReprLit )
+{
+    Gia_Man_t * pAig = p->pMan->pAig;
+    return Abc_LitNotCond( iReprLit, Gia_ManObj(pAig, iRepr)->fPhase ^ Gia_ManObj(pAig, iObj)->fPhase );
+}
+static int Cec4_ParObjSatLit_rec( Cec4_ParThr_t * p, int iObj )
+{
+    Gia_Obj_t * pObj = Gia_ManObj( p->pMan->pAig, iObj );
+    int jType = p->pMan->pPars->jType;
+    int iRepr, iVar, Lit0 = -1, Lit1 = -1;
+    if ( p->pSatLits[iObj] >= 0 )
+        return p->pSatLits[iObj];
+    // the members proved earlier share the literal of their representative
+    iRepr = Vec_IntEntry( p->pMan->vProved, iObj );
+    if ( iRepr >= 0 )
+        return p->pSatLits[iObj] = Cec4_ParObjProvedLit( p, iRepr, iObj, Cec4_ParObjSatLit_rec(p, iRepr) );
+    if ( Gia_ObjIsAnd(pObj) )
+    {
+        Lit0 = Abc_LitNotCond( Cec4_ParObjSatLit_rec(p, Gia_ObjFaninId0(pObj, iObj)), Gia_ObjFaninC0(pObj) );
+        Lit1 = Abc_LitNotCond( Cec4_ParObjSatLit_rec(p, Gia_ObjFaninId1(pObj, iObj)), Gia_ObjFaninC1(pObj) );
+        // the fanins may have become equal after merging
+        if ( Abc_Lit2Var(Lit0) == Abc_Lit2Var(Lit1) )
+        {
+            if ( Gia_ObjIsXor(pObj) )
+                return p->pSatLits[iObj] = Abc_LitNotCond( Cec4_ParObjSatLit_rec(p, 0), Lit0 != Lit1 );
+            return p->pSatLits[iObj] = Lit0 == Lit1 ? Lit0 : Cec4_ParObjSatLit_rec(p, 0);
+        }
+    }
+    // the SAT variables are the indexes of the objects in vUsed
+    iVar = sat_solver_addvar( p->pSat );
+    assert( iVar == Vec_IntSize(p->vUsed) );
+    p->pSatLits[iObj] = Abc_Var2Lit( iVar, 0 );
+    Vec_IntPush( p->vUsed, iObj );
+    if ( iObj == 0 )
+    {
+        int Lit = Abc_Var2Lit( iVar, 1 );
+        sat_solver_addclause( p->pSat, &Lit, 1 );
+        return p->pSatLits[iObj];
+    }
+    if ( Gia_ObjIsCi(pObj) )
+        return p->pSatLits[iObj];
+    // the same CNF as in Cec4_ObjGetCnfVar(), without detecting XORs
+    if ( jType < 2 )
+    {
+        if ( Gia_ObjIsXor(pObj) )
+            sat_solver_add_xor( p->pSat, iVar, Abc_Lit2Var(Lit0), Abc_Lit2Var(Lit1), Abc_LitIsCompl(Lit0) ^ Abc_LitIsCompl(Lit1) );
+        else
+            sat_solver_add_and( p->pSat, iVar, Abc_Lit2Var(Lit0), Abc_Lit2Var(Lit1), Abc_LitIsCompl(Lit0), Abc_LitIsCompl(Lit1), 0 );
+    }
+    if ( jType > 0 )
+    {
+        if ( (Lit0 > Lit1) ^ Gia_ObjIsXor(pObj) )
+             Lit1 ^= Lit0, Lit0 ^= Lit1, Lit1 ^= Lit0;
+        sat_solver_set_var_fanin_lit( p->pSat, iVar, Lit0, Lit1 );
+    }
+    return p->pSatLits[iObj];
+}
+// checks that iObj is equal to iRepr complemented by fPhase, in both directions
+static int Cec4_ParSolvePair( Cec4_ParThr_t * p, int iRepr, int iObj, int fPhase )
+{
+    int iLit0 = Cec4_ParObjSatLit_rec( p, iRepr );
+    int iLit1 = Abc_LitNotCond( Cec4_ParObjSatLit_rec(p, iObj), fPhase );
+    int k, status = GLUCOSE_UNSAT, Lits[2];
+    if ( iLit0 == iLit1 )
+        return GLUCOSE_UNSAT;
+    if ( p->pMan->pPars->jType > 0 )
+    {
+        sat_solver_start_new_round( p->pSat );
+        sat_solver_mark_cone( p->pSat, Abc_Lit2Var(iLit0) );
+        sat_solver_mark_cone( p->pSat, Abc_Lit2Var(iLit1) );
+    }
+    for ( k = 0; k < 2 && status == GLUCOSE_UNSAT; k++ )
+    {
+        Lits[0] = Abc_LitNotCond( iLit0, !k );
+        Lits[1] = Abc_LitNotCond( iLit1, k );
+        sat_solver_set_conflict_budget( p->pSat, p->pMan->pPars->nBTLimit );
+        status = sat_solver_solve( p->pSat, Lits, 2 );
+        p->nCalls++;
+    }
+    return status;
+}
+static int Cec4_ParNextTask( Cec4_ParMan_t * p )
+{
+    int iTask;
+    pthread_mutex_lock( &p->Mutex );
+    iTask = p->iNext < Vec_IntSize(p->vStarts) ? p->iNext++ : -1;
+    pthread_mutex_unlock( &p->Mutex );
+    return iTask;
+}
+static void * Cec4_ParWorkerThread( void * pArg )
+{
+    Cec4_ParThr_t * p = (Cec4_ParThr_t *)pArg;
+    Gia_Man_t * pAig = p->pMan->pAig;
+    int nSatVarMax = p->pMan->pPars->nSatVarMax;
+    int i, k, iTask, iRepr, iObj, iCi, status;
+    while ( (iTask = Cec4_ParNextTask(p->pMan)) >= 0 )
+    {
+        int * pTask = Vec_IntEntryP( p->pMan->vTasks, Vec_IntEntry(p->pMan->vStarts, iTask) );
+        if ( p->pSat == NULL || (nSatVarMax && Vec_IntSize(p->vUsed) > nSatVarMax) )
+            Cec4_ParSolverRestart( p );
+        iRepr = pTask[0];
+        for ( i = 1; (iObj = pTask[i]) >= 0; i++ )
+        {
+            int fPhase = Gia_ManObj(pAig, iRepr)->fPhase ^ Gia_ManObj(pAig, iObj)->fPhase;
+            status = Cec4_ParSolvePair( p, iRepr, iObj, fPhase );
+            if ( status == GLUCOSE_UNSAT )
+            {
+                Vec_IntPushTwo( p->vProved, iRepr, iObj );
+                p->pSatLits[iObj] = Cec4_ParObjProvedLit( p, iRepr, iObj, p->pSatLits[iRepr] );
+            }
+            else if ( status == GLUCOSE_UNDEC )
+                Vec_IntPush( p->vFailed, iObj );
+            else // the other members wait for the refinement
+            {
+                int iStart;
+                Vec_IntPushTwo( p->vDisproved, iRepr, iObj );
+                iStart = Vec_IntSize( p->vPats );
+                Vec_IntPush( p->vPats, 0 );
+                if ( p->pMan->pPars->jType == 0 )
+                {
+                    Vec_IntForEachEntry( p->vUsed, iCi, k )
+                        if ( Gia_ObjIsCi(Gia_ManObj(pAig, iCi)) )
+                            Vec_IntPush( p->vPats, Abc_Var2Lit(iCi, sat_solver_read_cex_varvalue(p->pSat, k)) );
+                }
+                else
+                {
+                    int * pCex = sat_solver_read_cex( p->pSat );
+                    for ( k = 1; k <= pCex[0]; k++ )
+                        Vec_IntPush( p->vPats, Abc_Lit2LitV(Vec_IntArray(p->vUsed), Abc_LitNot(pCex[k])) );
+                }
+                Vec_IntWriteEntry( p->vPats, iStart, Vec_IntSize(p->vPats) - iStart - 1 );
+                break;
+            }
+        }
+    }
+    return NULL;
+}
+static inline int Cec4_ManParObjIsCand( Gia_Man_t * p, Cec4_Man_t * pMan, Vec_Bit_t * vSkip, int iObj )
+{
+    return Vec_IntEntry(pMan->vProvedPar, iObj) < 0 && !Vec_BitEntry(pMan->vFails, iObj) && !Vec_BitEntry(vSkip, iObj);
+}
+static int Cec4_ManCollectParTasks( Gia_Man_t * p, Cec4_Man_t * pMan, Vec_Bit_t * vSkip, Vec_Int_t * vTasks, Vec_Int_t * vStarts, int nTasksMax )
+{
+    int iRepr, iObj, nCands = 0, nMembers = 0, LevelMin = ABC_INFINITY;
+    Vec_IntClear( vTasks );
+    Vec_IntClear( vStarts );
+    // like the sequential sweep, go from the inputs to the outputs, so that 
+    // the cones of the deeper members use the literals proved in earlier rounds
+    Gia_ManForEachClass0( p, iRepr )
+        Gia_ClassForEachObj1( p, iRepr, iObj )
+            if ( Cec4_ManParObjIsCand(p, pMan, vSkip, iObj) )
+                LevelMin = Abc_MinInt( LevelMin, Gia_ObjLevelId(p, iObj) );
+    Gia_ManForEachClass0( p, iRepr )
+    {
+        nMembers = 0;
+        Gia_ClassForEachObj1( p, iRepr, iObj )
+        {
+            if ( !Cec4_ManParObjIsCand(p, pMan, vSkip, iObj) || Gia_ObjLevelId(p, iObj) >= LevelMin + CEC4_PAR_LEVELS )
+                continue;
+            if ( nMembers == CEC4_PAR_CHUNK )
+            {
+                Vec_IntPush( vTasks, -1 );
+                nMembers = 0;
+            }
+            if ( nMembers == 0 )
+            {
+                if ( Vec_IntSize(vStarts) == nTasksMax )
+                    break;
+                Vec_IntPush( vStarts, Vec_IntSize(vTasks) );
+                Vec_IntPush( vTasks, iRepr );
+            }
+            Vec_IntPush( vTasks, iObj );
+            nMembers++;
+            nCands++;
+        }
+        if ( nMembers > 0 )
+            Vec_IntPush( vTasks, -1 );
+        if ( Vec_IntSize(vStarts) == nTasksMax )
+            break;
+    }
+    return nCands;
+}
+void Cec4_ManSweepParallel( Gia_Man_t * p, Cec4_Man_t * pMan )
+{
+    Cec_ParFra_t * pPars = pMan->pPars;
+    pthread_t WorkerThread[CEC4_PAR_THR_MAX];
+    Cec4_ParThr_t ThData[CEC4_PAR_THR_MAX];
+    Cec4_ParMan_t Par, * pPar = &Par;
+    Vec_Bit_t * vSkip = Vec_BitStart( Gia_ManObjNum(p) );
+    int nThreads = Abc_MinInt( pPars->nProcs, CEC4_PAR_THR_MAX );
+    int i, k, r, status, iLit, nCands, nPats, nProved, nFailed;
+    int nProvedAll = 0, nPatsAll = 0, nFailedAll = 0;
+    abctime clkTotal = Abc_Clock();
+    assert( nThreads > 1 );
+    memset( pPar, 0, sizeof(Cec4_ParMan_t) );
+    pPar->pAig    = p;
+    pPar->pPars   = pPars;
+    pPar->vTasks  = Vec_IntAlloc( 1000 );
+    pPar->vStarts = Vec_IntAlloc( 100 );
+    pthread_mutex_init( &pPar->Mutex, NULL );
+    memset( ThData, 0, sizeof(Cec4_ParThr_t) * nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        ThData[i].pMan     = pPar;
+        ThData[i].pSatLits = ABC_FALLOC( int, Gia_ManObjNum(p) );
+        ThData[i].vUsed    = Vec_IntAlloc( 1000 );
+        ThData[i].vProved  = Vec_IntAlloc( 100 );
+        ThData[i].vPats    = Vec_IntAlloc( 100 );
+        ThData[i].vFailed  = Vec_IntAlloc( 100 );
+        ThData[i].vDisproved = Vec_IntAlloc( 100 );
+    }
+    Gia_ManLevelNum( p );
+    pMan->vProvedPar = Vec_IntStartFull( Gia_ManObjNum(p) );
+    pPar->vProved = pMan->vProvedPar;
+    for ( r = 0; ; r++ )
+    {
+        abctime clk = Abc_Clock();
+        nCands = Cec4_ManCollectParTasks( p, pMan, vSkip, pPar->vTasks, pPar->vStarts, CEC4_PAR_TASKS * nThreads );
+        if ( nCands == 0 )
+            break;
+        pPar->iNext = 0;
+        for ( i = 0; i < nThreads; i++ )
+        {
+            Vec_IntClear( ThData[i].vProved );
+            Vec_IntClear( ThData[i].vPats );
+            Vec_IntClear( ThData[i].vFailed );
+            Vec_IntClear( ThData[i].vDisproved );
+            status = pthread_create( WorkerThread + i, NULL, Cec4_ParWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+        }
+        for ( i = 0; i < nThreads; i++ )
+            pthread_join( WorkerThread[i], NULL );
+        // record the results and simulate the counter-examples
+        nPats = nProved = nFailed = 0;
+        for ( i = 0; i < nThreads; i++ )
+        {
+            int * pPat, * pLimit;
+            for ( k = 0; k + 1 < Vec_IntSize(ThData[i].vProved); k += 2 )
+                Vec_IntWriteEntry( pMan->vProvedPar, Vec_IntEntry(ThData[i].vProved, k+1), Vec_IntEntry(ThData[i].vProved, k) );
+            Vec_IntForEachEntry( ThData[i].vFailed, iLit, k )
+                Vec_BitWriteEntry( pMan->vFails, iLit, 1 );
+            nProved += Vec_IntSize(ThData[i].vProved) / 2;
+            nFailed += Vec_IntSize(ThData[i].vFailed);
+            pLimit = Vec_IntLimit( ThData[i].vPats );
+            for ( pPat = Vec_IntArray(ThData[i].vPats); pPat < pLimit; pPat += pPat[0] + 1 )
+            {
+                if ( p->iPatsPi == 64 * p->nSimWords - 2 )
+                {
+                    Cec4_ManSimulate( p, pMan );
+                    Vec_IntFill( pMan->vCexStamps, Gia_ManObjNum(p), 0 );
+                    p->iPatsPi = 0;
+                }
+                p->iPatsPi++;
+                for ( k = 1; k <= pPat[0]; k++ )
+                    Cec4_ObjSimSetInputBit( p, Abc_Lit2Var(pPat[k]), Abc_LitIsCompl(pPat[k]) );
+                nPats++;
+            }
+        }
+        if ( p->iPatsPi > 0 )
+        {
+            Cec4_ManSimulate( p, pMan );
+            Vec_IntFill( pMan->vCexStamps, Gia_ManObjNum(p), 0 );
+            p->iPatsPi = 0;
+        }
+        // a partial counter-example may fail to refine the class; leave such members to the sequential sweep
+        for ( i = 0; i < nThreads; i++ )
+            for ( k = 0; k + 1 < Vec_IntSize(ThData[i].vDisproved); k += 2 )
+                if ( Gia_ObjRepr(p, Vec_IntEntry(ThData[i].vDisproved, k+1)) == Vec_IntEntry(ThData[i].vDisproved, k) )
+                    Vec_BitWriteEntry( vSkip, Vec_IntEntry(ThData[i].vDisproved, k+1), 1 );
+        pMan->nProvedPar += nProved;
+        nProvedAll += nProved;
+        nPatsAll   += nPats;
+        nFailedAll += nFailed;
+        if ( pPars->fVeryVerbose )
+        {
+            printf( "Parallel round %2d : Tasks = %6d  Cands = %7d  P = %7d  D = %6d  F = %5d  ", 
+                r, Vec_IntSize(pPar->vStarts), nCands, nProved, nPats, nFailed );
+            Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+        }
+    }
+    if ( pPars->fVerbose )
+    {
+        printf( "Parallel sweeping : Threads = %d  Rounds = %d  P = %d  D = %d  F = %d  ", nThreads, r, nProvedAll, nPatsAll, nFailedAll );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clkTotal );
+    }
+    Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        if ( ThData[i].pSat )
+            sat_solver_stop( ThData[i].pSat );
+        ABC_FREE( ThData[i].pSatLits );
+        Vec_IntFree( ThData[i].vUsed );
+        Vec_IntFree( ThData[i].vProved );
+        Vec_IntFree( ThData[i].vPats );
+        Vec_IntFree( ThData[i].vFailed );
+        Vec_IntFree( ThData[i].vDisproved );
+    }
+    Vec_BitFree( vSkip );
+    pthread_mutex_destroy( &pPar->Mutex );
+    Vec_IntFree( pPar->vTasks );
+    Vec_IntFree( pPar->vStarts );
+}
+
+#endif // pthreads are used
+
 int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** ppNew, int fSimOnly )
 {
 
@@ -1894,6 +2280,10 @@ int Cec4_ManPerformSweeping( Gia_Man_t * p, Cec_ParFra_t * pPars, Gia_Man_t ** p
 
     p->iPatsPi = 0;
     Vec_WrdFill( p->vSimsPi, Vec_WrdSize(p->vSimsPi), 0 );
+#ifdef ABC_USE_PTHREADS
+    if ( pPars->nProcs > 1 )
+        Cec4_ManSweepParallel( p, pMan );
+#endif
     pMan->nSatSat = 0;
     pMan->pNew = Cec4_ManStartNew( p );
     Gia_ManForEachAnd( p, pObj, i )
@@ -1984,6 +2374,9 @@ finalize:
             pMan->nSatSat,   pMan->nConflicts[0][0], (float)pMan->nConflicts[0][1]/Abc_MaxInt(1, pMan->nSatSat  -pMan->nConflicts[0][0]), pMan->nConflicts[0][2],  
             pMan->nSatUndec,  
             pMan->nSimulates, pMan->nRecycles, 100.0*pMan->nGates[1]/Abc_MaxInt(1, pMan->nGates[0]+pMan->nGates[1]) );
+    if ( pPars->fVerbose && pPars->nProcs > 1 )
+        printf( "Equivalences proved by parallel sweeping = %d (threads = %d)\n", pMan->nProvedPar, pPars->nProcs );
+    pPars->nProvedPar = pMan->nProvedPar;
     if ( pMan->vPairs && Vec_IntSize(pMan->vPairs) )
     {
         extern char * Extra_FileNameGeneric( char * FileName );
@@ -2034,6 +2427,17 @@ Gia_Man_t * Cec4_ManSimulateTest3( Gia_Man_t * p, int nBTLimit, int fVerbose )
     Cec4_ManPerformSweeping( p, pPars, &pNew, 0 );
     return pNew;
 }
+Gia_Man_t * Cec4_ManSimulateTest3Par( Gia_Man_t * p, int nBTLimit, int nProcs, int fVerbose )
+{
+    Gia_Man_t * pNew = NULL;
+    Cec_ParFra_t ParsFra, * pPars = &ParsFra;
+    Cec4_ManSetParams( pPars );
+    pPars->fVerbose = fVerbose;
+    pPars->nBTLimit = nBTLimit;
+    pPars->nProcs   = nProcs;
+    Cec4_ManPerformSweeping( p, pPars, &pNew, 0 );
+    return pNew;
+}
 Gia_Man_t * Cec4_ManSimulateTest4( Gia_Man_t * p, int nBTLimit, int nBTLimitPo, int fVerbose )
 {
     Gia_Man_t * pNew = NULL;
@@ -60,8 +60,11 @@ int Fra_FraigSat( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimi
         assert( Aig_ManRegNum(pMan) == 0 );
         pMan->pData = NULL;
 
-        // derive CNF
-        pCnf = Cnf_Derive( pMan, Aig_ManCoNum(pMan) );
+        // derive CNF (reusing the clauses of the cached nodes if the cache is given)
+        if ( pMan->pCnfCache )
+            pCnf = Cnf_DeriveCached( pMan, Aig_ManCoNum(pMan) );
+        else
+            pCnf = Cnf_Derive( pMan, Aig_ManCoNum(pMan) );
     //    pCnf = Cnf_DeriveSimple( pMan, Aig_ManCoNum(pMan) );
 
         if ( fFlipBits ) 
@@ -71,6 +74,7 @@ int Fra_FraigSat( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimi
         {
             printf( "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d. ", pCnf->nVars, pCnf->nClauses, pCnf->nLiterals );
             Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+            Cnf_CachePrintStats( pMan );
         }
 
         // convert into SAT solver
@@ -172,8 +176,11 @@ int Fra_FraigSat( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimi
         assert( Aig_ManRegNum(pMan) == 0 );
         pMan->pData = NULL;
 
-        // derive CNF
-        pCnf = Cnf_Derive( pMan, Aig_ManCoNum(pMan) );
+        // derive CNF (reusing the clauses of the cached nodes if the cache is given)
+        if ( pMan->pCnfCache )
+            pCnf = Cnf_DeriveCached( pMan, Aig_ManCoNum(pMan) );
+        else
+            pCnf = Cnf_Derive( pMan, Aig_ManCoNum(pMan) );
     //    pCnf = Cnf_DeriveSimple( pMan, Aig_ManCoNum(pMan) );
 
         if ( fFlipBits ) 
@@ -183,6 +190,7 @@ int Fra_FraigSat( Aig_Man_t * pMan, ABC_INT64_T nConfLimit, ABC_INT64_T nInsLimi
         {
             printf( "CNF stats: Vars = %6d. Clauses = %7d. Literals = %8d. ", pCnf->nVars, pCnf->nClauses, pCnf->nLiterals );
             Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+            Cnf_CachePrintStats( pMan );
         }
 
         // convert into SAT solver
@@ -356,6 +364,7 @@ ABC_PRT( "Time", Abc_Clock() - clk );
     // duplicate the AIG
 clk = Abc_Clock();
     pAig = Dar_ManRwsat( pTemp = pAig, 1, 0 );
+    Cnf_CacheTransfer( pTemp, pAig );
     Aig_ManStop( pTemp );
     if ( fVerbose )
     {
@@ -377,6 +386,7 @@ ABC_PRT( "Time", Abc_Clock() - clk );
         {
 clk = Abc_Clock();
             pAig = Dar_ManBalanceXor( pTemp = pAig, 1, 0, 0 );
+            Cnf_CacheTransfer( pTemp, pAig );
             Aig_ManStop( pTemp );
             if ( fVerbose )
             {
@@ -388,6 +398,7 @@ ABC_PRT( "Time", Abc_Clock() - clk );
         // run fraiging
 clk = Abc_Clock();
         pAig = Fra_FraigPerform( pTemp = pAig, pParams );
+        Cnf_CacheTransfer( pTemp, pAig );
         Aig_ManStop( pTemp );
         if ( fVerbose )
         {
@@ -403,6 +414,7 @@ ABC_PRT( "Time", Abc_Clock() - clk );
         // perform rewriting
 clk = Abc_Clock();
         pAig = Dar_ManRewriteDefault( pTemp = pAig );
+        Cnf_CacheTransfer( pTemp, pAig );
         Aig_ManStop( pTemp );
         if ( fVerbose )
         {
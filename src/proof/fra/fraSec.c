@@ -26,6 +26,7 @@
 #include "aig/saig/saig.h"
 #include "bdd/bbr/bbr.h"
 #include "proof/pdr/pdr.h"
+#include "sat/cnf/cnf.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -301,7 +302,12 @@ ABC_PRT( "Time", Abc_Clock() - clk );
     }
 
     if ( pNew->nRegs == 0 )
+    {
+        // share the CNF cache of the original miter, if any
+        if ( p->pCnfCache )
+            Cnf_CacheAttach( pNew, p->pCnfCache );
         RetValue = Fra_FraigCec( &pNew, 100000, 0 );
+    }
 
     RetValue = Fra_FraigMiterStatus( pNew );
     if ( RetValue >= 0 )
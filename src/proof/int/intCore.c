@@ -144,7 +144,7 @@ clk2 = Abc_Clock();
             p->pInter = Inter_ManStartInitState( Aig_ManRegNum(pAig) );
         assert( Aig_ManCoNum(p->pInter) == 1 );
 clk = Abc_Clock();
-        p->pCnfInter = Cnf_Derive( p->pInter, 0 );  
+        p->pCnfInter = Cnf_DeriveCached( p->pInter, 0 );  
 p->timeCnf += Abc_Clock() - clk;    
         // timeframes
         p->pFrames = Inter_ManFramesInter( pAig, p->nFrames, pPars->fUseBackward, pPars->fUseTwoFrames );
@@ -181,7 +181,7 @@ p->timeCnf += Abc_Clock() - clk;
             pCheck = Inter_CheckStart( p->pAigTrans, pPars->nFramesK );
             // try new containment check for the initial state
 clk = Abc_Clock();
-            pCnfInter2 = Cnf_Derive( p->pInter, 1 );  
+            pCnfInter2 = Cnf_DeriveCached( p->pInter, 1 );  
 p->timeCnf += Abc_Clock() - clk;    
 clk = Abc_Clock();
             RetValue = Inter_CheckPerform( pCheck, pCnfInter2, nTimeNewOut );
@@ -324,7 +324,7 @@ timeTemp = Abc_Clock() - clk2;
                     else
                     {   // new containment check
 clk2 = Abc_Clock();
-                        pCnfInter2 = Cnf_Derive( p->pInterNew, 1 );  
+                        pCnfInter2 = Cnf_DeriveCached( p->pInterNew, 1 );  
 p->timeCnf += Abc_Clock() - clk2;
 timeTemp = Abc_Clock() - clk2;
             
@@ -390,7 +390,7 @@ p->timeRwr += Abc_Clock() - clk;
             p->pInterNew = NULL;
             Cnf_DataFree( p->pCnfInter );
 clk = Abc_Clock();
-            p->pCnfInter = Cnf_Derive( p->pInter, 0 );  
+            p->pCnfInter = Cnf_DeriveCached( p->pInter, 0 );  
 p->timeCnf += Abc_Clock() - clk;
         }
 
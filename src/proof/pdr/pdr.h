@@ -50,6 +50,7 @@ struct Pdr_Par_t_
     int nTimeOutGap;      // approximate timeout in seconds since the last change
     int nTimeOutOne;      // approximate timeout in seconds per one output
     int nRandomSeed;      // value to seed the SAT solver with
+    int nWorkers;         // the number of parallel workers sharing lemmas
     int fTwoRounds;       // use two rounds for generalization
     int fMonoCnf;         // monolythic CNF
     int fNewXSim;         // updated X-valued simulation
@@ -78,6 +79,7 @@ struct Pdr_Par_t_
     int nDropOuts;        // the number of timed out outputs
     int nProveOuts;       // the number of proved outputs
     int iFrame;           // explored up to this frame
+    int nShrIn;           // the number of lemmas imported by parallel workers
     int RunId;            // PDR id in this run 
     int(*pFuncStop)(int); // callback to terminate
     int(*pFuncOnFail)(int,Abc_Cex_t*); // called for a failed output in MO mode
@@ -97,6 +99,8 @@ struct Pdr_Par_t_
 /*=== pdrCore.c ==========================================================*/
 extern void               Pdr_ManSetDefaultParams( Pdr_Par_t * pPars );
 extern int                Pdr_ManSolve( Aig_Man_t * p, Pdr_Par_t * pPars );
+/*=== pdrPar.c ==========================================================*/
+extern int                Pdr_ManSolvePar( Aig_Man_t * p, Pdr_Par_t * pPars );
 
 
 ABC_NAMESPACE_HEADER_END
@@ -59,6 +59,7 @@ void Pdr_ManSetDefaultParams( Pdr_Par_t * pPars )
     pPars->nConfGenLimit  =       0;  // limit on SAT solver conflicts during generalization
     pPars->nRestLimit     =       0;  // limit on the number of proof-obligations
     pPars->nRandomSeed   = 91648253;  // value to seed the SAT solver with
+    pPars->nWorkers       =       1;  // the number of parallel workers
     pPars->fTwoRounds     =       0;  // use two rounds for generalization
     pPars->fMonoCnf       =       0;  // monolythic CNF
     pPars->fNewXSim       =       0;  // updated X-valued simulation
@@ -194,6 +195,8 @@ int Pdr_ManPushClauses( Pdr_Man_t * p )
 
             // if it can be moved, add it to the next frame
             Pdr_ManSolverAddClause( p, k+1, pCubeK );
+            if ( p->pShr )
+                Pdr_ManShrExport( p, k+1, pCubeK );
             // check if the clause subsumes others
             Vec_PtrForEachEntry( Pdr_Set_t *, vArrayK1, pCubeK1, i )
             {
@@ -433,6 +436,8 @@ int ZPdr_ManDown( Pdr_Man_t * p, int k, Pdr_Set_t ** ppCube, Pdr_Set_t * pPred,
             // add clause
             for ( i = 1; i <= l; i++ )
                 Pdr_ManSolverAddClause( p, i, pCubeMin );
+            if ( p->pShr )
+                Pdr_ManShrExport( p, l, pCubeMin );
             Pdr_SetDeref( pPred );
             RetValue = Pdr_ManCheckCube( p, k, *ppCube, &pPred, p->pPars->nConfLimit, 0, 1 );
             assert( RetValue >= 0 );
@@ -918,6 +923,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
             Pdr_QueueStop( p );
             return 1; // restart
         }
+        if ( p->pShr && Pdr_ManShrImport( p ) == -1 )
+            return -1;
         pThis = Pdr_QueuePop( p );
         assert( pThis->iFrame > 0 );
         assert( !Pdr_SetIsInit(pThis->pState, -1) );
@@ -991,6 +998,8 @@ int Pdr_ManBlockCube( Pdr_Man_t * p, Pdr_Set_t * pCube )
             // add clause
             for ( i = 1; i <= k; i++ )
                 Pdr_ManSolverAddClause( p, i, pCubeMin );
+            if ( p->pShr )
+                Pdr_ManShrExport( p, k, pCubeMin );
             // schedule proof obligation
             if ( (k < kMax || p->pPars->fReuseProofOblig) && !p->pPars->fShortest )
             {
@@ -1286,8 +1295,11 @@ int Pdr_ManSolveInt( Pdr_Man_t * p )
             Abc_Print( 1, "*** Clauses after frame %d:\n", iFrame );
             Pdr_ManPrintClauses( p, 0 );
         }
+        // add the lemmas of other workers
+        RetValue = p->pShr ? Pdr_ManShrImport( p ) : 1;
         // push clauses into this timeframe
-        RetValue = Pdr_ManPushClauses( p );
+        if ( RetValue != -1 )
+            RetValue = Pdr_ManPushClauses( p );
         if ( RetValue == -1 )
         {
             if ( p->pPars->fVerbose )
@@ -1412,6 +1424,8 @@ int Pdr_ManSolve( Aig_Man_t * pAig, Pdr_Par_t * pPars )
             pPars->fSkipGeneral ? "yes" : "no",
             pPars->fSolveAll ?    "yes" : "no" );
     }
+    if ( pPars->nWorkers > 1 && !pPars->fSolveAll && !pPars->fUseAbs )
+        return Pdr_ManSolvePar( pAig, pPars );
     ABC_FREE( pAig->pSeqModel );
     p = Pdr_ManStart( pAig, pPars, NULL );
     RetValue = Pdr_ManSolveInt( p );
@@ -0,0 +1,485 @@
+/**CFile****************************************************************
+
+  FileName    [pdrPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Property driven reachability.]
+
+  Synopsis    [Parallel PDR with lemma sharing.]
+
+  Author      [Berkeley Logic Synthesis and Verification Group]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "pdrInt.h"
+#include "base/main/main.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+extern int Gia_ManToBridgeResult( FILE * pFile, int Result, Abc_Cex_t * pCex, int iPoProved );
+extern int Gia_ManToBridgeAbort( FILE * pFile, int Size, unsigned char * pBuffer );
+
+// Each worker runs its own PDR manager on its own copy of the AIG.
+// A lemma (cube blocked in frames 1..k) derived by any worker holds in
+// all states reachable in k steps. However, another worker can add it
+// to frame k only if it is inductive relative to its own frame k-1,
+// otherwise the frames may converge to a set that is not inductive.
+// This is why the imported lemmas are checked by the SAT solver of the
+// importing worker. Each worker appends its lemmas to its own log. The
+// log is written by one thread and read by all others, so no locks are
+// needed: the entries are stored in chunks that are never moved, and the
+// entry counter is published with a release store after the entry is
+// written.
+
+#define PDR_PAR_THR_MAX     64
+#define PDR_LOG_CHUNK_LOG   12
+#define PDR_LOG_CHUNK       (1 << PDR_LOG_CHUNK_LOG)
+#define PDR_LOG_CHUNKS      (1 << 12)
+
+typedef struct Pdr_Lem_t_ Pdr_Lem_t;
+struct Pdr_Lem_t_
+{
+    int              iFrame;      // the last frame where the cube is blocked
+    Pdr_Set_t *      pCube;       // the cube (owned by the log)
+};
+
+typedef struct Pdr_Log_t_ Pdr_Log_t;
+struct Pdr_Log_t_
+{
+    Pdr_Lem_t *      pChunks[PDR_LOG_CHUNKS]; // the lemmas
+    int              nEntries;    // the number of published lemmas
+};
+
+struct Pdr_Shr_t_
+{
+    int              nWorkers;    // the number of workers
+    Pdr_Log_t *      pLogs;       // the lemma log of each worker
+    int *            pRead;       // the number of lemmas read by each worker from each log
+    int              iWinner;     // the worker that solved the problem plus one
+    int(*pFuncStop)(int);         // the user's callback to terminate
+    int              RunId;       // the user's run ID
+};
+
+static Pdr_Shr_t * s_pPdrShr = NULL;
+
+static inline int  Pdr_ShrLoad( int * pVar )
+{
+#if defined(__GNUC__)
+    return __atomic_load_n( pVar, __ATOMIC_ACQUIRE );
+#else
+    return *(volatile int *)pVar;
+#endif
+}
+static inline void Pdr_ShrStore( int * pVar, int Value )
+{
+#if defined(__GNUC__)
+    __atomic_store_n( pVar, Value, __ATOMIC_RELEASE );
+#else
+    *(volatile int *)pVar = Value;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Publishes the lemma derived by this worker.]
+
+  Description [The cube is blocked in frames 1..k. The log keeps its own
+  copy, because the reference counters of cubes are not thread-safe.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManShrExport( Pdr_Man_t * p, int k, Pdr_Set_t * pCube )
+{
+    Pdr_Log_t * pLog = p->pShr->pLogs + p->iShr;
+    int iEntry = pLog->nEntries;
+    int iChunk = iEntry >> PDR_LOG_CHUNK_LOG;
+    Pdr_Lem_t * pLem;
+    if ( iChunk == PDR_LOG_CHUNKS )
+        return;
+    if ( pLog->pChunks[iChunk] == NULL )
+        pLog->pChunks[iChunk] = ABC_ALLOC( Pdr_Lem_t, PDR_LOG_CHUNK );
+    pLem = pLog->pChunks[iChunk] + (iEntry & (PDR_LOG_CHUNK - 1));
+    pLem->iFrame = k;
+    pLem->pCube  = Pdr_SetDup( pCube );
+    Pdr_ShrStore( &pLog->nEntries, iEntry + 1 );
+    p->nShrOut++;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the lemmas published by other workers.]
+
+  Description [A lemma blocked in frame k is added to frame k, or to
+  the last frame if this worker has fewer frames, if it is inductive
+  relative to the previous frame. Lemmas implied by the clauses of this
+  worker are skipped. Returns -1 if the resource limit is reached.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManShrImport( Pdr_Man_t * p )
+{
+    Pdr_Shr_t * pShr = p->pShr;
+    int * pRead = pShr->pRead + p->iShr * pShr->nWorkers;
+    int kMax = Vec_PtrSize(p->vSolvers) - 1;
+    int w, i, k, nEntries, RetValue;
+    if ( kMax < 1 )
+        return 1;
+    for ( w = 0; w < pShr->nWorkers; w++ )
+    {
+        Pdr_Log_t * pLog = pShr->pLogs + w;
+        if ( w == p->iShr )
+            continue;
+        nEntries = Pdr_ShrLoad( &pLog->nEntries );
+        for ( ; pRead[w] < nEntries; pRead[w]++ )
+        {
+            Pdr_Lem_t * pLem = pLog->pChunks[pRead[w] >> PDR_LOG_CHUNK_LOG] + (pRead[w] & (PDR_LOG_CHUNK - 1));
+            Pdr_Set_t * pCube;
+            k = Abc_MinInt( pLem->iFrame, kMax );
+            if ( k < 1 || Pdr_ManCheckContainment( p, k, pLem->pCube ) )
+                continue;
+            RetValue = Pdr_ManCheckCube( p, k-1, pLem->pCube, NULL, 0, 0, 1 );
+            if ( RetValue == -1 )
+                return -1;
+            if ( RetValue == 0 )
+            {
+                p->nShrFail++;
+                continue;
+            }
+            pCube = Pdr_SetDup( pLem->pCube );
+            Vec_VecPush( p->vClauses, k, pCube );   // consume ref
+            for ( i = 1; i <= k; i++ )
+                Pdr_ManSolverAddClause( p, i, pCube );
+            p->nShrIn++;
+        }
+    }
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Callback to stop the workers.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManShrStop( int RunId )
+{
+    Pdr_Shr_t * pShr = s_pPdrShr;
+    if ( pShr == NULL )
+        return 0;
+    if ( Pdr_ShrLoad( &pShr->iWinner ) )
+        return 1;
+    return pShr->pFuncStop && pShr->pFuncStop( pShr->RunId );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Sets the parameters of one worker.]
+
+  Description [Worker 0 uses the user's parameters. Other workers
+  use different random seeds and toggle generalization and ordering
+  options, so that they derive different lemmas.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Pdr_ManShrSetParams( Pdr_Par_t * pPars, Pdr_Par_t * pParsUser, int iWorker )
+{
+    *pPars = *pParsUser;
+    pPars->nRandomSeed += iWorker;
+    pPars->fVerbose     = 0;
+    pPars->fVeryVerbose = 0;
+    pPars->fNotVerbose  = 1;
+    pPars->fSilent      = 1;
+    pPars->fDumpInv     = 0;
+    pPars->fUseBridge   = 0;
+    pPars->vOutMap      = NULL;
+    pPars->RunId        = iWorker;
+    pPars->pFuncStop    = Pdr_ManShrStop;
+    switch ( iWorker % 6 )
+    {
+    case 1: pPars->fSkipDown ^= 1; pPars->fCtgs = !pPars->fSkipDown; break;
+    case 2: pPars->fFlopOrder ^= 1;     break;
+    case 3: pPars->fTwoRounds ^= 1;     break;
+    case 4: pPars->fSimpleGeneral ^= 1; break;
+    case 5: pPars->fMonoCnf ^= 1;       break;
+    }
+}
+char * Pdr_ManShrParamsStr( Pdr_Par_t * pPars, Pdr_Par_t * pParsUser )
+{
+    static char Buffer[100];
+    Buffer[0] = 0;
+    if ( pPars->fSkipDown != pParsUser->fSkipDown )
+        strcat( Buffer, pPars->fSkipDown ? " nodown" : " down+ctg" );
+    if ( pPars->fFlopOrder != pParsUser->fFlopOrder )
+        strcat( Buffer, pPars->fFlopOrder ? " floporder" : " nofloporder" );
+    if ( pPars->fTwoRounds != pParsUser->fTwoRounds )
+        strcat( Buffer, pPars->fTwoRounds ? " tworounds" : " oneround" );
+    if ( pPars->fSimpleGeneral != pParsUser->fSimpleGeneral )
+        strcat( Buffer, pPars->fSimpleGeneral ? " simplegen" : " fullgen" );
+    if ( pPars->fMonoCnf != pParsUser->fMonoCnf )
+        strcat( Buffer, pPars->fMonoCnf ? " monocnf" : " dyncnf" );
+    return Buffer[0] ? Buffer + 1 : (char *)"default";
+}
+
+#ifdef ABC_USE_PTHREADS
+
+typedef struct Pdr_ShrThr_t_ Pdr_ShrThr_t;
+struct Pdr_ShrThr_t_
+{
+    Pdr_Man_t *      pMan;        // the PDR manager of this worker
+    int              RetValue;    // the result
+    abctime          Time;        // the runtime
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Runs one worker.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Pdr_ManShrWorkerThread( void * pArg )
+{
+    Pdr_ShrThr_t * pThData = (Pdr_ShrThr_t *)pArg;
+    Pdr_Man_t * p = pThData->pMan;
+    abctime clk = Abc_Clock();
+    pThData->RetValue = Pdr_ManSolveInt( p );
+    pThData->Time = Abc_Clock() - clk;
+#if defined(__GNUC__)
+    if ( pThData->RetValue != -1 )
+    {
+        int Zero = 0;
+        __atomic_compare_exchange_n( &p->pShr->iWinner, &Zero, p->iShr + 1, 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE );
+    }
+#else
+    if ( pThData->RetValue != -1 && p->pShr->iWinner == 0 )
+        p->pShr->iWinner = p->iShr + 1;
+#endif
+    pthread_exit( NULL );
+    assert( 0 );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the problem using several PDR workers sharing lemmas.]
+
+  Description [Returns the result of the first worker that solved the
+  problem. The counter-example or the invariant is taken from this worker.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    pthread_t WorkerThread[PDR_PAR_THR_MAX];
+    Pdr_ShrThr_t ThData[PDR_PAR_THR_MAX];
+    Pdr_Par_t * pParsAll;
+    Pdr_Shr_t Shr, * pShr = &Shr;
+    Pdr_Man_t * pWin = NULL;
+    int nWorkers = Abc_MinInt( pPars->nWorkers, PDR_PAR_THR_MAX );
+    int i, k, c, status, RetValue = -1, nShrOut = 0, nShrIn = 0;
+    abctime clk = Abc_Clock();
+    assert( nWorkers > 1 );
+    assert( !pPars->fSolveAll && !pPars->fUseAbs );
+    if ( s_pPdrShr != NULL )
+    {
+        Abc_Print( 1, "Parallel PDR is already running. Using one worker.\n" );
+        pPars->nWorkers = 1;
+        RetValue = Pdr_ManSolve( pAig, pPars );
+        pPars->nWorkers = nWorkers;
+        return RetValue;
+    }
+    if ( pPars->fVerbose )
+        Abc_Print( 1, "Running %d PDR workers sharing lemmas.\n", nWorkers );
+    ABC_FREE( pAig->pSeqModel );
+    // start the shared data
+    memset( pShr, 0, sizeof(Pdr_Shr_t) );
+    pShr->nWorkers  = nWorkers;
+    pShr->pLogs     = ABC_CALLOC( Pdr_Log_t, nWorkers );
+    pShr->pRead     = ABC_CALLOC( int, nWorkers * nWorkers );
+    pShr->pFuncStop = pPars->pFuncStop;
+    pShr->RunId     = pPars->RunId;
+    s_pPdrShr = pShr;
+    // start the workers
+    pParsAll = ABC_CALLOC( Pdr_Par_t, nWorkers );
+    memset( ThData, 0, sizeof(Pdr_ShrThr_t) * nWorkers );
+    for ( i = 0; i < nWorkers; i++ )
+    {
+        Pdr_ManShrSetParams( pParsAll + i, pPars, i );
+        ThData[i].pMan = Pdr_ManStart( Aig_ManDupSimple(pAig), pParsAll + i, NULL );
+        ThData[i].pMan->pShr = pShr;
+        ThData[i].pMan->iShr = i;
+    }
+    for ( i = 0; i < nWorkers; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Pdr_ManShrWorkerThread, (void *)(ThData + i) );  assert( status == 0 );
+    }
+    for ( i = 0; i < nWorkers; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    s_pPdrShr = NULL;
+    // collect the results
+    if ( pShr->iWinner )
+    {
+        pWin = ThData[pShr->iWinner-1].pMan;
+        RetValue = ThData[pShr->iWinner-1].RetValue;
+    }
+    if ( pPars->fVerbose )
+    {
+        for ( i = 0; i < nWorkers; i++ )
+        {
+            Pdr_Man_t * p = ThData[i].pMan;
+            Abc_Print( 1, "Worker %2d : %-24s  ", i, Pdr_ManShrParamsStr(p->pPars, pPars) );
+            Abc_Print( 1, "%-9s  Frame =%4d  Cubes =%7d  Out =%7d  In =%7d (%7d)  ",
+                ThData[i].RetValue == 1 ? "proved" : ThData[i].RetValue == 0 ? "disproved" : "stopped",
+                p->pPars->iFrame, p->nCubes, p->nShrOut, p->nShrIn, p->nShrFail );
+            Abc_PrintTime( 1, "Time", ThData[i].Time );
+        }
+    }
+    for ( i = 0; i < nWorkers; i++ )
+    {
+        nShrOut += ThData[i].pMan->nShrOut;
+        nShrIn  += ThData[i].pMan->nShrIn;
+    }
+    pPars->nShrIn = nShrIn;
+    if ( pWin != NULL )
+    {
+        pPars->iFrame     = pWin->pPars->iFrame;
+        pPars->nProveOuts = pWin->pPars->nProveOuts;
+        pPars->nFailOuts  = pWin->pPars->nFailOuts;
+        if ( RetValue == 0 )
+        {
+            pAig->pSeqModel = pWin->pAig->pSeqModel;
+            pWin->pAig->pSeqModel = NULL;
+        }
+        if ( RetValue == 1 && !pPars->fSilent )
+        {
+            Pdr_ManReportInvariant( pWin );
+            Pdr_ManVerifyInvariant( pWin );
+        }
+        // convert previously 'unknown' into 'unsat' (as Pdr_ManSolveInt() does)
+        if ( RetValue == 1 && pPars->vOutMap )
+            for ( k = 0; k < Saig_ManPoNum(pAig); k++ )
+                if ( Vec_IntEntry(pPars->vOutMap, k) == -2 ) // unknown
+                {
+                    Vec_IntWriteEntry( pPars->vOutMap, k, 1 ); // unsat
+                    if ( pPars->fUseBridge )
+                        Gia_ManToBridgeResult( stdout, 1, NULL, k );
+                }
+        if ( pPars->fDumpInv )
+        {
+            char * pFileName = pPars->pInvFileName ? pPars->pInvFileName : Extra_FileNameGenericAppend(pAig->pName, "_inv.pla");
+            Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( pWin, RetValue!=1 ) );
+            Pdr_ManDumpClauses( pWin, pFileName, RetValue==1 );
+            printf( "Dumped inductive invariant in file \"%s\".\n", pFileName );
+        }
+        else if ( RetValue == 1 )
+            Abc_FrameSetInv( Pdr_ManDeriveInfinityClauses( pWin, RetValue!=1 ) );
+    }
+    else
+    {
+        for ( i = 0; i < nWorkers; i++ )
+            pPars->iFrame = Abc_MaxInt( pPars->iFrame, ThData[i].pMan->pPars->iFrame );
+        if ( !pPars->fSilent )
+            Abc_Print( 1, "None of the %d workers solved the problem (frame %d).\n", nWorkers, pPars->iFrame );
+    }
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Worker %d finished first. Lemmas exported = %d. Imported = %d.  ", pShr->iWinner-1, nShrOut, nShrIn );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    // free the workers
+    for ( i = 0; i < nWorkers; i++ )
+    {
+        Aig_Man_t * pAigCopy = ThData[i].pMan->pAig;
+        Pdr_ManStop( ThData[i].pMan );
+        Aig_ManStop( pAigCopy );
+    }
+    ABC_FREE( pParsAll );
+    // free the shared data
+    for ( i = 0; i < nWorkers; i++ )
+    for ( c = 0; c < PDR_LOG_CHUNKS && pShr->pLogs[i].pChunks[c]; c++ )
+    {
+        for ( k = 0; k < PDR_LOG_CHUNK && c * PDR_LOG_CHUNK + k < pShr->pLogs[i].nEntries; k++ )
+            Pdr_SetDeref( pShr->pLogs[i].pChunks[c][k].pCube );
+        ABC_FREE( pShr->pLogs[i].pChunks[c] );
+    }
+    ABC_FREE( pShr->pLogs );
+    ABC_FREE( pShr->pRead );
+    pPars->iFrame--;
+    // convert all -2 (unknown) entries into -1 (undec) (as Pdr_ManSolve() does)
+    if ( pPars->vOutMap )
+        for ( k = 0; k < Saig_ManPoNum(pAig); k++ )
+            if ( Vec_IntEntry(pPars->vOutMap, k) == -2 ) // unknown
+                Vec_IntWriteEntry( pPars->vOutMap, k, -1 ); // undec
+    if ( pPars->fUseBridge )
+        Gia_ManToBridgeAbort( stdout, 7, (unsigned char *)"timeout" );
+    return RetValue;
+}
+
+#else // pthreads are not used
+
+int Pdr_ManSolvePar( Aig_Man_t * pAig, Pdr_Par_t * pPars )
+{
+    int RetValue, nWorkers = pPars->nWorkers;
+    Abc_Print( 1, "This procedure requires pthreads. Using one worker.\n" );
+    pPars->nWorkers = 1;
+    RetValue = Pdr_ManSolve( pAig, pPars );
+    pPars->nWorkers = nWorkers;
+    return RetValue;
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
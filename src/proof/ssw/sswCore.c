@@ -47,6 +47,8 @@ void Ssw_ManSetDefaultParams( Ssw_Pars_t * p )
     memset( p, 0, sizeof(Ssw_Pars_t) );
     p->nPartSize      =       0;  // size of the partition
     p->nOverSize      =       0;  // size of the overlap between partitions
+    p->nProcs         =       1;  // the number of threads
+    p->fPrintParts    =       1;  // print (and dump) the partitions
     p->nFramesK       =       1;  // the induction depth
     p->nFramesAddSim  =       2;  // additional frames to simulate
     p->fConstrs       =       0;  // treat the last nConstrs POs as seq constraints
@@ -469,6 +471,9 @@ Aig_Man_t * Ssw_SignalCorrespondence( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
         if ( (pPars->nPartSize > 0 && pPars->nPartSize < Aig_ManRegNum(pAig))
              || (pAig->vClockDoms && Vec_VecSize(pAig->vClockDoms) > 0)  )
             return Ssw_SignalCorrespondencePart( pAig, pPars );
+        // solve batches of candidate equivalences concurrently
+        if ( pPars->nProcs > 1 && !pPars->fConstrs )
+            return Ssw_SignalCorrespondenceBatch( pAig, pPars );
     }
 
     if ( pPars->fScorrGia )
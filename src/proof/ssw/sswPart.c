@@ -142,6 +142,9 @@ void Ssw_SignalCorrespondenceArray( Vec_Ptr_t * vGias, Ssw_Pars_t * pPars )
     Vec_Ptr_t * vStack;
     Cec_ParCor_t CorPars, * pCorPars = &CorPars;
     Cec_ManCorSetDefaultParams( pCorPars );
+    pCorPars->nBTLimit  = pPars->nBTLimit;
+    pCorPars->fVerbose  = pPars->fVerbose;
+    pCorPars->fUseCSat  = 1;
     if ( pPars->fVerbose )
         printf( "Running concurrent &scorr with %d processes.\n", nProcs );
     fflush( stdout );
@@ -213,7 +216,7 @@ void Ssw_SignalCorrespondenceArray( Vec_Ptr_t * vGias, Ssw_Pars_t * pPars )
 ***********************************************************************/
 Aig_Man_t * Ssw_SignalCorrespondencePart( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
 {
-    int fPrintParts = 1;
+    int fPrintParts = pPars->fPrintParts;
     char Buffer[100];
     Aig_Man_t * pTemp, * pNew;
     Vec_Ptr_t * vResult;
@@ -227,6 +230,9 @@ Aig_Man_t * Ssw_SignalCorrespondencePart( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
         Abc_Print( 1, "Cannot use partitioned computation with constraints.\n" );
         return NULL;
     }
+    // solve the partitions concurrently
+    if ( pPars->nProcs > 1 )
+        return Ssw_SignalCorrespondencePart2( pAig, pPars );
     // save parameters
     nPartSize = pPars->nPartSize; pPars->nPartSize = 0;
     fVerbose  = pPars->fVerbose;  pPars->fVerbose  = 0;
@@ -313,7 +319,7 @@ Aig_Man_t * Ssw_SignalCorrespondencePart( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
 ***********************************************************************/
 Aig_Man_t * Ssw_SignalCorrespondencePart2( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
 {
-    int fPrintParts = 1;
+    int fPrintParts = pPars->fPrintParts;
     //char Buffer[100];
     Aig_Man_t * pTemp, * pNew;
     Vec_Ptr_t * vAigs;    
@@ -408,6 +414,41 @@ Aig_Man_t * Ssw_SignalCorrespondencePart2( Aig_Man_t * pAig, Ssw_Pars_t * pPars
     }
     return pNew;
 }
+
+/**Function*************************************************************
+
+  Synopsis    [Performs signal correspondence using several threads.]
+
+  Description [Runs the GIA-based induction, which refines the classes
+  of the whole AIG in one place, while the candidate equivalences
+  checked in each iteration are divided into batches solved by separate
+  threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Aig_Man_t * Ssw_SignalCorrespondenceBatch( Aig_Man_t * pAig, Ssw_Pars_t * pPars )
+{
+    Aig_Man_t * pNew;
+    Gia_Man_t * pGia;
+    Cec_ParCor_t CorPars, * pCorPars = &CorPars;
+    Cec_ManCorSetDefaultParams( pCorPars );
+    pCorPars->nFrames   = pPars->nFramesK;
+    pCorPars->nBTLimit  = pPars->nBTLimit;
+    pCorPars->nProcs    = pPars->nProcs;
+    pCorPars->fLatchCorr = pPars->fLatchCorr;
+    pCorPars->fUseCSat  = pPars->fUseCSat;
+    pCorPars->fVerbose  = pPars->fVerbose;
+    pGia = Gia_ManFromAigSimple( pAig );
+    Cec_ManLSCorrespondenceClasses( pGia, pCorPars );
+    Gia_ManReprToAigRepr( pAig, pGia );
+    Gia_ManStop( pGia );
+    pNew = Aig_ManDupRepr( pAig, 0 );
+    Aig_ManSeqCleanup( pNew );
+    return pNew;
+}
 void Gia_ManRestoreNodeMapping( Aig_Man_t * pAig, Gia_Man_t * pGia )
 {
     Aig_Obj_t * pObjAig; int i;
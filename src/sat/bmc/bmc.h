@@ -116,6 +116,7 @@ struct Saig_ParBmc_t_
     int         fNoRestarts;    // disables periodic restarts
     int         fUseSatoko;     // enables using Satoko
     int         fUseGlucose;    // enables using Glucose 3.0
+    int         nProcs;         // the number of concurrent solver threads
     int         nLearnedStart;  // starting learned clause limit
     int         nLearnedDelta;  // delta of learned clause limit
     int         nLearnedPerce;  // ratio of learned clause limit
@@ -157,6 +158,8 @@ struct Bmc_AndPar_t_
     int         nDropOuts;      // the number of dropped outputs
     
     void (*pFuncOnFrameDone)(int, int, int); // callback on each frame status (frame, po, statuss)
+    int         RunId;          // BMC id in this run 
+    int(*pFuncStop)(int);       // callback to terminate
 };
   
 typedef struct Bmc_BCorePar_t_ Bmc_BCorePar_t;
@@ -223,6 +226,9 @@ extern int               Saig_BmcPerform( Aig_Man_t * pAig, int nStart, int nFra
 /*=== bmcBmc3.c ==========================================================*/
 extern void              Saig_ParBmcSetDefaultParams( Saig_ParBmc_t * p );
 extern int               Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars );
+extern abctime           Saig_ManBmcTimeToStop( Saig_ParBmc_t * pPars, abctime nTimeToStopNG );
+/*=== bmcBmcPar.c ==========================================================*/
+extern int               Saig_ManBmcScalablePar( Aig_Man_t * pAig, Saig_ParBmc_t * pPars );
 /*=== bmcBmcAnd.c ==========================================================*/
 extern int               Gia_ManBmcPerform( Gia_Man_t * p, Bmc_AndPar_t * pPars );
 /*=== bmcCexCare.c ==========================================================*/
@@ -1347,6 +1347,7 @@ void Saig_ParBmcSetDefaultParams( Saig_ParBmc_t * p )
     p->nLearnedStart  = 10000;    // starting learned clause limit
     p->nLearnedDelta  =  2000;    // delta of learned clause limit
     p->nLearnedPerce  =    80;    // ratio of learned clause limit
+    p->nProcs         =     1;    // the number of concurrent solver threads
     p->fVerbose       =     0;    // verbose 
     p->fNotVerbose    =     0;    // skip line-by-line print-out 
     p->iFrame         =    -1;    // explored up to this frame
@@ -1471,6 +1472,10 @@ int Saig_ManBmcScalable( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
     abctime clk, clk2, clkSatRun, clkOther = 0, clkTotal = Abc_Clock();
     abctime nTimeUnsat = 0, nTimeSat = 0, nTimeUndec = 0, clkOne = 0;
     abctime nTimeToStopNG, nTimeToStop;
+    // the multi-threaded engine supports the default solver without jumping and per-output timeouts
+    if ( pPars->nProcs > 1 && !pPars->nFramesJump && !pPars->nTimeOutOne && !pPars->fUseBridge && 
+         !pPars->pLogFileName && !pPars->fUseSatoko && !pPars->fUseGlucose )
+        return Saig_ManBmcScalablePar( pAig, pPars );
     if ( pPars->pLogFileName )
         pLogFile = fopen( pPars->pLogFileName, "wb" );
     if ( pPars->nTimeOutOne && pPars->nTimeOut == 0 )
@@ -0,0 +1,866 @@
+/**CFile****************************************************************
+
+  FileName    [bmcBmcPar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [SAT-based bounded model checking.]
+
+  Synopsis    [Multi-threaded BMC with shared unrolling.]
+
+  Author      [Berkeley Logic Synthesis and Verification Group]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "bmc.h"
+#include "aig/gia/giaAig.h"
+#include "sat/bsat/satSolver.h"
+#include "sat/cnf/cnf.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#ifdef ABC_USE_PTHREADS
+
+// The main thread owns the incremental unrolling (Unr_Man_t). The frames
+// are added in windows. For the new nodes of each window, the main thread
+// derives the CNF and stores its clauses, grouped by the SAT variable they
+// define. The SAT variables are shared by all workers. While a window is
+// unrolled, the workers are idle. After that, the unrolling and the CNF
+// are not modified until all workers finish the window, so they can be
+// read without locks. Each (frame, output) pair of the window is a job.
+// The worker threads are started once and wait for the next window. Each
+// worker has its own SAT solver and loads the clauses of the cones of its
+// jobs into it on demand. The jobs of the window, listed in the frame-major
+// order, are split into as many blocks of consecutive jobs as there are
+// workers, and each block is given to its home worker. Usually, the same
+// outputs are checked by the same solver in the consecutive windows, so
+// their cones are not loaded into the other solvers and the learned clauses
+// are reused. A worker takes its own jobs first and then the remaining jobs
+// of the other workers. The outputs found to fail are pruned from the
+// remaining jobs of all workers and from the later windows. Without "-a",
+// the first failing output (or the first output that could not be solved)
+// is the point where all workers stop.
+
+#define BMC_PAR_THR_MAX     64
+#define BMC_PAR_SKIP        -2
+
+typedef struct Bmc_ParMan_t_ Bmc_ParMan_t;
+
+typedef struct Bmc_ParJob_t_ Bmc_ParJob_t;
+struct Bmc_ParJob_t_
+{
+    int              iFrame;      // the timeframe
+    int              iOut;        // the output
+    int              Status;      // the solver status (or BMC_PAR_SKIP)
+    int              iOwner;      // the home worker of the job
+    int              fTaken;      // the job is taken by a worker
+    Abc_Cex_t *      pCex;        // the counter-example if the output fails
+};
+
+typedef struct Bmc_ParWrk_t_ Bmc_ParWrk_t;
+struct Bmc_ParWrk_t_
+{
+    Bmc_ParMan_t *   pMan;        // the shared manager
+    sat_solver *     pSat;        // the SAT solver of this worker
+    Vec_Str_t *      vLoaded;     // marks the SAT variables whose clauses are loaded
+    Vec_Int_t *      vStack;      // the stack used to load the cones
+    int *            pNextUnit;   // the first frame of each output not asserted in the solver
+    int              iNext;       // the next job of this worker to look at
+    int              nSolved;     // the number of solved jobs
+    int              nStolen;     // the number of jobs taken from other workers
+    abctime          timeBusy;    // the time spent solving the windows
+};
+
+struct Bmc_ParMan_t_
+{
+    Saig_ParBmc_t *  pPars;       // parameters
+    Gia_Man_t *      pGia;        // the user's AIG
+    Unr_Man_t *      pUnr;        // the unrolling manager
+    Gia_Man_t *      pFrames;     // the unrolled AIG (owned by pUnr)
+    int              nPos;        // the number of outputs
+    // CNF shared by the workers
+    Vec_Int_t *      vFr2Sat;     // maps objects of the unrolling into SAT variables
+    Vec_Int_t *      vClauses;    // the clauses (the size followed by the literals)
+    Vec_Int_t *      vVar2Cla;    // the first clause defining each SAT variable (-1 if none)
+    Vec_Int_t *      vVar2Num;    // the number of clauses defining each SAT variable
+    int              nSatVars;    // the number of SAT variables
+    // workers and jobs
+    int              nWorkers;    // the number of workers
+    Bmc_ParWrk_t     pWrks[BMC_PAR_THR_MAX]; // the workers
+    Bmc_ParJob_t *   pJobs;       // the jobs of the current window
+    int              nJobs;       // the number of jobs
+    int              nJobsAlloc;  // the number of allocated jobs
+    int              iNext;       // the first job that may be not taken
+    int              iWindow;     // the number of windows given to the workers
+    int              nBusy;       // the number of workers solving the current window
+    int              fExit;       // the workers should quit
+    pthread_t        pThreads[BMC_PAR_THR_MAX]; // the worker threads
+    pthread_cond_t   CondStart;   // signals the workers that a window is ready
+    pthread_cond_t   CondDone;    // signals the main thread that a window is solved
+    int *            pFrameSat;   // the frame where each output fails (-1 if not known)
+    int              iStopFrame;  // the frame where the workers stop (-1 if not known)
+    int              iStopOut;    // the output where the workers stop
+    pthread_mutex_t  Mutex;       // protects the jobs, pFrameSat, the stop point, and the window
+    abctime          timeCnf;     // runtime of unrolling and CNF generation
+};
+
+static void *        Bmc_ParWorkerThread( void * pArg );
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the manager.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Bmc_ParMan_t * Bmc_ParManStart( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
+{
+    Bmc_ParMan_t * p = ABC_CALLOC( Bmc_ParMan_t, 1 );
+    int i, k;
+    p->pPars      = pPars;
+    p->pGia       = Gia_ManFromAigSimple( pAig );
+    p->pUnr       = Unr_ManUnrollStart( p->pGia, 0 );
+    p->nPos       = Saig_ManPoNum( pAig );
+    p->vFr2Sat    = Vec_IntAlloc( 10000 );
+    p->vClauses   = Vec_IntAlloc( 100000 );
+    p->vVar2Cla   = Vec_IntAlloc( 10000 );
+    p->vVar2Num   = Vec_IntAlloc( 10000 );
+    p->nWorkers   = Abc_MinInt( pPars->nProcs, BMC_PAR_THR_MAX );
+    p->pFrameSat  = ABC_FALLOC( int, p->nPos );
+    p->iStopFrame = -1;
+    // the constant node is mapped into variable 0
+    Vec_IntPush( p->vFr2Sat, 0 );
+    Vec_IntPush( p->vVar2Cla, -1 );
+    Vec_IntPush( p->vVar2Num, 0 );
+    p->nSatVars = 1;
+    for ( i = 0; i < p->nWorkers; i++ )
+    {
+        Bmc_ParWrk_t * pWrk = p->pWrks + i;
+        pWrk->pMan      = p;
+        pWrk->pSat      = sat_solver_new();
+        pWrk->vLoaded   = Vec_StrAlloc( 10000 );
+        pWrk->vStack    = Vec_IntAlloc( 1000 );
+        pWrk->pNextUnit = ABC_CALLOC( int, p->nPos );
+        for ( k = 0; k < p->nPos; k++ )
+            pWrk->pNextUnit[k] = pPars->nStart;
+        pWrk->pSat->nLearntStart = pPars->nLearnedStart;
+        pWrk->pSat->nLearntDelta = pPars->nLearnedDelta;
+        pWrk->pSat->nLearntRatio = pPars->nLearnedPerce;
+        pWrk->pSat->nLearntMax   = pWrk->pSat->nLearntStart;
+        pWrk->pSat->fNoRestarts  = pPars->fNoRestarts;
+        sat_solver_setnvars( pWrk->pSat, 1 );
+        sat_solver_add_const( pWrk->pSat, 0, 1 );
+        Vec_StrPush( pWrk->vLoaded, 1 );
+    }
+    pthread_mutex_init( &p->Mutex, NULL );
+    pthread_cond_init( &p->CondStart, NULL );
+    pthread_cond_init( &p->CondDone, NULL );
+    for ( i = 0; i < p->nWorkers; i++ )
+    {
+        int status = pthread_create( p->pThreads + i, NULL, Bmc_ParWorkerThread, (void *)(p->pWrks + i) );  assert( status == 0 );
+    }
+    return p;
+}
+void Bmc_ParManStop( Bmc_ParMan_t * p )
+{
+    int i;
+    pthread_mutex_lock( &p->Mutex );
+    p->fExit = 1;
+    pthread_cond_broadcast( &p->CondStart );
+    pthread_mutex_unlock( &p->Mutex );
+    for ( i = 0; i < p->nWorkers; i++ )
+        pthread_join( p->pThreads[i], NULL );
+    for ( i = 0; i < p->nWorkers; i++ )
+    {
+        sat_solver_delete( p->pWrks[i].pSat );
+        Vec_StrFree( p->pWrks[i].vLoaded );
+        Vec_IntFree( p->pWrks[i].vStack );
+        ABC_FREE( p->pWrks[i].pNextUnit );
+    }
+    for ( i = 0; i < p->nJobs; i++ )
+        Abc_CexFreeP( &p->pJobs[i].pCex );
+    pthread_cond_destroy( &p->CondStart );
+    pthread_cond_destroy( &p->CondDone );
+    pthread_mutex_destroy( &p->Mutex );
+    Unr_ManFree( p->pUnr );
+    Gia_ManStop( p->pGia );
+    Vec_IntFree( p->vFr2Sat );
+    Vec_IntFree( p->vClauses );
+    Vec_IntFree( p->vVar2Cla );
+    Vec_IntFree( p->vVar2Num );
+    ABC_FREE( p->pFrameSat );
+    ABC_FREE( p->pJobs );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the CNF of the new part of the unrolling.]
+
+  Description [Collects the nodes of the unrolling in the TFI of the
+  outputs of the window, which do not have SAT variables yet, into a
+  separate AIG, whose CIs are the nodes with SAT variables and the PIs.
+  The CNF of this AIG is derived and its clauses are stored.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_ParManCollect_rec( Bmc_ParMan_t * p, Gia_Man_t * pClean, int iObj )
+{
+    Gia_Obj_t * pObj;
+    int iLitClean = Gia_ObjCopyArray( p->pFrames, iObj );
+    if ( iLitClean >= 0 )
+        return iLitClean;
+    pObj = Gia_ManObj( p->pFrames, iObj );
+    if ( Vec_IntEntry(p->vFr2Sat, iObj) > 0 || Gia_ObjIsCi(pObj) )
+        iLitClean = Gia_ManAppendCi( pClean );
+    else if ( Gia_ObjIsAnd(pObj) )
+    {
+        int iLit0 = Bmc_ParManCollect_rec( p, pClean, Gia_ObjFaninId0(pObj, iObj) );
+        int iLit1 = Bmc_ParManCollect_rec( p, pClean, Gia_ObjFaninId1(pObj, iObj) );
+        iLit0 = Abc_LitNotCond( iLit0, Gia_ObjFaninC0(pObj) );
+        iLit1 = Abc_LitNotCond( iLit1, Gia_ObjFaninC1(pObj) );
+        iLitClean = Gia_ManAppendAnd( pClean, iLit0, iLit1 );
+    }
+    else assert( 0 );
+    assert( !Abc_LitIsCompl(iLitClean) );
+    Gia_ManObj( pClean, Abc_Lit2Var(iLitClean) )->Value = iObj;
+    Gia_ObjSetCopyArray( p->pFrames, iObj, iLitClean );
+    return iLitClean;
+}
+void Bmc_ParManAddCnf( Bmc_ParMan_t * p, int f, int nFrames )
+{
+    Gia_Man_t * pClean;
+    Gia_Obj_t * pObj;
+    Cnf_Dat_t * pCnf;
+    int i, k, c, iVar, iLit, * pMap;
+    abctime clk = Abc_Clock();
+    Vec_IntFillExtra( p->vFr2Sat, Gia_ManObjNum(p->pFrames), -1 );
+    Vec_IntFillExtra( &p->pFrames->vCopies, Gia_ManObjNum(p->pFrames), -1 );
+    pClean = Gia_ManStart( 1000 );
+    Gia_ObjSetCopyArray( p->pFrames, 0, 0 );
+    for ( k = 0; k < nFrames; k++ )
+    for ( i = 0; i < p->nPos; i++ )
+    {
+        if ( p->pFrameSat[i] >= 0 )
+            continue;
+        pObj = Gia_ManPo( p->pFrames, (f + k) * p->nPos + i );
+        if ( Gia_ObjFaninId0p(p->pFrames, pObj) == 0 )
+            continue;
+        iLit = Bmc_ParManCollect_rec( p, pClean, Gia_ObjFaninId0p(p->pFrames, pObj) );
+        iLit = Gia_ManAppendCo( pClean, Abc_LitNotCond(iLit, Gia_ObjFaninC0(pObj)) );
+        Gia_ManObj( pClean, Abc_Lit2Var(iLit) )->Value = Gia_ObjId( p->pFrames, pObj );
+    }
+    Gia_ManForEachObj( pClean, pObj, i )
+        Gia_ObjSetCopyArray( p->pFrames, pObj->Value, -1 );
+    if ( Gia_ManCoNum(pClean) == 0 )
+    {
+        Gia_ManStop( pClean );
+        p->timeCnf += Abc_Clock() - clk;
+        return;
+    }
+    // derive the CNF and map its variables
+    pCnf = (Cnf_Dat_t *)Mf_ManGenerateCnf( pClean, 8, 1, 0, 0, 0 );
+    pMap = ABC_FALLOC( int, Gia_ManObjNum(pClean) );
+    pMap[0] = 0;
+    Gia_ManForEachObj1( pClean, pObj, i )
+    {
+        if ( pCnf->pObj2Count[i] <= 0 && !Gia_ObjIsCi(pObj) )
+            continue;
+        iVar = Vec_IntEntry( p->vFr2Sat, pObj->Value );
+        if ( iVar == -1 )
+        {
+            Vec_IntWriteEntry( p->vFr2Sat, pObj->Value, (iVar = p->nSatVars++) );
+            Vec_IntPush( p->vVar2Cla, -1 );
+            Vec_IntPush( p->vVar2Num, 0 );
+        }
+        pMap[i] = iVar;
+    }
+    Gia_ManStop( pClean );
+    // the first literal of each clause belongs to the variable it defines
+    for ( c = 0; c < pCnf->nClauses; c++ )
+    {
+        int nLits = pCnf->pClauses[c+1] - pCnf->pClauses[c];
+        iVar = pMap[Abc_Lit2Var(pCnf->pClauses[c][0])];
+        if ( Vec_IntEntry(p->vVar2Cla, iVar) == -1 )
+            Vec_IntWriteEntry( p->vVar2Cla, iVar, Vec_IntSize(p->vClauses) );
+        Vec_IntAddToEntry( p->vVar2Num, iVar, 1 );
+        Vec_IntPush( p->vClauses, nLits );
+        for ( k = 0; k < nLits; k++ )
+            Vec_IntPush( p->vClauses, Abc_Lit2LitV(pMap, pCnf->pClauses[c][k]) );
+    }
+    ABC_FREE( pMap );
+    Cnf_DataFree( pCnf );
+    p->timeCnf += Abc_Clock() - clk;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Loads the clauses of the cone of the variable into the solver.]
+
+  Description [The cone is traversed without recursion because the
+  unrolling can be very deep.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_ParWrkLoadCone( Bmc_ParWrk_t * pWrk, int iRoot )
+{
+    Bmc_ParMan_t * p = pWrk->pMan;
+    int iVar, c, k, nLits, fReady, * pClause;
+    if ( Vec_StrEntry(pWrk->vLoaded, iRoot) )
+        return;
+    Vec_IntClear( pWrk->vStack );
+    Vec_IntPush( pWrk->vStack, iRoot );
+    while ( Vec_IntSize(pWrk->vStack) > 0 )
+    {
+        iVar = Vec_IntEntryLast( pWrk->vStack );
+        if ( Vec_StrEntry(pWrk->vLoaded, iVar) )
+        {
+            Vec_IntPop( pWrk->vStack );
+            continue;
+        }
+        // make sure the variables this one depends on are loaded
+        fReady  = 1;
+        pClause = Vec_IntEntryP( p->vClauses, Abc_MaxInt(0, Vec_IntEntry(p->vVar2Cla, iVar)) );
+        for ( c = 0; c < Vec_IntEntry(p->vVar2Num, iVar); c++, pClause += nLits + 1 )
+            for ( nLits = pClause[0], k = 1; k <= nLits; k++ )
+                if ( !Vec_StrEntry(pWrk->vLoaded, Abc_Lit2Var(pClause[k])) && Abc_Lit2Var(pClause[k]) != iVar )
+                {
+                    Vec_IntPush( pWrk->vStack, Abc_Lit2Var(pClause[k]) );
+                    fReady = 0;
+                }
+        if ( !fReady )
+            continue;
+        pClause = Vec_IntEntryP( p->vClauses, Abc_MaxInt(0, Vec_IntEntry(p->vVar2Cla, iVar)) );
+        for ( c = 0; c < Vec_IntEntry(p->vVar2Num, iVar); c++, pClause += pClause[0] + 1 )
+            sat_solver_addclause( pWrk->pSat, pClause + 1, pClause + 1 + pClause[0] );
+        Vec_StrWriteEntry( pWrk->vLoaded, iVar, 1 );
+        Vec_IntPop( pWrk->vStack );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the counter-example from the solver of the worker.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Cex_t * Bmc_ParWrkDeriveCex( Bmc_ParWrk_t * pWrk, int iFrame, int iOut )
+{
+    Bmc_ParMan_t * p = pWrk->pMan;
+    int nPis = Gia_ManPiNum(p->pGia);
+    Abc_Cex_t * pCex = Abc_CexMakeTriv( Gia_ManRegNum(p->pGia), nPis, p->nPos, iFrame * p->nPos + iOut );
+    int k, iVar;
+    for ( k = 0; k < (iFrame + 1) * nPis; k++ )
+    {
+        iVar = Vec_IntEntry( p->vFr2Sat, Gia_ManCiIdToId(p->pFrames, k) );
+        if ( iVar > 0 && Vec_StrEntry(pWrk->vLoaded, iVar) && sat_solver_var_value(pWrk->pSat, iVar) )
+            Abc_InfoSetBit( pCex->pData, pCex->nRegs + k );
+    }
+    return pCex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the job does not need to be solved.]
+
+  Description [Should be called with the mutex locked.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Bmc_ParJobIsPruned( Bmc_ParMan_t * p, int iFrame, int iOut )
+{
+    if ( p->iStopFrame >= 0 && (iFrame > p->iStopFrame || (iFrame == p->iStopFrame && iOut > p->iStopOut)) )
+        return 1;
+    if ( p->pFrameSat[iOut] >= 0 && iFrame > p->pFrameSat[iOut] )
+        return 1;
+    return 0;
+}
+static inline void Bmc_ParSetStop( Bmc_ParMan_t * p, int iFrame, int iOut )
+{
+    if ( p->iStopFrame >= 0 && (iFrame > p->iStopFrame || (iFrame == p->iStopFrame && iOut > p->iStopOut)) )
+        return;
+    p->iStopFrame = iFrame;
+    p->iStopOut   = iOut;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves one job.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Bmc_ParWrkSolve( Bmc_ParWrk_t * pWrk, Bmc_ParJob_t * pJob, int iFrameStart )
+{
+    Bmc_ParMan_t * p = pWrk->pMan;
+    Gia_Obj_t * pPo;
+    int f, iVar, Lit, status;
+    // assert the property in the earlier frames, if their cones are already loaded
+    for ( f = pWrk->pNextUnit[pJob->iOut]; f < iFrameStart; f++ )
+    {
+        iVar = Vec_IntEntry( p->vFr2Sat, Gia_ObjId(p->pFrames, Gia_ManPo(p->pFrames, f * p->nPos + pJob->iOut)) );
+        if ( iVar <= 0 || !Vec_StrEntry(pWrk->vLoaded, iVar) )
+            continue;
+        Lit = Abc_Var2Lit( iVar, 1 );
+        sat_solver_addclause( pWrk->pSat, &Lit, &Lit + 1 );
+    }
+    pWrk->pNextUnit[pJob->iOut] = Abc_MaxInt( pWrk->pNextUnit[pJob->iOut], iFrameStart );
+    // check the output
+    pPo = Gia_ManPo( p->pFrames, pJob->iFrame * p->nPos + pJob->iOut );
+    if ( Gia_ObjFaninLit0p(p->pFrames, pPo) == 0 )
+        return l_False;
+    if ( Gia_ObjFaninLit0p(p->pFrames, pPo) == 1 )
+    {
+        pJob->pCex = Bmc_ParWrkDeriveCex( pWrk, pJob->iFrame, pJob->iOut );
+        return l_True;
+    }
+    iVar = Vec_IntEntry( p->vFr2Sat, Gia_ObjId(p->pFrames, pPo) );
+    assert( iVar > 0 );
+    Bmc_ParWrkLoadCone( pWrk, iVar );
+    Lit  = Abc_Var2Lit( iVar, 0 );
+    sat_solver_compress( pWrk->pSat );
+    status = sat_solver_solve( pWrk->pSat, &Lit, &Lit + 1, (ABC_INT64_T)p->pPars->nConfLimit, 0, 0, 0 );
+    if ( status == l_False )
+    {
+        Lit = Abc_LitNot( Lit );
+        sat_solver_addclause( pWrk->pSat, &Lit, &Lit + 1 );
+    }
+    else if ( status == l_True )
+        pJob->pCex = Bmc_ParWrkDeriveCex( pWrk, pJob->iFrame, pJob->iOut );
+    return status;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Takes the next job of the worker.]
+
+  Description [Returns the first job of this worker, which is not taken
+  yet. If there is none, returns the first job of the other workers, which
+  is not taken yet. The pruned jobs are skipped. Should be called with the
+  mutex locked.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Bmc_ParJob_t * Bmc_ParWrkTakeJob( Bmc_ParWrk_t * pWrk )
+{
+    Bmc_ParMan_t * p = pWrk->pMan;
+    Bmc_ParJob_t * pJob;
+    int iWrk = pWrk - p->pWrks;
+    for ( ; pWrk->iNext < p->nJobs; pWrk->iNext++ )
+    {
+        pJob = p->pJobs + pWrk->iNext;
+        if ( pJob->iOwner != iWrk || pJob->fTaken )
+            continue;
+        pJob->fTaken = 1;
+        if ( Bmc_ParJobIsPruned(p, pJob->iFrame, pJob->iOut) )
+            continue;
+        pWrk->iNext++;
+        return pJob;
+    }
+    for ( ; p->iNext < p->nJobs; p->iNext++ )
+    {
+        pJob = p->pJobs + p->iNext;
+        if ( pJob->fTaken )
+            continue;
+        pJob->fTaken = 1;
+        if ( Bmc_ParJobIsPruned(p, pJob->iFrame, pJob->iOut) )
+            continue;
+        p->iNext++;
+        pWrk->nStolen++;
+        return pJob;
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the jobs of the current window.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_ParWrkSolveWindow( Bmc_ParWrk_t * pWrk )
+{
+    Bmc_ParMan_t * p = pWrk->pMan;
+    Bmc_ParJob_t * pJob;
+    int status, iFrameStart = p->pJobs[0].iFrame;
+    Vec_StrFillExtra( pWrk->vLoaded, p->nSatVars, 0 );
+    sat_solver_setnvars( pWrk->pSat, p->nSatVars );
+    while ( 1 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        pJob = Bmc_ParWrkTakeJob( pWrk );
+        pthread_mutex_unlock( &p->Mutex );
+        if ( pJob == NULL )
+            break;
+        status = Bmc_ParWrkSolve( pWrk, pJob, iFrameStart );
+        pWrk->nSolved++;
+        pthread_mutex_lock( &p->Mutex );
+        pJob->Status = status;
+        if ( status == l_True && p->pPars->fSolveAll )
+        {
+            if ( p->pFrameSat[pJob->iOut] == -1 || p->pFrameSat[pJob->iOut] > pJob->iFrame )
+                p->pFrameSat[pJob->iOut] = pJob->iFrame;
+        }
+        else if ( status != l_False )
+            Bmc_ParSetStop( p, pJob->iFrame, pJob->iOut );
+        pthread_mutex_unlock( &p->Mutex );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Worker thread.]
+
+  Description [Waits for the next window, solves its jobs, and reports
+  to the main thread, until the manager is stopped.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Bmc_ParWorkerThread( void * pArg )
+{
+    Bmc_ParWrk_t * pWrk = (Bmc_ParWrk_t *)pArg;
+    Bmc_ParMan_t * p = pWrk->pMan;
+    int iWindow = 0, fExit;
+    abctime clk;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        while ( !p->fExit && p->iWindow == iWindow )
+            pthread_cond_wait( &p->CondStart, &p->Mutex );
+        iWindow = p->iWindow;
+        fExit   = p->fExit;
+        pthread_mutex_unlock( &p->Mutex );
+        if ( fExit )
+            break;
+        clk = Abc_Clock();
+        Bmc_ParWrkSolveWindow( pWrk );
+        pWrk->timeBusy += Abc_Clock() - clk;
+        pthread_mutex_lock( &p->Mutex );
+        if ( --p->nBusy == 0 )
+            pthread_cond_signal( &p->CondDone );
+        pthread_mutex_unlock( &p->Mutex );
+    }
+    pthread_exit( NULL );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the jobs of the current window by the workers.]
+
+  Description [Returns when all workers are done.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_ParManSolveWindow( Bmc_ParMan_t * p, abctime nTimeToStop )
+{
+    int i;
+    for ( i = 0; i < p->nWorkers; i++ )
+    {
+        sat_solver_set_runtime_limit( p->pWrks[i].pSat, nTimeToStop );
+        p->pWrks[i].iNext = 0;
+    }
+    pthread_mutex_lock( &p->Mutex );
+    p->nBusy = p->nWorkers;
+    p->iWindow++;
+    pthread_cond_broadcast( &p->CondStart );
+    while ( p->nBusy > 0 )
+        pthread_cond_wait( &p->CondDone, &p->Mutex );
+    pthread_mutex_unlock( &p->Mutex );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints statistics of the window.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Bmc_ParManPrintFrame( Bmc_ParMan_t * p, int f, abctime clkTotal )
+{
+    double nVars = 0, nClas = 0, nConfs = 0, nLearns = 0, nMem = 0;
+    int i;
+    for ( i = 0; i < p->nWorkers; i++ )
+    {
+        nVars   += sat_solver_nvars( p->pWrks[i].pSat );
+        nClas   += p->pWrks[i].pSat->stats.clauses;
+        nConfs  += p->pWrks[i].pSat->stats.conflicts;
+        nLearns += p->pWrks[i].pSat->stats.learnts;
+        nMem    += sat_solver_memory( p->pWrks[i].pSat );
+    }
+    Abc_Print( 1, "%4d + : ",         f );
+    Abc_Print( 1, "Var =%8.0f. ",     nVars );
+    Abc_Print( 1, "Cla =%9.0f. ",     nClas );
+    Abc_Print( 1, "Conf =%7.0f. ",    nConfs );
+    Abc_Print( 1, "Learn =%7.0f. ",   nLearns );
+    if ( p->pPars->fSolveAll )
+        Abc_Print( 1, "CEX =%5d. ",   p->pPars->nFailOuts );
+    Abc_Print( 1, "%4.0f MB",         1.0*Gia_ManMemory(p->pFrames)/(1<<20) );
+    Abc_Print( 1, "%4.0f MB",         nMem/(1<<20) );
+    Abc_Print( 1, "%9.2f sec ",       1.0*(Abc_Clock() - clkTotal)/CLOCKS_PER_SEC );
+    Abc_Print( 1, "\n" );
+    fflush( stdout );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Multi-threaded bounded model checking.]
+
+  Description [Returns the same values as Saig_ManBmcScalable(), which
+  calls this procedure when more than one thread is requested.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Saig_ManBmcScalablePar( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
+{
+    Bmc_ParMan_t * p;
+    abctime clk, clkTotal = Abc_Clock();
+    abctime nTimeToStopNG = pPars->nTimeOut ? pPars->nTimeOut * CLOCKS_PER_SEC + Abc_Clock(): 0;
+    abctime nTimeToStop = Saig_ManBmcTimeToStop( pPars, nTimeToStopNG );
+    int nOutDigits = Abc_Base10Log( Saig_ManPoNum(pAig) );
+    int nFramesMax = pPars->nFramesMax ? pPars->nFramesMax : ABC_INFINITY;
+    int RetValue = -1, i, k, f, w, nWin, iJob;
+    p = Bmc_ParManStart( pAig, pPars );
+    if ( pPars->fSolveAll )
+        pAig->vSeqModelVec = Vec_PtrStart( p->nPos );
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Running \"bmc3\" with %d threads. PI/PO/Reg = %d/%d/%d. And =%7d. Lev =%6d.\n",
+            p->nWorkers, Saig_ManPiNum(pAig), Saig_ManPoNum(pAig), Saig_ManRegNum(pAig),
+            Aig_ManNodeNum(pAig), Aig_ManLevelNum(pAig) );
+        Abc_Print( 1, "Params: FramesMax = %d. Start = %d. ConfLimit = %d. TimeOut = %d. SolveAll = %d.\n",
+            pPars->nFramesMax, pPars->nStart, pPars->nConfLimit, pPars->nTimeOut, pPars->fSolveAll );
+    }
+    pPars->timeLastSolved = Abc_Clock();
+    for ( f = 0; f < nFramesMax; f += nWin )
+    {
+        int nUnsolved = p->nPos - pPars->nFailOuts;
+        // stop BMC after exploring all reachable states
+        if ( Aig_ManRegNum(pAig) < 30 && f >= (1 << Aig_ManRegNum(pAig)) )
+        {
+            Abc_Print( 1, "Stopping BMC because all 2^%d reachable states are visited.\n", Aig_ManRegNum(pAig) );
+            RetValue = pPars->nFailOuts ? 0 : 1;
+            goto finish;
+        }
+        // stop BMC if all targets are solved
+        if ( pPars->fSolveAll && nUnsolved == 0 )
+        {
+            Abc_Print( 1, "Stopping BMC because all targets are disproved or timed out.\n" );
+            RetValue = 0;
+            goto finish;
+        }
+        if ( nTimeToStop && Abc_Clock() > nTimeToStop )
+        {
+            if ( !pPars->fSilent )
+                Abc_Print( 1, "Reached timeout (%d seconds).\n",  pPars->nTimeOut );
+            goto finish;
+        }
+        if ( pPars->pFuncStop && pPars->pFuncStop(pPars->RunId) )
+        {
+            if ( !pPars->fSilent )
+                Abc_Print( 1, "Bmc3 got callbacks.\n" );
+            goto finish;
+        }
+        if ( pPars->nStart == 0 )
+            pPars->iFrame = f - 1;
+        // the window has enough jobs to keep all workers busy
+        nWin = Abc_MaxInt( 1, p->nWorkers / Abc_MaxInt(1, nUnsolved) );
+        nWin = Abc_MinInt( nWin, nFramesMax - f );
+        if ( Aig_ManRegNum(pAig) < 30 )
+            nWin = Abc_MinInt( nWin, (1 << Aig_ManRegNum(pAig)) - f );
+        clk = Abc_Clock();
+        for ( w = 0; w < nWin; w++ )
+            p->pFrames = Unr_ManUnrollFrame( p->pUnr, f + w );
+        p->timeCnf += Abc_Clock() - clk;
+        Bmc_ParManAddCnf( p, f, nWin );
+        // create the jobs
+        for ( i = 0; i < p->nJobs; i++ )
+            Abc_CexFreeP( &p->pJobs[i].pCex );
+        if ( p->nJobsAlloc < nWin * p->nPos )
+        {
+            p->nJobsAlloc = nWin * p->nPos;
+            p->pJobs = ABC_REALLOC( Bmc_ParJob_t, p->pJobs, p->nJobsAlloc );
+        }
+        // the jobs are split into blocks; iJob also counts the frames before nStart
+        p->nJobs = p->iNext = iJob = 0;
+        for ( w = 0; w < nWin; w++ )
+        for ( i = 0; i < p->nPos; i++ )
+        {
+            if ( p->pFrameSat[i] >= 0 )
+                continue;
+            if ( f + w >= pPars->nStart )
+            {
+                p->pJobs[p->nJobs].iFrame = f + w;
+                p->pJobs[p->nJobs].iOut   = i;
+                p->pJobs[p->nJobs].Status = BMC_PAR_SKIP;
+                p->pJobs[p->nJobs].iOwner = iJob * p->nWorkers / (nWin * nUnsolved);
+                p->pJobs[p->nJobs].fTaken = 0;
+                p->pJobs[p->nJobs].pCex   = NULL;
+                p->nJobs++;
+            }
+            iJob++;
+        }
+        // solve the jobs
+        if ( p->nJobs > 0 )
+            Bmc_ParManSolveWindow( p, nTimeToStop );
+        // report the failed outputs
+        if ( pPars->fSolveAll )
+        {
+            for ( k = 0; k < p->nJobs; k++ )
+            {
+                Bmc_ParJob_t * pJob = p->pJobs + k;
+                if ( pJob->Status != l_True || pJob->iFrame != p->pFrameSat[pJob->iOut] )
+                    continue;
+                pPars->nFailOuts++;
+                pPars->timeLastSolved = Abc_Clock();
+                nTimeToStop = Saig_ManBmcTimeToStop( pPars, nTimeToStopNG );
+                if ( !pPars->fNotVerbose )
+                    Abc_Print( 1, "Output %*d was asserted in frame %2d (solved %*d out of %*d outputs).\n",
+                        nOutDigits, pJob->iOut, pJob->iFrame, nOutDigits, pPars->nFailOuts, nOutDigits, p->nPos );
+                Vec_PtrWriteEntry( pAig->vSeqModelVec, pJob->iOut, pPars->fStoreCex ? pJob->pCex : (Abc_Cex_t *)(ABC_PTRINT_T)1 );
+                if ( pPars->fStoreCex )
+                    pJob->pCex = NULL;
+                if ( pPars->pFuncOnFail && pPars->pFuncOnFail(pJob->iOut, pPars->fStoreCex ? (Abc_Cex_t *)Vec_PtrEntry(pAig->vSeqModelVec, pJob->iOut) : NULL) )
+                {
+                    Abc_Print( 1, "Quitting due to callback on fail.\n" );
+                    RetValue = 0;
+                    goto finish;
+                }
+            }
+            if ( pPars->nFailOuts )
+                RetValue = 0;
+        }
+        if ( p->iStopFrame >= 0 )
+        {
+            // find the job where the workers stopped
+            for ( k = 0; k < p->nJobs; k++ )
+                if ( p->pJobs[k].iFrame == p->iStopFrame && p->pJobs[k].iOut == p->iStopOut )
+                    break;
+            assert( k < p->nJobs );
+            if ( p->pJobs[k].Status == l_True )
+            {
+                assert( !pPars->fSolveAll );
+                RetValue = 0;
+                ABC_FREE( pAig->pSeqModel );
+                pAig->pSeqModel = p->pJobs[k].pCex;
+                p->pJobs[k].pCex = NULL;
+            }
+            if ( pPars->nStart == 0 )
+                pPars->iFrame = p->iStopFrame - 1;
+            if ( pPars->fVerbose )
+                Bmc_ParManPrintFrame( p, p->iStopFrame, clkTotal );
+            goto finish;
+        }
+        if ( RetValue == -1 && pPars->nStart == 0 )
+            pPars->iFrame = f + nWin - 1;
+        if ( pPars->fVerbose )
+            Bmc_ParManPrintFrame( p, f + nWin - 1, clkTotal );
+        if ( pPars->nTimeOutGap && pPars->timeLastSolved && Abc_Clock() > pPars->timeLastSolved + pPars->nTimeOutGap * CLOCKS_PER_SEC )
+        {
+            Abc_Print( 1, "Reached gap timeout (%d seconds).\n",  pPars->nTimeOutGap );
+            goto finish;
+        }
+    }
+finish:
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Runtime:  CNF = %.1f sec (%.1f %%)\n", 1.0*p->timeCnf/CLOCKS_PER_SEC, 100.0*p->timeCnf/(Abc_Clock() - clkTotal) );
+        Abc_Print( 1, "Jobs solved (taken from other threads) by each thread:" );
+        for ( i = 0; i < p->nWorkers; i++ )
+            Abc_Print( 1, " %d (%d)", p->pWrks[i].nSolved, p->pWrks[i].nStolen );
+        Abc_Print( 1, "\n" );
+        Abc_Print( 1, "Time spent solving the windows by each thread:" );
+        for ( i = 0; i < p->nWorkers; i++ )
+            Abc_Print( 1, " %.2f", 1.0*p->pWrks[i].timeBusy/CLOCKS_PER_SEC );
+        Abc_Print( 1, " sec\n" );
+    }
+    Bmc_ParManStop( p );
+    fflush( stdout );
+    return RetValue;
+}
+
+#else // pthreads are not used
+
+int Saig_ManBmcScalablePar( Aig_Man_t * pAig, Saig_ParBmc_t * pPars )
+{
+    pPars->nProcs = 1;
+    return Saig_ManBmcScalable( pAig, pPars );
+}
+
+#endif // pthreads are used
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
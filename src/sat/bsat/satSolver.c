@@ -132,6 +132,17 @@ int sat_solver_get_var_value(sat_solver* s, int v)
 static inline int      sat_solver_dl(sat_solver* s)                { return veci_size(&s->trail_lim); }
 static inline veci*    sat_solver_read_wlist(sat_solver* s, lit l) { return &s->wlists[l];            }
 
+// the watcher of a 2-lit clause is one entry: the other literal tagged by clause_from_lit()
+// the watcher of a longer clause is two entries: the clause handle and the blocker literal,
+// which is a literal of the clause; when it is true, the clause is skipped without reading it
+static inline int      sat_solver_watch_size(cla h)                { return clause_is_lit(h) ? 1 : 2; }
+static inline void     sat_solver_watch(sat_solver* s, lit l, cla h, lit blocker)
+{
+    veci* ws = sat_solver_read_wlist(s,l);
+    veci_push(ws, h);
+    veci_push(ws, blocker);
+}
+
 //=================================================================================================
 // Variable order functions:
 
@@ -586,8 +597,16 @@ int sat_solver_clause_new(sat_solver* s, lit* begin, lit* end, int learnt)
 
     //veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),c);
     //veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),c);
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),(size > 2 ? h : clause_from_lit(begin[1])));
-    veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),(size > 2 ? h : clause_from_lit(begin[0])));
+    if ( size > 2 )
+    {
+        sat_solver_watch(s, lit_neg(begin[0]), h, begin[1]);
+        sat_solver_watch(s, lit_neg(begin[1]), h, begin[0]);
+    }
+    else
+    {
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[0])),clause_from_lit(begin[1]));
+        veci_push(sat_solver_read_wlist(s,lit_neg(begin[1])),clause_from_lit(begin[0]));
+    }
 
     return h;
 }
@@ -1053,12 +1072,14 @@ int sat_solver_propagate(sat_solver* s)
         int*  begin = veci_begin(ws);
         int*  end   = begin + veci_size(ws);
         int*i, *j;
+        int nKept = 0, w; // the number of watchers staying in the list
 
         s->stats.propagations++;
 //        s->simpdb_props--;
 
         //printf("checking lit %d: "L_LIT"\n", veci_size(ws), L_lit(p));
         for (i = j = begin; i < end; ){
+            nKept++;
             if (clause_is_lit(*i)){
 
                 int Lit = clause_read_lit(*i);
@@ -1073,12 +1094,27 @@ int sat_solver_propagate(sat_solver* s)
                     (clause_begin(s->binary))[1] = lit_neg(p);
                     (clause_begin(s->binary))[0] = clause_read_lit(*i++);
                     // Copy the remaining watches:
-                    while (i < end)
-                        *j++ = *i++;
+                    while (i < end){
+                        nKept++;
+                        for (w = sat_solver_watch_size(*i); w > 0; w--)
+                            *j++ = *i++;
+                    }
                 }
+                else
+                    i++;
             }else{
 
-                clause* c = clause_read(s,*i);
+                clause* c;
+                lit blocker = i[1];
+
+                // If the blocker is true, then clause is already satisfied.
+                if (var_value(s, lit_var(blocker)) == lit_sign(blocker)){
+                    *j++ = *i++;
+                    *j++ = *i++;
+                    continue;
+                }
+
+                c = clause_read(s,*i);
                 lits = clause_begin(c);
 
                 // Make sure the false literal is data[1]:
@@ -1090,8 +1126,10 @@ int sat_solver_propagate(sat_solver* s)
                 assert(lits[1] == false_lit);
 
                 // If 0th watch is true, then clause is already satisfied.
-                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0]))
+                if (var_value(s, lit_var(lits[0])) == lit_sign(lits[0])){
                     *j++ = *i;
+                    *j++ = lits[0];
+                }
                 else{
                     // Look for new watch:
                     lit* stop = lits + clause_size(c);
@@ -1100,27 +1138,34 @@ int sat_solver_propagate(sat_solver* s)
                         if (var_value(s, lit_var(*k)) != !lit_sign(*k)){
                             lits[1] = *k;
                             *k = false_lit;
-                            veci_push(sat_solver_read_wlist(s,lit_neg(lits[1])),*i);
+                            sat_solver_watch(s, lit_neg(lits[1]), *i, lits[0]);
+                            nKept--;
                             goto next; }
                     }
 
                     *j++ = *i;
+                    *j++ = lits[0];
                     // Clause is unit under assignment:
                     if ( c->lrn )
                         c->lbd = sat_clause_compute_lbd(s, c);
                     if (!sat_solver_enqueue(s,lits[0], *i)){
-                        hConfl = *i++;
+                        hConfl = *i;
+                        i += 2;
                         // Copy the remaining watches:
-                        while (i < end)
-                            *j++ = *i++;
+                        while (i < end){
+                            nKept++;
+                            for (w = sat_solver_watch_size(*i); w > 0; w--)
+                                *j++ = *i++;
+                        }
+                        continue;
                     }
                 }
+            next:
+                i += 2;
             }
-        next:
-            i++;
         }
 
-        s->stats.inspects += j - veci_begin(ws);
+        s->stats.inspects += nKept;
         veci_resize(ws,j - veci_begin(ws));
 #ifdef TEST_CNF_LOAD
         }
@@ -1130,6 +1175,41 @@ int sat_solver_propagate(sat_solver* s)
     return hConfl;
 }
 
+// performs rounds of random decisions followed by propagation, until
+// a conflict or a complete assignment; returns the number of conflicts,
+// or -1 if propagating the unit clauses already gives a conflict
+int sat_solver_propagate_bench(sat_solver* s, int nRounds)
+{
+    double seed = 91648253;
+    int r, i, k, v, nConfls = 0;
+    int * pPerm;
+    assert( sat_solver_dl(s) == 0 );
+    if ( sat_solver_propagate(s) != 0 )
+        return -1;
+    pPerm = ABC_ALLOC( int, s->size );
+    for ( i = 0; i < s->size; i++ )
+        pPerm[i] = i;
+    for ( r = 0; r < nRounds; r++ )
+    {
+        for ( i = 0; i < s->size; i++ )
+        {
+            k = i + irand( &seed, s->size - i );
+            v = pPerm[k]; pPerm[k] = pPerm[i]; pPerm[i] = v;
+            if ( var_value(s, v) != varX )
+                continue;
+            sat_solver_decision( s, toLitCond(v, irand(&seed, 2)) );
+            if ( sat_solver_propagate(s) != 0 )
+            {
+                nConfls++;
+                break;
+            }
+        }
+        sat_solver_canceluntil( s, 0 );
+    }
+    ABC_FREE( pPerm );
+    return nConfls;
+}
+
 //=================================================================================================
 // External solver functions:
 
@@ -1607,17 +1687,23 @@ void sat_solver_reducedb(sat_solver* s)
     for ( i = 0; i < s->size*2; i++ )
     {
         pArray = veci_begin(&s->wlists[i]);
-        for ( j = k = 0; k < veci_size(&s->wlists[i]); k++ )
+        for ( j = k = 0; k < veci_size(&s->wlists[i]); k += sat_solver_watch_size(pArray[k]) )
         {
             if ( clause_is_lit(pArray[k]) ) // 2-lit clause
                 pArray[j++] = pArray[k];
             else if ( !clause_learnt_h(pMem, pArray[k]) ) // problem clause
+            {
                 pArray[j++] = pArray[k];
+                pArray[j++] = pArray[k+1];
+            }
             else 
             {
                 c = clause_read(s, pArray[k]);
                 if ( !c->mark ) // useful learned clause
+                {
                    pArray[j++] = clause_id(c); // updating handle here!!!
+                   pArray[j++] = pArray[k+1];
+                }
             }
         }
         veci_resize(&s->wlists[i],j);
@@ -1671,7 +1757,7 @@ void sat_solver_rollback( sat_solver* s )
     for ( i = 0; i < s->iVarPivot*2; i++ )
     {
         cla* pArray = veci_begin(&s->wlists[i]);
-        for ( j = k = 0; k < veci_size(&s->wlists[i]); k++ )
+        for ( j = k = 0; k < veci_size(&s->wlists[i]); k += sat_solver_watch_size(pArray[k]) )
         {
             if ( clause_is_lit(pArray[k]) )
             {
@@ -1679,7 +1765,10 @@ void sat_solver_rollback( sat_solver* s )
                     pArray[j++] = pArray[k];
             }
             else if ( Sat_MemClauseUsed(pMem, pArray[k]) )
+            {
                 pArray[j++] = pArray[k];
+                pArray[j++] = pArray[k+1];
+            }
         }
         veci_resize(&s->wlists[i],j);
     }
@@ -134,6 +134,15 @@ extern Cnf_Dat_t *     Cnf_DeriveOtherWithMan( Cnf_Man_t * p, Aig_Man_t * pAig,
 extern void            Cnf_ManPrepare();
 extern Cnf_Man_t *     Cnf_ManRead();
 extern void            Cnf_ManFree();
+/*=== cnfCache.c ========================================================*/
+extern Cnf_Dat_t *     Cnf_DeriveCached( Aig_Man_t * pAig, int nOutputs );
+extern Cnf_Dat_t *     Cnf_DeriveCachedCone( Aig_Man_t * pAig, Vec_Ptr_t * vNodes );
+extern void *          Cnf_CacheStart();
+extern void            Cnf_CacheStop( void * pCache );
+extern void            Cnf_CacheFree( Aig_Man_t * pAig );
+extern void            Cnf_CacheAttach( Aig_Man_t * pAig, void * pCache );
+extern void            Cnf_CacheTransfer( Aig_Man_t * pFrom, Aig_Man_t * pTo );
+extern void            Cnf_CachePrintStats( Aig_Man_t * pAig );
 /*=== cnfCut.c ========================================================*/
 extern Cnf_Cut_t *     Cnf_CutCreate( Cnf_Man_t * p, Aig_Obj_t * pObj );
 extern void            Cnf_CutPrint( Cnf_Cut_t * pCut );
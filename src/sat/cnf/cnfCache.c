@@ -0,0 +1,786 @@
+/**CFile****************************************************************
+
+  FileName    [cnfCache.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [AIG-to-CNF conversion.]
+
+  Synopsis    [CNF cache attached to the AIG manager.]
+
+  Author      [Berkeley Logic Synthesis and Verification Group]
+
+  Affiliation [UC Berkeley]
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    []
+
+***********************************************************************/
+
+#include "cnf.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The cache stores the clauses derived by the cut-based CNF generator for
+// each mapped AND node, using object IDs as variables. The record of a node
+// also lists the leaves of its cut and the fanins of the nodes between the
+// node and the leaves. The record remains valid while these fanins do not
+// change and the leaves are CIs or nodes with valid records. When the CNF
+// is requested again, the valid records are reused and only the remaining
+// part of the logic cone is mapped.
+//
+// Each record is the following sequence of numbers:
+//   nLeaves, <leaf IDs>, nInner, <node ID, fanin0 literal, fanin1 literal>,
+//   nClauses, <clause size, literals>
+
+typedef struct Cnf_Cache_t_ Cnf_Cache_t;
+struct Cnf_Cache_t_
+{
+    Vec_Int_t *      vRecs;          // the record of each object (-1 if none)
+    Vec_Int_t *      vData;          // the records
+    int              nDataLive;      // the size of records in use
+    Vec_Int_t *      vMemo;          // the validity of each object (0 = unknown; 1 = valid; 2 = invalid; 3 = remapped)
+    Vec_Int_t *      vLeaves;        // temporary leaves
+    Vec_Int_t *      vClas;          // temporary clauses
+    // statistics
+    int              nCalls;         // the number of requests
+    int              nHits;          // the number of requests served without mapping
+    int              nReused;        // the number of reused node records
+    int              nDerived;       // the number of derived node records
+};
+
+static inline int   Cnf_RecLeafNum( int * pRec )  { return pRec[0];                                             }
+static inline int * Cnf_RecLeaves( int * pRec )   { return pRec + 1;                                            }
+static inline int * Cnf_RecInner( int * pRec )    { return pRec + 1 + pRec[0];                                  }
+static inline int * Cnf_RecClauses( int * pRec )  { int * pInner = Cnf_RecInner(pRec); return pInner + 1 + 3 * pInner[0]; }
+
+static inline int   Cnf_ObjLit0( Aig_Obj_t * pObj ) { return Abc_Var2Lit( Aig_ObjFaninId0(pObj), Aig_ObjFaninC0(pObj) ); }
+static inline int   Cnf_ObjLit1( Aig_Obj_t * pObj ) { return Abc_Var2Lit( Aig_ObjFaninId1(pObj), Aig_ObjFaninC1(pObj) ); }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Starts and stops the cache.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Cnf_CacheStart()
+{
+    Cnf_Cache_t * p = ABC_CALLOC( Cnf_Cache_t, 1 );
+    p->vRecs   = Vec_IntAlloc( 0 );
+    p->vData   = Vec_IntAlloc( 0 );
+    p->vMemo   = Vec_IntAlloc( 0 );
+    p->vLeaves = Vec_IntAlloc( 100 );
+    p->vClas   = Vec_IntAlloc( 1000 );
+    return p;
+}
+void Cnf_CacheStop( void * pCache )
+{
+    Cnf_Cache_t * p = (Cnf_Cache_t *)pCache;
+    Vec_IntFree( p->vRecs );
+    Vec_IntFree( p->vData );
+    Vec_IntFree( p->vMemo );
+    Vec_IntFree( p->vLeaves );
+    Vec_IntFree( p->vClas );
+    ABC_FREE( p );
+}
+static Cnf_Cache_t * Cnf_CacheGet( Aig_Man_t * pAig )
+{
+    if ( pAig->pCnfCache == NULL )
+    {
+        pAig->pCnfCache = Cnf_CacheStart();
+        pAig->pCnfCacheFree = Cnf_CacheStop;
+    }
+    return (Cnf_Cache_t *)pAig->pCnfCache;
+}
+void Cnf_CacheFree( Aig_Man_t * pAig )
+{
+    if ( pAig->pCnfCacheFree )
+        pAig->pCnfCacheFree( pAig->pCnfCache );
+    pAig->pCnfCache = NULL;
+    pAig->pCnfCacheFree = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Makes the manager use the given cache.]
+
+  Description [The cache remains owned by the caller and is not freed
+  together with the manager. The records are checked against the
+  structure of the AIG before they are reused, so the same cache can
+  serve several managers derived from the same network, for example,
+  the miters built by consecutive SAT-based commands.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_CacheAttach( Aig_Man_t * pAig, void * pCache )
+{
+    Cnf_CacheFree( pAig );
+    pAig->pCnfCache = pCache;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Moves the cache to the manager derived from this one.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_CacheTransfer( Aig_Man_t * pFrom, Aig_Man_t * pTo )
+{
+    if ( pFrom->pCnfCache == NULL )
+        return;
+    Cnf_CacheFree( pTo );
+    pTo->pCnfCache = pFrom->pCnfCache;
+    pTo->pCnfCacheFree = pFrom->pCnfCacheFree;
+    pFrom->pCnfCache = NULL;
+    pFrom->pCnfCacheFree = NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Prints the statistics of the cache.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cnf_CachePrintStats( Aig_Man_t * pAig )
+{
+    Cnf_Cache_t * p = (Cnf_Cache_t *)pAig->pCnfCache;
+    if ( p == NULL )
+        return;
+    printf( "CNF cache:  Calls = %d.  Hits = %d.  Reused = %d.  Derived = %d.  Memory = %.2f MB.\n",
+        p->nCalls, p->nHits, p->nReused, p->nDerived,
+        4.0 * (Vec_IntCap(p->vData) + Vec_IntCap(p->vRecs) + Vec_IntCap(p->vMemo)) / (1<<20) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the record of the object.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int * Cnf_CacheRec( Cnf_Cache_t * p, int iObj )
+{
+    int iRec = iObj < Vec_IntSize(p->vRecs) ? Vec_IntEntry(p->vRecs, iObj) : -1;
+    return iRec >= 0 ? Vec_IntEntryP(p->vData, iRec) : NULL;
+}
+static int Cnf_CacheRecSize( int * pRec )
+{
+    int * pClas = Cnf_RecClauses( pRec );
+    int * pCur = pClas + 1, i;
+    for ( i = 0; i < pClas[0]; i++ )
+        pCur += 1 + pCur[0];
+    return pCur - pRec;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compacts the records when too many of them are not used.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_CacheCompact( Cnf_Cache_t * p )
+{
+    Vec_Int_t * vData;
+    int i, k, iRec, nSize;
+    if ( Vec_IntSize(p->vData) < 2 * p->nDataLive + 10000 )
+        return;
+    vData = Vec_IntAlloc( p->nDataLive );
+    Vec_IntForEachEntry( p->vRecs, iRec, i )
+    {
+        if ( iRec < 0 )
+            continue;
+        nSize = Cnf_CacheRecSize( Vec_IntEntryP(p->vData, iRec) );
+        Vec_IntWriteEntry( p->vRecs, i, Vec_IntSize(vData) );
+        for ( k = 0; k < nSize; k++ )
+            Vec_IntPush( vData, Vec_IntEntry(p->vData, iRec + k) );
+    }
+    assert( Vec_IntSize(vData) == p->nDataLive );
+    Vec_IntFree( p->vData );
+    p->vData = vData;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the record of one node.]
+
+  Description [The clauses are given as the sequence of their sizes
+  followed by the literals, with object IDs as variables. The first
+  literal of each clause belongs to the node.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_CacheCollectInner_rec( Aig_Man_t * pAig, Aig_Obj_t * pObj, Vec_Int_t * vData )
+{
+    if ( Aig_ObjIsTravIdCurrent(pAig, pObj) )
+        return;
+    Aig_ObjSetTravIdCurrent(pAig, pObj);
+    if ( !Aig_ObjIsNode(pObj) )
+        return;
+    Cnf_CacheCollectInner_rec( pAig, Aig_ObjFanin0(pObj), vData );
+    Cnf_CacheCollectInner_rec( pAig, Aig_ObjFanin1(pObj), vData );
+    Vec_IntPush( vData, Aig_ObjId(pObj) );
+    Vec_IntPush( vData, Cnf_ObjLit0(pObj) );
+    Vec_IntPush( vData, Cnf_ObjLit1(pObj) );
+}
+static void Cnf_CacheAddRecord( Cnf_Cache_t * p, Aig_Man_t * pAig, int iObj, Vec_Int_t * vClas, int nClas )
+{
+    int * pRec, i, k, nSize, iStart, iInner, Leaf;
+    // collect the leaves
+    Vec_IntClear( p->vLeaves );
+    for ( i = 0; i < Vec_IntSize(vClas); i += 1 + nSize )
+    {
+        nSize = Vec_IntEntry( vClas, i );
+        assert( Abc_Lit2Var(Vec_IntEntry(vClas, i+1)) == iObj );
+        for ( k = 2; k <= nSize; k++ )
+            Vec_IntPushUnique( p->vLeaves, Abc_Lit2Var(Vec_IntEntry(vClas, i+k)) );
+    }
+    Vec_IntSort( p->vLeaves, 0 );
+    // remove the old record
+    if ( (pRec = Cnf_CacheRec(p, iObj)) )
+        p->nDataLive -= Cnf_CacheRecSize( pRec );
+    iStart = Vec_IntSize( p->vData );
+    Vec_IntWriteEntry( p->vRecs, iObj, iStart );
+    // add the leaves
+    Vec_IntPush( p->vData, Vec_IntSize(p->vLeaves) );
+    Vec_IntAppend( p->vData, p->vLeaves );
+    // add the inner nodes
+    Aig_ManIncrementTravId( pAig );
+    Vec_IntForEachEntry( p->vLeaves, Leaf, i )
+        Aig_ObjSetTravIdCurrent( pAig, Aig_ManObj(pAig, Leaf) );
+    iInner = Vec_IntSize( p->vData );
+    Vec_IntPush( p->vData, 0 );
+    Cnf_CacheCollectInner_rec( pAig, Aig_ManObj(pAig, iObj), p->vData );
+    Vec_IntWriteEntry( p->vData, iInner, (Vec_IntSize(p->vData) - iInner - 1) / 3 );
+    // add the clauses
+    Vec_IntPush( p->vData, nClas );
+    Vec_IntAppend( p->vData, vClas );
+    p->nDataLive += Vec_IntSize(p->vData) - iStart;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the records of the nodes mapped in the CNF.]
+
+  Description [Considers the first nClauses clauses of the CNF derived
+  by Cnf_ManWriteCnf(). The clauses of each mapped node are consecutive
+  and start with the literal of the node. Array vVar2Obj gives the object
+  of the AIG for each variable of the CNF.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_CacheAddCnf( Cnf_Cache_t * p, Aig_Man_t * pAig, Cnf_Dat_t * pCnf, int nClauses, Vec_Int_t * vVar2Obj )
+{
+    int * pLit, * pStop, i, iObj, iObjCur = -1, nClas = 0;
+    Vec_IntClear( p->vClas );
+    for ( i = 0; i < nClauses; i++ )
+    {
+        iObj = Vec_IntEntry( vVar2Obj, Abc_Lit2Var(pCnf->pClauses[i][0]) );
+        assert( iObj > 0 );
+        if ( iObj != iObjCur && iObjCur >= 0 )
+        {
+            Cnf_CacheAddRecord( p, pAig, iObjCur, p->vClas, nClas );
+            Vec_IntClear( p->vClas );
+            nClas = 0;
+            p->nDerived++;
+        }
+        iObjCur = iObj;
+        Vec_IntPush( p->vClas, pCnf->pClauses[i+1] - pCnf->pClauses[i] );
+        for ( pLit = pCnf->pClauses[i], pStop = pCnf->pClauses[i+1]; pLit < pStop; pLit++ )
+            Vec_IntPush( p->vClas, Abc_Var2Lit(Vec_IntEntry(vVar2Obj, Abc_Lit2Var(*pLit)), Abc_LitIsCompl(*pLit)) );
+        nClas++;
+    }
+    if ( iObjCur >= 0 )
+    {
+        Cnf_CacheAddRecord( p, pAig, iObjCur, p->vClas, nClas );
+        p->nDerived++;
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the record of the node can be reused.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cnf_CacheIsValid_rec( Cnf_Cache_t * p, Aig_Man_t * pAig, int iObj )
+{
+    Aig_Obj_t * pObj = Aig_ManObj( pAig, iObj ), * pInner;
+    int * pRec, * pInners, i, Value;
+    if ( pObj == NULL )
+        return 0;
+    if ( Aig_ObjIsCi(pObj) || Aig_ObjIsConst1(pObj) )
+        return 1;
+    if ( (Value = Vec_IntEntry(p->vMemo, iObj)) )
+        return Value == 1;
+    Value = 2;
+    if ( (pRec = Cnf_CacheRec(p, iObj)) )
+    {
+        // check that the nodes between the node and the leaves did not change
+        pInners = Cnf_RecInner( pRec );
+        for ( i = 0; i < pInners[0]; i++ )
+        {
+            pInner = pInners[1+3*i] < Aig_ManObjNumMax(pAig) ? Aig_ManObj( pAig, pInners[1+3*i] ) : NULL;
+            if ( pInner == NULL || !Aig_ObjIsNode(pInner) ||
+                 Cnf_ObjLit0(pInner) != pInners[2+3*i] || Cnf_ObjLit1(pInner) != pInners[3+3*i] )
+                break;
+        }
+        // check that the leaves are valid
+        if ( i == pInners[0] )
+        {
+            for ( i = 0; i < Cnf_RecLeafNum(pRec); i++ )
+                if ( !Cnf_CacheIsValid_rec(p, pAig, Cnf_RecLeaves(pRec)[i]) )
+                    break;
+            if ( i == Cnf_RecLeafNum(pRec) )
+                Value = 1;
+        }
+    }
+    Vec_IntWriteEntry( p->vMemo, iObj, Value );
+    return Value == 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the nodes whose records cannot be reused.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_CacheCollectRegion_rec( Cnf_Cache_t * p, Aig_Man_t * pAig, Aig_Obj_t * pObj, Vec_Int_t * vRegion )
+{
+    if ( Aig_ObjIsTravIdCurrent(pAig, pObj) )
+        return;
+    Aig_ObjSetTravIdCurrent(pAig, pObj);
+    if ( !Aig_ObjIsNode(pObj) || Cnf_CacheIsValid_rec(p, pAig, Aig_ObjId(pObj)) )
+        return;
+    Cnf_CacheCollectRegion_rec( p, pAig, Aig_ObjFanin0(pObj), vRegion );
+    Cnf_CacheCollectRegion_rec( p, pAig, Aig_ObjFanin1(pObj), vRegion );
+    Vec_IntWriteEntry( p->vMemo, Aig_ObjId(pObj), 3 );
+    Vec_IntPush( vRegion, Aig_ObjId(pObj) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Maps the nodes whose records cannot be reused.]
+
+  Description [Copies the nodes into a separate AIG, whose CIs are the
+  fanins of these nodes with valid records and whose COs are the roots.
+  Derives CNF for this AIG and adds the records of its mapped nodes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Aig_Obj_t * Cnf_CacheSubObj( Aig_Man_t * pSub, Vec_Int_t * vCopy, Vec_Int_t * vOwner, Aig_Obj_t * pObj )
+{
+    int Lit = Vec_IntEntry( vCopy, Aig_ObjId(pObj) );
+    if ( Lit == -1 )
+    {
+        Aig_Obj_t * pObjNew = Aig_ObjCreateCi( pSub );
+        Vec_IntSetEntryFull( vOwner, Aig_ObjId(pObjNew), Aig_ObjId(pObj) );
+        Lit = Abc_Var2Lit( Aig_ObjId(pObjNew), 0 );
+        Vec_IntWriteEntry( vCopy, Aig_ObjId(pObj), Lit );
+    }
+    return Aig_NotCond( Aig_ManObj(pSub, Abc_Lit2Var(Lit)), Abc_LitIsCompl(Lit) );
+}
+static void Cnf_CacheDeriveRegion( Cnf_Cache_t * p, Aig_Man_t * pAig, Vec_Int_t * vRegion, Vec_Int_t * vRoots )
+{
+    Aig_Man_t * pSub;
+    Aig_Obj_t * pObj, * pObjNew, * pFan0, * pFan1;
+    Cnf_Dat_t * pCnf;
+    Vec_Int_t * vCopy, * vOwner, * vVar2Obj;
+    int i, iObj, iSub, Lit;
+    // copy the nodes
+    vCopy  = Vec_IntStartFull( Aig_ManObjNumMax(pAig) );
+    vOwner = Vec_IntStartFull( 1 );
+    pSub = Aig_ManStart( Vec_IntSize(vRegion) );
+    Vec_IntWriteEntry( vCopy, Aig_ManConst1(pAig)->Id, Abc_Var2Lit(Aig_ManConst1(pSub)->Id, 0) );
+    Vec_IntWriteEntry( vOwner, Aig_ManConst1(pSub)->Id, Aig_ManConst1(pAig)->Id );
+    Vec_IntForEachEntry( vRegion, iObj, i )
+    {
+        pObj  = Aig_ManObj( pAig, iObj );
+        pFan0 = Cnf_CacheSubObj( pSub, vCopy, vOwner, Aig_ObjFanin0(pObj) );
+        pFan1 = Cnf_CacheSubObj( pSub, vCopy, vOwner, Aig_ObjFanin1(pObj) );
+        pObjNew = Aig_And( pSub, Aig_NotCond(pFan0, Aig_ObjFaninC0(pObj)), Aig_NotCond(pFan1, Aig_ObjFaninC1(pObj)) );
+        Vec_IntWriteEntry( vCopy, iObj, Abc_Var2Lit(Aig_Regular(pObjNew)->Id, Aig_IsComplement(pObjNew)) );
+        if ( Vec_IntGetEntryFull(vOwner, Aig_Regular(pObjNew)->Id) == -1 )
+            Vec_IntSetEntryFull( vOwner, Aig_Regular(pObjNew)->Id, iObj );
+    }
+    Vec_IntForEachEntry( vRoots, iObj, i )
+        if ( Vec_IntEntry(p->vMemo, iObj) == 3 )
+        {
+            Lit = Vec_IntEntry( vCopy, iObj );
+            Aig_ObjCreateCo( pSub, Aig_NotCond(Aig_ManObj(pSub, Abc_Lit2Var(Lit)), Abc_LitIsCompl(Lit)) );
+        }
+    // derive CNF and record the clauses of its mapped nodes
+    pCnf = Cnf_Derive( pSub, 0 );
+    vVar2Obj = Vec_IntStartFull( pCnf->nVars );
+    Aig_ManForEachObj( pSub, pObj, i )
+        if ( pCnf->pVarNums[i] >= 0 )
+            Vec_IntWriteEntry( vVar2Obj, pCnf->pVarNums[i], Vec_IntGetEntryFull(vOwner, i) );
+    Cnf_CacheAddCnf( p, pAig, pCnf, pCnf->nClauses - 1 - Aig_ManCoNum(pSub), vVar2Obj );
+    Cnf_DataFree( pCnf );
+    Vec_IntFree( vVar2Obj );
+    // the roots merged with other nodes by structural hashing become buffers
+    Vec_IntForEachEntry( vRoots, iObj, i )
+    {
+        if ( Vec_IntEntry(p->vMemo, iObj) != 3 )
+            continue;
+        Lit  = Vec_IntEntry( vCopy, iObj );
+        iSub = Vec_IntGetEntryFull( vOwner, Abc_Lit2Var(Lit) );
+        if ( iSub == iObj && !Abc_LitIsCompl(Lit) )
+            continue;
+        Vec_IntClear( p->vClas );
+        if ( iSub == Aig_ManConst1(pAig)->Id )
+        {
+            Vec_IntPush( p->vClas, 1 );
+            Vec_IntPush( p->vClas, Abc_Var2Lit(iObj, Abc_LitIsCompl(Lit)) );
+            Cnf_CacheAddRecord( p, pAig, iObj, p->vClas, 1 );
+        }
+        else
+        {
+            Vec_IntPush( p->vClas, 2 );
+            Vec_IntPush( p->vClas, Abc_Var2Lit(iObj, 1) );
+            Vec_IntPush( p->vClas, Abc_Var2Lit(iSub, Abc_LitIsCompl(Lit)) );
+            Vec_IntPush( p->vClas, 2 );
+            Vec_IntPush( p->vClas, Abc_Var2Lit(iObj, 0) );
+            Vec_IntPush( p->vClas, Abc_Var2Lit(iSub, !Abc_LitIsCompl(Lit)) );
+            Cnf_CacheAddRecord( p, pAig, iObj, p->vClas, 2 );
+        }
+    }
+    Aig_ManStop( pSub );
+    Vec_IntFree( vCopy );
+    Vec_IntFree( vOwner );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Makes sure the records of the roots' cones are valid.]
+
+  Description [Returns the number of remapped nodes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cnf_CacheUpdate( Cnf_Cache_t * p, Aig_Man_t * pAig, Vec_Int_t * vRoots )
+{
+    Vec_Int_t * vRegion = Vec_IntAlloc( 100 );
+    int i, iObj, nDerived = p->nDerived;
+    Vec_IntFillExtra( p->vRecs, Aig_ManObjNumMax(pAig), -1 );
+    Vec_IntFill( p->vMemo, Aig_ManObjNumMax(pAig), 0 );
+    Aig_ManIncrementTravId( pAig );
+    Vec_IntForEachEntry( vRoots, iObj, i )
+        Cnf_CacheCollectRegion_rec( p, pAig, Aig_ManObj(pAig, iObj), vRegion );
+    if ( Vec_IntSize(vRegion) )
+        Cnf_CacheDeriveRegion( p, pAig, vRegion, vRoots );
+    else
+        p->nHits++;
+    Vec_IntFree( vRegion );
+    Cnf_CacheCompact( p );
+    return p->nDerived - nDerived;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the mapped nodes in the DFS preorder.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cnf_CacheCollect_rec( Cnf_Cache_t * p, Aig_Man_t * pAig, Aig_Obj_t * pObj, Vec_Ptr_t * vMapped, Vec_Ptr_t * vCis )
+{
+    int * pRec, i;
+    if ( Aig_ObjIsTravIdCurrent(pAig, pObj) )
+        return;
+    Aig_ObjSetTravIdCurrent(pAig, pObj);
+    if ( Aig_ObjIsCi(pObj) && vCis )
+        Vec_PtrPush( vCis, pObj );
+    if ( !Aig_ObjIsNode(pObj) )
+        return;
+    pRec = Cnf_CacheRec( p, Aig_ObjId(pObj) );
+    assert( pRec != NULL );
+    Vec_PtrPush( vMapped, pObj );
+    for ( i = 0; i < Cnf_RecLeafNum(pRec); i++ )
+        Cnf_CacheCollect_rec( p, pAig, Aig_ManObj(pAig, Cnf_RecLeaves(pRec)[i]), vMapped, vCis );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes CNF using the records of the mapped nodes.]
+
+  Description [Follows the variable order and the clause order of
+  Cnf_ManWriteCnf(). If fAddCos is 0, the CO clauses are not added and
+  only the given CIs are assigned variables.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Cnf_Dat_t * Cnf_CacheWriteCnf( Cnf_Cache_t * p, Aig_Man_t * pAig, Vec_Ptr_t * vMapped, Vec_Ptr_t * vCis, int nOutputs, int fAddCos )
+{
+    Aig_Obj_t * pObj;
+    Cnf_Dat_t * pCnf;
+    int * pRec, * pCla, * pLits, ** pClas;
+    int i, k, c, nLiterals, nClauses, Number, OutVar, PoVar;
+    // count the number of literals and clauses
+    nLiterals = 1 + (fAddCos ? Aig_ManCoNum(pAig) + 3 * nOutputs : 0);
+    nClauses  = 1 + (fAddCos ? Aig_ManCoNum(pAig) + nOutputs : 0);
+    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+    {
+        pRec = Cnf_RecClauses( Cnf_CacheRec(p, Aig_ObjId(pObj)) );
+        nClauses += pRec[0];
+        for ( c = 0, pCla = pRec + 1; c < pRec[0]; c++, pCla += 1 + pCla[0] )
+            nLiterals += pCla[0];
+    }
+    // allocate CNF
+    pCnf = ABC_CALLOC( Cnf_Dat_t, 1 );
+    pCnf->pMan = pAig;
+    pCnf->nLiterals = nLiterals;
+    pCnf->nClauses = nClauses;
+    pCnf->pClauses = ABC_ALLOC( int *, nClauses + 1 );
+    pCnf->pClauses[0] = ABC_ALLOC( int, nLiterals );
+    pCnf->pClauses[nClauses] = pCnf->pClauses[0] + nLiterals;
+    pCnf->pVarNums = ABC_FALLOC( int, Aig_ManObjNumMax(pAig) );
+    // assign variables to the last (nOutputs) POs
+    Number = 1;
+    if ( fAddCos && nOutputs )
+    {
+        if ( Aig_ManRegNum(pAig) == 0 )
+        {
+            assert( nOutputs == Aig_ManCoNum(pAig) );
+            Aig_ManForEachCo( pAig, pObj, i )
+                pCnf->pVarNums[pObj->Id] = Number++;
+        }
+        else
+        {
+            assert( nOutputs == Aig_ManRegNum(pAig) );
+            Aig_ManForEachLiSeq( pAig, pObj, i )
+                pCnf->pVarNums[pObj->Id] = Number++;
+        }
+    }
+    // assign variables to the internal nodes, the CIs, and the constant node
+    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+        pCnf->pVarNums[pObj->Id] = Number++;
+    if ( vCis == NULL )
+    {
+        Aig_ManForEachCi( pAig, pObj, i )
+            pCnf->pVarNums[pObj->Id] = Number++;
+    }
+    else
+    {
+        Vec_PtrForEachEntry( Aig_Obj_t *, vCis, pObj, i )
+            pCnf->pVarNums[pObj->Id] = Number++;
+    }
+    pCnf->pVarNums[Aig_ManConst1(pAig)->Id] = Number++;
+    pCnf->nVars = Number;
+    // copy the clauses
+    pLits = pCnf->pClauses[0];
+    pClas = pCnf->pClauses;
+    Vec_PtrForEachEntry( Aig_Obj_t *, vMapped, pObj, i )
+    {
+        pRec = Cnf_RecClauses( Cnf_CacheRec(p, Aig_ObjId(pObj)) );
+        for ( c = 0, pCla = pRec + 1; c < pRec[0]; c++, pCla += 1 + pCla[0] )
+        {
+            *pClas++ = pLits;
+            for ( k = 1; k <= pCla[0]; k++ )
+            {
+                assert( pCnf->pVarNums[Abc_Lit2Var(pCla[k])] > 0 );
+                *pLits++ = Abc_Var2Lit( pCnf->pVarNums[Abc_Lit2Var(pCla[k])], Abc_LitIsCompl(pCla[k]) );
+            }
+        }
+    }
+    // write the constant literal
+    OutVar = pCnf->pVarNums[ Aig_ManConst1(pAig)->Id ];
+    *pClas++ = pLits;
+    *pLits++ = 2 * OutVar;
+    // write the output literals
+    if ( fAddCos )
+    Aig_ManForEachCo( pAig, pObj, i )
+    {
+        OutVar = pCnf->pVarNums[ Aig_ObjFanin0(pObj)->Id ];
+        if ( i < Aig_ManCoNum(pAig) - nOutputs )
+        {
+            *pClas++ = pLits;
+            *pLits++ = 2 * OutVar + Aig_ObjFaninC0(pObj);
+        }
+        else
+        {
+            PoVar = pCnf->pVarNums[ pObj->Id ];
+            // first clause
+            *pClas++ = pLits;
+            *pLits++ = 2 * PoVar;
+            *pLits++ = 2 * OutVar + !Aig_ObjFaninC0(pObj);
+            // second clause
+            *pClas++ = pLits;
+            *pLits++ = 2 * PoVar + 1;
+            *pLits++ = 2 * OutVar + Aig_ObjFaninC0(pObj);
+        }
+    }
+    assert( pLits - pCnf->pClauses[0] == nLiterals );
+    assert( pClas - pCnf->pClauses == nClauses );
+    return pCnf;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives CNF for the AIG using the cache.]
+
+  Description [Returns the same CNF as Cnf_Derive(). The clauses of the
+  mapped nodes are kept in the cache attached to the manager. When the
+  CNF is derived again for the same manager, possibly after some nodes
+  have been added or changed, the clauses of the unchanged nodes are
+  reused and only the new part of the AIG is mapped. The cache is
+  deleted together with the manager or by calling Cnf_CacheFree(),
+  unless it was given by Cnf_CacheAttach().]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Dat_t * Cnf_DeriveCached( Aig_Man_t * pAig, int nOutputs )
+{
+    Cnf_Cache_t * p = Cnf_CacheGet( pAig );
+    Cnf_Dat_t * pCnf;
+    Vec_Ptr_t * vMapped;
+    Vec_Int_t * vRoots;
+    Aig_Obj_t * pObj;
+    int i, nDerived;
+    p->nCalls++;
+    if ( Vec_IntSize(p->vData) == 0 )
+    {
+        // derive CNF for the first time and fill in the cache
+        Vec_Int_t * vVar2Obj;
+        pCnf = Cnf_Derive( pAig, nOutputs );
+        vVar2Obj = Vec_IntStartFull( pCnf->nVars );
+        Aig_ManForEachObj( pAig, pObj, i )
+            if ( pCnf->pVarNums[i] >= 0 )
+                Vec_IntWriteEntry( vVar2Obj, pCnf->pVarNums[i], i );
+        Vec_IntFillExtra( p->vRecs, Aig_ManObjNumMax(pAig), -1 );
+        Cnf_CacheAddCnf( p, pAig, pCnf, pCnf->nClauses - 1 - Aig_ManCoNum(pAig) - nOutputs, vVar2Obj );
+        Vec_IntFree( vVar2Obj );
+        return pCnf;
+    }
+    // update the records of the logic cones of the COs
+    vRoots = Vec_IntAlloc( Aig_ManCoNum(pAig) );
+    Aig_ManForEachCo( pAig, pObj, i )
+        Vec_IntPush( vRoots, Aig_ObjFaninId0(pObj) );
+    nDerived = Cnf_CacheUpdate( p, pAig, vRoots );
+    // collect the mapped nodes in the same order as Cnf_ManScanMapping()
+    vMapped = Vec_PtrAlloc( 1000 );
+    Aig_ManIncrementTravId( pAig );
+    Aig_ManForEachCo( pAig, pObj, i )
+        Cnf_CacheCollect_rec( p, pAig, Aig_ObjFanin0(pObj), vMapped, NULL );
+    p->nReused += Vec_PtrSize(vMapped) - nDerived;
+    pCnf = Cnf_CacheWriteCnf( p, pAig, vMapped, NULL, nOutputs, 1 );
+    Vec_PtrFree( vMapped );
+    Vec_IntFree( vRoots );
+    return pCnf;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives CNF for the logic cones of the nodes using the cache.]
+
+  Description [The CNF contains the clauses of the mapped nodes in the
+  cones and the unit clause of the constant node. The variables are
+  assigned to the mapped nodes, the CIs of the cones, and the constant
+  node. The variable of each root is given by its entry of pVarNums.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Cnf_Dat_t * Cnf_DeriveCachedCone( Aig_Man_t * pAig, Vec_Ptr_t * vNodes )
+{
+    Cnf_Cache_t * p = Cnf_CacheGet( pAig );
+    Cnf_Dat_t * pCnf;
+    Vec_Ptr_t * vMapped, * vCis;
+    Vec_Int_t * vRoots;
+    Aig_Obj_t * pObj;
+    int i, nDerived;
+    p->nCalls++;
+    vRoots = Vec_IntAlloc( Vec_PtrSize(vNodes) );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+        Vec_IntPush( vRoots, Aig_ObjId(Aig_Regular(pObj)) );
+    nDerived = Cnf_CacheUpdate( p, pAig, vRoots );
+    vMapped = Vec_PtrAlloc( 1000 );
+    vCis = Vec_PtrAlloc( 100 );
+    Aig_ManIncrementTravId( pAig );
+    Vec_PtrForEachEntry( Aig_Obj_t *, vNodes, pObj, i )
+        Cnf_CacheCollect_rec( p, pAig, Aig_Regular(pObj), vMapped, vCis );
+    p->nReused += Vec_PtrSize(vMapped) - nDerived;
+    pCnf = Cnf_CacheWriteCnf( p, pAig, vMapped, vCis, 0, 0 );
+    Vec_PtrFree( vMapped );
+    Vec_PtrFree( vCis );
+    Vec_IntFree( vRoots );
+    return pCnf;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -64,6 +64,17 @@ struct satoko_opts {
     /* Binary resolution */
     unsigned clause_max_sz_bin_resol;
     unsigned clause_min_lbd_bin_resol;
+
+    /* Inprocessing */
+    unsigned inpr_interval;      /* N.of conflicts between inprocessing rounds (0 = no inprocessing) */
+    long inpr_effort;            /* Limit on the work of each technique in a round */
+    unsigned vivify_max_lbd;     /* Only learnt clauses up to this LBD are vivified */
+    unsigned bve_max_occ;        /* Skip variables with more occurrences of one polarity */
+    unsigned bve_max_resolvent;  /* Skip variables producing longer resolvents */
+    char f_vivify;               /* Vivify learnt clauses */
+    char f_subsume;              /* Remove subsumed clauses */
+    char f_bve;                  /* Eliminate non-frozen variables (see satoko_freeze_var) */
+
     float garbage_max_ratio;
     char verbose;
     char no_simplify;
@@ -83,6 +94,13 @@ struct satoko_stats {
 
     long n_original_lits;
     long n_learnt_lits;
+
+    unsigned n_inprocess;
+    long n_vivified;
+    long n_vivified_lits;
+    long n_subsumed;
+    long n_eliminated;
+    long n_resolvents;
 };
 
 
@@ -106,6 +124,10 @@ extern int  satoko_solve_assumptions_limit(satoko_t *s, int * plits, int nlits,
 extern int  satoko_minimize_assumptions(satoko_t *s, int * plits, int nlits, int nconflim);
 extern void satoko_mark_cone(satoko_t *, int *, int);
 extern void satoko_unmark_cone(satoko_t *, int *, int);
+/* Variables used in clauses or assumptions added after a call to the solver
+ * should be frozen when bounded variable elimination (f_bve) is enabled.
+ * Assumptions of the current call are frozen automatically. */
+extern void satoko_freeze_var(satoko_t *, int, int);
 
 extern void satoko_rollback(satoko_t *);
 extern void satoko_bookmark(satoko_t *);
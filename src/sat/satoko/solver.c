@@ -194,6 +194,8 @@ static inline unsigned solver_decide(solver_t *s)
         next_var = heap_remove_min(s->var_order);
         if (solver_has_marks(s) && !var_mark(s, next_var))
             next_var = UNDEF;
+        else if (var_is_eliminated(s, next_var))
+            next_var = UNDEF;
     }
     return var2lit(next_var, satoko_var_polarity(s, next_var));
 }
@@ -477,6 +479,448 @@ static inline void solver_reduce_cdb(solver_t *s)
         solver_garbage_collect(s);
 }
 
+//===------------------------------------------------------------------------===
+// Inprocessing functions
+//===------------------------------------------------------------------------===
+static inline int clause_is_locked(solver_t *s, unsigned cref)
+{
+    struct clause *clause = clause_fetch(s, cref);
+    unsigned *lits = &(clause->data[0].lit);
+
+    if (lit_value(s, lits[0]) == SATOKO_LIT_TRUE && lit_reason(s, lits[0]) == cref)
+        return 1;
+    return clause->size == 2 && lit_value(s, lits[1]) == SATOKO_LIT_TRUE &&
+           lit_reason(s, lits[1]) == cref;
+}
+
+static inline int clause_is_satisfied_top(solver_t *s, struct clause *clause)
+{
+    unsigned i;
+
+    assert(solver_dlevel(s) == 0);
+    for (i = 0; i < clause->size; i++)
+        if (lit_value(s, clause->data[i].lit) == SATOKO_LIT_TRUE)
+            return 1;
+    return 0;
+}
+
+static inline void clause_delete(solver_t *s, unsigned cref)
+{
+    struct clause *clause = clause_fetch(s, cref);
+
+    clause_unwatch(s, cref);
+    clause->f_mark = 1;
+    if (clause->f_learnt)
+        s->stats.n_learnt_lits -= clause->size;
+    else
+        s->stats.n_original_lits -= clause->size;
+    cdb_remove(s->all_clauses, clause);
+}
+
+/* Removes the deleted clauses from a clause vector, starting from 'start' */
+static inline void solver_compact_clauses(solver_t *s, vec_uint_t *clauses, unsigned start)
+{
+    unsigned i, j = start;
+    unsigned cref;
+
+    vec_uint_foreach_start(clauses, cref, i, start)
+        if (!clause_fetch(s, cref)->f_mark)
+            vec_uint_assign(clauses, j++, cref);
+    vec_uint_shrink(clauses, j);
+}
+
+/* Creates occurrence lists of all live clauses (the watcher's blocker is not used) */
+static inline vec_wl_t *solver_occurs_alloc(solver_t *s)
+{
+    unsigned i, j, cref;
+    unsigned n_lits = 2 * vec_char_size(s->assigns);
+    vec_wl_t *occs = vec_wl_alloc(n_lits);
+    vec_uint_t *lists[2];
+
+    for (i = 0; i < n_lits; i++)
+        vec_wl_push(occs);
+    lists[0] = s->originals;
+    lists[1] = s->learnts;
+    for (j = 0; j < 2; j++) {
+        vec_uint_foreach(lists[j], cref, i) {
+            struct clause *clause = clause_fetch(s, cref);
+            struct watcher w;
+            unsigned k;
+            if (clause->f_mark)
+                continue;
+            w.cref = cref;
+            w.blocker = UNDEF;
+            for (k = 0; k < clause->size; k++)
+                watch_list_push(vec_wl_at(occs, clause->data[k].lit), w, 0);
+        }
+    }
+    return occs;
+}
+
+/**
+ *  Vivification of learnt clauses. For each clause, literals are assigned to
+ *  false one by one at the decision level 1, 2, ... and propagated. A literal
+ *  which becomes false is redundant, a literal which becomes true or a conflict
+ *  means the remaining literals are redundant. Each clause is vivified once.
+ *  Only learnt clauses added after the bookmark are considered, because the
+ *  stronger clause may depend on clauses removed by rollback.
+ */
+static inline unsigned solver_vivify(solver_t *s)
+{
+    unsigned i, j, cref;
+    long limit = s->stats.n_propagations + s->opts.inpr_effort;
+
+    assert(solver_dlevel(s) == 0);
+    vec_uint_foreach_start(s->learnts, cref, i, s->book_cl_lrnt) {
+        struct clause *clause = clause_fetch(s, cref);
+        unsigned *lits = &(clause->data[0].lit);
+        unsigned size = clause->size;
+        unsigned new_size;
+        clause_act_t act;
+
+        if (s->stats.n_propagations > limit)
+            break;
+        if (clause->f_mark || clause->f_vivified || size <= 2 ||
+            clause->lbd > s->opts.vivify_max_lbd || clause_is_satisfied_top(s, clause))
+            continue;
+        clause->f_vivified = 1;
+        clause_unwatch(s, cref);
+        vec_uint_clear(s->temp_lits);
+        for (j = 0; j < size; j++) {
+            if (lit_value(s, lits[j]) == SATOKO_LIT_FALSE)
+                continue;
+            vec_uint_push_back(s->temp_lits, lits[j]);
+            if (lit_value(s, lits[j]) == SATOKO_LIT_TRUE)
+                break;
+            solver_new_decision(s, lit_compl(lits[j]));
+            if (solver_propagate(s) != UNDEF)
+                break;
+        }
+        solver_cancel_until(s, 0);
+        new_size = vec_uint_size(s->temp_lits);
+        if (new_size == size || new_size == 0) {
+            clause_watch(s, cref);
+            continue;
+        }
+        s->stats.n_vivified++;
+        s->stats.n_vivified_lits += size - new_size;
+        if (new_size == 1) {
+            unsigned lit = vec_uint_at(s->temp_lits, 0);
+            clause->f_mark = 1;
+            s->stats.n_learnt_lits -= size;
+            cdb_remove(s->all_clauses, clause);
+            assert(var_value(s, lit2var(lit)) == SATOKO_VAR_UNASSING);
+            solver_enqueue(s, lit, UNDEF);
+            if (solver_propagate(s) != UNDEF)
+                return SATOKO_ERR;
+            continue;
+        }
+        act = clause->data[size].act;
+        memcpy(lits, vec_uint_data(s->temp_lits), sizeof(unsigned) * new_size);
+        clause->data[new_size].act = act;
+        clause->size = new_size;
+        if (clause->lbd > new_size)
+            clause->lbd = new_size;
+        s->all_clauses->wasted += size - new_size;
+        s->stats.n_learnt_lits -= size - new_size;
+        clause_watch(s, cref);
+    }
+    return SATOKO_OK;
+}
+
+/**
+ *  Forward subsumption. Each clause is put into the occurrence list of its
+ *  least frequent literal, so that all clauses subsuming a given clause are
+ *  found in the lists of its literals. Original clauses are only subsumed by
+ *  original clauses. Only clauses added after the bookmark are removed.
+ */
+static inline void solver_subsume(solver_t *s)
+{
+    unsigned i, j, k, cref;
+    unsigned n_lits = 2 * vec_char_size(s->assigns);
+    long effort = s->opts.inpr_effort;
+    vec_uint_t *counts = vec_uint_init(n_lits, 0);
+    vec_wl_t *occs = vec_wl_alloc(n_lits);
+    vec_uint_t *lists[2];
+    unsigned starts[2];
+
+    for (i = 0; i < n_lits; i++)
+        vec_wl_push(occs);
+    lists[0] = s->originals;
+    lists[1] = s->learnts;
+    starts[0] = s->book_cl_orig;
+    starts[1] = s->book_cl_lrnt;
+    for (j = 0; j < 2; j++) {
+        vec_uint_foreach(lists[j], cref, i) {
+            struct clause *clause = clause_fetch(s, cref);
+            if (clause->f_mark)
+                continue;
+            for (k = 0; k < clause->size; k++)
+                vec_uint_data(counts)[clause->data[k].lit]++;
+        }
+    }
+    for (j = 0; j < 2; j++) {
+        vec_uint_foreach(lists[j], cref, i) {
+            struct clause *clause = clause_fetch(s, cref);
+            unsigned min_lit;
+            struct watcher w;
+            if (clause->f_mark)
+                continue;
+            min_lit = clause->data[0].lit;
+            for (k = 1; k < clause->size; k++)
+                if (vec_uint_at(counts, clause->data[k].lit) < vec_uint_at(counts, min_lit))
+                    min_lit = clause->data[k].lit;
+            w.cref = cref;
+            w.blocker = min_lit;
+            watch_list_push(vec_wl_at(occs, min_lit), w, 0);
+        }
+    }
+    for (j = 0; j < 2 && effort > 0; j++) {
+        vec_uint_foreach_start(lists[j], cref, i, starts[j]) {
+            struct clause *clause = clause_fetch(s, cref);
+            int f_subsumed = 0;
+
+            if (effort <= 0)
+                break;
+            if (clause->f_mark || clause_is_locked(s, cref))
+                continue;
+            for (k = 0; k < clause->size; k++)
+                vec_char_assign(s->seen, lit2var(clause->data[k].lit), 1 + lit_polarity(clause->data[k].lit));
+            for (k = 0; k < clause->size && !f_subsumed; k++) {
+                struct watcher *w;
+                watch_list_foreach(occs, w, clause->data[k].lit) {
+                    struct clause *other = clause_fetch(s, w->cref);
+                    unsigned l;
+                    if (w->cref == cref || other->f_mark || other->size > clause->size ||
+                        (other->f_learnt && !clause->f_learnt))
+                        continue;
+                    effort -= other->size;
+                    for (l = 0; l < other->size; l++) {
+                        unsigned lit = other->data[l].lit;
+                        if (vec_char_at(s->seen, lit2var(lit)) != 1 + lit_polarity(lit))
+                            break;
+                    }
+                    if (l == other->size) {
+                        f_subsumed = 1;
+                        break;
+                    }
+                }
+            }
+            for (k = 0; k < clause->size; k++)
+                vec_char_assign(s->seen, lit2var(clause->data[k].lit), 0);
+            if (f_subsumed) {
+                clause_delete(s, cref);
+                s->stats.n_subsumed++;
+            }
+        }
+    }
+    vec_wl_free(occs);
+    vec_uint_free(counts);
+}
+
+/* Computes the resolvent of two clauses on the variable 'var' and appends it
+ * to 'resolvents' (size first). Literals false at the top level are dropped.
+ * Returns 0 if the resolvent is a tautology or is satisfied. */
+static inline int clause_resolve(solver_t *s, unsigned cref0, unsigned cref1,
+                                 unsigned var, vec_uint_t *resolvents)
+{
+    struct clause *clause0 = clause_fetch(s, cref0);
+    struct clause *clause1 = clause_fetch(s, cref1);
+    unsigned i, lit, start = vec_uint_size(resolvents);
+    int f_keep = 1;
+
+    vec_uint_push_back(resolvents, 0);
+    for (i = 0; i < clause0->size; i++) {
+        lit = clause0->data[i].lit;
+        if (lit2var(lit) == var || lit_value(s, lit) == SATOKO_LIT_FALSE)
+            continue;
+        if (lit_value(s, lit) == SATOKO_LIT_TRUE) {
+            f_keep = 0;
+            break;
+        }
+        vec_char_assign(s->seen, lit2var(lit), 1 + lit_polarity(lit));
+        vec_uint_push_back(resolvents, lit);
+    }
+    for (i = 0; f_keep && i < clause1->size; i++) {
+        lit = clause1->data[i].lit;
+        if (lit2var(lit) == var || lit_value(s, lit) == SATOKO_LIT_FALSE)
+            continue;
+        if (lit_value(s, lit) == SATOKO_LIT_TRUE ||
+            vec_char_at(s->seen, lit2var(lit)) == 2 - lit_polarity(lit)) {
+            f_keep = 0;
+            break;
+        }
+        if (vec_char_at(s->seen, lit2var(lit)) == 0)
+            vec_uint_push_back(resolvents, lit);
+    }
+    for (i = 0; i < clause0->size; i++)
+        vec_char_assign(s->seen, lit2var(clause0->data[i].lit), 0);
+    if (!f_keep) {
+        vec_uint_shrink(resolvents, start);
+        return 0;
+    }
+    vec_uint_assign(resolvents, start, vec_uint_size(resolvents) - start - 1);
+    return 1;
+}
+
+static inline void solver_elim_push(solver_t *s, unsigned pivot, struct clause *clause)
+{
+    unsigned i;
+
+    vec_uint_push_back(s->elim_clauses, pivot);
+    for (i = 0; clause && i < clause->size; i++)
+        if (clause->data[i].lit != pivot)
+            vec_uint_push_back(s->elim_clauses, clause->data[i].lit);
+    vec_uint_push_back(s->elim_clauses, clause ? clause->size : 1);
+}
+
+/**
+ *  Bounded variable elimination. A variable is eliminated if the number of
+ *  non-trivial resolvents of its original clauses does not exceed the number
+ *  of these clauses. The clauses of the smaller polarity are saved to extend
+ *  the model. Frozen variables and the current assumptions are skipped.
+ *  Learnt clauses containing an eliminated variable are removed.
+ */
+static inline unsigned solver_eliminate(solver_t *s)
+{
+    unsigned i, j, k, var, cref;
+    unsigned n_vars = vec_char_size(s->assigns);
+    long effort = s->opts.inpr_effort;
+    vec_wl_t *occs = solver_occurs_alloc(s);
+    vec_uint_t *occ[2];
+    vec_uint_t *resolvents = vec_uint_alloc(0);
+    unsigned status = SATOKO_OK;
+
+    occ[0] = vec_uint_alloc(0);
+    occ[1] = vec_uint_alloc(0);
+    s->cur_stamp++;
+    vec_uint_foreach(s->assumptions, var, i)
+        vec_uint_assign(s->stamps, lit2var(var), s->cur_stamp);
+    for (var = 0; var < n_vars && effort > 0 && status == SATOKO_OK; var++) {
+        unsigned n_clauses, n_resolvents = 0, pivot;
+        int f_ok = 1;
+
+        if (var_value(s, var) != SATOKO_VAR_UNASSING || var_is_frozen(s, var) ||
+            var_is_eliminated(s, var) || vec_uint_at(s->stamps, var) == s->cur_stamp)
+            continue;
+        for (j = 0; j < 2; j++) {
+            struct watcher *w;
+            vec_uint_clear(occ[j]);
+            watch_list_foreach(occs, w, var2lit(var, (char)j)) {
+                struct clause *clause = clause_fetch(s, w->cref);
+                if (!clause->f_mark && !clause->f_learnt)
+                    vec_uint_push_back(occ[j], w->cref);
+            }
+        }
+        n_clauses = vec_uint_size(occ[0]) + vec_uint_size(occ[1]);
+        if (n_clauses == 0 || vec_uint_size(occ[0]) > s->opts.bve_max_occ ||
+            vec_uint_size(occ[1]) > s->opts.bve_max_occ)
+            continue;
+        vec_uint_clear(resolvents);
+        vec_uint_foreach(occ[0], cref, i) {
+            vec_uint_foreach(occ[1], k, j) {
+                unsigned start = vec_uint_size(resolvents);
+                effort -= clause_fetch(s, cref)->size + clause_fetch(s, k)->size;
+                if (!clause_resolve(s, cref, k, var, resolvents))
+                    continue;
+                if (++n_resolvents > n_clauses ||
+                    vec_uint_at(resolvents, start) > s->opts.bve_max_resolvent) {
+                    f_ok = 0;
+                    break;
+                }
+            }
+            if (!f_ok)
+                break;
+        }
+        if (!f_ok)
+            continue;
+        /* Save the clauses of the smaller polarity followed by the opposite unit */
+        j = vec_uint_size(occ[0]) <= vec_uint_size(occ[1]) ? 0 : 1;
+        pivot = var2lit(var, (char)j);
+        vec_uint_foreach(occ[j], cref, i)
+            solver_elim_push(s, pivot, clause_fetch(s, cref));
+        solver_elim_push(s, lit_compl(pivot), NULL);
+        vec_char_assign(s->eliminated, var, 1);
+        s->stats.n_eliminated++;
+        /* Remove the clauses, including the learnt ones */
+        for (j = 0; j < 2; j++) {
+            struct watcher *w;
+            watch_list_foreach(occs, w, var2lit(var, (char)j))
+                if (!clause_fetch(s, w->cref)->f_mark)
+                    clause_delete(s, w->cref);
+        }
+        /* Add the resolvents */
+        for (i = 0; i < vec_uint_size(resolvents); i += k + 1) {
+            unsigned *lits = vec_uint_data(resolvents) + i + 1;
+            int f_sat = 0;
+            k = vec_uint_at(resolvents, i);
+            s->stats.n_resolvents++;
+            vec_uint_clear(s->temp_lits);
+            for (j = 0; j < k; j++) {
+                if (lit_value(s, lits[j]) == SATOKO_LIT_TRUE)
+                    f_sat = 1;
+                else if (var_value(s, lit2var(lits[j])) == SATOKO_VAR_UNASSING)
+                    vec_uint_push_back(s->temp_lits, lits[j]);
+            }
+            if (f_sat)
+                continue;
+            if (vec_uint_size(s->temp_lits) == 0) {
+                status = SATOKO_ERR;
+                break;
+            }
+            if (vec_uint_size(s->temp_lits) == 1) {
+                solver_enqueue(s, vec_uint_at(s->temp_lits, 0), UNDEF);
+                if (solver_propagate(s) != UNDEF) {
+                    status = SATOKO_ERR;
+                    break;
+                }
+            } else {
+                struct watcher w;
+                unsigned new_cref = solver_clause_create(s, s->temp_lits, 0);
+                clause_watch(s, new_cref);
+                w.cref = new_cref;
+                w.blocker = UNDEF;
+                for (j = 0; j < vec_uint_size(s->temp_lits); j++)
+                    watch_list_push(vec_wl_at(occs, vec_uint_at(s->temp_lits, j)), w, 0);
+            }
+        }
+    }
+    vec_uint_free(occ[0]);
+    vec_uint_free(occ[1]);
+    vec_uint_free(resolvents);
+    vec_wl_free(occs);
+    return status;
+}
+
+static inline unsigned solver_inprocess(solver_t *s)
+{
+    unsigned status = SATOKO_OK;
+    long n_vivified = s->stats.n_vivified;
+    long n_subsumed = s->stats.n_subsumed;
+    long n_eliminated = s->stats.n_eliminated;
+
+    assert(solver_dlevel(s) == 0);
+    s->stats.n_inprocess++;
+    s->n_confl_last_inpr = s->stats.n_conflicts_all;
+    if (s->opts.f_vivify && !solver_has_marks(s))
+        status = solver_vivify(s);
+    if (status == SATOKO_OK && s->opts.f_subsume)
+        solver_subsume(s);
+    if (status == SATOKO_OK && s->opts.f_bve && !s->book_vars && !solver_has_marks(s))
+        status = solver_eliminate(s);
+    solver_compact_clauses(s, s->originals, s->book_cl_orig);
+    solver_compact_clauses(s, s->learnts, s->book_cl_lrnt);
+    if (s->opts.verbose) {
+        printf("inprocess: Vivified %6ld, subsumed %6ld clauses, eliminated %6ld vars\n",
+               s->stats.n_vivified - n_vivified, s->stats.n_subsumed - n_subsumed,
+               s->stats.n_eliminated - n_eliminated);
+        fflush(stdout);
+    }
+    if (status == SATOKO_OK && cdb_wasted(s->all_clauses) > cdb_size(s->all_clauses) * s->opts.garbage_max_ratio)
+        solver_garbage_collect(s);
+    return status;
+}
+
 //===------------------------------------------------------------------------===
 // Solver external functions
 //===------------------------------------------------------------------------===
@@ -496,6 +940,7 @@ unsigned solver_clause_create(solver_t *s, vec_uint_t *lits, unsigned f_learnt)
     clause->f_mark = 0;
     clause->f_reallocd = 0;
     clause->f_deletable = f_learnt;
+    clause->f_vivified = 0;
     clause->size = vec_uint_size(lits);
     memcpy(&(clause->data[0].lit), vec_uint_data(lits), sizeof(unsigned) * vec_uint_size(lits));
 
@@ -512,6 +957,26 @@ unsigned solver_clause_create(solver_t *s, vec_uint_t *lits, unsigned f_learnt)
     return cref;
 }
 
+/* Assigns the eliminated variables (in the polarity vector) in the reverse
+ * order of elimination, so that their saved clauses are satisfied. */
+void solver_extend_model(solver_t *s)
+{
+    unsigned i = vec_uint_size(s->elim_clauses);
+
+    while (i > 0) {
+        unsigned size = vec_uint_at(s->elim_clauses, --i);
+        unsigned *lits = vec_uint_data(s->elim_clauses) + i - size;
+        unsigned j;
+
+        i -= size;
+        for (j = 1; j < size; j++)
+            if ((lit_polarity(lits[j]) ^ vec_char_at(s->polarity, lit2var(lits[j]))) == SATOKO_LIT_TRUE)
+                break;
+        if (j == size)
+            vec_char_assign(s->polarity, lit2var(lits[0]), lit_polarity(lits[0]));
+    }
+}
+
 void solver_cancel_until(solver_t *s, unsigned level)
 {
     unsigned i;
@@ -653,6 +1118,12 @@ char solver_search(solver_t *s)
             if (!s->opts.no_simplify && solver_dlevel(s) == 0)
                 satoko_simplify(s);
 
+            /* Inprocessing between restarts */
+            if (s->opts.inpr_interval && solver_dlevel(s) == 0 &&
+                s->stats.n_conflicts_all >= s->n_confl_last_inpr + (long)s->opts.inpr_interval &&
+                solver_inprocess(s) == SATOKO_ERR)
+                return SATOKO_UNSAT;
+
             /* Reduce the set of learnt clauses */
             if (s->opts.learnt_ratio && vec_uint_size(s->learnts) > 100 &&
                 s->stats.n_conflicts >= s->n_confl_bfr_reduce) {
@@ -99,6 +99,13 @@ struct solver_t_ {
 
     /* Temporary data used for solving cones */
     vec_char_t *marks;
+
+    /* Inprocessing */
+    long n_confl_last_inpr;   /* N.of conflicts at the last inprocessing round */
+    vec_char_t *frozen;       /* Variables that cannot be eliminated */
+    vec_char_t *eliminated;   /* Variables removed by elimination */
+    vec_uint_t *elim_clauses; /* Clauses of eliminated variables (pivot first,
+                                 followed by the size) used to extend the model */
     
     /* Callbacks to stop the solver */
     abctime nRuntimeLimit;
@@ -115,6 +122,7 @@ extern unsigned solver_clause_create(solver_t *, vec_uint_t *, unsigned);
 extern char solver_search(solver_t *);
 extern void solver_cancel_until(solver_t *, unsigned);
 extern unsigned solver_propagate(solver_t *);
+extern void solver_extend_model(solver_t *);
 
 /* Debuging */
 extern void solver_debug_check(solver_t *, int);
@@ -162,6 +170,16 @@ static inline void var_clean_mark(solver_t *s, unsigned var)
 {
     vec_char_assign(s->marks, var, 0);
 }
+
+static inline int var_is_frozen(solver_t *s, unsigned var)
+{
+    return (int)vec_char_at(s->frozen, var);
+}
+
+static inline int var_is_eliminated(solver_t *s, unsigned var)
+{
+    return (int)vec_char_at(s->eliminated, var);
+}
 //===------------------------------------------------------------------------===
 // Inline lit functions
 //===------------------------------------------------------------------------===
@@ -27,7 +27,7 @@ static inline void solver_rebuild_order(solver_t *s)
     vec_uint_t *vars = vec_uint_alloc(vec_char_size(s->assigns));
 
     for (var = 0; var < vec_char_size(s->assigns); var++)
-        if (var_value(s, var) == SATOKO_VAR_UNASSING)
+        if (var_value(s, var) == SATOKO_VAR_UNASSING && !var_is_eliminated(s, var))
             vec_uint_push_back(vars, var);
     heap_build(s->var_order, vars);
     vec_uint_free(vars);
@@ -80,6 +80,12 @@ static inline void print_stats(solver_t *s)
     printf("conflicts     : %10ld\n", s->stats.n_conflicts);
     printf("decisions     : %10ld\n", s->stats.n_decisions);
     printf("propagations  : %10ld\n", s->stats.n_propagations);
+    if (s->stats.n_inprocess == 0)
+        return;
+    printf("inprocessing  : %10d\n", s->stats.n_inprocess);
+    printf("vivified      : %10ld (%ld lits)\n", s->stats.n_vivified, s->stats.n_vivified_lits);
+    printf("subsumed      : %10ld\n", s->stats.n_subsumed);
+    printf("eliminated    : %10ld (%ld resolvents)\n", s->stats.n_eliminated, s->stats.n_resolvents);
 }
 
 //===------------------------------------------------------------------------===
@@ -126,6 +132,10 @@ solver_t * satoko_create()
     s->last_dlevel = vec_uint_alloc(0);
     /* Misc temporary */
     s->stamps = vec_uint_alloc(0);
+    /* Inprocessing */
+    s->frozen = vec_char_alloc(0);
+    s->eliminated = vec_char_alloc(0);
+    s->elim_clauses = vec_uint_alloc(0);
     return s;
 }
 
@@ -153,6 +163,9 @@ void satoko_destroy(solver_t *s)
     vec_uint_free(s->stack);
     vec_uint_free(s->last_dlevel);
     vec_uint_free(s->stamps);
+    vec_char_free(s->frozen);
+    vec_char_free(s->eliminated);
+    vec_uint_free(s->elim_clauses);
     if (s->marks)
         vec_char_free(s->marks);
     satoko_free(s);
@@ -186,6 +199,15 @@ void satoko_default_opts(satoko_opts_t *opts)
     /* Binary resolution */
     opts->clause_max_sz_bin_resol = 30;
     opts->clause_min_lbd_bin_resol = 6;
+    /* Inprocessing */
+    opts->inpr_interval = 0;
+    opts->inpr_effort = 1000000;
+    opts->vivify_max_lbd = 6;
+    opts->bve_max_occ = 16;
+    opts->bve_max_resolvent = 20;
+    opts->f_vivify = 1;
+    opts->f_subsume = 1;
+    opts->f_bve = 0;
 
     opts->garbage_max_ratio = (float) 0.3;
 }
@@ -246,6 +268,8 @@ int satoko_add_variable(solver_t *s, char sign)
     vec_uint_push_back(s->reasons, UNDEF);
     vec_uint_push_back(s->stamps, 0);
     vec_char_push_back(s->seen, 0);
+    vec_char_push_back(s->frozen, 0);
+    vec_char_push_back(s->eliminated, 0);
     heap_insert(s->var_order, var);
     if (s->marks)
         vec_char_push_back(s->marks, 0);
@@ -268,6 +292,7 @@ int satoko_add_clause(solver_t *s, int *lits, int size)
     j = 0;
     prev_lit = UNDEF;
     for (i = 0; i < (unsigned)size; i++) {
+        assert(!var_is_eliminated(s, lit2var(lits[i])));
         if ((unsigned)lits[i] == lit_compl(prev_lit) || lit_value(s, lits[i]) == SATOKO_LIT_TRUE)
             return SATOKO_OK;
         else if ((unsigned)lits[i] != prev_lit && var_value(s, lit2var(lits[i])) == SATOKO_VAR_UNASSING) {
@@ -298,6 +323,7 @@ int satoko_add_clause(solver_t *s, int *lits, int size)
 void satoko_assump_push(solver_t *s, int lit)
 {
     assert(lit2var(lit) < (unsigned)satoko_varnum(s));
+    assert(!var_is_eliminated(s, lit2var(lit)));
     // printf("[Satoko] Push assumption: %d\n", lit);
     vec_uint_push_back(s->assumptions, lit);
     vec_char_assign(s->polarity, lit2var(lit), lit_polarity(lit));
@@ -337,6 +363,8 @@ int satoko_solve(solver_t *s)
         if (s->pFuncStop && s->pFuncStop(s->RunId))
             break;
     }
+    if (status == SATOKO_SAT && vec_uint_size(s->elim_clauses))
+        solver_extend_model(s);
     if (s->opts.verbose)
         print_stats(s);
     
@@ -491,6 +519,9 @@ void satoko_reset(satoko_t *s)
     vec_uint_clear(s->stack);
     vec_uint_clear(s->last_dlevel);
     vec_uint_clear(s->stamps);
+    vec_char_clear(s->frozen);
+    vec_char_clear(s->eliminated);
+    vec_uint_clear(s->elim_clauses);
     s->status = SATOKO_OK;
     s->var_act_inc = VAR_ACT_INIT_INC;
     s->clause_act_inc = CLAUSE_ACT_INIT_INC;
@@ -503,6 +534,7 @@ void satoko_reset(satoko_t *s)
     s->book_vars = 0;
     s->book_trail = 0;
     s->i_qhead = 0;
+    s->n_confl_last_inpr = 0;
 }
 
 void satoko_rollback(satoko_t *s)
@@ -546,6 +578,8 @@ void satoko_rollback(satoko_t *s)
     vec_char_shrink(s->assigns, s->book_vars);
     vec_char_shrink(s->seen, s->book_vars);
     vec_char_shrink(s->polarity, s->book_vars);
+    vec_char_shrink(s->frozen, s->book_vars);
+    vec_char_shrink(s->eliminated, s->book_vars);
     solver_rebuild_order(s);
     /* Rewind solver and cancel level 0 assignments to the trail */
     solver_cancel_until(s, 0);
@@ -580,6 +614,13 @@ void satoko_unmark_cone(satoko_t *s, int *pvars, int n_vars)
         var_clean_mark(s, pvars[i]);
 }
 
+void satoko_freeze_var(satoko_t *s, int var, int frozen)
+{
+    assert(var < satoko_varnum(s));
+    assert(!var_is_eliminated(s, var));
+    vec_char_assign(s->frozen, var, (char)(frozen != 0));
+}
+
 void satoko_write_dimacs(satoko_t *s, char *fname, int wrt_lrnt, int zero_var)
 {
     FILE *file;
@@ -0,0 +1,156 @@
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+#include "base/abc/abc.h"
+#include "base/main/main.h"
+#include "test_util.h"
+
+ABC_NAMESPACE_IMPL_START
+
+static const std::string kReadI10 = "read " + SrcPath("i10.aig") + "; strash";
+
+// the structure of the current network: the type and the fanin literals of each object
+static std::vector<int> NtkStructure(Abc_Ntk_t* pNtk) {
+  std::vector<int> res;
+  Abc_Obj_t* pObj;
+  int i, k;
+  Abc_NtkForEachObj(pNtk, pObj, i) {
+    res.push_back(pObj->Id);
+    res.push_back(pObj->Type);
+    for (k = 0; k < Abc_ObjFaninNum(pObj); k++)
+      res.push_back(2 * Abc_ObjFaninId(pObj, k) + Abc_ObjFaninC(pObj, k));
+  }
+  return res;
+}
+
+TEST(AbciTest, OrchestrateThreadsMatchSerial) {
+  Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
+  Abc_FrameSetBatchMode(1);
+  const char* pFiles[3] = {"i10.aig", "lsv/pa1/benchmarks/router.blif", "lsv/example/ctrl.aig"};
+  const char* pOptions[3] = {"", " -N 2 -K 10 -z", " -l -C 2"};
+  for (int f = 0; f < 3; f++) {
+    std::string read = "read " + SrcPath(pFiles[f]) + "; strash";
+    std::string serial = std::string("orchestrate") + pOptions[f];
+    std::string parallel = serial + " -P 3";
+    ASSERT_EQ(Cmd_CommandExecute(pAbc, read.c_str()), 0);
+    int nNodesOrig = Abc_NtkNodeNum(Abc_FrameReadNtk(pAbc));
+    // two passes, so that the second one starts from a changed network
+    ASSERT_EQ(Cmd_CommandExecute(pAbc, (read + "; " + serial + "; " + serial).c_str()), 0);
+    std::vector<int> expected = NtkStructure(Abc_FrameReadNtk(pAbc));
+    EXPECT_LT(Abc_NtkNodeNum(Abc_FrameReadNtk(pAbc)), nNodesOrig);
+    ASSERT_EQ(Cmd_CommandExecute(pAbc, (read + "; " + parallel + "; " + parallel).c_str()), 0);
+    EXPECT_EQ(NtkStructure(Abc_FrameReadNtk(pAbc)), expected) << pFiles[f] << pOptions[f];
+  }
+}
+
+TEST(AbciTest, OrchestrateGainCacheMatchesUncached) {
+  Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
+  Abc_FrameSetBatchMode(1);
+  const char* pFiles[3] = {"i10.aig", "lsv/pa1/benchmarks/router.blif", "lsv/example/ctrl.aig"};
+  int nCached = 0;
+  for (int f = 0; f < 3; f++) {
+    std::string read = "read " + SrcPath(pFiles[f]) + "; strash";
+    // three passes, so that the later ones skip the nodes not updated by the earlier ones
+    ASSERT_EQ(Cmd_CommandExecute(pAbc, (read + "; orchestrate; orchestrate; orchestrate").c_str()), 0);
+    int nNodes = Abc_NtkNodeNum(Abc_FrameReadNtk(pAbc));
+    int nLevels = Abc_AigLevel(Abc_FrameReadNtk(pAbc));
+    EXPECT_TRUE(Abc_FrameReadNtk(pAbc)->vOrchGains == NULL);
+    for (int r = 2; r <= 3; r++) {
+      std::string cached = "orchestrate -C " + std::to_string(r);
+      ASSERT_EQ(Cmd_CommandExecute(pAbc, (read + "; " + cached + "; " + cached + "; " + cached).c_str()), 0);
+      Abc_Ntk_t* pNtk = Abc_FrameReadNtk(pAbc);
+      // the cache holds the gains of the nodes that were not updated
+      ASSERT_TRUE(pNtk->vOrchGains != NULL);
+      for (int i = 4; i < Vec_IntSize(pNtk->vOrchGains); i += 3)
+        nCached += (Vec_IntEntry(pNtk->vOrchGains, i) != ABC_INFINITY);
+      // skipping these nodes may change the structure (the cache is approximate),
+      // but the size and the depth are the same as without the cache
+      EXPECT_EQ(Abc_NtkNodeNum(pNtk), nNodes) << pFiles[f] << " -C " << r;
+      EXPECT_EQ(Abc_AigLevel(pNtk), nLevels) << pFiles[f] << " -C " << r;
+    }
+  }
+  EXPECT_GT(nCached, 0);
+}
+
+TEST(AbciTest, OrchestratePolicyFromMemoryAndFile) {
+  Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
+  Abc_FrameSetBatchMode(1);
+  ASSERT_EQ(Cmd_CommandExecute(pAbc, kReadI10.c_str()), 0);
+  int nObjs = Abc_NtkObjNumMax(Abc_FrameReadNtk(pAbc));
+  Vec_Int_t* vPolicy = Vec_IntAlloc(nObjs);
+  for (int i = 0; i < nObjs; i++) Vec_IntPush(vPolicy, (i * 7 + 3) % 6);
+  // the same policy is given in memory and in a binary file
+  Abc_FrameSetOrchData(pAbc, ABC_ORCH_DATA_DECS, Vec_IntArray(vPolicy), nObjs, 1);
+  std::string policy_file = TmpPath("policy.orch"), decisions_file = TmpPath("decisions.orch");
+  ASSERT_EQ(Abc_OrchDataWrite((char*)policy_file.c_str(), ABC_ORCH_DATA_DECS, vPolicy, 1), 1);
+  int nNodes[2];
+  for (int k = 0; k < 2; k++) {
+    ASSERT_EQ(Cmd_CommandExecute(pAbc, kReadI10.c_str()), 0);
+    ASSERT_EQ(Cmd_CommandExecute(pAbc, k ? ("orchestrate -p " + policy_file + " -d " + decisions_file).c_str() : "orchestrate -p -"), 0);
+    nNodes[k] = Abc_NtkNodeNum(Abc_FrameReadNtk(pAbc));
+  }
+  EXPECT_EQ(nNodes[1], nNodes[0]);
+  // the decisions are readable as a policy of the same size
+  int nCols = 0;
+  Vec_Int_t* vDecs = Abc_OrchDataRead((char*)decisions_file.c_str(), ABC_ORCH_DATA_DECS, &nCols);
+  ASSERT_TRUE(vDecs != NULL);
+  EXPECT_EQ(nCols, 1);
+  EXPECT_EQ(Vec_IntSize(vDecs), nObjs);
+  Vec_IntFree(vDecs);
+  // a header whose size does not fit into the file is rejected
+  int pHead[8] = {0x4843524F, 1, ABC_ORCH_DATA_DECS, 0x10000, 0x10000, 0, 0, 0};
+  FILE* pFile = fopen(policy_file.c_str(), "wb");
+  fwrite(pHead, sizeof(int), 8, pFile);
+  fwrite(Vec_IntArray(vPolicy), sizeof(int), 16, pFile);
+  fclose(pFile);
+  EXPECT_TRUE(Abc_OrchDataRead((char*)policy_file.c_str(), ABC_ORCH_DATA_DECS, NULL) == NULL);
+  EXPECT_NE(Cmd_CommandExecute(pAbc, ("orchestrate -p " + policy_file).c_str()), 0);
+  remove(policy_file.c_str());
+  remove(decisions_file.c_str());
+  Vec_IntFree(vPolicy);
+}
+
+TEST(AbciTest, OrchestrateBatchMatchesCommand) {
+  Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
+  Abc_FrameSetBatchMode(1);
+  ASSERT_EQ(Cmd_CommandExecute(pAbc, kReadI10.c_str()), 0);
+  const int nPolicies = 3;
+  int nObjs = Abc_NtkObjNumMax(Abc_FrameReadNtk(pAbc));
+  std::vector<int> policies(nPolicies * nObjs);
+  for (int i = 0; i < nPolicies * nObjs; i++) policies[i] = (i * 13 + i / nObjs) % 6;
+  // the default parameters and the parameters given by the caller (no level preservation)
+  int pPars[ABC_ORCH_PAR_NUM];
+  Abc_FrameOrchSetDefaultPars(pPars);
+  pPars[ABC_ORCH_PAR_UPDATE_LEV] = 0;
+  for (int k = 0; k < 2; k++) {
+    int pArea[nPolicies], pDelay[nPolicies];
+    ASSERT_EQ(Cmd_CommandExecute(pAbc, kReadI10.c_str()), 0);
+    ASSERT_EQ(Abc_FrameOrchEvalBatch(pAbc, policies.data(), nPolicies, nObjs, k ? pPars : NULL, pArea, pDelay), nPolicies);
+    // the current network is not changed
+    EXPECT_EQ(Abc_NtkObjNumMax(Abc_FrameReadNtk(pAbc)), nObjs);
+    for (int i = 0; i < nPolicies; i++) {
+      Abc_FrameSetOrchData(pAbc, ABC_ORCH_DATA_DECS, policies.data() + i * nObjs, nObjs, 1);
+      ASSERT_EQ(Cmd_CommandExecute(pAbc, kReadI10.c_str()), 0);
+      ASSERT_EQ(Cmd_CommandExecute(pAbc, k ? "orchestrate -l -p -" : "orchestrate -p -"), 0);
+      EXPECT_EQ(pArea[i], Abc_NtkNodeNum(Abc_FrameReadNtk(pAbc)));
+      EXPECT_EQ(pDelay[i], Abc_AigLevel(Abc_FrameReadNtk(pAbc)));
+    }
+  }
+  // the runs that do not change the network share one copy
+  ASSERT_EQ(Cmd_CommandExecute(pAbc, ("read " + SrcPath("lsv/pa1/benchmarks/adder.blif") + "; strash; orchestrate; orchestrate").c_str()), 0);
+  Abc_FrameOrchSetDefaultPars(pPars);
+  pPars[ABC_ORCH_PAR_ZEROS_RWR] = pPars[ABC_ORCH_PAR_ZEROS_REF] = 0;
+  nObjs = Abc_NtkObjNumMax(Abc_FrameReadNtk(pAbc));
+  std::vector<int> same(nPolicies * nObjs, 1);
+  int pArea[nPolicies], pDelay[nPolicies];
+  ASSERT_EQ(Abc_FrameOrchEvalBatch(pAbc, same.data(), nPolicies, nObjs, pPars, pArea, pDelay), nPolicies);
+  EXPECT_EQ(pArea[0], Abc_NtkNodeNum(Abc_FrameReadNtk(pAbc)));
+  for (int i = 1; i < nPolicies; i++) {
+    EXPECT_EQ(pArea[i], pArea[0]);
+    EXPECT_EQ(pDelay[i], pDelay[0]);
+  }
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,18 @@
+#ifndef ABC_TEST_UTIL_H_
+#define ABC_TEST_UTIL_H_
+
+#include <string>
+
+#include "gtest/gtest.h"
+
+// the path of a file in the source tree (ABC_TEST_SRC_DIR is set by CMake)
+static inline std::string SrcPath(const std::string& name) {
+  return std::string(ABC_TEST_SRC_DIR) + "/" + name;
+}
+
+// the path of a scratch file in the temporary directory of the test run
+static inline std::string TmpPath(const std::string& name) {
+  return ::testing::TempDir() + "abc_test_" + name;
+}
+
+#endif  // ABC_TEST_UTIL_H_
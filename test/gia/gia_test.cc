@@ -1,6 +1,20 @@
 #include "gtest/gtest.h"
 
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
 #include "aig/gia/gia.h"
+#include "base/main/main.h"
+#include "test_util.h"
+
+ABC_NAMESPACE_HEADER_START
+Vec_Wrd_t* Gia_ManSimPatSimIn(Gia_Man_t* pGia, Vec_Wrd_t* vSims, int fIns, Vec_Int_t* vAnds);
+Vec_Wrd_t* Gia_ManSimPatSim2(Gia_Man_t* pGia);
+ABC_NAMESPACE_HEADER_END
 
 ABC_NAMESPACE_IMPL_START
 
@@ -51,4 +65,399 @@ TEST(GiaTest, CanAddAnAndGate) {
   Gia_ManStop(aig_manager);
 }
 
+TEST(GiaTest, OrchestrateReducesAndPreservesFunction) {
+  Gia_Man_t* aig_manager = Gia_ManStart(1000);
+  int inputs[8];
+  for (int i = 0; i < 8; i++) inputs[i] = Gia_ManAppendCi(aig_manager);
+  Gia_ManHashAlloc(aig_manager);
+  for (int i = 0; i < 8; i++) {
+    int a = inputs[i], b = inputs[(i + 1) % 8], c = inputs[(i + 3) % 8];
+    // (a & b) | (a & !c) can be factored into a & (b | !c)
+    int ab = Gia_ManHashAnd(aig_manager, a, b);
+    int ac = Gia_ManHashAnd(aig_manager, a, Abc_LitNot(c));
+    Gia_ManAppendCo(aig_manager, Gia_ManHashOr(aig_manager, ab, ac));
+  }
+  Gia_ManHashStop(aig_manager);
+
+  Gia_Man_t* result = Gia_ManOrchestrate(aig_manager, 2, 10, 8, 150, 0, 0, 0);
+
+  EXPECT_LT(Gia_ManAndNum(result), Gia_ManAndNum(aig_manager));
+  Vec_Wrd_t* stimulus = Vec_WrdStartRandom(Gia_ManCiNum(aig_manager));
+  Vec_Wrd_t* output = Gia_ManSimPatSimOut(aig_manager, stimulus, /*fouts*/1);
+  Vec_Wrd_t* output_new = Gia_ManSimPatSimOut(result, stimulus, /*fouts*/1);
+  EXPECT_EQ(Vec_WrdSize(output), Vec_WrdSize(output_new));
+  for (int i = 0; i < Vec_WrdSize(output); i++)
+    EXPECT_EQ(Vec_WrdEntry(output, i), Vec_WrdEntry(output_new, i));
+  Vec_WrdFree(stimulus);
+  Vec_WrdFree(output);
+  Vec_WrdFree(output_new);
+  Gia_ManStop(result);
+  Gia_ManStop(aig_manager);
+}
+
+// builds a multi-level AIG whose AND gates take fanins from the earlier nodes,
+// mostly from the recent ones, so that the depth grows with the size
+static Gia_Man_t* MakeRandomAig(int nCis, int nAnds, int nCos, unsigned seed) {
+  std::mt19937 rng(seed);
+  Gia_Man_t* p = Gia_ManStart(nCis + nAnds + nCos + 1);
+  std::vector<int> lits;
+  for (int i = 0; i < nCis; i++) lits.push_back(Gia_ManAppendCi(p));
+  while ((int)lits.size() < nCis + nAnds) {
+    int n = (int)lits.size();
+    int window = std::min(n, 16);
+    int lit0 = lits[n - 1 - (int)(rng() % window)];
+    int lit1 = lits[(rng() & 3) ? n - 1 - (int)(rng() % window) : (int)(rng() % n)];
+    if (Abc_Lit2Var(lit0) == Abc_Lit2Var(lit1)) continue;
+    lits.push_back(Gia_ManAppendAnd(p, Abc_LitNotCond(lit0, rng() & 1), Abc_LitNotCond(lit1, rng() & 1)));
+  }
+  for (int i = 0; i < nCos; i++) Gia_ManAppendCo(p, Abc_LitNotCond(lits[lits.size() - 1 - i], i & 1));
+  return p;
+}
+
+TEST(GiaTest, SimdSimulationMatchesScalar) {
+  Gia_Man_t* aig_manager = MakeRandomAig(10, 190, 10, 1);
+  EXPECT_GE(Gia_ManLevelNum(aig_manager), 20);
+
+  int isa = Gia_ManSimPatGetIsa();
+  // 13 words is not a multiple of the vector width, which tests the tails
+  Vec_Wrd_t* stimulus = Vec_WrdStartRandom(Gia_ManCiNum(aig_manager) * 13);
+  Gia_ManSimPatSetIsa(1);
+  Vec_Wrd_t* output = Gia_ManSimPatSimOut(aig_manager, stimulus, /*fouts*/1);
+  // the observability kernel
+  Vec_Wrd_t* sims = Gia_ManSimPatSimOut(aig_manager, stimulus, /*fouts*/0);
+  Vec_Wrd_t* obs = Gia_ManSimPatSimIn(aig_manager, sims, /*fins*/0, NULL);
+  EXPECT_LT(Vec_WrdCountZero(obs), Vec_WrdSize(obs));
+  // the paired AND/NOT kernel
+  aig_manager->vSimsPi = stimulus;
+  Vec_Wrd_t* pairs = Gia_ManSimPatSim2(aig_manager);
+  for (int i = 2; i <= 3; i++) {
+    Gia_ManSimPatSetIsa(i);
+    Vec_Wrd_t* output_simd = Gia_ManSimPatSimOut(aig_manager, stimulus, /*fouts*/1);
+    EXPECT_TRUE(Vec_WrdEqual(output, output_simd));
+    Vec_WrdFree(output_simd);
+    Vec_Wrd_t* obs_simd = Gia_ManSimPatSimIn(aig_manager, sims, /*fins*/0, NULL);
+    EXPECT_TRUE(Vec_WrdEqual(obs, obs_simd));
+    Vec_WrdFree(obs_simd);
+    Vec_Wrd_t* pairs_simd = Gia_ManSimPatSim2(aig_manager);
+    EXPECT_TRUE(Vec_WrdEqual(pairs, pairs_simd));
+    Vec_WrdFree(pairs_simd);
+  }
+  aig_manager->vSimsPi = NULL;
+  Gia_ManSimPatSetIsa(isa);
+  EXPECT_EQ(Gia_ManSimPatBench(aig_manager, 9, 2, 0), 1);
+  Vec_WrdFree(stimulus);
+  Vec_WrdFree(output);
+  Vec_WrdFree(sims);
+  Vec_WrdFree(obs);
+  Vec_WrdFree(pairs);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, ParallelSimulationMatchesSerial) {
+  // the level mode synchronizes the threads after each of the many levels
+  Gia_Man_t* aig_manager = MakeRandomAig(12, 288, 20, 2);
+  EXPECT_GE(Gia_ManLevelNum(aig_manager), 20);
+
+  // 37 words do not split evenly among 3 threads
+  Vec_Wrd_t* stimulus = Vec_WrdStartRandom(Gia_ManCiNum(aig_manager) * 37);
+  Vec_Wrd_t* serial = Gia_ManSimPatSimOut(aig_manager, stimulus, /*fouts*/0);
+  for (int levels = 0; levels <= 1; levels++) {
+    Vec_Wrd_t* parallel = Gia_ManSimPatSimPar(aig_manager, stimulus, 3, levels, 0);
+    EXPECT_TRUE(Vec_WrdEqual(serial, parallel));
+    Vec_WrdFree(parallel);
+  }
+  Gia_ManSimulateWordsInitPar(aig_manager, stimulus, 3);
+  EXPECT_EQ(aig_manager->nSimWords, 37);
+  EXPECT_TRUE(Vec_WrdEqual(serial, aig_manager->vSims));
+  Vec_WrdFree(stimulus);
+  Vec_WrdFree(serial);
+  Gia_ManStop(aig_manager);
+}
+
+// builds the same 200 nodes from 16 inputs, starting at a different node
+static void BuildSharedLogic(Gia_Man_t* p, int start, int use_conc, int* result) {
+  int lits[216];
+  for (int i = 0; i < 16; i++) lits[i] = Abc_Var2Lit(i + 1, 0);
+  for (int k = 0; k < 200; k++) {
+    int i = 16 + (start + k) % 200;
+    int lit0 = Abc_LitNotCond(lits[(i * 7) % 16], i & 1);
+    int lit1 = Abc_LitNotCond(lits[(i * 3 + 1) % 16], (i >> 1) & 1);
+    lits[i] = use_conc ? Gia_ManHashConcAnd(p, lit0, lit1) : Gia_ManHashAnd(p, lit0, lit1);
+  }
+  for (int k = 0; k < 100; k++) {
+    int lit = lits[16 + k];
+    for (int j = 1; j < 4; j++)
+      lit = use_conc ? Gia_ManHashConcAnd(p, lit, lits[16 + (k * j + 50) % 200])
+                     : Gia_ManHashAnd(p, lit, lits[16 + (k * j + 50) % 200]);
+    result[k] = lit;
+  }
+}
+
+TEST(GiaTest, ConcurrentStrashMatchesSerial) {
+  Gia_Man_t* serial = Gia_ManStart(1000);
+  for (int i = 0; i < 16; i++) Gia_ManAppendCi(serial);
+  Gia_ManHashAlloc(serial);
+  int outs_serial[100];
+  BuildSharedLogic(serial, 0, 0, outs_serial);
+  Gia_ManHashStop(serial);
+
+  Gia_Man_t* aig_manager = Gia_ManStart(100);
+  for (int i = 0; i < 16; i++) Gia_ManAppendCi(aig_manager);
+  ASSERT_TRUE(Gia_ManHashConcStart(aig_manager, 5000));
+  std::vector<std::vector<int>> outs(4, std::vector<int>(100));
+  std::vector<std::thread> threads;
+  for (int t = 0; t < 4; t++)
+    threads.emplace_back(BuildSharedLogic, aig_manager, 50 * t, 1, outs[t].data());
+  for (auto& thread : threads) thread.join();
+  Gia_ManHashConcStop(aig_manager);
+
+  // every node is created once and all threads see the same literals
+  EXPECT_EQ(Gia_ManAndNum(aig_manager), Gia_ManAndNum(serial));
+  for (int t = 1; t < 4; t++) EXPECT_EQ(outs[t], outs[0]);
+  for (int k = 0; k < 100; k++) {
+    Gia_ManAppendCo(serial, outs_serial[k]);
+    Gia_ManAppendCo(aig_manager, outs[0][k]);
+  }
+  Vec_Wrd_t* stimulus = Vec_WrdStartRandom(16);
+  Vec_Wrd_t* output = Gia_ManSimPatSimOut(serial, stimulus, /*fouts*/1);
+  Vec_Wrd_t* output_conc = Gia_ManSimPatSimOut(aig_manager, stimulus, /*fouts*/1);
+  EXPECT_TRUE(Vec_WrdEqual(output, output_conc));
+  Vec_WrdFree(stimulus);
+  Vec_WrdFree(output);
+  Vec_WrdFree(output_conc);
+  Gia_ManStop(aig_manager);
+  Gia_ManStop(serial);
+}
+
+TEST(GiaTest, ConcurrentStrashOutOfObjects) {
+  Gia_Man_t* aig_manager = Gia_ManStart(20);
+  for (int i = 0; i < 16; i++) Gia_ManAppendCi(aig_manager);
+  ASSERT_TRUE(Gia_ManHashConcStart(aig_manager, Gia_ManObjNum(aig_manager) + 50));
+  std::vector<int> lits;
+  for (int i = 1; i <= 16; i++)
+    for (int j = i + 1; j <= 16; j++)
+      lits.push_back(Gia_ManHashConcAnd(aig_manager, Abc_Var2Lit(i, 0), Abc_Var2Lit(j, 1)));
+  // the first 50 nodes are created, the remaining calls fail without creating objects
+  EXPECT_EQ(Gia_ManAndNum(aig_manager), 50);
+  for (int k = 0; k < (int)lits.size(); k++) EXPECT_EQ(lits[k] == -1, k >= 50);
+  EXPECT_EQ(Gia_ManHashConcAnd(aig_manager, Abc_Var2Lit(1, 0), Abc_Var2Lit(2, 1)), lits[0]);
+  EXPECT_EQ(Gia_ManHashConcAnd(aig_manager, Abc_Var2Lit(16, 1), Abc_Var2Lit(15, 0)), -1);
+  EXPECT_EQ(Gia_ManHashConcLookup(aig_manager, Abc_Var2Lit(15, 0), Abc_Var2Lit(16, 1)), -1);
+  Gia_ManHashConcStop(aig_manager);
+
+  // the caller falls back to the regular table
+  Gia_ManHashStart(aig_manager);
+  int k = 0;
+  for (int i = 1; i <= 16; i++)
+    for (int j = i + 1; j <= 16; j++, k++) {
+      int lit = Gia_ManHashAnd(aig_manager, Abc_Var2Lit(i, 0), Abc_Var2Lit(j, 1));
+      if (lits[k] >= 0) {
+        EXPECT_EQ(lit, lits[k]);
+      }
+    }
+  Gia_ManHashStop(aig_manager);
+  EXPECT_EQ(Gia_ManAndNum(aig_manager), 120);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, AigerReadSkipsNamesOnRequest) {
+  // 9000 inputs make some fanin deltas take three bytes
+  Gia_Man_t* aig_manager = Gia_ManStart(20000);
+  for (int i = 0; i < 9000; i++) Gia_ManAppendCi(aig_manager);
+  int lit = Gia_ManAppendAnd(aig_manager, Gia_ManCiLit(aig_manager, 0),
+                             Gia_ManCiLit(aig_manager, 8999));
+  for (int i = 1; i < 100; i++)
+    lit = Gia_ManAppendAnd(aig_manager, Abc_LitNot(lit),
+                           Gia_ManCiLit(aig_manager, 37 * i));
+  Gia_ManAppendCo(aig_manager, lit);
+  aig_manager->vNamesIn = Vec_PtrAlloc(9000);
+  for (int i = 0; i < 9000; i++) {
+    char name[20];
+    snprintf(name, sizeof(name), "pi%d", i);
+    Vec_PtrPush(aig_manager->vNamesIn, Abc_UtilStrsav(name));
+  }
+  aig_manager->vNamesOut = Vec_PtrAlloc(1);
+  Vec_PtrPush(aig_manager->vNamesOut, Abc_UtilStrsav((char*)"po0"));
+  std::string path = TmpPath("read.aig");
+  char* file_name = (char*)path.c_str();
+  Gia_AigerWrite(aig_manager, file_name, /*fWriteSymbols*/1, 0, 0);
+
+  Gia_Man_t* with_names = Gia_AigerReadExt(file_name, 0, 0, 0, 0);
+  Gia_Man_t* without_names = Gia_AigerReadExt(file_name, 0, 0, 1, 0);
+  remove(file_name);
+  ASSERT_TRUE(with_names != NULL);
+  ASSERT_TRUE(without_names != NULL);
+  EXPECT_EQ(Gia_ManAndNum(with_names), Gia_ManAndNum(aig_manager));
+  EXPECT_EQ(Gia_ManAndNum(without_names), Gia_ManAndNum(aig_manager));
+  ASSERT_TRUE(with_names->vNamesIn != NULL);
+  EXPECT_STREQ((char*)Vec_PtrEntry(with_names->vNamesIn, 8999), "pi8999");
+  EXPECT_TRUE(without_names->vNamesIn == NULL);
+  Gia_Obj_t* obj;
+  int i;
+  Gia_ManForEachAnd(aig_manager, obj, i) {
+    EXPECT_EQ(Gia_ObjFaninId0(Gia_ManObj(without_names, i), i), Gia_ObjFaninId0(obj, i));
+    EXPECT_EQ(Gia_ObjFaninId1(Gia_ManObj(without_names, i), i), Gia_ObjFaninId1(obj, i));
+  }
+  Gia_ManStop(with_names);
+  Gia_ManStop(without_names);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, AigerWriteCompressedRoundTrip) {
+  Gia_Man_t* aig_manager = Gia_ManStart(50000);
+  for (int i = 0; i < 64; i++) Gia_ManAppendCi(aig_manager);
+  int lit = Gia_ManCiLit(aig_manager, 0);
+  // enough nodes to flush the output buffer several times
+  for (int i = 1; i < 40000; i++)
+    lit = Gia_ManAppendAnd(aig_manager, Abc_LitNotCond(lit, i & 1),
+                           Gia_ManCiLit(aig_manager, (i * 7) % 64));
+  Gia_ManAppendCo(aig_manager, lit);
+  const char* file_names[] = {"write.aig", "write.aig.gz", "write.aig.bz2"};
+  for (const char* name : file_names) {
+    std::string path = TmpPath(name);
+    char* file_name = (char*)path.c_str();
+    Gia_AigerWrite(aig_manager, file_name, 0, 0, 0);
+    Gia_Man_t* read_back = Gia_AigerRead(file_name, 0, 1, 0);
+    remove(file_name);
+    ASSERT_TRUE(read_back != NULL) << name;
+    EXPECT_EQ(Gia_ManAndNum(read_back), Gia_ManAndNum(aig_manager)) << name;
+    EXPECT_EQ(Gia_ObjFaninLit0p(read_back, Gia_ManCo(read_back, 0)),
+              Gia_ObjFaninLit0p(aig_manager, Gia_ManCo(aig_manager, 0))) << name;
+    Gia_ManStop(read_back);
+  }
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, SnapshotRoundTripsAttributes) {
+  Gia_Man_t* aig_manager = Gia_ManStart(100);
+  for (int i = 0; i < 4; i++) Gia_ManAppendCi(aig_manager);
+  int and1 = Gia_ManAppendAnd(aig_manager, 2, 4);
+  int and2 = Gia_ManAppendAnd(aig_manager, 6, Abc_LitNot(8));
+  Gia_ManAppendCo(aig_manager, Gia_ManAppendAnd(aig_manager, and1, and2));
+  Gia_ManAppendCo(aig_manager, Gia_ManCiLit(aig_manager, 3));
+  Gia_ManSetRegNum(aig_manager, 1);
+  int nObjs = Gia_ManObjNum(aig_manager);
+  aig_manager->pName = Abc_UtilStrsav((char*)"snap");
+  aig_manager->pSibls = ABC_CALLOC(int, nObjs);
+  aig_manager->pSibls[6] = 5;
+  aig_manager->vFlopClasses = Vec_IntStart(1);
+  Vec_IntWriteEntry(aig_manager->vFlopClasses, 0, 7);
+  aig_manager->vInArrs = Vec_FltStart(3);
+  Vec_FltWriteEntry(aig_manager->vInArrs, 2, 1.5);
+  aig_manager->vNamesNode = Vec_PtrStart(nObjs);
+  Vec_PtrWriteEntry(aig_manager->vNamesNode, 5, Abc_UtilStrsav((char*)"n5"));
+
+  std::string path = TmpPath("snap.snap");
+  char* file_name = (char*)path.c_str();
+  ASSERT_TRUE(Gia_ManSnapWrite(aig_manager, file_name));
+  Gia_Man_t* read_back = Gia_ManSnapRead(file_name);
+  remove(file_name);
+  ASSERT_TRUE(read_back != NULL);
+  EXPECT_EQ(Gia_ManObjNum(read_back), nObjs);
+  EXPECT_EQ(Gia_ManRegNum(read_back), 1);
+  EXPECT_EQ(0, memcmp(read_back->pObjs, aig_manager->pObjs, sizeof(Gia_Obj_t) * nObjs));
+  EXPECT_STREQ(read_back->pName, "snap");
+  ASSERT_TRUE(read_back->pSibls != NULL);
+  EXPECT_EQ(read_back->pSibls[6], 5);
+  EXPECT_TRUE(Vec_IntEqual(read_back->vFlopClasses, aig_manager->vFlopClasses));
+  ASSERT_TRUE(read_back->vInArrs != NULL);
+  EXPECT_EQ(Vec_FltEntry(read_back->vInArrs, 2), 1.5);
+  ASSERT_TRUE(read_back->vNamesNode != NULL);
+  EXPECT_TRUE(Vec_PtrEntry(read_back->vNamesNode, 4) == NULL);
+  EXPECT_STREQ((char*)Vec_PtrEntry(read_back->vNamesNode, 5), "n5");
+  EXPECT_TRUE(read_back->vMapping == NULL);
+  Gia_ManStop(read_back);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(GiaTest, ZipRoundTripsObjects) {
+  Gia_Man_t* aig_manager = Gia_ManStart(100);
+  aig_manager->pMuxes = ABC_CALLOC(unsigned, 100);
+  Gia_ManHashStart(aig_manager);
+  for (int i = 0; i < 4; i++) Gia_ManAppendCi(aig_manager);
+  int and1 = Gia_ManHashAnd(aig_manager, 2, Abc_LitNot(4));
+  int xor1 = Gia_ManHashXorReal(aig_manager, and1, 6);
+  int mux1 = Gia_ManHashMuxReal(aig_manager, 8, xor1, Abc_LitNot(and1));
+  Gia_ManAppendCo(aig_manager, Abc_LitNot(mux1));
+  Gia_ManAppendCo(aig_manager, Gia_ManCiLit(aig_manager, 3));
+  Gia_ManSetRegNum(aig_manager, 1);
+  int nObjs = Gia_ManObjNum(aig_manager);
+  Gia_Obj_t* objs = ABC_ALLOC(Gia_Obj_t, nObjs);
+  memcpy(objs, aig_manager->pObjs, sizeof(Gia_Obj_t) * nObjs);
+  unsigned* muxes = ABC_ALLOC(unsigned, nObjs);
+  memcpy(muxes, aig_manager->pMuxes, sizeof(unsigned) * nObjs);
+
+  Gia_Zip_t* zip = Gia_ManZip(aig_manager);
+  int size_orig = 0;
+  EXPECT_LT(Gia_ZipSize(zip, &size_orig), size_orig);
+  Gia_Man_t* restored = Gia_ManUnzip(zip);
+  ASSERT_EQ(Gia_ManObjNum(restored), nObjs);
+  EXPECT_EQ(Gia_ManRegNum(restored), 1);
+  for (int i = 0; i < nObjs; i++) objs[i].Value = restored->pObjs[i].Value = 0;
+  EXPECT_EQ(0, memcmp(restored->pObjs, objs, sizeof(Gia_Obj_t) * nObjs));
+  ASSERT_TRUE(restored->pMuxes != NULL);
+  EXPECT_EQ(0, memcmp(restored->pMuxes, muxes, sizeof(unsigned) * nObjs));
+  ABC_FREE(objs);
+  ABC_FREE(muxes);
+  Gia_ManStop(restored);
+}
+
+TEST(GiaTest, UndoLimitDoesNotUndo) {
+  Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
+  Abc_FrameSetBatchMode(1);
+  ASSERT_EQ(Cmd_CommandExecute(pAbc, ("&r " + SrcPath("i10.aig") + "; &st; &syn2").c_str()), 0);
+  int nAnds1 = Gia_ManAndNum(Abc_FrameReadGia(pAbc));
+  ASSERT_EQ(Cmd_CommandExecute(pAbc, "&dc2"), 0);
+  int nAnds2 = Gia_ManAndNum(Abc_FrameReadGia(pAbc));
+  ASSERT_NE(nAnds1, nAnds2);
+  // changing the number of saved AIGs keeps the current AIG
+  ASSERT_EQ(Cmd_CommandExecute(pAbc, "&undo -N 1"), 0);
+  EXPECT_EQ(Gia_ManAndNum(Abc_FrameReadGia(pAbc)), nAnds2);
+  ASSERT_EQ(Cmd_CommandExecute(pAbc, "&undo"), 0);
+  EXPECT_EQ(Gia_ManAndNum(Abc_FrameReadGia(pAbc)), nAnds1);
+}
+
+TEST(GiaTest, ZipRoundTripsMappingAndChoices) {
+  Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
+  Abc_FrameSetBatchMode(1);
+  const char* commands[] = {"&st; &dch", "&st; &if -K 4"};
+  for (int c = 0; c < 2; c++) {
+    ASSERT_EQ(Cmd_CommandExecute(pAbc, ("&r " + SrcPath("i10.aig") + "; " + commands[c]).c_str()), 0);
+    Gia_Man_t* aig_manager = Abc_FrameGetGia(pAbc);
+    int nObjs = Gia_ManObjNum(aig_manager);
+    std::vector<int> sibls, luts;
+    if (c == 0) {
+      ASSERT_TRUE(aig_manager->pSibls != NULL);
+      sibls.assign(aig_manager->pSibls, aig_manager->pSibls + nObjs);
+    } else {
+      ASSERT_TRUE(Gia_ManHasMapping(aig_manager));
+      int i, iFan, k;
+      Gia_ManForEachLut(aig_manager, i) {
+        luts.push_back(i);
+        Gia_LutForEachFanin(aig_manager, i, iFan, k) luts.push_back(iFan);
+      }
+    }
+    Gia_Zip_t* zip = Gia_ManZip(aig_manager);
+    int size_orig = 0;
+    // the attributes are compressed together with the objects
+    EXPECT_LT(2 * Gia_ZipSize(zip, &size_orig), size_orig);
+    Gia_Man_t* restored = Gia_ManUnzip(zip);
+    ASSERT_EQ(Gia_ManObjNum(restored), nObjs);
+    if (c == 0) {
+      ASSERT_TRUE(restored->pSibls != NULL);
+      EXPECT_TRUE(std::equal(sibls.begin(), sibls.end(), restored->pSibls));
+    } else {
+      ASSERT_TRUE(Gia_ManHasMapping(restored));
+      std::vector<int> luts_new;
+      int i, iFan, k;
+      Gia_ManForEachLut(restored, i) {
+        luts_new.push_back(i);
+        Gia_LutForEachFanin(restored, i, iFan, k) luts_new.push_back(iFan);
+      }
+      EXPECT_EQ(luts, luts_new);
+    }
+    Gia_ManStop(restored);
+  }
+}
+
 ABC_NAMESPACE_IMPL_END
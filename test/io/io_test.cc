@@ -0,0 +1,332 @@
+#include "gtest/gtest.h"
+
+#include <string>
+
+#include "base/abc/abc.h"
+#include "base/io/ioAbc.h"
+#include "base/main/main.h"
+#include "base/ver/ver.h"
+#include "test_util.h"
+
+ABC_NAMESPACE_IMPL_START
+
+TEST(IoTest, ParallelBlifReaderMatchesDefault) {
+  // a hierarchical file (read by the fallback) and a flat file whose undriven nets grow the name table
+  const std::string file_names[] = {TmpPath("hier.blif"), TmpPath("flat.blif")}, ref_name = TmpPath("ref.blif");
+  const char* contents[] = {
+      ".model top\n.inputs a0 a1 b0 b1\n.outputs s0 s1 c\n"
+      ".subckt fa x=a0 y=b0 z=zero s=s0 co=c0\n.subckt fa x=a1 y=b1 z=c0 s=s1 co=c\n"
+      ".names zero\n.end\n\n"
+      ".model fa\n.inputs x y z\n.outputs s co\n"
+      ".names x y z s\n100 1\n010 1\n001 1\n111 1\n"
+      ".names x y z co\n11- 1\n1-1 1\n-11 1\n.end\n",
+      ".model flat\n.inputs a b\n.outputs y z\n"
+      ".names a u1 u2 u3 u4 u5 u6 y\n0------ 1\n"
+      ".names a b z\n11 1\n.end\n"};
+  Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
+  Abc_FrameSetBatchMode(1);
+  for (int f = 0; f < 2; f++) {
+    FILE* pFile = fopen(file_names[f].c_str(), "wb");
+    ASSERT_NE(pFile, nullptr);
+    fputs(contents[f], pFile);
+    fclose(pFile);
+    std::string command = "read_blif " + file_names[f] + "; strash; write_blif " + ref_name;
+    ASSERT_EQ(Cmd_CommandExecute(pAbc, command.c_str()), 0);
+    int nNodes = Abc_NtkNodeNum(Abc_FrameReadNtk(pAbc));
+    EXPECT_GT(nNodes, 0);
+    command = "read_blif -P 2 " + file_names[f] + "; strash";
+    ASSERT_EQ(Cmd_CommandExecute(pAbc, command.c_str()), 0);
+    EXPECT_EQ(Abc_NtkNodeNum(Abc_FrameReadNtk(pAbc)), nNodes);
+    EXPECT_EQ(Abc_NtkPoNum(Abc_FrameReadNtk(pAbc)), f ? 2 : 3);
+    ASSERT_EQ(Cmd_CommandExecute(pAbc, ("miter -n " + ref_name + "; iprove").c_str()), 0);
+    EXPECT_EQ(Abc_FrameReadProbStatus(pAbc), 1);
+    // the parallel reader does not implement the old parser
+    EXPECT_NE(Cmd_CommandExecute(pAbc, ("read_blif -n -P 2 " + file_names[f]).c_str()), 0);
+    remove(file_names[f].c_str());
+  }
+  remove(ref_name.c_str());
+}
+
+TEST(IoTest, ParallelVerilogParserMatchesDefault) {
+  // a hierarchical file written by hand and a flat file written by ABC
+  const std::string file_names[] = {TmpPath("hier.v"), TmpPath("flat.v")}, ref_name = TmpPath("ref.blif");
+  FILE* pFile = fopen(file_names[0].c_str(), "w");
+  ASSERT_NE(pFile, nullptr);
+  fputs("module fa ( x, y, z, s, co );\n  input x, y, z;\n  output s, co;\n"
+        "  assign s = x ^ y ^ z;\n  assign co = (x & y) | (x & z) | (y & z);\nendmodule\n\n"
+        "module top ( a0, a1, b0, b1, s0, s1, c );\n  input a0, a1, b0, b1;\n  output s0, s1, c;\n"
+        "  wire c0;\n  fa f0 ( .x(a0), .y(b0), .z(1'b0), .s(s0), .co(c0) );\n"
+        "  fa f1 ( .x(a1), .y(b1), .z(c0), .s(s1), .co(c) );\nendmodule\n",
+        pFile);
+  fclose(pFile);
+  Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
+  Abc_FrameSetBatchMode(1);
+  ASSERT_EQ(Cmd_CommandExecute(pAbc, ("read " + SrcPath("i10.aig") + "; write_verilog " + file_names[1]).c_str()), 0);
+  for (int f = 0; f < 2; f++) {
+    Abc_Des_t* pDes = Ver_ParseFile((char*)file_names[f].c_str(), NULL, 1, 1);
+    Abc_Des_t* pDesPar = Ver_ParseFilePar((char*)file_names[f].c_str(), NULL, 1, 1, 2, 0);
+    ASSERT_NE(pDes, nullptr);
+    ASSERT_NE(pDesPar, nullptr);
+    ASSERT_EQ(Vec_PtrSize(pDesPar->vModules), Vec_PtrSize(pDes->vModules));
+    for (int m = 0; m < Vec_PtrSize(pDes->vModules); m++) {
+      Abc_Ntk_t* pNtk = (Abc_Ntk_t*)Vec_PtrEntry(pDes->vModules, m);
+      Abc_Ntk_t* pNtkPar = (Abc_Ntk_t*)Vec_PtrEntry(pDesPar->vModules, m);
+      Abc_Obj_t* pObj;
+      int i;
+      EXPECT_STREQ(Abc_NtkName(pNtkPar), Abc_NtkName(pNtk));
+      ASSERT_EQ(Abc_NtkPiNum(pNtkPar), Abc_NtkPiNum(pNtk));
+      ASSERT_EQ(Abc_NtkPoNum(pNtkPar), Abc_NtkPoNum(pNtk));
+      EXPECT_EQ(Abc_NtkNodeNum(pNtkPar), Abc_NtkNodeNum(pNtk));
+      EXPECT_EQ(Abc_NtkBoxNum(pNtkPar), Abc_NtkBoxNum(pNtk));
+      EXPECT_EQ(Abc_NtkNetNum(pNtkPar), Abc_NtkNetNum(pNtk));
+      Abc_NtkForEachPi(pNtk, pObj, i)
+          EXPECT_STREQ(Abc_ObjName(Abc_ObjFanout0(Abc_NtkPi(pNtkPar, i))), Abc_ObjName(Abc_ObjFanout0(pObj)));
+      Abc_NtkForEachPo(pNtk, pObj, i)
+          EXPECT_STREQ(Abc_ObjName(Abc_ObjFanin0(Abc_NtkPo(pNtkPar, i))), Abc_ObjName(Abc_ObjFanin0(pObj)));
+    }
+    Abc_DesFree(pDes, NULL);
+    Abc_DesFree(pDesPar, NULL);
+    // the command reads the same network
+    std::string command = "read_verilog " + file_names[f] + "; strash; write_blif " + ref_name;
+    ASSERT_EQ(Cmd_CommandExecute(pAbc, command.c_str()), 0);
+    command = "read_verilog -P 2 " + file_names[f] + "; strash";
+    ASSERT_EQ(Cmd_CommandExecute(pAbc, command.c_str()), 0);
+    ASSERT_EQ(Cmd_CommandExecute(pAbc, ("miter -n " + ref_name + "; iprove").c_str()), 0);
+    EXPECT_EQ(Abc_FrameReadProbStatus(pAbc), 1);
+    remove(file_names[f].c_str());
+  }
+  remove(ref_name.c_str());
+}
+
+TEST(IoTest, BufferedWritersMatchExpectedText) {
+  // the expected text (without the time-stamp line) was produced by the writers before buffering
+  const std::string in_name = TmpPath("w_in.blif");
+  FILE* pFile = fopen(in_name.c_str(), "w");
+  ASSERT_NE(pFile, nullptr);
+  fputs(R"txt(.model writer_test
+.inputs input_signal_a input_signal_b input_signal_c input_signal_d input_signal_e
+.inputs input_signal_f input_signal_g input_signal_h input_signal_i input_signal_j
+.outputs out_and out_or out_xor out_mux out_const out_inv state
+.latch next state 1
+.names input_signal_a input_signal_b input_signal_c out_and
+111 1
+.names input_signal_d input_signal_e input_signal_f input_signal_g out_or
+1--- 1
+-1-- 1
+--1- 1
+---0 1
+.names input_signal_h input_signal_i out_xor
+10 1
+01 1
+.names input_signal_j input_signal_a input_signal_b out_mux
+11- 1
+0-1 1
+.names out_const
+1
+.names input_signal_c out_inv
+0 1
+.names state out_xor input_signal_j next
+1-- 1
+-11 1
+.end
+)txt", pFile);
+  fclose(pFile);
+  struct Case {
+    const char* pFile;
+    const char* pText;
+  } Cases[] = {
+      {"w.blif", R"txt(.model writer_test
+.inputs input_signal_a input_signal_b input_signal_c input_signal_d \
+ input_signal_e input_signal_f input_signal_g input_signal_h input_signal_i \
+ input_signal_j
+.outputs out_and out_or out_xor out_mux out_const out_inv state
+
+.latch        n36      state  1
+
+.names input_signal_a input_signal_b input_signal_c out_and
+111 1
+.names input_signal_d input_signal_e input_signal_f input_signal_g out_or
+1--- 1
+-1-- 1
+--1- 1
+---0 1
+.names input_signal_h input_signal_i out_xor
+10 1
+01 1
+.names input_signal_j input_signal_a input_signal_b out_mux
+11- 1
+0-1 1
+.names input_signal_c out_inv
+0 1
+.names state out_xor input_signal_j n36
+1-- 1
+-11 1
+.names out_const
+ 1
+.end
+)txt"},
+      {"w.v", R"txt(
+module writer_test ( clock, 
+    input_signal_a, input_signal_b, input_signal_c, input_signal_d,
+    input_signal_e, input_signal_f, input_signal_g, input_signal_h,
+    input_signal_i, input_signal_j,
+    out_and, out_or, out_xor, out_mux, out_const, out_inv, state  );
+  input  clock;
+  input  input_signal_a, input_signal_b, input_signal_c, input_signal_d,
+    input_signal_e, input_signal_f, input_signal_g, input_signal_h,
+    input_signal_i, input_signal_j;
+  output out_and, out_or, out_xor, out_mux, out_const, out_inv, state;
+  reg state;
+  wire n36;
+  assign out_and = input_signal_c & input_signal_a & input_signal_b;
+  assign out_or = input_signal_f | ~input_signal_g | input_signal_d | input_signal_e;
+  assign out_xor = ~input_signal_h ^ ~input_signal_i;
+  assign out_mux = input_signal_j ? input_signal_a : input_signal_b;
+  assign out_inv = ~input_signal_c;
+  assign n36 = state | (out_xor & input_signal_j);
+  assign out_const = 1'b1;
+  always @ (posedge clock) begin
+    state <= n36;
+  end
+  initial begin
+    state <= 1'b1;
+  end
+endmodule
+
+
+)txt"},
+      {"w.eqn", R"txt(INORDER = input_signal_a input_signal_b input_signal_c input_signal_d 
+ input_signal_e input_signal_f input_signal_g input_signal_h input_signal_i 
+ input_signal_j state;
+OUTORDER = out_and out_or out_xor out_mux out_const out_inv state n36;
+out_and = input_signal_c * input_signal_a * input_signal_b;
+out_or = input_signal_f + !input_signal_g + input_signal_d + input_signal_e;
+out_xor = (input_signal_h * !input_signal_i) + (!input_signal_h * input_signal_i);
+out_mux = (input_signal_j * input_signal_a) + (!input_signal_j * input_signal_b);
+out_inv = !input_signal_c;
+n36 = state + (out_xor * input_signal_j);
+out_const = 1;
+
+)txt"},
+      {"wa.bench", R"txt(INPUT(input_signal_a)
+INPUT(input_signal_b)
+INPUT(input_signal_c)
+INPUT(input_signal_d)
+INPUT(input_signal_e)
+INPUT(input_signal_f)
+INPUT(input_signal_g)
+INPUT(input_signal_h)
+INPUT(input_signal_i)
+INPUT(input_signal_j)
+OUTPUT(out_and)
+OUTPUT(out_or)
+OUTPUT(out_xor)
+OUTPUT(out_mux)
+OUTPUT(out_const)
+OUTPUT(out_inv)
+OUTPUT(state)
+state       = DFF(n36)
+out_inv     = NOT(input_signal_c)
+new_n23     = NOT(input_signal_d)
+new_n24     = NOT(input_signal_e)
+new_n25     = NOT(input_signal_f)
+new_n26     = NOT(input_signal_h)
+new_n27     = NOT(input_signal_i)
+new_n28     = NOT(input_signal_j)
+new_n29     = NOT(state)
+new_n30     = AND(input_signal_a, input_signal_b)
+out_and     = AND(input_signal_c, new_n30)
+new_n32     = AND(new_n25, input_signal_g)
+new_n33     = AND(new_n23, new_n24)
+new_n34     = AND(new_n32, new_n33)
+out_or      = NOT(new_n34)
+new_n36_1   = AND(input_signal_h, new_n27)
+new_n37     = NOT(new_n36_1)
+new_n38     = AND(new_n26, input_signal_i)
+new_n39     = NOT(new_n38)
+new_n40     = AND(new_n37, new_n39)
+out_xor     = NOT(new_n40)
+new_n42     = AND(input_signal_a, input_signal_j)
+new_n43     = NOT(new_n42)
+new_n44     = AND(input_signal_b, new_n28)
+new_n45     = NOT(new_n44)
+new_n46     = AND(new_n43, new_n45)
+out_mux     = NOT(new_n46)
+new_n48     = AND(input_signal_j, out_xor)
+new_n49     = NOT(new_n48)
+new_n50     = AND(new_n29, new_n49)
+n36         = NOT(new_n50)
+out_const   = vdd
+)txt"},
+      {"wl.bench", R"txt(INPUT(input_signal_a)
+INPUT(input_signal_b)
+INPUT(input_signal_c)
+INPUT(input_signal_d)
+INPUT(input_signal_e)
+INPUT(input_signal_f)
+INPUT(input_signal_g)
+INPUT(input_signal_h)
+INPUT(input_signal_i)
+INPUT(input_signal_j)
+OUTPUT(out_and)
+OUTPUT(out_or)
+OUTPUT(out_xor)
+OUTPUT(out_mux)
+OUTPUT(out_const)
+OUTPUT(out_inv)
+OUTPUT(state)
+state       = DFFRSE( n36, gnd, gnd, gnd, gnd )
+out_and     = LUT 0x80 ( input_signal_a, input_signal_b, input_signal_c )
+out_or      = LUT 0xfd ( new_n24, input_signal_d, input_signal_e )
+new_n24     = LUT 0x4 ( input_signal_f, input_signal_g )
+out_xor     = LUT 0x6 ( input_signal_h, input_signal_i )
+out_mux     = LUT 0xac ( input_signal_a, input_signal_b, input_signal_j )
+n36         = LUT 0xf8 ( out_xor, input_signal_j, state )
+out_const   = vdd
+out_inv     = LUT 0x1 ( input_signal_c )
+)txt"},
+  };
+  Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
+  Abc_FrameSetBatchMode(1);
+  std::string command = "read " + in_name + "; write_blif " + TmpPath("w.blif") + "; write_verilog " + TmpPath("w.v") +
+                        "; write_eqn " + TmpPath("w.eqn") + "; strash; write_bench -l " + TmpPath("wa.bench");
+  ASSERT_EQ(Cmd_CommandExecute(pAbc, command.c_str()), 0);
+  command = "read " + in_name + "; if -K 3; write_bench " + TmpPath("wl.bench");
+  ASSERT_EQ(Cmd_CommandExecute(pAbc, command.c_str()), 0);
+  for (const Case& c : Cases) {
+    FILE* pOut = fopen(TmpPath(c.pFile).c_str(), "rb");
+    ASSERT_NE(pOut, nullptr) << c.pFile;
+    std::string Text;
+    char Buffer[4096];
+    size_t nRead;
+    while ((nRead = fread(Buffer, 1, sizeof(Buffer), pOut)) > 0) Text.append(Buffer, nRead);
+    fclose(pOut);
+    size_t iLine = Text.find('\n');
+    ASSERT_NE(iLine, std::string::npos) << c.pFile;
+    EXPECT_EQ(Text.substr(iLine + 1), c.pText) << c.pFile;
+    remove(TmpPath(c.pFile).c_str());
+  }
+  remove(in_name.c_str());
+}
+
+TEST(IoTest, BufferCollectedInMemoryGrowsGeometrically) {
+  // without a file, the text is only collected, so the buffer keeps growing
+  Io_Buf_t* pBuf = Io_BufStart(NULL);
+  int nReallocs = 0, nCapPrev = Vec_StrCap(pBuf->vText);
+  for (int i = 0; i < 100000; i++) {
+    if (i % 2)
+      Io_BufStr(pBuf, "name ");
+    else
+      Io_BufPrintf(pBuf, "%d ", i);
+    if (Vec_StrCap(pBuf->vText) != nCapPrev) {
+      nCapPrev = Vec_StrCap(pBuf->vText);
+      nReallocs++;
+    }
+  }
+  EXPECT_GT(Vec_StrSize(pBuf->vText), 500000);
+  EXPECT_LT(nReallocs, 20);
+  EXPECT_EQ(strncmp(Vec_StrArray(pBuf->vText), "0 name 2 name 4 ", 16), 0);
+  Io_BufStop(pBuf);
+}
+
+ABC_NAMESPACE_IMPL_END
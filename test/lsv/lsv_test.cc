@@ -0,0 +1,134 @@
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "aig/gia/gia.h"
+#include "ext-lsv/lsv.h"
+
+ABC_NAMESPACE_IMPL_START
+
+// The example AIG from PA1: 4 = 1 & 2, 5 = 2 & 3, 6 = 4 & 5.
+static Gia_Man_t* MakeExampleGia() {
+  Gia_Man_t* p = Gia_ManStart(10);
+  int a = Gia_ManAppendCi(p);
+  int b = Gia_ManAppendCi(p);
+  int c = Gia_ManAppendCi(p);
+  int ab = Gia_ManAppendAnd(p, a, b);
+  int bc = Gia_ManAppendAnd(p, b, c);
+  Gia_ManAppendCo(p, Gia_ManAppendAnd(p, ab, bc));
+  return p;
+}
+
+static std::string EnumerateCuts(Gia_Man_t* p, int nLeafMax, int nThreads,
+                                 int fStream) {
+  Lsv_CutPar_t Pars;
+  Lsv_CutGraph_t Graph;
+  Lsv_CutSetDefaultParams(&Pars);
+  Pars.nLeafMax = nLeafMax;
+  Pars.nThreads = nThreads;
+  Pars.fStream = fStream;
+  EXPECT_TRUE(Lsv_CutGraphFromGia(p, &Graph));
+  FILE* pFile = tmpfile();
+  EXPECT_TRUE(Lsv_CutEnumerate(&Graph, &Pars, pFile));
+  std::string Result;
+  char Buffer[256];
+  rewind(pFile);
+  while (fgets(Buffer, sizeof(Buffer), pFile)) Result += Buffer;
+  fclose(pFile);
+  return Result;
+}
+
+static std::vector<std::string> SortedLines(const std::string& Text) {
+  std::vector<std::string> vLines;
+  std::istringstream Stream(Text);
+  for (std::string Line; std::getline(Stream, Line);) vLines.push_back(Line);
+  std::sort(vLines.begin(), vLines.end());
+  return vLines;
+}
+
+TEST(LsvCutTest, EnumeratesThreeFeasibleCuts) {
+  Gia_Man_t* p = MakeExampleGia();
+  EXPECT_EQ(EnumerateCuts(p, 3, 1, 0),
+            "1: 1\n2: 2\n3: 3\n4: 4\n4: 1 2\n5: 5\n5: 2 3\n"
+            "6: 6\n6: 4 5\n6: 1 2 5\n6: 2 3 4\n6: 1 2 3\n");
+  Gia_ManStop(p);
+}
+
+// Checks that no cut of a node contains another cut of the same node.
+static void ExpectNoDominatedCuts(const std::string& Text) {
+  std::map<int, std::vector<std::vector<int>>> Cuts;
+  std::istringstream Stream(Text);
+  for (std::string Line; std::getline(Stream, Line);) {
+    std::istringstream LineStream(Line);
+    int Node, Leaf;
+    char Colon;
+    LineStream >> Node >> Colon;
+    std::vector<int> Leaves;
+    while (LineStream >> Leaf) Leaves.push_back(Leaf);
+    std::sort(Leaves.begin(), Leaves.end());
+    Cuts[Node].push_back(Leaves);
+  }
+  for (auto& Entry : Cuts)
+    for (size_t i = 0; i < Entry.second.size(); i++)
+      for (size_t k = 0; k < Entry.second.size(); k++) {
+        if (i == k) continue;
+        const std::vector<int>& Small = Entry.second[i];
+        const std::vector<int>& Large = Entry.second[k];
+        EXPECT_FALSE(std::includes(Large.begin(), Large.end(), Small.begin(),
+                                   Small.end()))
+            << "cut " << k << " of node " << Entry.first
+            << " is dominated by cut " << i;
+      }
+}
+
+TEST(LsvCutTest, RemovesDominatedCuts) {
+  // reconvergent logic: 4 = 1 & 2, 5 = 4 & 3, 6 = 4 & 5
+  Gia_Man_t* p = Gia_ManStart(10);
+  int a = Gia_ManAppendCi(p);
+  int b = Gia_ManAppendCi(p);
+  int c = Gia_ManAppendCi(p);
+  int ab = Gia_ManAppendAnd(p, a, b);
+  int abc = Gia_ManAppendAnd(p, ab, c);
+  Gia_ManAppendCo(p, Gia_ManAppendAnd(p, ab, abc));
+  // merging {1 2} with {4 3} gives {1 2 3 4}, which is dominated by {3 4}
+  std::string Cuts = EnumerateCuts(p, 4, 1, 0);
+  EXPECT_EQ(Cuts,
+            "1: 1\n2: 2\n3: 3\n4: 4\n4: 1 2\n5: 5\n5: 3 4\n5: 1 2 3\n"
+            "6: 6\n6: 4 5\n6: 1 2 5\n6: 3 4\n6: 1 2 3\n");
+  ExpectNoDominatedCuts(Cuts);
+  Gia_ManStop(p);
+  // with k = 2, cuts {1 2 5}, {2 3 4} and {1 2 3} are too large
+  p = MakeExampleGia();
+  Cuts = EnumerateCuts(p, 2, 1, 0);
+  EXPECT_EQ(Cuts,
+            "1: 1\n2: 2\n3: 3\n4: 4\n4: 1 2\n5: 5\n5: 2 3\n6: 6\n6: 4 5\n");
+  ExpectNoDominatedCuts(Cuts);
+  Gia_ManStop(p);
+}
+
+TEST(LsvCutTest, ThreadedAndStreamingMatchSerial) {
+  Gia_Man_t* p = Gia_ManStart(1000);
+  Vec_Int_t* vLits = Vec_IntAlloc(100);
+  for (int i = 0; i < 16; i++) Vec_IntPush(vLits, Gia_ManAppendCi(p));
+  Gia_ManHashAlloc(p);
+  for (int i = 0; i < 300; i++) {
+    int Lit0 = Vec_IntEntry(vLits, (i * 7) % Vec_IntSize(vLits));
+    int Lit1 = Vec_IntEntry(vLits, (i * 13 + 5) % Vec_IntSize(vLits));
+    Vec_IntPush(vLits, Gia_ManHashAnd(p, Abc_LitNotCond(Lit0, i & 1), Lit1));
+  }
+  Gia_ManHashStop(p);
+  Gia_ManAppendCo(p, Vec_IntEntryLast(vLits));
+  std::string Serial = EnumerateCuts(p, 4, 1, 0);
+  ExpectNoDominatedCuts(Serial);
+  EXPECT_EQ(EnumerateCuts(p, 4, 4, 0), Serial);
+  // streaming prints level by level, so compare the sorted lines
+  EXPECT_EQ(SortedLines(EnumerateCuts(p, 4, 4, 1)), SortedLines(Serial));
+  Vec_IntFree(vLits);
+  Gia_ManStop(p);
+}
+
+ABC_NAMESPACE_IMPL_END
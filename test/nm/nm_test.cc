@@ -0,0 +1,96 @@
+#include "gtest/gtest.h"
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include "misc/vec/vec.h"
+#include "misc/nm/nm.h"
+
+ABC_NAMESPACE_IMPL_START
+
+TEST(NmTest, NameManagerDeletesCollidingNames) {
+  // find names with the same home slot in the smallest table
+  std::vector<std::string> vColl;
+  for (int i = 0; vColl.size() < 6; i++) {
+    std::string Name = "c" + std::to_string(i);
+    unsigned Key = 2166136261u;
+    for (char c : Name) Key = (Key ^ (unsigned char)c) * 16777619u;
+    if ((Key & 15) == 5) vColl.push_back(Name);
+  }
+  Nm_Man_t* p = Nm_ManCreate(4);
+  for (int i = 0; i < 6; i++)
+    Nm_ManStoreIdName(p, i, 1, (char*)vColl[i].c_str(), NULL);
+  // delete from the middle and from the front of the probe sequence
+  Nm_ManDeleteIdName(p, 2);
+  Nm_ManDeleteIdName(p, 0);
+  for (int i = 0; i < 6; i++)
+    EXPECT_EQ(Nm_ManFindIdByName(p, (char*)vColl[i].c_str(), -1), (i == 0 || i == 2) ? -1 : i);
+  Nm_ManStoreIdName(p, 10, 1, (char*)vColl[2].c_str(), NULL);
+  EXPECT_EQ(Nm_ManFindIdByName(p, (char*)vColl[2].c_str(), 1), 10);
+  // add and delete many names, so that the table is resized
+  std::mt19937 Rng(11);
+  std::vector<int> vLive(2000, 0);
+  for (int Round = 0; Round < 20000; Round++) {
+    int Id = 100 + (int)(Rng() % 2000);
+    std::string Name = "n" + std::to_string(Id);
+    if (vLive[Id - 100])
+      Nm_ManDeleteIdName(p, Id);
+    else
+      Nm_ManStoreIdName(p, Id, 1, (char*)Name.c_str(), NULL);
+    vLive[Id - 100] ^= 1;
+  }
+  int nLive = 5;
+  for (int Id = 100; Id < 2100; Id++) {
+    std::string Name = "n" + std::to_string(Id);
+    EXPECT_EQ(Nm_ManFindIdByName(p, (char*)Name.c_str(), -1), vLive[Id - 100] ? Id : -1);
+    nLive += vLive[Id - 100];
+  }
+  EXPECT_EQ(Nm_ManNumEntries(p), nLive);
+  // the returned IDs are distinct and have names
+  Vec_Int_t* vIds = Nm_ManReturnNameIds(p);
+  int nIds = Vec_IntSize(vIds);
+  EXPECT_GT(nIds, 0);
+  EXPECT_LE(nIds, nLive);
+  Vec_IntUniqify(vIds);
+  EXPECT_EQ(Vec_IntSize(vIds), nIds);
+  for (int i = 0; i < Vec_IntSize(vIds); i++)
+    EXPECT_NE(Nm_ManFindNameById(p, Vec_IntEntry(vIds, i)), nullptr);
+  Vec_IntFree(vIds);
+  Nm_ManFree(p);
+}
+
+TEST(NmTest, NameManagerKeepsNamesakeOrder) {
+  Nm_Man_t* p = Nm_ManCreate(16);
+  char Name[] = "x";
+  // the head comes first, followed by the namesakes, newest first
+  Nm_ManStoreIdName(p, 1, 1, Name, NULL);
+  Nm_ManStoreIdName(p, 2, 2, Name, NULL);
+  Nm_ManStoreIdName(p, 3, 2, Name, NULL);
+  Nm_ManStoreIdName(p, 4, 3, Name, NULL);
+  EXPECT_EQ(Nm_ManFindIdByName(p, Name, -1), 1);
+  EXPECT_EQ(Nm_ManFindIdByName(p, Name, 2), 3);
+  EXPECT_EQ(Nm_ManFindIdByName(p, Name, 3), 4);
+  EXPECT_EQ(Nm_ManFindIdByName(p, Name, 5), -1);
+  EXPECT_EQ(Nm_ManFindIdByNameTwoTypes(p, Name, 5, 2), 3);
+  EXPECT_EQ(Nm_ManFindNameById(p, 3), Nm_ManFindNameById(p, 1));
+  // deleting a namesake keeps the order of the others
+  Nm_ManDeleteIdName(p, 3);
+  EXPECT_EQ(Nm_ManFindIdByName(p, Name, 2), 2);
+  // deleting the head makes the oldest namesake the head
+  Nm_ManStoreIdName(p, 5, 2, Name, NULL);
+  Nm_ManDeleteIdName(p, 1);
+  EXPECT_EQ(Nm_ManFindIdByName(p, Name, -1), 2);
+  EXPECT_EQ(Nm_ManFindIdByName(p, Name, 1), -1);
+  EXPECT_EQ(Nm_ManFindIdByName(p, Name, 2), 2);
+  Nm_ManDeleteIdName(p, 2);
+  EXPECT_EQ(Nm_ManFindIdByName(p, Name, -1), 4);
+  EXPECT_EQ(Nm_ManFindIdByName(p, Name, 2), 5);
+  Nm_ManDeleteIdName(p, 4);
+  Nm_ManDeleteIdName(p, 5);
+  EXPECT_EQ(Nm_ManFindIdByName(p, Name, -1), -1);
+  EXPECT_EQ(Nm_ManNumEntries(p), 0);
+  Nm_ManFree(p);
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,259 @@
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "aig/gia/gia.h"
+#include "aig/gia/giaAig.h"
+#include "base/main/main.h"
+#include "proof/cec/cec.h"
+#include "proof/pdr/pdr.h"
+#include "proof/ssw/ssw.h"
+#include "sat/bmc/bmc.h"
+#include "test_util.h"
+
+ABC_NAMESPACE_HEADER_START
+void Cec4_ManSetParams(Cec_ParFra_t* pPars);
+Gia_Man_t* Cec4_ManSimulateTest(Gia_Man_t* p, Cec_ParFra_t* pPars);
+Gia_Man_t* Cec4_ManSimulateTest3Par(Gia_Man_t* p, int nBTLimit, int nProcs, int fVerbose);
+int Cec_GiaProveTest(Gia_Man_t* p, int nProcs, int nTimeOut, int nTimeOut2, int nTimeOut3,
+                     int fVerbose, int fVeryVerbose, int fSilent);
+ABC_NAMESPACE_HEADER_END
+
+ABC_NAMESPACE_IMPL_START
+
+TEST(ProofTest, ParallelSweepingMatchesSerial) {
+  Gia_Man_t* aig_manager = Gia_ManStart(1000);
+  int inputs[10];
+  for (int i = 0; i < 10; i++) inputs[i] = Gia_ManAppendCi(aig_manager);
+  for (int i = 0; i < 10; i++) {
+    int a = inputs[i], b = inputs[(i + 2) % 10], c = inputs[(i + 5) % 10];
+    // (a & b) | (a & c) and a & (b | c) are structurally different but equal
+    int ab = Gia_ManAppendAnd(aig_manager, a, b);
+    int ac = Gia_ManAppendAnd(aig_manager, a, c);
+    int abac = Abc_LitNot(Gia_ManAppendAnd(aig_manager, Abc_LitNot(ab), Abc_LitNot(ac)));
+    int bc = Abc_LitNot(Gia_ManAppendAnd(aig_manager, Abc_LitNot(b), Abc_LitNot(c)));
+    Gia_ManAppendCo(aig_manager, abac);
+    Gia_ManAppendCo(aig_manager, Gia_ManAppendAnd(aig_manager, a, bc));
+  }
+
+  Cec_ParFra_t pars;
+  Cec4_ManSetParams(&pars);
+  Gia_Man_t* serial = Cec4_ManSimulateTest(aig_manager, &pars);
+  pars.nProcs = 3;
+  Gia_Man_t* parallel = Cec4_ManSimulateTest(aig_manager, &pars);
+  EXPECT_LT(Gia_ManAndNum(serial), Gia_ManAndNum(aig_manager));
+  EXPECT_EQ(Gia_ManAndNum(parallel), Gia_ManAndNum(serial));
+  EXPECT_GT(pars.nProvedPar, 0);
+  Vec_Wrd_t* stimulus = Vec_WrdStartRandom(Gia_ManCiNum(aig_manager));
+  Vec_Wrd_t* output = Gia_ManSimPatSimOut(aig_manager, stimulus, /*fouts*/1);
+  Vec_Wrd_t* output_par = Gia_ManSimPatSimOut(parallel, stimulus, /*fouts*/1);
+  EXPECT_TRUE(Vec_WrdEqual(output, output_par));
+  Vec_WrdFree(stimulus);
+  Vec_WrdFree(output);
+  Vec_WrdFree(output_par);
+  Gia_ManStop(parallel);
+  Gia_ManStop(serial);
+  Gia_ManStop(aig_manager);
+}
+
+TEST(ProofTest, CecThreadsProveEquivalence) {
+  Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
+  Abc_FrameSetBatchMode(1);
+  std::string read = "&r " + SrcPath("i10.aig"), file_name = TmpPath("cec.aig");
+  ASSERT_EQ(Cmd_CommandExecute(pAbc, (read + "; &st; &syn2; &w " + file_name).c_str()), 0);
+  Gia_Man_t* p0 = Gia_AigerRead((char*)SrcPath("i10.aig").c_str(), 0, 0, 0);
+  Gia_Man_t* p1 = Gia_AigerRead((char*)file_name.c_str(), 0, 0, 0);
+  for (int k = 0; k < 2; k++) {
+    ASSERT_EQ(Cmd_CommandExecute(pAbc, read.c_str()), 0);
+    ASSERT_EQ(Cmd_CommandExecute(pAbc, ((k ? "&cec -x -P 2 " : "&cec -x ") + file_name).c_str()), 0);
+    // the sweeper used by "&cec -x" reduces the miter to constants
+    Gia_Man_t* miter = Gia_ManMiter(p0, p1, 0, 0, 0, 0, 0);
+    Gia_Man_t* result = Cec4_ManSimulateTest3Par(miter, 1000, k ? 2 : 1, 0);
+    EXPECT_EQ(Gia_ManAndNum(result), 0);
+    Gia_ManStop(result);
+    Gia_ManStop(miter);
+  }
+  Gia_ManStop(p0);
+  Gia_ManStop(p1);
+  remove(file_name.c_str());
+}
+
+// 3-bit counter that wraps after reaching Wrap; the output fires when the count is Bad
+static Aig_Man_t* MakeCounterMiter(int Wrap, int Bad) {
+  Gia_Man_t* p = Gia_ManStart(100);
+  int q[3], n[3], carry = 1, wrap = 1, bad = 1;
+  Gia_ManHashStart(p);
+  Gia_ManAppendCi(p);  // unused primary input
+  for (int i = 0; i < 3; i++) q[i] = Gia_ManAppendCi(p);
+  for (int i = 0; i < 3; i++) {
+    wrap = Gia_ManHashAnd(p, wrap, Abc_LitNotCond(q[i], !((Wrap >> i) & 1)));
+    bad = Gia_ManHashAnd(p, bad, Abc_LitNotCond(q[i], !((Bad >> i) & 1)));
+  }
+  for (int i = 0; i < 3; i++) {
+    n[i] = Gia_ManHashAnd(p, Gia_ManHashXor(p, q[i], carry), Abc_LitNot(wrap));
+    carry = Gia_ManHashAnd(p, q[i], carry);
+  }
+  Gia_ManAppendCo(p, bad);
+  for (int i = 0; i < 3; i++) Gia_ManAppendCo(p, n[i]);
+  Gia_ManSetRegNum(p, 3);
+  Aig_Man_t* pAig = Gia_ManToAigSimple(p);
+  Gia_ManStop(p);
+  return pAig;
+}
+
+TEST(ProofTest, ParallelPdrMatchesSerial) {
+  Abc_FrameGetGlobalFrame();
+  for (int nWorkers = 1; nWorkers <= 3; nWorkers += 2) {
+    Pdr_Par_t Pars;
+    Aig_Man_t* pAig = MakeCounterMiter(4, 6);
+    Pdr_ManSetDefaultParams(&Pars);
+    Pars.fSilent = 1;
+    Pars.nWorkers = nWorkers;
+    EXPECT_EQ(Pdr_ManSolve(pAig, &Pars), 1);
+    // the workers learn from each other
+    if (nWorkers > 1) {
+      EXPECT_GT(Pars.nShrIn, 0);
+    }
+    Aig_ManStop(pAig);
+
+    pAig = MakeCounterMiter(7, 5);
+    Pdr_ManSetDefaultParams(&Pars);
+    Pars.fSilent = 1;
+    Pars.nWorkers = nWorkers;
+    EXPECT_EQ(Pdr_ManSolve(pAig, &Pars), 0);
+    ASSERT_TRUE(pAig->pSeqModel != NULL);
+    EXPECT_EQ(pAig->pSeqModel->iFrame, 5);
+    EXPECT_TRUE(Saig_ManVerifyCex(pAig, pAig->pSeqModel));
+    Aig_ManStop(pAig);
+  }
+}
+
+TEST(ProofTest, ParallelBmcMatchesSerial) {
+  Abc_FrameGetGlobalFrame();
+  for (int nProcs = 1; nProcs <= 3; nProcs += 2) {
+    Saig_ParBmc_t Pars;
+    Aig_Man_t* pAig = MakeCounterMiter(7, 5);
+    Saig_ParBmcSetDefaultParams(&Pars);
+    Pars.nProcs = nProcs;
+    Pars.fSilent = 1;
+    EXPECT_EQ(Saig_ManBmcScalable(pAig, &Pars), 0);
+    ASSERT_TRUE(pAig->pSeqModel != NULL);
+    EXPECT_EQ(pAig->pSeqModel->iFrame, 5);
+    EXPECT_EQ(Pars.iFrame, 4);
+    EXPECT_TRUE(Saig_ManVerifyCex(pAig, pAig->pSeqModel));
+    Aig_ManStop(pAig);
+
+    pAig = MakeCounterMiter(4, 6);
+    Saig_ParBmcSetDefaultParams(&Pars);
+    Pars.nProcs = nProcs;
+    Pars.nFramesMax = 6;
+    Pars.fSilent = 1;
+    EXPECT_EQ(Saig_ManBmcScalable(pAig, &Pars), -1);
+    EXPECT_EQ(Pars.iFrame, 5);
+    Aig_ManStop(pAig);
+  }
+}
+
+// several 3-bit counters, each with a duplicate of every register
+static Aig_Man_t* MakeDuplicatedCounters(int nCounters) {
+  Gia_Man_t* p = Gia_ManStart(1000);
+  std::vector<int> q(6 * nCounters), n(3 * nCounters);
+  Gia_ManHashStart(p);
+  int en = Gia_ManAppendCi(p);
+  for (int i = 0; i < 6 * nCounters; i++) q[i] = Gia_ManAppendCi(p);
+  for (int c = 0; c < nCounters; c++) {
+    // the next state depends on the originals only
+    int carry = en, carry_dup = en;
+    for (int i = 0; i < 3; i++) {
+      n[3 * c + i] = Gia_ManHashXor(p, q[6 * c + i], carry);
+      carry = Gia_ManHashAnd(p, q[6 * c + i], carry);
+      carry_dup = Gia_ManHashAnd(p, q[6 * c + 3 + i], carry_dup);
+    }
+    Gia_ManAppendCo(p, carry);
+    Gia_ManAppendCo(p, carry_dup);
+  }
+  for (int c = 0; c < nCounters; c++)
+    for (int k = 0; k < 2; k++)
+      for (int i = 0; i < 3; i++) Gia_ManAppendCo(p, n[3 * c + i]);
+  Gia_ManSetRegNum(p, 6 * nCounters);
+  Aig_Man_t* pAig = Gia_ManToAigSimple(p);
+  Gia_ManStop(p);
+  return pAig;
+}
+
+TEST(ProofTest, ParallelScorrMatchesSerial) {
+  Abc_FrameGetGlobalFrame();
+  int nRegs[2], nNodes[2];
+  for (int k = 0; k < 2; k++) {
+    Ssw_Pars_t Pars;
+    Aig_Man_t* pAig = MakeDuplicatedCounters(5);
+    Ssw_ManSetDefaultParams(&Pars);
+    Pars.nPartSize = 6;
+    Pars.nProcs = k ? 3 : 1;
+    Pars.fPrintParts = 0;
+    Aig_Man_t* pNew = Ssw_SignalCorrespondence(pAig, &Pars);
+    ASSERT_TRUE(pNew != NULL);
+    nRegs[k] = Aig_ManRegNum(pNew);
+    nNodes[k] = Aig_ManNodeNum(pNew);
+    Aig_ManStop(pNew);
+    Aig_ManStop(pAig);
+  }
+  EXPECT_EQ(nRegs[0], 15);
+  EXPECT_EQ(nRegs[1], nRegs[0]);
+  EXPECT_EQ(nNodes[1], nNodes[0]);
+}
+
+TEST(ProofTest, BatchScorrMatchesSerial) {
+  Abc_FrameGetGlobalFrame();
+  Aig_Man_t* pAig = MakeDuplicatedCounters(5);
+  Gia_Man_t* p = Gia_ManFromAigSimple(pAig);
+  int nRegs[2], nNodes[2];
+  for (int k = 0; k < 2; k++) {
+    // the candidate equivalences are solved in batches on three threads
+    Cec_ParCor_t Pars;
+    Cec_ManCorSetDefaultParams(&Pars);
+    Pars.nProcs = k ? 3 : 1;
+    Gia_Man_t* pNew = Cec_ManLSCorrespondence(p, &Pars);
+    nRegs[k] = Gia_ManRegNum(pNew);
+    nNodes[k] = Gia_ManAndNum(pNew);
+    Gia_ManStop(pNew);
+  }
+  // the counters are equivalent to each other
+  EXPECT_EQ(nRegs[0], 3);
+  EXPECT_EQ(nRegs[1], nRegs[0]);
+  EXPECT_EQ(nNodes[1], nNodes[0]);
+  // the same through the AIG-based command without partitions
+  Ssw_Pars_t SswPars;
+  Ssw_ManSetDefaultParams(&SswPars);
+  SswPars.nProcs = 3;
+  Aig_Man_t* pNew = Ssw_SignalCorrespondence(pAig, &SswPars);
+  ASSERT_TRUE(pNew != NULL);
+  EXPECT_EQ(Aig_ManRegNum(pNew), nRegs[0]);
+  Aig_ManStop(pNew);
+  Gia_ManStop(p);
+  Aig_ManStop(pAig);
+}
+
+TEST(ProofTest, ProvePortfolioSharesVerdict) {
+  Abc_FrameGetGlobalFrame();
+  Aig_Man_t* pAig = MakeCounterMiter(4, 6);
+  Gia_Man_t* p = Gia_ManFromAig(pAig);
+  // the engines that cannot prove the property stop when the verdict is known
+  auto start = std::chrono::steady_clock::now();
+  EXPECT_EQ(Cec_GiaProveTest(p, 3, 10, 10, 10, 0, 0, 1), 1);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(10));
+  Gia_ManStop(p);
+  Aig_ManStop(pAig);
+
+  pAig = MakeCounterMiter(7, 5);
+  p = Gia_ManFromAig(pAig);
+  EXPECT_EQ(Cec_GiaProveTest(p, 3, 10, 10, 10, 0, 0, 1), 0);
+  ASSERT_TRUE(p->pCexSeq != NULL);
+  EXPECT_EQ(Gia_ManVerifyCex(p, p->pCexSeq, 0), 1);
+  Gia_ManStop(p);
+  Aig_ManStop(pAig);
+}
+
+ABC_NAMESPACE_IMPL_END
@@ -0,0 +1,350 @@
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+#include "aig/aig/aig.h"
+#include "base/main/main.h"
+#include "sat/bsat/satSolver.h"
+#include "sat/cnf/cnf.h"
+#include "sat/satoko/satoko.h"
+#include "test_util.h"
+
+ABC_NAMESPACE_HEADER_START
+Aig_Man_t* Abc_NtkToDar(Abc_Ntk_t* pNtk, int fExors, int fRegisters);
+ABC_NAMESPACE_HEADER_END
+
+ABC_NAMESPACE_IMPL_START
+
+TEST(SatTest, SatokoInprocessingKeepsResults) {
+  const int nVars = 120, nClauses = 500;
+  unsigned seed = 1, nInprocess = 0;
+  for (int round = 0; round < 8; round++) {
+    std::vector<std::vector<int>> clauses(nClauses);
+    for (auto& clause : clauses)
+      for (int k = 0; k < 3; k++) {
+        seed = seed * 1103515245 + 12345;
+        clause.push_back((int)((seed >> 8) % (2 * nVars)));
+      }
+    int status[2];
+    for (int fInpr = 0; fInpr < 2; fInpr++) {
+      satoko_t* pSat = satoko_create();
+      satoko_opts_t* opts = satoko_options(pSat);
+      opts->inpr_interval = fInpr ? 1 : 0;
+      opts->f_bve = fInpr;
+      satoko_setnvars(pSat, nVars);
+      for (auto clause : clauses)
+        satoko_add_clause(pSat, clause.data(), (int)clause.size());
+      // a satisfiable problem is solved again, starting with inprocessing
+      for (int call = 0; call < 2 && (call == 0 || status[fInpr] == SATOKO_SAT); call++) {
+        status[fInpr] = satoko_solve(pSat);
+        if (status[fInpr] == SATOKO_SAT)
+          for (auto& clause : clauses) {
+            bool fSat = false;
+            for (int lit : clause)
+              fSat |= satoko_read_cex_varvalue(pSat, lit >> 1) != (lit & 1);
+            EXPECT_TRUE(fSat);
+          }
+        if (fInpr)
+          nInprocess += satoko_stats(pSat)->n_inprocess;
+      }
+      satoko_destroy(pSat);
+    }
+    EXPECT_EQ(status[0], status[1]);
+  }
+  EXPECT_GT(nInprocess, 0u);
+}
+
+TEST(SatTest, SatokoInprocessingIsOffByDefault) {
+  satoko_opts_t opts;
+  satoko_default_opts(&opts);
+  EXPECT_EQ(opts.inpr_interval, 0u);
+  // a satisfiable problem is solved twice without inprocessing
+  satoko_t* pSat = satoko_create();
+  int clauses[][2] = {{0, 2}, {1, 4}, {3, 5}};
+  satoko_setnvars(pSat, 3);
+  for (auto& clause : clauses) satoko_add_clause(pSat, clause, 2);
+  EXPECT_EQ(satoko_solve(pSat), SATOKO_SAT);
+  EXPECT_EQ(satoko_solve(pSat), SATOKO_SAT);
+  EXPECT_EQ(satoko_stats(pSat)->n_inprocess, 0u);
+  satoko_destroy(pSat);
+  // a negative interval is rejected
+  Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
+  Abc_FrameSetBatchMode(1);
+  ASSERT_EQ(Cmd_CommandExecute(pAbc, ("&r " + SrcPath("i10.aig")).c_str()), 0);
+  EXPECT_NE(Cmd_CommandExecute(pAbc, "&satoko -I -1"), 0);
+}
+
+// checks the watch lists: binary clauses take one entry, longer clauses take two
+// (the handle and a blocker), the watched literal is one of the first two literals
+// of the clause, and the blocker is a literal of the clause; after a rollback, only
+// the clauses added before the bookmark are watched
+static void CheckSatWatches(sat_solver* s, int nVars, int fRolledBack) {
+  for (int l = 0; l < 2 * nVars; l++) {
+    veci* ws = &s->wlists[l];
+    int* pArray = veci_begin(ws);
+    int k = 0;
+    while (k < veci_size(ws)) {
+      if (clause_is_lit(pArray[k])) {
+        EXPECT_LT(lit_var(clause_read_lit(pArray[k])), nVars);
+        k++;
+        continue;
+      }
+      ASSERT_LT(k + 1, veci_size(ws));
+      if (fRolledBack) {
+        EXPECT_TRUE(Sat_MemClauseUsed(&s->Mem, pArray[k]));
+      }
+      clause* c = clause_read(s, pArray[k]);
+      ASSERT_GE(clause_size(c), 3);
+      EXPECT_TRUE(c->lits[0] == lit_neg(l) || c->lits[1] == lit_neg(l));
+      bool fFound = false;
+      for (int i = 0; i < clause_size(c); i++) fFound |= c->lits[i] == pArray[k + 1];
+      EXPECT_TRUE(fFound);
+      k += 2;
+    }
+    EXPECT_EQ(k, veci_size(ws));
+  }
+}
+
+static int SolveClauses(const std::vector<std::vector<int>>& clauses, int nVars) {
+  sat_solver* s = sat_solver_new();
+  sat_solver_setnvars(s, nVars);
+  int status = l_True;
+  for (auto clause : clauses)
+    if (!sat_solver_addclause(s, clause.data(), clause.data() + clause.size())) status = l_False;
+  if (status == l_True) status = sat_solver_solve(s, NULL, NULL, 0, 0, 0, 0);
+  sat_solver_delete(s);
+  return status;
+}
+
+static void CheckSatModel(sat_solver* s, const std::vector<std::vector<int>>& clauses) {
+  for (auto& clause : clauses) {
+    bool fSat = false;
+    for (int lit : clause) fSat |= sat_solver_var_value(s, lit_var(lit)) != (lit & 1);
+    EXPECT_TRUE(fSat);
+  }
+}
+
+TEST(SatTest, SatSolverWatchesSurviveReduceDbAndRollback) {
+  const int nVars = 120, nExtra = 40;
+  unsigned seed = 5;
+  auto Rand = [&seed](int n) {
+    seed = seed * 1103515245 + 12345;
+    return (int)((seed >> 8) % n);
+  };
+  int nReduces = 0, nRollbacks = 0;
+  for (int round = 0; round < 6; round++) {
+    // random 3-clauses near the threshold mixed with binary and 4-clauses
+    std::vector<std::vector<int>> clauses, extra;
+    for (int i = 0; i < 480; i++) {
+      int nLits = i % 20 == 0 ? 2 : (i % 20 == 1 ? 4 : 3);
+      std::vector<int> clause;
+      for (int k = 0; k < nLits; k++) clause.push_back(toLitCond(Rand(nVars), Rand(2)));
+      clauses.push_back(clause);
+    }
+    // clauses over the variables added after the bookmark
+    for (int i = 0; i < 150; i++) {
+      std::vector<int> clause;
+      clause.push_back(toLitCond(nVars + Rand(nExtra), Rand(2)));
+      for (int k = 0; k < 2 + i % 2; k++) clause.push_back(toLitCond(Rand(nVars + nExtra), Rand(2)));
+      extra.push_back(clause);
+    }
+    std::vector<std::vector<int>> all = clauses;
+    all.insert(all.end(), extra.begin(), extra.end());
+    int statusBase = SolveClauses(clauses, nVars);
+    int statusAll = SolveClauses(all, nVars + nExtra);
+
+    sat_solver* s = sat_solver_new();
+    // learned clauses are reduced often
+    s->nLearntStart = s->nLearntMax = 30;
+    s->nLearntDelta = 5;
+    sat_solver_setnvars(s, nVars);
+    int fOk = 1;
+    for (auto clause : clauses) fOk &= sat_solver_addclause(s, clause.data(), clause.data() + clause.size());
+    // the bookmark needs the unit clauses to be propagated
+    if (fOk) fOk = sat_solver_simplify(s);
+    if (!fOk) {
+      EXPECT_EQ(statusBase, l_False);
+      sat_solver_delete(s);
+      continue;
+    }
+    sat_solver_bookmark(s);
+    sat_solver_setnvars(s, nVars + nExtra);
+    for (auto clause : extra) fOk &= sat_solver_addclause(s, clause.data(), clause.data() + clause.size());
+    int status = fOk ? sat_solver_solve(s, NULL, NULL, 0, 0, 0, 0) : l_False;
+    EXPECT_EQ(status, statusAll);
+    if (status == l_True) CheckSatModel(s, all);
+    CheckSatWatches(s, nVars + nExtra, 0);
+    // the rollback needs an empty propagation queue, which is not the case
+    // after a conflict at the top level
+    if (s->qhead != s->qtail) {
+      sat_solver_delete(s);
+      continue;
+    }
+    // the rollback drops the extra variables and the clauses added after the bookmark
+    sat_solver_rollback(s);
+    nRollbacks++;
+    CheckSatWatches(s, nVars, 1);
+    status = sat_solver_solve(s, NULL, NULL, 0, 0, 0, 0);
+    EXPECT_EQ(status, statusBase);
+    if (status == l_True) CheckSatModel(s, clauses);
+    CheckSatWatches(s, nVars, 1);
+    nReduces += s->nDBreduces;
+    sat_solver_delete(s);
+  }
+  EXPECT_GT(nReduces, 0);
+  EXPECT_GT(nRollbacks, 0);
+}
+
+// checks that the values of the objects in the CNF agree with simulation
+static void CheckCnfValues(Aig_Man_t* pAig, Cnf_Dat_t* pCnf, std::vector<Aig_Obj_t*>& objs, unsigned* seed) {
+  sat_solver* pSat = (sat_solver*)Cnf_DataWriteIntoSolver(pCnf, 1, 0);
+  ASSERT_TRUE(pSat != NULL);
+  for (int round = 0; round < 8; round++) {
+    std::vector<int> values(Aig_ManObjNumMax(pAig), 0), assumps;
+    Aig_Obj_t* pObj;
+    int i;
+    values[Aig_ManConst1(pAig)->Id] = 1;
+    Aig_ManForEachCi(pAig, pObj, i) {
+      *seed = *seed * 1103515245 + 12345;
+      values[pObj->Id] = (*seed >> 16) & 1;
+      if (pCnf->pVarNums[pObj->Id] >= 0)
+        assumps.push_back(toLitCond(pCnf->pVarNums[pObj->Id], !values[pObj->Id]));
+    }
+    Aig_ManForEachNode(pAig, pObj, i)
+      values[pObj->Id] = (values[Aig_ObjFaninId0(pObj)] ^ Aig_ObjFaninC0(pObj)) &
+                         (values[Aig_ObjFaninId1(pObj)] ^ Aig_ObjFaninC1(pObj));
+    Aig_ManForEachCo(pAig, pObj, i)
+      values[pObj->Id] = values[Aig_ObjFaninId0(pObj)] ^ Aig_ObjFaninC0(pObj);
+    ASSERT_EQ(sat_solver_solve(pSat, assumps.data(), assumps.data() + assumps.size(), 0, 0, 0, 0), l_True);
+    for (Aig_Obj_t* pRoot : objs) {
+      Aig_Obj_t* pReg = Aig_Regular(pRoot);
+      ASSERT_GE(pCnf->pVarNums[pReg->Id], 0);
+      EXPECT_EQ(sat_solver_var_value(pSat, pCnf->pVarNums[pReg->Id]), values[pReg->Id]);
+    }
+  }
+  sat_solver_delete(pSat);
+}
+
+TEST(SatTest, SatSolverCountsInspectedWatchers) {
+  // x implies y1, y2, y3 by binary clauses; the 3-clause (!x, y1, y4) stays satisfied by y1
+  sat_solver* pSat = sat_solver_new();
+  sat_solver_setnvars(pSat, 5);
+  int clauses[][3] = {{toLitCond(0, 1), toLitCond(1, 0)},
+                      {toLitCond(0, 1), toLitCond(2, 0)},
+                      {toLitCond(0, 1), toLitCond(3, 0)},
+                      {toLitCond(0, 1), toLitCond(1, 0), toLitCond(4, 0)}};
+  for (int i = 0; i < 4; i++)
+    ASSERT_TRUE(sat_solver_addclause(pSat, clauses[i], clauses[i] + (i < 3 ? 2 : 3)));
+  int Lit = toLitCond(0, 0);
+  ASSERT_TRUE(sat_solver_addclause(pSat, &Lit, &Lit + 1));
+  ASSERT_TRUE(sat_solver_simplify(pSat));
+  EXPECT_EQ(pSat->stats.propagations, 4);
+  // each of the four watchers of !x counts once, although the 3-clause watcher takes two words
+  EXPECT_EQ(pSat->stats.inspects, 4);
+  sat_solver_delete(pSat);
+}
+
+TEST(SatTest, CnfCacheMatchesDerivation) {
+  unsigned seed = 7;
+  std::vector<Aig_Obj_t*> nodes, roots;
+  Aig_Man_t* pAig = Aig_ManStart(1000);
+  for (int i = 0; i < 12; i++) Aig_ObjCreateCi(pAig);
+  // CNF derivation removes dangling nodes, so the live objects are collected first
+  auto addNodes = [&](int nNodes) {
+    Aig_Obj_t* pObj;
+    int i;
+    nodes.clear();
+    Aig_ManForEachObj(pAig, pObj, i)
+      if (Aig_ObjIsCi(pObj) || Aig_ObjIsNode(pObj)) nodes.push_back(pObj);
+    for (i = 0; i < nNodes; i++) {
+      seed = seed * 1103515245 + 12345;
+      Aig_Obj_t* p0 = Aig_NotCond(nodes[(seed >> 8) % nodes.size()], (seed >> 4) & 1);
+      Aig_Obj_t* p1 = Aig_NotCond(nodes[(seed >> 20) % nodes.size()], (seed >> 5) & 1);
+      nodes.push_back(Aig_Regular(Aig_And(pAig, p0, p1)));
+    }
+  };
+  addNodes(400);
+  for (int i = 0; i < 6; i++) Aig_ObjCreateCo(pAig, nodes[nodes.size() - 1 - 13 * i]);
+
+  // the cached CNF is the same as the regular one
+  for (int k = 0; k < 3; k++) {
+    Cnf_Dat_t* pCnf = Cnf_DeriveCached(pAig, k == 2 ? 0 : Aig_ManCoNum(pAig));
+    Cnf_Dat_t* pCmp = Cnf_Derive(pAig, k == 2 ? 0 : Aig_ManCoNum(pAig));
+    EXPECT_EQ(pCnf->nVars, pCmp->nVars);
+    ASSERT_EQ(pCnf->nClauses, pCmp->nClauses);
+    ASSERT_EQ(pCnf->nLiterals, pCmp->nLiterals);
+    for (int i = 0; i < pCnf->nLiterals; i++)
+      ASSERT_EQ(pCnf->pClauses[0][i], pCmp->pClauses[0][i]) << k << " " << i;
+    Cnf_DataFree(pCnf);
+    Cnf_DataFree(pCmp);
+  }
+
+  // after adding nodes and changing the existing ones, the CNF remains correct
+  addNodes(200);
+  Aig_ObjCreateCo(pAig, nodes[nodes.size() - 7]);
+  Aig_ObjPatchFanin0(pAig, Aig_ManCo(pAig, 2), Aig_Not(nodes.back()));
+  Aig_Obj_t* pOld = Aig_ObjFanin0(Aig_ObjFanin0(Aig_ManCo(pAig, 0)));
+  Aig_Obj_t* pNew = Aig_And(pAig, Aig_Not(Aig_ManCi(pAig, 3)), Aig_Not(Aig_ManCi(pAig, 5)));
+  ASSERT_TRUE(Aig_ObjIsNode(pOld) && Aig_ObjRefs(pNew) == 0);
+  Aig_ObjReplace(pAig, pOld, pNew, 0);
+  Cnf_Dat_t* pCnf = Cnf_DeriveCached(pAig, Aig_ManCoNum(pAig));
+  Aig_Obj_t* pObj;
+  int i;
+  Aig_ManForEachCo(pAig, pObj, i) roots.push_back(pObj);
+  CheckCnfValues(pAig, pCnf, roots, &seed);
+  Cnf_DataFree(pCnf);
+
+  // CNF of the cones of some nodes
+  roots.clear();
+  Aig_ManForEachCo(pAig, pObj, i)
+    if (Aig_ObjIsNode(Aig_ObjFanin0(pObj)))
+      roots.push_back(Aig_ObjFanin1(Aig_ObjFanin0(pObj)));
+  Vec_Ptr_t* vRoots = Vec_PtrAlloc(roots.size());
+  for (Aig_Obj_t* pRoot : roots) Vec_PtrPush(vRoots, pRoot);
+  pCnf = Cnf_DeriveCachedCone(pAig, vRoots);
+  Vec_PtrFree(vRoots);
+  CheckCnfValues(pAig, pCnf, roots, &seed);
+  Cnf_DataFree(pCnf);
+
+  // a cache given by the caller serves the managers derived from this one
+  void* pCache = Cnf_CacheStart();
+  Cnf_CacheAttach(pAig, pCache);
+  Cnf_DataFree(Cnf_DeriveCached(pAig, Aig_ManCoNum(pAig)));
+  Aig_Man_t* pDup = Aig_ManDupDfs(pAig);
+  Cnf_CacheAttach(pDup, pCache);
+  pCnf = Cnf_DeriveCached(pDup, Aig_ManCoNum(pDup));
+  roots.clear();
+  Aig_ManForEachCo(pDup, pObj, i) roots.push_back(pObj);
+  CheckCnfValues(pDup, pCnf, roots, &seed);
+  Aig_Man_t* pDup2 = Aig_ManDupDfs(pAig);
+  Cnf_CacheAttach(pDup2, pCache);
+  Cnf_Dat_t* pCnf2 = Cnf_DeriveCached(pDup2, Aig_ManCoNum(pDup2));
+  ASSERT_EQ(pCnf2->nLiterals, pCnf->nLiterals);
+  for (i = 0; i < pCnf->nLiterals; i++) ASSERT_EQ(pCnf2->pClauses[0][i], pCnf->pClauses[0][i]);
+  Cnf_DataFree(pCnf);
+  Cnf_DataFree(pCnf2);
+  Aig_ManStop(pDup);
+  Aig_ManStop(pDup2);
+  Aig_ManStop(pAig);
+  Cnf_CacheStop(pCache);
+}
+
+TEST(SatTest, CnfCacheIsSharedByCommands) {
+  Abc_Frame_t* pAbc = Abc_FrameGetGlobalFrame();
+  Abc_FrameSetBatchMode(1);
+  // the second call finds the clauses of all nodes in the cache
+  ASSERT_EQ(Cmd_CommandExecute(pAbc, ("read " + SrcPath("i10.aig") + "; strash; orpos; dsat").c_str()), 0);
+  ASSERT_EQ(Cmd_CommandExecute(pAbc, "dsat"), 0);
+  Aig_Man_t* pMan = Abc_NtkToDar(Abc_FrameReadNtk(pAbc), 0, 0);
+  Cnf_Dat_t* pCmp = Cnf_Derive(pMan, Aig_ManCoNum(pMan));
+  Cnf_CacheAttach(pMan, Abc_FrameReadCnfCache());
+  Cnf_Dat_t* pCnf = Cnf_DeriveCached(pMan, Aig_ManCoNum(pMan));
+  ASSERT_EQ(pCnf->nLiterals, pCmp->nLiterals);
+  for (int i = 0; i < pCnf->nLiterals; i++) ASSERT_EQ(pCnf->pClauses[0][i], pCmp->pClauses[0][i]);
+  Cnf_DataFree(pCnf);
+  Cnf_DataFree(pCmp);
+  Aig_ManStop(pMan);
+}
+
+ABC_NAMESPACE_IMPL_END